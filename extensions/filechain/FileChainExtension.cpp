@@ -19,6 +19,8 @@
 **/
 
 #include "src/FileBlockChainStorage.h"
+#include "src/StateCheckpointerService.h"
+#include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeBootstrapper.h"
 
 namespace catapult { namespace filechain {
@@ -27,6 +29,15 @@ namespace catapult { namespace filechain {
 		void RegisterExtension(extensions::LocalNodeBootstrapper& bootstrapper) {
 			// register storage
 			bootstrapper.extensionManager().setBlockChainStorage(CreateFileBlockChainStorage());
+
+			// register state checkpointer (checkpoints are not needed when cache data is saved in a database)
+			const auto& config = bootstrapper.config();
+			const auto& checkpointInterval = config.Node.StateCheckpointInterval;
+			if (0 != checkpointInterval.millis() && !config.Node.ShouldUseCacheDatabaseStorage) {
+				bootstrapper.extensionManager().addServiceRegistrar(CreateStateCheckpointerServiceRegistrar(
+						config.User.DataDirectory,
+						checkpointInterval));
+			}
 		}
 	}
 }}
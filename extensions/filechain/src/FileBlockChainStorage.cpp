@@ -43,7 +43,12 @@ namespace catapult { namespace filechain {
 				cache::SupplementalData supplementalData;
 				bool isStateLoaded = false;
 				try {
-					isStateLoaded = LoadState(stateRef.Config.User.DataDirectory, stateRef.Cache, supplementalData);
+					const auto& dataDirectory = stateRef.Config.User.DataDirectory;
+					RecoverStateCheckpoint(dataDirectory);
+					if (IsStateCheckpointConsistent(dataDirectory, stateRef.Storage.view()))
+						isStateLoaded = LoadState(dataDirectory, stateRef.Cache, supplementalData);
+					else
+						CATAPULT_LOG(warning) << "ignoring state checkpoint that is inconsistent with block storage";
 				} catch (...) {
 					CATAPULT_LOG(error) << "error when loading state, remove state directories and start again";
 					throw;
@@ -23,11 +23,16 @@
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/cache/SupplementalDataStorage.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FileLock.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
+#include <thread>
 
 namespace catapult { namespace filechain {
 
@@ -35,10 +40,12 @@ namespace catapult { namespace filechain {
 		constexpr size_t Default_Loader_Batch_Size = 100'000;
 		constexpr auto Supplemental_Data_Filename = "supplemental.dat";
 		constexpr auto State_Lock_Filename = "state.lock";
+		constexpr auto Checkpoint_Filename = "checkpoint.dat";
+		constexpr auto State_Directory_Name = "state";
 
 		std::string GetStatePath(const std::string& baseDirectory, const std::string& filename) {
 			boost::filesystem::path path = baseDirectory;
-			path /= "state";
+			path /= State_Directory_Name;
 			if (!boost::filesystem::exists(path))
 				boost::filesystem::create_directory(path);
 
@@ -46,10 +53,14 @@ namespace catapult { namespace filechain {
 			return path.generic_string();
 		}
 
-		void LoadCache(const std::string& baseDirectory, const std::string& filename, cache::CacheStorage& cacheStorage) {
+		void LoadCache(
+				const std::string& baseDirectory,
+				const std::string& filename,
+				cache::CacheStorage& cacheStorage,
+				thread::IoServiceThreadPool& parserPool) {
 			auto path = GetStatePath(baseDirectory, filename);
 			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
-			cacheStorage.loadAll(file, Default_Loader_Batch_Size);
+			cacheStorage.loadAll(file, Default_Loader_Batch_Size, parserPool);
 		}
 
 		void SaveCache(const std::string& baseDirectory, const std::string& filename, const cache::CacheStorage& cacheStorage) {
@@ -63,8 +74,45 @@ namespace catapult { namespace filechain {
 			return boost::filesystem::exists(path);
 		}
 
+		std::string GetStorageFilename(const std::string& storageName) {
+			return storageName + ".dat";
+		}
+
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
-			return storage.name() + ".dat";
+			return GetStorageFilename(storage.name());
+		}
+
+		std::unique_ptr<thread::IoServiceThreadPool> CreateStartedThreadPool(size_t numWorkerThreads, const char* name) {
+			auto pPool = thread::CreateIoServiceThreadPool(std::max<size_t>(1, numWorkerThreads), name);
+			pPool->start();
+			return pPool;
+		}
+
+		template<typename TStorages, typename TAction>
+		void ForEachStorageInParallel(TStorages& storages, const char* operationName, TAction action) {
+			// each storage is processed by a dedicated thread because storages block while loading or saving
+			auto pPool = CreateStartedThreadPool(storages.size(), operationName);
+			std::vector<std::exception_ptr> storageExceptions(storages.size());
+			thread::ParallelFor(pPool->service(), storages, storages.size(), [operationName, action, &storageExceptions](
+					const auto& pStorage,
+					auto index) {
+				// exceptions must not escape pool threads
+				try {
+					auto message = std::string(operationName) + " " + pStorage->name();
+					utils::StackLogger stopwatch(message.c_str(), utils::LogLevel::Info);
+					action(*pStorage);
+				} catch (...) {
+					storageExceptions[index] = std::current_exception();
+				}
+
+				return true;
+			}).get();
+			pPool->join();
+
+			for (const auto& pException : storageExceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
 		}
 	}
 
@@ -81,8 +129,14 @@ namespace catapult { namespace filechain {
 
 		utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
 
-		for (const auto& pStorage : cache.storages())
-			LoadCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		// storages are loaded concurrently and entries of large storages are additionally parsed by a shared parser pool
+		// (separate pools are used because storage threads block while waiting for parsers)
+		auto pParserPool = CreateStartedThreadPool(std::thread::hardware_concurrency(), "state parser");
+		auto storages = cache.storages();
+		ForEachStorageInParallel(storages, "load state", [&dataDirectory, &parserPool = *pParserPool](auto& storage) {
+			LoadCache(dataDirectory, GetStorageFilename(storage), storage, parserPool);
+		});
+		pParserPool->join();
 
 		Height chainHeight;
 		{
@@ -111,7 +165,7 @@ namespace catapult { namespace filechain {
 	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData) {
 		// 1. if the previous SaveState crashed, an orphaned lock file will be present, which would have caused LoadState to be bypassed
 		//    and instead triggered a rebuild of the cache by reloading all blocks
-		// 2. in the current SaveState, delete any existing lock file (state is not written incrementally) and create a new one
+		// 2. in the current SaveState, delete any existing lock file (state is written in place) and create a new one
 		// 3. if successful, the lock file will be deleted and the next LoadState will load directly from the saved state
 		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
 		io::FileLock stateLock(lockFilePath);
@@ -120,8 +174,13 @@ namespace catapult { namespace filechain {
 		else
 			CATAPULT_LOG(warning) << "lock file could not be removed and must be removed manually";
 
-		for (const auto& pStorage : cache.storages())
-			SaveCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		// state saved on shutdown is always consistent with block storage, so any checkpoint information is stale
+		boost::filesystem::remove(GetStatePath(dataDirectory, Checkpoint_Filename));
+
+		auto storages = cache.storages();
+		ForEachStorageInParallel(storages, "save state", [&dataDirectory](const auto& storage) {
+			SaveCache(dataDirectory, GetStorageFilename(storage), storage);
+		});
 
 		{
 			auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
@@ -133,4 +192,203 @@ namespace catapult { namespace filechain {
 			cache::SaveSupplementalData(data, cache.createView().height(), file);
 		}
 	}
+
+	namespace {
+		// output stream that copies all written data into memory
+		class MemoryOutputStream final : public io::OutputStream {
+		public:
+			explicit MemoryOutputStream(std::vector<uint8_t>& buffer) : m_buffer(buffer)
+			{}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+			}
+
+			void flush() override
+			{}
+
+		private:
+			std::vector<uint8_t>& m_buffer;
+		};
+
+		std::string GetCheckpointFilePath(const boost::filesystem::path& directory, const std::string& filename) {
+			return (directory / filename).generic_string();
+		}
+
+		void ReuseStorageFile(const boost::filesystem::path& sourcePath, const boost::filesystem::path& destinationPath) {
+			// prefer a hard link because it is cheap, but fall back to a copy when links are not supported
+			boost::system::error_code ec;
+			boost::filesystem::create_hard_link(sourcePath, destinationPath, ec);
+			if (ec)
+				boost::filesystem::copy_file(sourcePath, destinationPath);
+
+			// the source might have been written by SaveState without a flush, so flush the (shared or copied) data explicitly
+			io::RawFile file(destinationPath.generic_string(), io::OpenMode::Read_Append);
+			file.flush();
+		}
+
+		void WriteCheckpointFile(const boost::filesystem::path& directory, const std::string& filename, const RawBuffer& buffer) {
+			auto path = GetCheckpointFilePath(directory, filename);
+			io::RawFile file(path.c_str(), io::OpenMode::Read_Write);
+			file.write(buffer);
+			file.flush();
+		}
+
+		struct StatePaths {
+		public:
+			explicit StatePaths(const std::string& dataDirectory)
+					: Data(dataDirectory)
+					, State(Data / State_Directory_Name)
+					, Checkpoint(Data / (std::string(State_Directory_Name) + ".tmp"))
+					, OldState(Data / (std::string(State_Directory_Name) + ".old"))
+			{}
+
+		public:
+			boost::filesystem::path Data;
+			boost::filesystem::path State;
+			boost::filesystem::path Checkpoint;
+			boost::filesystem::path OldState;
+		};
+
+		bool IsCompleteCheckpoint(const boost::filesystem::path& checkpointPath) {
+			// the checkpoint file is written (and flushed) only after all other checkpoint files are durable
+			boost::system::error_code ec;
+			auto size = boost::filesystem::file_size(checkpointPath / Checkpoint_Filename, ec);
+			return !ec && sizeof(Height) + Hash256_Size == size;
+		}
+	}
+
+	StateCheckpoint CreateStateCheckpoint(
+			const std::string& dataDirectory,
+			const std::vector<std::unique_ptr<const cache::CacheStorage>>& storages,
+			const cache::CatapultCacheView& cacheView,
+			const cache::SupplementalData& supplementalData,
+			const Hash256& blockHash,
+			const CacheStorageGenerations& previousGenerations) {
+		auto statePath = boost::filesystem::path(dataDirectory) / State_Directory_Name;
+
+		StateCheckpoint checkpoint;
+		checkpoint.CacheHeight = cacheView.height();
+		checkpoint.BlockHash = blockHash;
+		checkpoint.SupplementalData.State = supplementalData.State;
+		checkpoint.SupplementalData.ChainScore = supplementalData.ChainScore;
+
+		// copy data of storages that changed since the previous checkpoint (or cannot be reused) so that it can be saved later
+		std::vector<const cache::CacheStorage*> changedStorages;
+		for (const auto& pStorage : storages) {
+			auto generation = pStorage->generation();
+			checkpoint.Generations.emplace(pStorage->name(), generation);
+
+			auto previousIter = previousGenerations.find(pStorage->name());
+			auto isUnchanged = previousGenerations.cend() != previousIter && generation == previousIter->second;
+			if (!isUnchanged || !boost::filesystem::exists(statePath / GetStorageFilename(*pStorage))) {
+				changedStorages.push_back(pStorage.get());
+				checkpoint.StorageData.emplace(pStorage->name(), std::vector<uint8_t>());
+			}
+		}
+
+		CATAPULT_LOG(info) << "copying " << changedStorages.size() << " of " << storages.size() << " storages into state checkpoint";
+		if (!changedStorages.empty()) {
+			// all buffers are created above, so the map is not modified concurrently
+			ForEachStorageInParallel(changedStorages, "copy state", [&checkpoint, &cacheView](const auto& storage) {
+				MemoryOutputStream stream(checkpoint.StorageData.find(storage.name())->second);
+				storage.saveAll(cacheView, stream);
+			});
+		}
+
+		return checkpoint;
+	}
+
+	void SaveStateCheckpoint(const std::string& dataDirectory, const StateCheckpoint& checkpoint) {
+		StatePaths paths(dataDirectory);
+
+		// 1. write the checkpoint into a separate directory so that the current state stays valid until the checkpoint is complete
+		boost::filesystem::remove_all(paths.Checkpoint);
+		boost::filesystem::remove_all(paths.OldState);
+		boost::filesystem::create_directories(paths.Checkpoint);
+		io::FlushDirectory(dataDirectory);
+
+		// 2. save (and flush) copied storage data and reuse the files of all other storages
+		for (const auto& pair : checkpoint.Generations) {
+			auto filename = GetStorageFilename(pair.first);
+			auto dataIter = checkpoint.StorageData.find(pair.first);
+			if (checkpoint.StorageData.cend() == dataIter)
+				ReuseStorageFile(paths.State / filename, paths.Checkpoint / filename);
+			else
+				WriteCheckpointFile(paths.Checkpoint, filename, dataIter->second);
+		}
+
+		{
+			std::vector<uint8_t> buffer;
+			MemoryOutputStream stream(buffer);
+			cache::SaveSupplementalData(checkpoint.SupplementalData, checkpoint.CacheHeight, stream);
+			WriteCheckpointFile(paths.Checkpoint, Supplemental_Data_Filename, buffer);
+		}
+
+		io::FlushDirectory(paths.Checkpoint.generic_string());
+
+		// 3. write the checkpoint file last; its presence marks the checkpoint directory as complete (see RecoverStateCheckpoint)
+		{
+			std::vector<uint8_t> buffer;
+			MemoryOutputStream stream(buffer);
+			io::Write(stream, checkpoint.CacheHeight);
+			io::Write(stream, checkpoint.BlockHash);
+			WriteCheckpointFile(paths.Checkpoint, Checkpoint_Filename, buffer);
+		}
+
+		io::FlushDirectory(paths.Checkpoint.generic_string());
+
+		// 4. swap the checkpoint with the current state and flush each rename
+		//    (if this is interrupted, RecoverStateCheckpoint completes or undoes the swap on the next boot)
+		if (boost::filesystem::exists(paths.State)) {
+			boost::filesystem::rename(paths.State, paths.OldState);
+			io::FlushDirectory(dataDirectory);
+		}
+
+		boost::filesystem::rename(paths.Checkpoint, paths.State);
+		io::FlushDirectory(dataDirectory);
+		boost::filesystem::remove_all(paths.OldState);
+	}
+
+	void RecoverStateCheckpoint(const std::string& dataDirectory) {
+		StatePaths paths(dataDirectory);
+		if (!boost::filesystem::exists(paths.State)) {
+			if (IsCompleteCheckpoint(paths.Checkpoint)) {
+				CATAPULT_LOG(warning) << "completing interrupted swap of state checkpoint " << paths.Checkpoint.generic_string();
+				boost::filesystem::rename(paths.Checkpoint, paths.State);
+			} else if (boost::filesystem::exists(paths.OldState)) {
+				CATAPULT_LOG(warning) << "restoring previous state " << paths.OldState.generic_string();
+				boost::filesystem::rename(paths.OldState, paths.State);
+			} else {
+				return;
+			}
+
+			io::FlushDirectory(dataDirectory);
+		}
+
+		// state is valid, so any leftover directories are either incomplete checkpoints or already replaced states
+		boost::filesystem::remove_all(paths.Checkpoint);
+		boost::filesystem::remove_all(paths.OldState);
+	}
+
+	bool IsStateCheckpointConsistent(const std::string& dataDirectory, const io::BlockStorageView& storage) {
+		auto path = (boost::filesystem::path(dataDirectory) / State_Directory_Name / Checkpoint_Filename).generic_string();
+		if (!boost::filesystem::exists(path))
+			return true;
+
+		Height checkpointHeight;
+		Hash256 checkpointBlockHash;
+		{
+			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
+			io::Read(file, checkpointHeight);
+			io::Read(file, checkpointBlockHash);
+		}
+
+		if (checkpointHeight > storage.chainHeight())
+			return false;
+
+		auto hashes = storage.loadHashesFrom(checkpointHeight, 1);
+		return 1 == hashes.size() && checkpointBlockHash == *hashes.cbegin();
+	}
 }}
@@ -19,21 +19,76 @@
 **/
 
 #pragma once
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/types.h"
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace catapult {
 	namespace cache {
+		class CacheStorage;
 		class CatapultCache;
-		struct SupplementalData;
+		class CatapultCacheView;
 	}
+	namespace io { class BlockStorageView; }
 }
 
 namespace catapult { namespace filechain {
 
+	/// Map of cache storage names to cache generations.
+	using CacheStorageGenerations = std::unordered_map<std::string, size_t>;
+
 	/// Save catapult \a cache state along with \a supplementalData into state directory inside \a dataDirectory.
 	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData);
 
 	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory.
 	/// Returns \c true if data has been loaded, \c false if there was nothing to load.
 	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData);
+
+	/// Snapshot of cache state that can be saved as a checkpoint without holding any cache locks.
+	struct StateCheckpoint {
+		/// Cache height.
+		Height CacheHeight;
+
+		/// Hash of the block at the cache height.
+		Hash256 BlockHash;
+
+		/// Supplemental data.
+		cache::SupplementalData SupplementalData;
+
+		/// Generations of all storages.
+		CacheStorageGenerations Generations;
+
+		/// Serialized data of all storages that need to be saved keyed by storage name.
+		/// \note Data of all other storages is reused from the current state directory.
+		std::unordered_map<std::string, std::vector<uint8_t>> StorageData;
+	};
+
+	/// Creates a checkpoint of the cache state locked by \a cacheView along with \a supplementalData and \a blockHash, the hash of the
+	/// block at the checkpoint height.
+	/// Data of \a storages with generations equal to \a previousGenerations is not copied when it can be reused from the current
+	/// state directory inside \a dataDirectory.
+	StateCheckpoint CreateStateCheckpoint(
+			const std::string& dataDirectory,
+			const std::vector<std::unique_ptr<const cache::CacheStorage>>& storages,
+			const cache::CatapultCacheView& cacheView,
+			const cache::SupplementalData& supplementalData,
+			const Hash256& blockHash,
+			const CacheStorageGenerations& previousGenerations);
+
+	/// Saves \a checkpoint into state directory inside \a dataDirectory.
+	/// \note The checkpoint is written into a separate directory that replaces the current state directory only when it is complete
+	///       and flushed to disk.
+	void SaveStateCheckpoint(const std::string& dataDirectory, const StateCheckpoint& checkpoint);
+
+	/// Recovers the state directory inside \a dataDirectory after a crash that interrupted saving a checkpoint.
+	/// \note A complete checkpoint replaces a missing state directory, otherwise the previous state directory is restored.
+	void RecoverStateCheckpoint(const std::string& dataDirectory);
+
+	/// Returns \c true if the state directory inside \a dataDirectory does not contain a checkpoint or contains a checkpoint
+	/// that is consistent with the blocks in \a storage.
+	/// \note A checkpoint can become inconsistent when blocks at or below its height are rolled back after it is saved.
+	bool IsStateCheckpointConsistent(const std::string& dataDirectory, const io::BlockStorageView& storage);
 }}
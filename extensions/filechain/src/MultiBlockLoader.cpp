@@ -27,7 +27,12 @@
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/Elements.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 
 namespace catapult { namespace filechain {
 
@@ -76,12 +81,18 @@ namespace catapult { namespace filechain {
 	// region LoadBlockChain
 
 	namespace {
+		constexpr size_t Num_Reader_Threads = 4;
+		constexpr uint64_t Max_Prefetched_Blocks = 128;
+
 		class AnalyzeProgressLogger {
 		private:
 			static constexpr auto Log_Interval_Millis = 2'000;
 
 		public:
-			explicit AnalyzeProgressLogger(const utils::StackLogger& stopwatch) : m_stopwatch(stopwatch), m_numLogs(0)
+			AnalyzeProgressLogger(const utils::StackLogger& stopwatch, Height startHeight)
+					: m_stopwatch(stopwatch)
+					, m_startHeight(startHeight)
+					, m_numLogs(0)
 			{}
 
 		public:
@@ -90,14 +101,124 @@ namespace catapult { namespace filechain {
 				if (currentMillis < (m_numLogs + 1) * Log_Interval_Millis)
 					return;
 
-				CATAPULT_LOG(info) << "loaded " << height << " / " << chainHeight << " blocks in " << currentMillis << "ms";
+				auto numLoadedBlocks = (height - m_startHeight).unwrap() + 1;
+				CATAPULT_LOG(info)
+						<< "loaded " << height << " / " << chainHeight << " blocks in " << currentMillis << "ms ("
+						<< numLoadedBlocks * 1000 / currentMillis << " blocks/s)";
 				++m_numLogs;
 			}
 
 		private:
 			const utils::StackLogger& m_stopwatch;
+			Height m_startHeight;
 			size_t m_numLogs;
 		};
+
+		// reader threads load block elements ahead of the executing thread so that storage reads and deserialization
+		// overlap with block execution; at most Max_Prefetched_Blocks elements are loaded but not yet consumed
+		class BlockElementPrefetcher {
+		private:
+			struct PrefetchResult {
+				std::shared_ptr<const model::BlockElement> pBlockElement;
+				std::exception_ptr pException;
+			};
+
+		public:
+			BlockElementPrefetcher(const io::BlockStorageView& storage, Height startHeight, Height endHeight)
+					: m_storage(storage)
+					, m_endHeight(endHeight)
+					, m_nextLoadHeight(startHeight)
+					, m_nextConsumeHeight(startHeight)
+					, m_isStopped(false)
+					, m_pPool(thread::CreateIoServiceThreadPool(Num_Reader_Threads, "block prefetcher")) {
+				m_pPool->start();
+				for (auto i = 0u; i < Num_Reader_Threads; ++i)
+					m_pPool->service().post([this]() { prefetch(); });
+			}
+
+			~BlockElementPrefetcher() {
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_isStopped = true;
+				}
+
+				m_loadSlotAvailable.notify_all();
+				m_pPool->join();
+			}
+
+		public:
+			/// Waits for and returns the next block element, rethrowing any exception raised when it was loaded.
+			std::shared_ptr<const model::BlockElement> next() {
+				PrefetchResult result;
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					auto height = m_nextConsumeHeight;
+					m_elementAvailable.wait(lock, [this, height]() { return m_results.cend() != m_results.find(height); });
+
+					auto iter = m_results.find(height);
+					result = std::move(iter->second);
+					m_results.erase(iter);
+					m_nextConsumeHeight = height + Height(1);
+				}
+
+				m_loadSlotAvailable.notify_all();
+				if (result.pException)
+					std::rethrow_exception(result.pException);
+
+				return result.pBlockElement;
+			}
+
+		private:
+			void prefetch() {
+				for (;;) {
+					Height height;
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_loadSlotAvailable.wait(lock, [this]() { return m_isStopped || !hasPendingLoadSlot() || hasFreeLoadSlot(); });
+						if (m_isStopped || !hasPendingLoadSlot())
+							return;
+
+						height = m_nextLoadHeight;
+						m_nextLoadHeight = height + Height(1);
+					}
+
+					// exceptions must not escape pool threads
+					PrefetchResult result;
+					try {
+						result.pBlockElement = m_storage.loadBlockElement(height);
+					} catch (...) {
+						result.pException = std::current_exception();
+					}
+
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_results.emplace(height, std::move(result));
+					}
+
+					m_elementAvailable.notify_one();
+				}
+			}
+
+			bool hasPendingLoadSlot() const {
+				return m_nextLoadHeight <= m_endHeight;
+			}
+
+			bool hasFreeLoadSlot() const {
+				return m_nextLoadHeight < m_nextConsumeHeight + Height(Max_Prefetched_Blocks);
+			}
+
+		private:
+			const io::BlockStorageView& m_storage;
+			Height m_endHeight;
+			Height m_nextLoadHeight;
+			Height m_nextConsumeHeight;
+			bool m_isStopped;
+			std::map<Height, PrefetchResult> m_results;
+			std::mutex m_mutex;
+			std::condition_variable m_loadSlotAvailable;
+			std::condition_variable m_elementAvailable;
+			std::unique_ptr<thread::IoServiceThreadPool> m_pPool;
+		};
 	}
 
 	class BlockChainLoader {
@@ -123,8 +244,13 @@ namespace catapult { namespace filechain {
 
 			model::ChainScore score;
 			auto chainHeight = storage.chainHeight();
+			if (chainHeight < height)
+				return score;
+
+			// block elements are loaded by the prefetcher, so this thread only scores and executes blocks in order
+			BlockElementPrefetcher prefetcher(storage, height, chainHeight);
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
+				auto pBlockElement = prefetcher.next();
 				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
 
 				execute(*pBlockElement);
@@ -160,7 +286,7 @@ namespace catapult { namespace filechain {
 		BlockChainLoader loader(observerFactory, stateRef, startHeight);
 
 		utils::StackLogger stopwatch("load block chain", utils::LogLevel::Warning);
-		return loader.loadAll(AnalyzeProgressLogger(stopwatch));
+		return loader.loadAll(AnalyzeProgressLogger(stopwatch, startHeight));
 	}
 
 	// endregion
@@ -0,0 +1,218 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StateCheckpointerService.h"
+#include "LocalNodeStateStorage.h"
+#include "catapult/cache/CacheStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/ServiceLocator.h"
+#include "catapult/extensions/ServiceState.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/MultiServicePool.h"
+#include "catapult/utils/StackLogger.h"
+#include <atomic>
+
+namespace catapult { namespace filechain {
+
+	namespace {
+		constexpr auto Service_Name = "stateCheckpointer";
+
+		struct PendingCheckpoint {
+			Height CacheHeight;
+			Hash256 BlockHash;
+			cache::SupplementalData SupplementalData;
+		};
+
+		class StateCheckpointer : public std::enable_shared_from_this<StateCheckpointer> {
+		public:
+			StateCheckpointer(
+					const std::string& dataDirectory,
+					const utils::TimeSpan& interval,
+					extensions::ServiceState& state,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+					: m_dataDirectory(dataDirectory)
+					, m_interval(interval)
+					, m_cache(state.cache())
+					, m_storage(state.storage())
+					, m_state(state.state())
+					, m_score(state.score())
+					, m_timeSupplier(state.timeSupplier())
+					, m_pPool(pPool)
+					, m_nextCheckpointTime(m_timeSupplier() + Timestamp(m_interval.millis()))
+					, m_isCheckpointPending(false)
+					, m_shouldRetry(false)
+					, m_numCheckpoints(0)
+			{}
+
+		public:
+			size_t numCheckpoints() const {
+				return m_numCheckpoints;
+			}
+
+		public:
+			// schedules a checkpoint if one is due (this must be called by the thread committing the cache after every commit)
+			void trySchedule() {
+				auto now = m_timeSupplier();
+				if (!m_pPool || m_isCheckpointPending || (!m_shouldRetry && now < m_nextCheckpointTime))
+					return;
+
+				// capture everything that is not part of the cache on the committing thread, where it is consistent with the cache
+				PendingCheckpoint checkpoint;
+				checkpoint.CacheHeight = m_cache.createView().height();
+				checkpoint.SupplementalData.State = m_state;
+				checkpoint.SupplementalData.ChainScore = m_score.get();
+
+				auto hashes = m_storage.view().loadHashesFrom(checkpoint.CacheHeight, 1);
+				if (1 != hashes.size())
+					return;
+
+				checkpoint.BlockHash = *hashes.cbegin();
+
+				m_isCheckpointPending = true;
+				m_shouldRetry = false;
+				m_nextCheckpointTime = now + Timestamp(m_interval.millis());
+				m_pPool->service().post([pThis = shared_from_this(), checkpoint]() {
+					pThis->save(checkpoint);
+				});
+			}
+
+			void shutdown() {
+				// release the pool so that it can be shut down (the dispatcher is shut down before this service)
+				m_pPool.reset();
+			}
+
+		private:
+			void save(const PendingCheckpoint& checkpoint) {
+				try {
+					StateCheckpoint stateCheckpoint;
+					if (!tryCreateStateCheckpoint(checkpoint, stateCheckpoint)) {
+						// cache changed after the checkpoint was scheduled, so try again after the next commit
+						CATAPULT_LOG(debug) << "skipping state checkpoint at height " << checkpoint.CacheHeight;
+						m_shouldRetry = true;
+					} else {
+						// the cache is no longer locked, so commits are not delayed while the checkpoint is written
+						utils::StackLogger stopwatch("save state checkpoint", utils::LogLevel::Info);
+						SaveStateCheckpoint(m_dataDirectory, stateCheckpoint);
+						m_generations = std::move(stateCheckpoint.Generations);
+						++m_numCheckpoints;
+						CATAPULT_LOG(info) << "saved state checkpoint at height " << checkpoint.CacheHeight;
+					}
+				} catch (const std::exception& ex) {
+					// the state directory might have been only partially swapped, so save all storages next time
+					CATAPULT_LOG(warning) << "failed to save state checkpoint: " << ex.what();
+					m_generations.clear();
+				}
+
+				m_isCheckpointPending = false;
+			}
+
+			bool tryCreateStateCheckpoint(const PendingCheckpoint& checkpoint, StateCheckpoint& stateCheckpoint) const {
+				// get storages before locking the cache because storages briefly lock the cache too
+				auto storages = m_cache.storages();
+				auto cacheView = m_cache.createView();
+				if (checkpoint.CacheHeight != cacheView.height())
+					return false;
+
+				// only copy changed cache data while the cache is locked
+				utils::StackLogger stopwatch("copy state checkpoint", utils::LogLevel::Info);
+				stateCheckpoint = CreateStateCheckpoint(
+						m_dataDirectory,
+						storages,
+						cacheView,
+						checkpoint.SupplementalData,
+						checkpoint.BlockHash,
+						m_generations);
+				return true;
+			}
+
+		private:
+			std::string m_dataDirectory;
+			utils::TimeSpan m_interval;
+			const cache::CatapultCache& m_cache;
+			io::BlockStorageCache& m_storage;
+			const state::CatapultState& m_state;
+			const extensions::LocalNodeChainScore& m_score;
+			supplier<Timestamp> m_timeSupplier;
+			std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+
+			// only accessed by the committing thread
+			Timestamp m_nextCheckpointTime;
+
+			// only accessed by the checkpoint thread (and serialized by m_isCheckpointPending)
+			CacheStorageGenerations m_generations;
+
+			std::atomic_bool m_isCheckpointPending;
+			std::atomic_bool m_shouldRetry;
+			std::atomic<size_t> m_numCheckpoints;
+		};
+
+		class StateCheckpointerServiceRegistrar : public extensions::ServiceRegistrar {
+		public:
+			StateCheckpointerServiceRegistrar(const std::string& dataDirectory, const utils::TimeSpan& interval)
+					: m_dataDirectory(dataDirectory)
+					, m_interval(interval)
+			{}
+
+		public:
+			extensions::ServiceRegistrarInfo info() const override {
+				// needs to be registered before DispatcherService (transactionsChangeHandler | Post_Remote_Peers)
+				return { "StateCheckpointer", extensions::ServiceRegistrarPhase::Initial };
+			}
+
+			void registerServiceCounters(extensions::ServiceLocator& locator) override {
+				locator.registerServiceCounter<StateCheckpointer>(Service_Name, "STATE CHKPTS", [](const auto& checkpointer) {
+					return checkpointer.numCheckpoints();
+				});
+			}
+
+			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
+				// checkpoints are saved by a dedicated thread so that they never delay block processing
+				// (notice that the service group must be after the isolated pool in order to allow proper shutdown)
+				auto pPool = state.pool().pushIsolatedPool("state checkpointer", 1);
+				auto pServiceGroup = state.pool().pushServiceGroup("state checkpointer");
+				auto pCheckpointer = pServiceGroup->registerService(std::make_shared<StateCheckpointer>(
+						m_dataDirectory,
+						m_interval,
+						state,
+						pPool));
+				locator.registerService(Service_Name, pCheckpointer);
+
+				// the handler is called by the dispatcher thread after each commit, when cache, state and score are consistent
+				std::weak_ptr<StateCheckpointer> pWeakCheckpointer = pCheckpointer;
+				state.hooks().addTransactionsChangeHandler([pWeakCheckpointer](const auto&) {
+					auto pCheckpointerShared = pWeakCheckpointer.lock();
+					if (pCheckpointerShared)
+						pCheckpointerShared->trySchedule();
+				});
+			}
+
+		private:
+			std::string m_dataDirectory;
+			utils::TimeSpan m_interval;
+		};
+	}
+
+	DECLARE_SERVICE_REGISTRAR(StateCheckpointer)(const std::string& dataDirectory, const utils::TimeSpan& interval) {
+		return std::make_unique<StateCheckpointerServiceRegistrar>(dataDirectory, interval);
+	}
+}}
@@ -0,0 +1,31 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/extensions/ServiceRegistrar.h"
+#include "catapult/utils/TimeSpan.h"
+
+namespace catapult { namespace filechain {
+
+	/// Creates a registrar for a state checkpointer service that saves checkpoints of the cache state into state directory inside
+	/// \a dataDirectory in the background at most once every \a interval.
+	/// \note Only the data of caches that changed since the previous checkpoint is saved.
+	DECLARE_SERVICE_REGISTRAR(StateCheckpointer)(const std::string& dataDirectory, const utils::TimeSpan& interval);
+}}
@@ -23,15 +23,18 @@
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/FileLock.h"
 #include "catapult/model/Address.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/core/mocks/MockMemoryBasedStorage.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 #include <boost/filesystem.hpp>
+#include <fstream>
 
 namespace catapult { namespace filechain {
 
@@ -185,4 +188,358 @@ namespace catapult { namespace filechain {
 		EXPECT_EQ(originalSupplementalData.State.LastRecalculationHeight, supplementalData.State.LastRecalculationHeight);
 		EXPECT_EQ(Height(54321), cache.createView().height());
 	}
+
+	// region SaveStateCheckpoint
+
+	namespace {
+		constexpr auto Account_State_Filename = "AccountStateCache.dat";
+		constexpr auto Block_Difficulty_Filename = "BlockDifficultyCache.dat";
+
+		boost::filesystem::path GetStateFilePath(const std::string& dataDirectory, const std::string& filename) {
+			return boost::filesystem::path(dataDirectory) / "state" / filename;
+		}
+
+		cache::SupplementalData CreateSupplementalData() {
+			cache::SupplementalData supplementalData;
+			supplementalData.ChainScore = model::ChainScore(0x1234567890ABCDEF, 0xFEDCBA0987654321);
+			supplementalData.State.LastRecalculationHeight = model::ImportanceHeight(12345);
+			return supplementalData;
+		}
+
+		void PopulateCache(cache::CatapultCache& cache) {
+			auto delta = cache.createDelta();
+			PopulateAccountStateCache(delta.sub<cache::AccountStateCache>());
+			PopulateBlockDifficultyCache(delta.sub<cache::BlockDifficultyCache>());
+			cache.commit(Height(54321));
+		}
+
+		StateCheckpoint CreateStateCheckpoint(
+				const std::string& dataDirectory,
+				const cache::CatapultCache& cache,
+				const Hash256& blockHash,
+				const CacheStorageGenerations& previousGenerations) {
+			auto storages = cache.storages();
+			auto cacheView = cache.createView();
+			return filechain::CreateStateCheckpoint(
+					dataDirectory,
+					storages,
+					cacheView,
+					CreateSupplementalData(),
+					blockHash,
+					previousGenerations);
+		}
+
+		CacheStorageGenerations SaveStateCheckpoint(
+				const std::string& dataDirectory,
+				const cache::CatapultCache& cache,
+				const Hash256& blockHash,
+				const CacheStorageGenerations& previousGenerations) {
+			auto checkpoint = CreateStateCheckpoint(dataDirectory, cache, blockHash, previousGenerations);
+			filechain::SaveStateCheckpoint(dataDirectory, checkpoint);
+			return checkpoint.Generations;
+		}
+
+		void OverwriteFile(const boost::filesystem::path& path, const std::string& contents) {
+			boost::filesystem::remove(path);
+			std::ofstream stream(path.generic_string(), std::ios_base::binary);
+			stream << contents;
+		}
+
+		std::string ReadFile(const boost::filesystem::path& path) {
+			std::ifstream stream(path.generic_string(), std::ios_base::binary);
+			return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		}
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadStateCheckpoint) {
+		// Arrange: seed the cache
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		PopulateCache(originalCache);
+
+		// Act: save a checkpoint and load the cache
+		auto generations = SaveStateCheckpoint(tempDir.name(), originalCache, test::GenerateRandomData<Hash256_Size>(), {});
+
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
+
+		// Assert: the checkpoint was loaded
+		EXPECT_TRUE(isStateLoaded);
+		AssertSubCaches(originalCache, cache);
+		EXPECT_EQ(CreateSupplementalData().ChainScore, supplementalData.ChainScore);
+		EXPECT_EQ(model::ImportanceHeight(12345), supplementalData.State.LastRecalculationHeight);
+		EXPECT_EQ(Height(54321), cache.createView().height());
+
+		// - generations of all storages were returned
+		EXPECT_EQ(originalCache.storages().size(), generations.size());
+
+		// - no temporary directories are left behind
+		EXPECT_FALSE(boost::filesystem::exists(boost::filesystem::path(tempDir.name()) / "state.tmp"));
+		EXPECT_FALSE(boost::filesystem::exists(boost::filesystem::path(tempDir.name()) / "state.old"));
+	}
+
+	namespace {
+		template<typename TAssert>
+		void AssertSecondCheckpoint(bool shouldUsePreviousGenerations, TAssert assertFiles) {
+			// Arrange: seed the cache and save a checkpoint
+			test::TempDirectoryGuard tempDir;
+			auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			PopulateCache(cache);
+			auto generations = SaveStateCheckpoint(tempDir.name(), cache, Hash256(), {});
+
+			// - mark both storage files so that rewritten files can be detected
+			OverwriteFile(GetStateFilePath(tempDir.name(), Account_State_Filename), "account marker");
+			OverwriteFile(GetStateFilePath(tempDir.name(), Block_Difficulty_Filename), "difficulty marker");
+
+			// - only change the block difficulty cache
+			{
+				auto delta = cache.createDelta();
+				delta.sub<cache::BlockDifficultyCache>().insert(Height(Block_Cache_Size), Timestamp(1), Difficulty(1));
+				cache.commit(Height(54322));
+			}
+
+			// Act:
+			SaveStateCheckpoint(tempDir.name(), cache, Hash256(), shouldUsePreviousGenerations ? generations : CacheStorageGenerations());
+
+			// Assert:
+			assertFiles(tempDir.name());
+		}
+	}
+
+	TEST(TEST_CLASS, SaveStateCheckpointOnlySavesChangedStorages) {
+		// Act:
+		AssertSecondCheckpoint(true, [](const auto& dataDirectory) {
+			// Assert: the unchanged account state storage was reused and the changed block difficulty storage was saved
+			EXPECT_EQ("account marker", ReadFile(GetStateFilePath(dataDirectory, Account_State_Filename)));
+			EXPECT_NE("difficulty marker", ReadFile(GetStateFilePath(dataDirectory, Block_Difficulty_Filename)));
+		});
+	}
+
+	TEST(TEST_CLASS, SaveStateCheckpointSavesAllStoragesWhenPreviousGenerationsAreUnknown) {
+		// Act:
+		AssertSecondCheckpoint(false, [](const auto& dataDirectory) {
+			// Assert: both storages were saved
+			EXPECT_NE("account marker", ReadFile(GetStateFilePath(dataDirectory, Account_State_Filename)));
+			EXPECT_NE("difficulty marker", ReadFile(GetStateFilePath(dataDirectory, Block_Difficulty_Filename)));
+		});
+	}
+
+	TEST(TEST_CLASS, CreateStateCheckpointOnlyCopiesStoragesThatCannotBeReused) {
+		// Arrange: seed the cache and save a checkpoint
+		test::TempDirectoryGuard tempDir;
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		PopulateCache(cache);
+		auto generations = SaveStateCheckpoint(tempDir.name(), cache, Hash256(), {});
+
+		// - change the block difficulty cache
+		{
+			auto delta = cache.createDelta();
+			delta.sub<cache::BlockDifficultyCache>().insert(Height(Block_Cache_Size), Timestamp(1), Difficulty(1));
+			cache.commit(Height(54322));
+		}
+
+		// Act:
+		auto checkpoint = CreateStateCheckpoint(tempDir.name(), cache, Hash256(), generations);
+
+		// Assert: only the changed block difficulty storage was copied
+		EXPECT_EQ(Height(54322), checkpoint.CacheHeight);
+		EXPECT_EQ(cache.storages().size(), checkpoint.Generations.size());
+		EXPECT_EQ(1u, checkpoint.StorageData.size());
+		EXPECT_EQ(1u, checkpoint.StorageData.count("BlockDifficultyCache"));
+	}
+
+	TEST(TEST_CLASS, SaveStateCheckpointSavesCacheStateAtCheckpointCreation) {
+		// Arrange: seed the cache and create a checkpoint
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		PopulateCache(originalCache);
+		auto checkpoint = CreateStateCheckpoint(tempDir.name(), originalCache, Hash256(), {});
+
+		// - change the cache after the checkpoint was created (this would deadlock if the checkpoint still locked the cache)
+		{
+			auto delta = originalCache.createDelta();
+			delta.sub<cache::BlockDifficultyCache>().insert(Height(Block_Cache_Size), Timestamp(1), Difficulty(1));
+			originalCache.commit(Height(54322));
+		}
+
+		// Act: save the checkpoint and load the cache
+		filechain::SaveStateCheckpoint(tempDir.name(), checkpoint);
+
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
+
+		// Assert: the cache state at checkpoint creation was loaded
+		EXPECT_TRUE(isStateLoaded);
+		EXPECT_EQ(Height(54321), cache.createView().height());
+		SanityAssertCache(cache);
+	}
+
+	// endregion
+
+	// region IsStateCheckpointConsistent
+
+	namespace {
+		bool IsCheckpointConsistent(const std::string& dataDirectory) {
+			io::BlockStorageCache storage(std::make_unique<mocks::MockMemoryBasedStorage>());
+			return IsStateCheckpointConsistent(dataDirectory, storage.view());
+		}
+
+		Hash256 GetNemesisBlockHash() {
+			io::BlockStorageCache storage(std::make_unique<mocks::MockMemoryBasedStorage>());
+			return storage.view().loadBlockElement(Height(1))->EntityHash;
+		}
+
+		void SaveStateCheckpointAtHeight(const std::string& dataDirectory, Height height, const Hash256& blockHash) {
+			auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			{
+				auto delta = cache.createDelta();
+				cache.commit(height);
+			}
+
+			SaveStateCheckpoint(dataDirectory, cache, blockHash, {});
+		}
+	}
+
+	TEST(TEST_CLASS, StateWithoutCheckpointIsConsistent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache);
+
+		// Act + Assert:
+		EXPECT_TRUE(IsCheckpointConsistent(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, CheckpointMatchingStorageIsConsistent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		SaveStateCheckpointAtHeight(tempDir.name(), Height(1), GetNemesisBlockHash());
+
+		// Act + Assert:
+		EXPECT_TRUE(IsCheckpointConsistent(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, CheckpointWithDifferentBlockHashIsInconsistent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		SaveStateCheckpointAtHeight(tempDir.name(), Height(1), test::GenerateRandomData<Hash256_Size>());
+
+		// Act + Assert:
+		EXPECT_FALSE(IsCheckpointConsistent(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, CheckpointAboveStorageHeightIsInconsistent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		SaveStateCheckpointAtHeight(tempDir.name(), Height(2), GetNemesisBlockHash());
+
+		// Act + Assert:
+		EXPECT_FALSE(IsCheckpointConsistent(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, SaveStateDiscardsCheckpointInformation) {
+		// Arrange: save an inconsistent checkpoint
+		test::TempDirectoryGuard tempDir;
+		SaveStateCheckpointAtHeight(tempDir.name(), Height(1), test::GenerateRandomData<Hash256_Size>());
+
+		// Act: save the state (on shutdown)
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache);
+
+		// Assert:
+		EXPECT_TRUE(IsCheckpointConsistent(tempDir.name()));
+	}
+
+	// endregion
+
+	// region RecoverStateCheckpoint
+
+	namespace {
+		void SaveStateCheckpointAs(const std::string& dataDirectory, Height height, const std::string& directoryName) {
+			SaveStateCheckpointAtHeight(dataDirectory, height, Hash256());
+			auto dataPath = boost::filesystem::path(dataDirectory);
+			boost::filesystem::rename(dataPath / "state", dataPath / directoryName);
+		}
+
+		void PrepareInterruptedSwap(const std::string& dataDirectory, bool isCheckpointComplete) {
+			// checkpoint directories are saved under scratch names because saving a checkpoint removes leftover directories
+			auto dataPath = boost::filesystem::path(dataDirectory);
+			SaveStateCheckpointAs(dataDirectory, Height(22), "state.new");
+			SaveStateCheckpointAs(dataDirectory, Height(11), "state.old");
+			boost::filesystem::rename(dataPath / "state.new", dataPath / "state.tmp");
+
+			if (!isCheckpointComplete)
+				boost::filesystem::remove(dataPath / "state.tmp" / "checkpoint.dat");
+		}
+
+		Height LoadStateHeight(const std::string& dataDirectory) {
+			auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			cache::SupplementalData supplementalData;
+			EXPECT_TRUE(LoadState(dataDirectory, cache, supplementalData));
+			return cache.createView().height();
+		}
+
+		void AssertNoLeftoverDirectories(const std::string& dataDirectory) {
+			EXPECT_FALSE(boost::filesystem::exists(boost::filesystem::path(dataDirectory) / "state.tmp"));
+			EXPECT_FALSE(boost::filesystem::exists(boost::filesystem::path(dataDirectory) / "state.old"));
+		}
+	}
+
+	TEST(TEST_CLASS, RecoverStateCheckpointCompletesInterruptedSwapOfCompleteCheckpoint) {
+		// Arrange: crash after the state was moved aside but before the checkpoint was moved into place
+		test::TempDirectoryGuard tempDir;
+		PrepareInterruptedSwap(tempDir.name(), true);
+
+		// Act:
+		RecoverStateCheckpoint(tempDir.name());
+
+		// Assert: the checkpoint became the state
+		EXPECT_EQ(Height(22), LoadStateHeight(tempDir.name()));
+		AssertNoLeftoverDirectories(tempDir.name());
+	}
+
+	TEST(TEST_CLASS, RecoverStateCheckpointRestoresPreviousStateWhenCheckpointIsIncomplete) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		PrepareInterruptedSwap(tempDir.name(), false);
+
+		// Act:
+		RecoverStateCheckpoint(tempDir.name());
+
+		// Assert: the previous state was restored
+		EXPECT_EQ(Height(11), LoadStateHeight(tempDir.name()));
+		AssertNoLeftoverDirectories(tempDir.name());
+	}
+
+	TEST(TEST_CLASS, RecoverStateCheckpointKeepsStateAndRemovesLeftoverDirectories) {
+		// Arrange: crash while writing a checkpoint (state.tmp) and after a swap (state.old)
+		test::TempDirectoryGuard tempDir;
+		auto dataPath = boost::filesystem::path(tempDir.name());
+		SaveStateCheckpointAs(tempDir.name(), Height(11), "state.new");
+		SaveStateCheckpointAtHeight(tempDir.name(), Height(33), Hash256());
+		boost::filesystem::rename(dataPath / "state.new", dataPath / "state.old");
+		boost::filesystem::create_directory(dataPath / "state.tmp");
+
+		// Act:
+		RecoverStateCheckpoint(tempDir.name());
+
+		// Assert: the state was not changed
+		EXPECT_EQ(Height(33), LoadStateHeight(tempDir.name()));
+		AssertNoLeftoverDirectories(tempDir.name());
+	}
+
+	TEST(TEST_CLASS, RecoverStateCheckpointDoesNotCreateStateWhenNoStateIsPresent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+
+		// Act:
+		RecoverStateCheckpoint(tempDir.name());
+
+		// Assert:
+		EXPECT_FALSE(boost::filesystem::exists(boost::filesystem::path(tempDir.name()) / "state"));
+	}
+
+	// endregion
 }}
@@ -221,5 +221,26 @@ namespace catapult { namespace filechain {
 		EXPECT_EQ(expectedHeights, factoryHeights);
 	}
 
+	TEST(TEST_CLASS, LoadBlockChainLoadsBlocksInOrderWhenStorageHeightExceedsPrefetchWindow) {
+		// Arrange: create a storage with more blocks than can be prefetched at once
+		mocks::MockEntityObserver observer;
+		std::vector<Height> factoryHeights;
+		test::LocalNodeTestState state;
+		SetStorageChainHeight(state.ref().Storage.modifier(), 300);
+
+		// Act:
+		auto score = LoadBlockChain(MakeObserverFactory(observer, factoryHeights), state.ref(), Height(2));
+
+		// Assert: all blocks were executed in order
+		std::vector<Height> expectedHeights;
+		for (auto i = 2u; i <= 300; ++i)
+			expectedHeights.push_back(Height(i));
+
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(300)), score);
+		EXPECT_EQ(299u, observer.blockHeights().size());
+		EXPECT_EQ(expectedHeights, observer.blockHeights());
+		EXPECT_EQ(expectedHeights, factoryHeights);
+	}
+
 	// endregion
 }}
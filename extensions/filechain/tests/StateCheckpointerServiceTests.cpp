@@ -0,0 +1,178 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "filechain/src/StateCheckpointerService.h"
+#include "filechain/src/LocalNodeStateStorage.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/consumers/BlockChainSyncHandlers.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/local/ServiceLocatorTestContext.h"
+#include "tests/test/local/ServiceTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace filechain {
+
+#define TEST_CLASS StateCheckpointerServiceTests
+
+	namespace {
+		constexpr auto Counter_Name = "STATE CHKPTS";
+		constexpr auto Checkpoint_Interval = utils::TimeSpan::FromMinutes(10);
+
+		struct StateCheckpointerServiceTraits {
+			static auto CreateRegistrar(const std::string& dataDirectory) {
+				return CreateStateCheckpointerServiceRegistrar(dataDirectory, Checkpoint_Interval);
+			}
+
+			static auto CreateRegistrar() {
+				return CreateRegistrar("");
+			}
+		};
+
+		using BaseTestContext = test::ServiceLocatorTestContext<StateCheckpointerServiceTraits>;
+
+		class TestContext : public BaseTestContext {
+		public:
+			TestContext()
+					: BaseTestContext(
+							test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized()),
+							[&time = m_time]() { return time; })
+					, m_time(Timestamp(1000))
+			{}
+
+		public:
+			const auto& dataDirectory() const {
+				return m_tempDir.name();
+			}
+
+		public:
+			void boot() {
+				BaseTestContext::boot(dataDirectory());
+			}
+
+			void setTime(Timestamp time) {
+				m_time = time;
+			}
+
+			void commitAndNotify(Height height) {
+				auto& cache = testState().state().cache();
+				{
+					auto delta = cache.createDelta();
+					cache.commit(height);
+				}
+
+				utils::HashPointerSet addedTransactionHashes;
+				std::vector<model::TransactionInfo> revertedTransactionInfos;
+				testState().state().hooks().transactionsChangeHandler()({ addedTransactionHashes, revertedTransactionInfos });
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			Timestamp m_time;
+		};
+
+		bool HasStateCheckpoint(const std::string& dataDirectory) {
+			return boost::filesystem::exists(boost::filesystem::path(dataDirectory) / "state" / "checkpoint.dat");
+		}
+	}
+
+	ADD_SERVICE_REGISTRAR_INFO_TEST(StateCheckpointer, Initial)
+
+	TEST(TEST_CLASS, CanBootService) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(1u, context.locator().numServices());
+		EXPECT_EQ(1u, context.locator().counters().size());
+
+		EXPECT_EQ(0u, context.counter(Counter_Name));
+	}
+
+	TEST(TEST_CLASS, CheckpointIsNotSavedBeforeIntervalElapses) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act: notify one millisecond before the interval elapses
+		context.setTime(Timestamp(1000 + Checkpoint_Interval.millis() - 1));
+		context.commitAndNotify(Height(1));
+
+		// Assert:
+		EXPECT_EQ(0u, context.counter(Counter_Name));
+		EXPECT_FALSE(HasStateCheckpoint(context.dataDirectory()));
+	}
+
+	TEST(TEST_CLASS, CheckpointIsSavedAfterIntervalElapses) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act:
+		context.setTime(Timestamp(1000 + Checkpoint_Interval.millis()));
+		context.commitAndNotify(Height(1));
+		WAIT_FOR_ONE_EXPR(context.counter(Counter_Name));
+
+		// Assert: the checkpoint is consistent with the (nemesis) block in storage and can be loaded
+		EXPECT_TRUE(HasStateCheckpoint(context.dataDirectory()));
+		EXPECT_TRUE(IsStateCheckpointConsistent(context.dataDirectory(), context.testState().state().storage().view()));
+
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		EXPECT_TRUE(LoadState(context.dataDirectory(), cache, supplementalData));
+		EXPECT_EQ(Height(1), cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, CheckpointIsSavedAtMostOncePerInterval) {
+		// Arrange: save a checkpoint
+		TestContext context;
+		context.boot();
+		context.setTime(Timestamp(1000 + Checkpoint_Interval.millis()));
+		context.commitAndNotify(Height(1));
+		WAIT_FOR_ONE_EXPR(context.counter(Counter_Name));
+
+		// Act: notify again before another interval elapses
+		context.setTime(Timestamp(1000 + 2 * Checkpoint_Interval.millis() - 1));
+		context.commitAndNotify(Height(1));
+
+		// Assert:
+		EXPECT_EQ(1u, context.counter(Counter_Name));
+	}
+
+	TEST(TEST_CLASS, CheckpointIsNotSavedWhenCacheHeightIsNotInStorage) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act: storage only contains the nemesis block
+		context.setTime(Timestamp(1000 + Checkpoint_Interval.millis()));
+		context.commitAndNotify(Height(2));
+
+		// Assert:
+		EXPECT_EQ(0u, context.counter(Counter_Name));
+		EXPECT_FALSE(HasStateCheckpoint(context.dataDirectory()));
+	}
+}}
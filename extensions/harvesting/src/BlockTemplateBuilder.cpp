@@ -0,0 +1,185 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockTemplateBuilder.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/cache/RelockableDetachedCatapultCache.h"
+#include "catapult/chain/ProcessingNotificationSubscriber.h"
+#include "catapult/utils/ArraySet.h"
+#include "catapult/utils/HexFormatter.h"
+#include <algorithm>
+
+namespace catapult { namespace harvesting {
+
+	class BlockTemplateBuilder::Impl final {
+	public:
+		Impl(
+				const cache::MemoryUtCache& utCache,
+				const cache::CatapultCache& confirmedCatapultCache,
+				const chain::ExecutionConfiguration& config,
+				const chain::TimeSupplier& timeSupplier,
+				uint32_t maxTransactionsPerBlock)
+				: m_utCache(utCache)
+				, m_detachedCatapultCache(confirmedCatapultCache)
+				, m_config(config)
+				, m_timeSupplier(timeSupplier)
+				, m_maxTransactionsPerBlock(maxTransactionsPerBlock)
+		{}
+
+	public:
+		size_t size() const {
+			return m_transactionInfos.size();
+		}
+
+		void update() {
+			// 1. lock the UT cache before the unconfirmed copy (same order as the ut updater)
+			auto utView = m_utCache.view();
+			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.getAndLock();
+
+			// 2. rebuild the template if it is based on a stale cache or contains transactions that are no longer unconfirmed
+			if (!pUnconfirmedCatapultCache || !containsAll(utView)) {
+				pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
+				reset();
+			}
+
+			// 3. execute new candidates
+			apply(utView, *pUnconfirmedCatapultCache);
+		}
+
+		TransactionsInfo transactionsInfo(uint32_t count) {
+			update();
+
+			TransactionsInfo info;
+			std::vector<const model::TransactionInfo*> transactionInfos;
+			for (const auto& transactionInfo : m_transactionInfos) {
+				if (count == info.Transactions.size())
+					break;
+
+				info.Transactions.push_back(transactionInfo.pEntity);
+				transactionInfos.push_back(&transactionInfo);
+			}
+
+			CalculateBlockTransactionsHash(transactionInfos, info.TransactionsHash);
+			return info;
+		}
+
+	private:
+		bool containsAll(const cache::MemoryUtCacheView& utView) const {
+			return std::all_of(m_transactionInfos.cbegin(), m_transactionInfos.cend(), [&utView](const auto& transactionInfo) {
+				return utView.contains(transactionInfo.EntityHash);
+			});
+		}
+
+		void reset() {
+			if (!m_transactionInfos.empty() || !m_rejectedHashes.empty()) {
+				CATAPULT_LOG(debug)
+						<< "rebuilding block template (" << m_transactionInfos.size() << " included, "
+						<< m_rejectedHashes.size() << " rejected)";
+			}
+
+			m_transactionInfos.clear();
+			m_includedHashes.clear();
+			m_rejectedHashes.clear();
+		}
+
+		bool isKnown(const Hash256& entityHash) const {
+			return m_includedHashes.cend() != m_includedHashes.find(entityHash)
+					|| m_rejectedHashes.cend() != m_rejectedHashes.find(entityHash);
+		}
+
+		void apply(const cache::MemoryUtCacheView& utView, cache::CatapultCacheDelta& unconfirmedCatapultCache) {
+			if (m_maxTransactionsPerBlock <= m_transactionInfos.size())
+				return;
+
+			auto readOnlyCache = unconfirmedCatapultCache.toReadOnly();
+
+			// note that the validator and observer context height is one larger than the chain height
+			// since the validation and observation has to be for the *next* block
+			auto effectiveHeight = m_detachedCatapultCache.height() + Height(1);
+			auto validatorContext = validators::ValidatorContext(effectiveHeight, m_timeSupplier(), m_config.Network, readOnlyCache);
+
+			// note that the "real" state is currently only required by block observers, so a dummy state can be used
+			state::CatapultState dummyState;
+			auto observerContext = observers::ObserverContext(
+					unconfirmedCatapultCache,
+					dummyState,
+					effectiveHeight,
+					observers::NotifyMode::Commit);
+
+			utView.forEachByPriority([this, &validatorContext, &observerContext](const auto& utInfo) {
+				const auto& entityHash = utInfo.EntityHash;
+				if (isKnown(entityHash))
+					return true;
+
+				// notice that subscriber is created within loop because aggregate result needs to be reset each iteration
+				chain::ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
+				sub.enableUndo();
+				m_config.pNotificationPublisher->publish(model::WeakEntityInfo(*utInfo.pEntity, entityHash), sub);
+				if (!validators::IsValidationResultSuccess(sub.result())) {
+					CATAPULT_LOG(trace)
+							<< "excluding transaction " << utils::HexFormat(entityHash) << " from block template: " << sub.result();
+					sub.undo();
+					m_rejectedHashes.insert(entityHash);
+					return true;
+				}
+
+				m_includedHashes.insert(entityHash);
+				m_transactionInfos.push_back(utInfo.copy());
+				return m_maxTransactionsPerBlock != m_transactionInfos.size();
+			});
+		}
+
+	private:
+		const cache::MemoryUtCache& m_utCache;
+		cache::RelockableDetachedCatapultCache m_detachedCatapultCache;
+		chain::ExecutionConfiguration m_config;
+		chain::TimeSupplier m_timeSupplier;
+		uint32_t m_maxTransactionsPerBlock;
+
+		std::vector<model::TransactionInfo> m_transactionInfos;
+		utils::HashSet m_includedHashes;
+		utils::HashSet m_rejectedHashes;
+	};
+
+	BlockTemplateBuilder::BlockTemplateBuilder(
+			const cache::MemoryUtCache& utCache,
+			const cache::CatapultCache& confirmedCatapultCache,
+			const chain::ExecutionConfiguration& config,
+			const chain::TimeSupplier& timeSupplier,
+			uint32_t maxTransactionsPerBlock)
+			: m_pImpl(std::make_unique<Impl>(utCache, confirmedCatapultCache, config, timeSupplier, maxTransactionsPerBlock))
+	{}
+
+	BlockTemplateBuilder::~BlockTemplateBuilder() = default;
+
+	size_t BlockTemplateBuilder::size() const {
+		return m_pImpl->size();
+	}
+
+	void BlockTemplateBuilder::update() {
+		m_pImpl->update();
+	}
+
+	TransactionsInfo BlockTemplateBuilder::transactionsInfo(uint32_t count) {
+		return m_pImpl->transactionsInfo(count);
+	}
+}}
@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TransactionsInfo.h"
+#include "catapult/chain/ChainFunctions.h"
+#include "catapult/chain/ExecutionConfiguration.h"
+#include <memory>
+
+namespace catapult {
+	namespace cache {
+		class CatapultCache;
+		class MemoryUtCache;
+	}
+}
+
+namespace catapult { namespace harvesting {
+
+	/// Builds and incrementally maintains a template of statefully pre-validated transactions for the next harvested block.
+	/// \note Candidate transactions are taken from the unconfirmed transactions cache in priority order and executed against
+	///       a detached delta of the confirmed cache. Transactions that fail validation are skipped.
+	/// \note This class is not thread safe.
+	class BlockTemplateBuilder {
+	public:
+		/// Creates a builder around an unconfirmed transactions cache (\a utCache), a confirmed catapult cache
+		/// (\a confirmedCatapultCache), an execution configuration (\a config), a current time supplier (\a timeSupplier)
+		/// and the maximum number of transactions in a block (\a maxTransactionsPerBlock).
+		BlockTemplateBuilder(
+				const cache::MemoryUtCache& utCache,
+				const cache::CatapultCache& confirmedCatapultCache,
+				const chain::ExecutionConfiguration& config,
+				const chain::TimeSupplier& timeSupplier,
+				uint32_t maxTransactionsPerBlock);
+
+		/// Destroys the builder.
+		~BlockTemplateBuilder();
+
+	public:
+		/// Gets the number of transactions in the template.
+		size_t size() const;
+
+		/// Updates the template with the current contents of the unconfirmed transactions cache.
+		/// \note The template is rebuilt from scratch when the confirmed cache has changed or when a template transaction has
+		///       been removed from the unconfirmed transactions cache. Otherwise, only new candidates are executed.
+		void update();
+
+		/// Updates the template and gets a transactions info composed of at most \a count template transactions.
+		TransactionsInfo transactionsInfo(uint32_t count);
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}}
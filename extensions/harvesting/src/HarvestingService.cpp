@@ -19,6 +19,7 @@
 **/
 
 #include "HarvestingService.h"
+#include "BlockTemplateBuilder.h"
 #include "HarvestingConfiguration.h"
 #include "ScheduledHarvesterTask.h"
 #include "UnlockedAccounts.h"
@@ -28,6 +29,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/plugins/PluginManager.h"
 
 namespace catapult { namespace harvesting {
 
@@ -70,22 +72,42 @@ namespace catapult { namespace harvesting {
 			});
 		}
 
+		chain::ExecutionConfiguration CreateExecutionConfiguration(const plugins::PluginManager& pluginManager) {
+			chain::ExecutionConfiguration executionConfig;
+			executionConfig.Network = pluginManager.config().Network;
+			executionConfig.pObserver = pluginManager.createObserver();
+			executionConfig.pValidator = pluginManager.createStatefulValidator();
+			executionConfig.pNotificationPublisher = pluginManager.createNotificationPublisher();
+			return executionConfig;
+		}
+
 		thread::Task CreateHarvestingTask(extensions::ServiceState& state, UnlockedAccounts& unlockedAccounts) {
 			const auto& cache = state.cache();
 			const auto& blockChainConfig = state.config().BlockChain;
+			auto pBlockTemplateBuilder = std::make_shared<BlockTemplateBuilder>(
+					state.utCache(),
+					cache,
+					CreateExecutionConfiguration(state.pluginManager()),
+					state.timeSupplier(),
+					blockChainConfig.MaxTransactionsPerBlock);
 			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
 					CreateHarvesterTaskOptions(state),
 					std::make_unique<Harvester>(
 							cache,
 							blockChainConfig,
 							unlockedAccounts,
-							CreateTransactionsInfoSupplier(state.utCache())));
+							[pBlockTemplateBuilder](auto count) { return pBlockTemplateBuilder->transactionsInfo(count); }));
 
 			auto minHarvesterBalance = blockChainConfig.MinHarvesterBalance;
-			return thread::CreateNamedTask("harvesting task", [&cache, &unlockedAccounts, pHarvesterTask, minHarvesterBalance]() {
+			return thread::CreateNamedTask("harvesting task", [
+					&cache, &unlockedAccounts, pBlockTemplateBuilder, pHarvesterTask, minHarvesterBalance]() {
 				// prune accounts that are not eligible to harvest the next block
 				PruneUnlockedAccounts(unlockedAccounts, cache, minHarvesterBalance);
 
+				// keep the block template warm so that a successful harvest attempt only needs to sign
+				if (0 != unlockedAccounts.view().size())
+					pBlockTemplateBuilder->update();
+
 				// harvest the next block
 				pHarvesterTask->harvest();
 				return thread::make_ready_future(thread::TaskResult::Continue);
@@ -30,7 +30,7 @@ namespace catapult { namespace harvesting {
 
 			auto view = utCache.view();
 			if (0 != count) {
-				view.forEach([count, &info, &transactionInfos](const auto& transactionInfo) {
+				view.forEachByPriority([count, &info, &transactionInfos](const auto& transactionInfo) {
 					info.Transactions.push_back(transactionInfo.pEntity);
 					transactionInfos.push_back(&transactionInfo);
 					return info.Transactions.size() != count;
@@ -38,5 +38,6 @@ namespace catapult { namespace harvesting {
 	using TransactionsInfoSupplier = std::function<TransactionsInfo (uint32_t)>;
 
 	/// Creates a default transactions info supplier around \a utCache.
+	/// \note Transactions are supplied in order of descending fee density (fee per byte).
 	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache);
 }}
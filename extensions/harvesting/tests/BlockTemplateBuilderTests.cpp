@@ -0,0 +1,314 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/BlockTemplateBuilder.h"
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/model/BlockUtils.h"
+#include "tests/catapult/chain/test/MockExecutionConfiguration.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/cache/UtTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS BlockTemplateBuilderTests
+
+	namespace {
+		constexpr auto Default_Height = Height(17);
+		constexpr auto Default_Time = Timestamp(987);
+		constexpr uint32_t Max_Transactions_Per_Block = 100;
+
+		auto CreateCacheWithDefaultHeight() {
+			auto cache = test::CreateCatapultCacheWithMarkerAccount();
+			auto delta = cache.createDelta();
+			cache.commit(Default_Height);
+			return cache;
+		}
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithIncreasingFees(size_t count) {
+			// all transactions have the same size, so later transactions have higher priorities
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(i + 1, Amount(i + 1)));
+
+			return transactionInfos;
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(uint32_t maxTransactionsPerBlock = Max_Transactions_Per_Block)
+					: m_cache(CreateCacheWithDefaultHeight())
+					, m_transactionsCache(cache::MemoryCacheOptions(1024, 1000))
+					, m_builder(
+							m_transactionsCache,
+							m_cache,
+							m_executionConfig.Config,
+							[]() { return Default_Time; },
+							maxTransactionsPerBlock)
+			{}
+
+		public:
+			cache::CatapultCache& cache() {
+				return m_cache;
+			}
+
+			cache::MemoryUtCache& transactionsCache() {
+				return m_transactionsCache;
+			}
+
+			BlockTemplateBuilder& builder() {
+				return m_builder;
+			}
+
+			size_t numPublishCalls() const {
+				return m_executionConfig.pNotificationPublisher->params().size();
+			}
+
+			void setValidationResult(validators::ValidationResult result, const Hash256& hash, size_t id) {
+				m_executionConfig.pValidator->setResult(result, hash, id);
+			}
+
+		public:
+			void assertTransactions(
+					const std::vector<model::TransactionInfo>& expectedTransactionInfos,
+					const TransactionsInfo& transactionsInfo) const {
+				ASSERT_EQ(expectedTransactionInfos.size(), transactionsInfo.Transactions.size());
+
+				std::vector<const model::TransactionInfo*> expectedTransactionInfoPointers;
+				for (auto i = 0u; i < expectedTransactionInfos.size(); ++i) {
+					EXPECT_EQ(*expectedTransactionInfos[i].pEntity, *transactionsInfo.Transactions[i]) << "transaction at " << i;
+					expectedTransactionInfoPointers.push_back(&expectedTransactionInfos[i]);
+				}
+
+				Hash256 expectedHash;
+				CalculateBlockTransactionsHash(expectedTransactionInfoPointers, expectedHash);
+				EXPECT_EQ(expectedHash, transactionsInfo.TransactionsHash);
+			}
+
+		private:
+			test::MockExecutionConfiguration m_executionConfig;
+			cache::CatapultCache m_cache;
+			cache::MemoryUtCache m_transactionsCache;
+			BlockTemplateBuilder m_builder;
+		};
+
+		template<typename TContainer>
+		auto Select(const TContainer& container, const std::vector<size_t>& indexes) {
+			TContainer result;
+			for (const auto& index : indexes)
+				result.push_back(container[index].copy());
+
+			return result;
+		}
+	}
+
+	// region update
+
+	TEST(TEST_CLASS, TemplateIsInitiallyEmpty) {
+		// Arrange:
+		TestContext context;
+		test::AddAll(context.transactionsCache(), CreateTransactionInfosWithIncreasingFees(3));
+
+		// Act + Assert:
+		EXPECT_EQ(0u, context.builder().size());
+		EXPECT_EQ(0u, context.numPublishCalls());
+	}
+
+	TEST(TEST_CLASS, UpdateIncludesAllValidTransactionsByPriority) {
+		// Arrange:
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+
+		// Act:
+		context.builder().update();
+		auto transactionsInfo = context.builder().transactionsInfo(Max_Transactions_Per_Block);
+
+		// Assert:
+		EXPECT_EQ(5u, context.builder().size());
+		EXPECT_EQ(5u, context.numPublishCalls());
+		context.assertTransactions(Select(transactionInfos, { 4, 3, 2, 1, 0 }), transactionsInfo);
+	}
+
+	TEST(TEST_CLASS, UpdateExcludesTransactionsFailingValidation) {
+		// Arrange: fail validation of the second notification of a transaction in order to trigger an undo
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+		context.setValidationResult(validators::ValidationResult::Failure, transactionInfos[1].EntityHash, 1);
+		context.setValidationResult(validators::ValidationResult::Failure, transactionInfos[3].EntityHash, 2);
+
+		// Act:
+		context.builder().update();
+		auto transactionsInfo = context.builder().transactionsInfo(Max_Transactions_Per_Block);
+
+		// Assert:
+		EXPECT_EQ(3u, context.builder().size());
+		EXPECT_EQ(5u, context.numPublishCalls());
+		context.assertTransactions(Select(transactionInfos, { 4, 2, 0 }), transactionsInfo);
+	}
+
+	TEST(TEST_CLASS, UpdateIncludesAtMostMaxTransactionsPerBlock) {
+		// Arrange:
+		TestContext context(3);
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+
+		// Act:
+		context.builder().update();
+		auto transactionsInfo = context.builder().transactionsInfo(Max_Transactions_Per_Block);
+
+		// Assert:
+		EXPECT_EQ(3u, context.builder().size());
+		EXPECT_EQ(3u, context.numPublishCalls());
+		context.assertTransactions(Select(transactionInfos, { 4, 3, 2 }), transactionsInfo);
+	}
+
+	TEST(TEST_CLASS, UpdateDoesNotModifyConfirmedCache) {
+		// Arrange:
+		TestContext context;
+		test::AddAll(context.transactionsCache(), CreateTransactionInfosWithIncreasingFees(5));
+
+		// Act:
+		context.builder().update();
+
+		// Assert: the mock observer adds a difficulty info for each observed notification to the detached cache only
+		EXPECT_EQ(5u, context.builder().size());
+		EXPECT_EQ(0u, context.cache().sub<cache::BlockDifficultyCache>().createView()->size());
+	}
+
+	TEST(TEST_CLASS, UpdateOnlyExecutesNewTransactionsWhenTemplateIsUnchanged) {
+		// Arrange:
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), Select(transactionInfos, { 0, 1, 2 }));
+		context.builder().update();
+
+		// Act:
+		test::AddAll(context.transactionsCache(), Select(transactionInfos, { 3, 4 }));
+		context.builder().update();
+		auto transactionsInfo = context.builder().transactionsInfo(Max_Transactions_Per_Block);
+
+		// Assert: new transactions are appended to the template
+		EXPECT_EQ(5u, context.builder().size());
+		EXPECT_EQ(5u, context.numPublishCalls());
+		context.assertTransactions(Select(transactionInfos, { 2, 1, 0, 4, 3 }), transactionsInfo);
+	}
+
+	TEST(TEST_CLASS, UpdateDoesNotReexecuteRejectedTransactionsWhenTemplateIsUnchanged) {
+		// Arrange:
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(3);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+		context.setValidationResult(validators::ValidationResult::Failure, transactionInfos[1].EntityHash, 1);
+		context.builder().update();
+
+		// Act:
+		context.builder().update();
+
+		// Assert:
+		EXPECT_EQ(2u, context.builder().size());
+		EXPECT_EQ(3u, context.numPublishCalls());
+	}
+
+	TEST(TEST_CLASS, UpdateRebuildsTemplateWhenTemplateTransactionIsRemovedFromUtCache) {
+		// Arrange:
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+		context.builder().update();
+
+		// Act:
+		context.transactionsCache().modifier().remove(transactionInfos[2].EntityHash);
+		context.builder().update();
+		auto transactionsInfo = context.builder().transactionsInfo(Max_Transactions_Per_Block);
+
+		// Assert: all remaining transactions were reexecuted
+		EXPECT_EQ(4u, context.builder().size());
+		EXPECT_EQ(5u + 4, context.numPublishCalls());
+		context.assertTransactions(Select(transactionInfos, { 4, 3, 1, 0 }), transactionsInfo);
+	}
+
+	TEST(TEST_CLASS, UpdateRebuildsTemplateWhenConfirmedCacheIsCommitted) {
+		// Arrange:
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+		context.builder().update();
+
+		// Act:
+		{
+			auto delta = context.cache().createDelta();
+			context.cache().commit(Default_Height + Height(1));
+		}
+
+		context.builder().update();
+
+		// Assert: all transactions were reexecuted
+		EXPECT_EQ(5u, context.builder().size());
+		EXPECT_EQ(5u + 5, context.numPublishCalls());
+	}
+
+	// endregion
+
+	// region transactionsInfo
+
+	TEST(TEST_CLASS, TransactionsInfoUpdatesTemplate) {
+		// Arrange:
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+
+		// Act:
+		auto transactionsInfo = context.builder().transactionsInfo(Max_Transactions_Per_Block);
+
+		// Assert:
+		EXPECT_EQ(5u, context.builder().size());
+		context.assertTransactions(Select(transactionInfos, { 4, 3, 2, 1, 0 }), transactionsInfo);
+	}
+
+	TEST(TEST_CLASS, TransactionsInfoReturnsAtMostCountTransactions) {
+		// Arrange:
+		TestContext context;
+		auto transactionInfos = CreateTransactionInfosWithIncreasingFees(5);
+		test::AddAll(context.transactionsCache(), transactionInfos);
+
+		// Act:
+		auto transactionsInfo = context.builder().transactionsInfo(2);
+
+		// Assert:
+		EXPECT_EQ(5u, context.builder().size());
+		context.assertTransactions(Select(transactionInfos, { 4, 3 }), transactionsInfo);
+	}
+
+	TEST(TEST_CLASS, TransactionsInfoReturnsNoTransactionsWhenZeroAreRequested) {
+		// Arrange:
+		TestContext context;
+		test::AddAll(context.transactionsCache(), CreateTransactionInfosWithIncreasingFees(5));
+
+		// Act:
+		auto transactionsInfo = context.builder().transactionsInfo(0);
+
+		// Assert:
+		context.assertTransactions({}, transactionsInfo);
+	}
+
+	// endregion
+}}
@@ -29,12 +29,28 @@ namespace catapult { namespace harvesting {
 
 	namespace {
 		auto PrepareCache(size_t count) {
+			// Arrange: assign increasing fees to equally sized transactions so that priority order is the reverse of arrival order
 			auto pCache = std::make_unique<cache::MemoryUtCache>(cache::MemoryCacheOptions(1000, 1000));
-			auto transactionInfos = test::CreateTransactionInfos(count);
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(i + 1, Amount(i + 1)));
+
 			test::AddAll(*pCache, transactionInfos);
 			return pCache;
 		}
 
+		std::vector<const model::TransactionInfo*> ExtractTransactionInfosByPriority(const cache::MemoryUtCacheView& view, size_t count) {
+			std::vector<const model::TransactionInfo*> transactionInfos;
+			if (0 == count)
+				return transactionInfos;
+
+			view.forEachByPriority([count, &transactionInfos](const auto& transactionInfo) {
+				transactionInfos.push_back(&transactionInfo);
+				return count != transactionInfos.size();
+			});
+			return transactionInfos;
+		}
+
 		void AssertSupplierBehavior(uint32_t count, uint32_t numRequested, uint32_t expectedCount) {
 			// Arrange:
 			auto pCache = PrepareCache(count);
@@ -43,15 +59,18 @@ namespace catapult { namespace harvesting {
 			auto info = CreateTransactionsInfoSupplier(*pCache)(numRequested);
 
 			// Assert:
-			// - check transactions
-			auto expectedTransactions = test::ExtractTransactions(*pCache, expectedCount);
+			// - check transactions (highest fee first)
+			auto view = pCache->view();
+			auto expectedTransactionInfos = ExtractTransactionInfosByPriority(view, expectedCount);
 			ASSERT_EQ(expectedCount, info.Transactions.size());
-			for (auto i = 0u; i < expectedCount; ++i)
-				EXPECT_EQ(*expectedTransactions[i], *info.Transactions[i]) << "transaction at " << i;
+			for (auto i = 0u; i < expectedCount; ++i) {
+				EXPECT_EQ(*expectedTransactionInfos[i]->pEntity, *info.Transactions[i]) << "transaction at " << i;
+				EXPECT_EQ(Amount(count - i), info.Transactions[i]->Fee) << "transaction at " << i;
+			}
 
 			// - check hash
 			Hash256 expectedHash;
-			CalculateBlockTransactionsHash(test::ExtractTransactionInfos(pCache->view(), expectedCount), expectedHash);
+			CalculateBlockTransactionsHash(expectedTransactionInfos, expectedHash);
 			EXPECT_EQ(expectedHash, info.TransactionsHash);
 		}
 	}
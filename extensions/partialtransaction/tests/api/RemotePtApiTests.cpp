@@ -121,10 +121,23 @@ namespace catapult { namespace api {
 
 		struct RemotePtApiTraits {
 			static auto Create(const std::shared_ptr<ionet::PacketIo>& pPacketIo) {
-				return test::CreateLifetimeExtendedApi(CreateRemotePtApi, *pPacketIo, mocks::CreateDefaultTransactionRegistry());
+				auto registry = mocks::CreateDefaultTransactionRegistry();
+				return test::CreateLifetimeExtendedApi(CreateRemotePtApi, *pPacketIo, Key(), std::move(registry));
 			}
 		};
 	}
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemotePtApi, TransactionInfos)
+
+	TEST(RemotePtApiTests, CanCreateApiForRemoteNode) {
+		// Arrange:
+		mocks::MockPacketIo packetIo;
+		auto remoteIdentityKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto pApi = test::CreateLifetimeExtendedApi(CreateRemotePtApi, packetIo, remoteIdentityKey, mocks::CreateDefaultTransactionRegistry());
+
+		// Assert:
+		EXPECT_EQ(remoteIdentityKey, pApi->remoteIdentityKey());
+	}
 }}
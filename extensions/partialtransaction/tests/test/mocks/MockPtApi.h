@@ -35,7 +35,8 @@ namespace catapult { namespace mocks {
 	public:
 		/// Creates a partial transaction api around cosigned transaction infos (\a transactionInfos).
 		explicit MockPtApi(const partialtransaction::CosignedTransactionInfos& transactionInfos)
-				: m_transactionInfos(transactionInfos)
+				: api::RemotePtApi(Key())
+				, m_transactionInfos(transactionInfos)
 				, m_errorEntryPoint(EntryPoint::None)
 		{}
 
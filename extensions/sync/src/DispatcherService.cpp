@@ -47,8 +47,10 @@
 #include "catapult/subscribers/StateChangeSubscriber.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/ParallelMerkleHashing.h"
 #include "catapult/validators/AggregateEntityValidator.h"
 #include <boost/filesystem.hpp>
+#include <unordered_set>
 
 using namespace catapult::consumers;
 using namespace catapult::disruptor;
@@ -62,6 +64,7 @@ namespace catapult { namespace sync {
 			auto options = ConsumerDispatcherOptions("block dispatcher", config.BlockDisruptorSize);
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -69,6 +72,7 @@ namespace catapult { namespace sync {
 			auto options = ConsumerDispatcherOptions("transaction dispatcher", config.TransactionDisruptorSize);
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -109,9 +113,20 @@ namespace catapult { namespace sync {
 			};
 		}
 
+		chain::BatchEntityProcessor CreateSyncBatchEntityProcessor(
+				const config::NodeConfiguration& nodeConfig,
+				const chain::ExecutionConfiguration& executionConfig,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pExecutionPool) {
+			// cache database reads are not thread safe, so parallel execution is only supported for memory based caches
+			if (!nodeConfig.ShouldEnableParallelBlockExecution || nodeConfig.ShouldUseCacheDatabaseStorage)
+				return chain::CreateBatchEntityProcessor(executionConfig);
+
+			return chain::CreateParallelBatchEntityProcessor(executionConfig, pExecutionPool);
+		}
+
 		BlockChainProcessor CreateSyncProcessor(
 				const model::BlockChainConfiguration& blockChainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const chain::BatchEntityProcessor& batchEntityProcessor) {
 			return CreateBlockChainProcessor(
 					[&blockChainConfig](const cache::ReadOnlyCatapultCache& cache) {
 						cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
@@ -119,10 +134,13 @@ namespace catapult { namespace sync {
 							return view.getAccountImportanceOrDefault(publicKey, height);
 						});
 					},
-					chain::CreateBatchEntityProcessor(executionConfig));
+					batchEntityProcessor);
 		}
 
-		BlockChainSyncHandlers CreateBlockChainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockChainSyncHandlers CreateBlockChainSyncHandlers(
+				extensions::ServiceState& state,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pExecutionPool,
+				RollbackInfo& rollbackInfo) {
 			const auto& blockChainConfig = state.config().BlockChain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -138,7 +156,10 @@ namespace catapult { namespace sync {
 				rollbackInfo.increment();
 				undoBlockHandler(blockElement, observerState);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, CreateExecutionConfiguration(pluginManager));
+			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, CreateSyncBatchEntityProcessor(
+					state.config().Node,
+					CreateExecutionConfiguration(pluginManager),
+					pExecutionPool));
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -152,6 +173,13 @@ namespace catapult { namespace sync {
 			};
 
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
+
+			if (state.config().Node.ShouldEnableParallelCacheCommit) {
+				syncHandlers.CommitCache = [pExecutionPool](auto& cache, auto height) {
+					cache.commit(height, *pExecutionPool);
+				};
+			}
+
 			return syncHandlers;
 		}
 
@@ -163,8 +191,10 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
-				m_consumers.push_back(CreateBlockHashCalculatorConsumer(m_state.pluginManager().transactionRegistry()));
+			void addHashConsumers(const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
+						m_state.pluginManager().transactionRegistry(),
+						thread::CreateParallelMerkleLevelHasher(pValidatorPool)));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 					m_state.timeSupplier(),
 					extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
@@ -192,7 +222,7 @@ namespace catapult { namespace sync {
 						m_state.state(),
 						m_state.storage(),
 						m_state.config().BlockChain.MaxRollbackBlocks,
-						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockChainSyncHandlers(m_state, pValidatorPool, rollbackInfo)));
 
 				disruptorConsumers.push_back(CreateNewBlockConsumer(m_state.hooks().newBlockSink(), InputSource::Local));
 				return CreateConsumerDispatcher(
@@ -305,6 +335,27 @@ namespace catapult { namespace sync {
 
 		// endregion
 
+		bool CanUpdateIncrementally(const TransactionsChangeInfo& changeInfo) {
+			if (!changeInfo.pConfirmedStateChanges)
+				return false;
+
+			// - account state changes are tracked by address
+			// - block difficulties are never read by transaction validators
+			// - hash cache (registered by a plugin) changes only affect confirmed transactions, which are always removed
+			static const std::unordered_set<std::string> Incremental_Update_Cache_Names{
+				cache::AccountStateCache::Name,
+				cache::BlockDifficultyCache::Name,
+				"HashCache"
+			};
+
+			for (const auto& cacheName : changeInfo.pConfirmedStateChanges->ChangedCacheNames) {
+				if (Incremental_Update_Cache_Names.cend() == Incremental_Update_Cache_Names.find(cacheName))
+					return false;
+			}
+
+			return true;
+		}
+
 		chain::UtUpdater& CreateAndRegisterUtUpdater(extensions::ServiceLocator& locator, extensions::ServiceState& state) {
 			auto pUtUpdater = std::make_shared<chain::UtUpdater>(
 					state.utCache(),
@@ -316,7 +367,16 @@ namespace catapult { namespace sync {
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
 			auto& utUpdater = *pUtUpdater;
-			state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
+			// cache changes are detected via cache storages, which are not available when cache data is stored in a database
+			const auto& nodeConfig = state.config().Node;
+			auto shouldEnableIncrementalUtUpdates = nodeConfig.ShouldEnableIncrementalUtUpdates && !nodeConfig.ShouldUseCacheDatabaseStorage;
+			state.hooks().addTransactionsChangeHandler([&utUpdater, shouldEnableIncrementalUtUpdates](const auto& changeInfo) {
+				if (shouldEnableIncrementalUtUpdates && CanUpdateIncrementally(changeInfo)) {
+					const auto& changedAddresses = changeInfo.pConfirmedStateChanges->ChangedAddresses;
+					utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos, changedAddresses);
+					return;
+				}
+
 				utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
 			});
 
@@ -371,7 +431,7 @@ namespace catapult { namespace sync {
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
 				transactionDispatcherBuilder.addHashConsumers();
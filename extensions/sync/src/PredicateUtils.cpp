@@ -38,8 +38,9 @@ namespace catapult { namespace sync {
 		}
 
 		chain::UtUpdater::Throttle CreateDefaultUtUpdaterThrottle(uint64_t maxCacheSize) {
-			return [maxCacheSize](const auto&, const auto& context) {
-				return context.TransactionsCache.size() >= maxCacheSize;
+			return [maxCacheSize](const auto& transactionInfo, const auto& context) {
+				// when the cache is full, only accept transactions that can replace the lowest priority transaction
+				return context.TransactionsCache.size() >= maxCacheSize && !context.TransactionsCache.canEvictFor(transactionInfo);
 			};
 		}
 	}
@@ -28,7 +28,9 @@
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/PeersConnectionTasks.h"
+#include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/SynchronizerTaskCallbacks.h"
+#include "catapult/net/PacketIoPicker.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/MemoryUtils.h"
 
@@ -36,6 +38,7 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Sync_Source = disruptor::InputSource::Remote_Pull;
+		constexpr auto Statistics_Service_Name = "sync.statistics";
 
 		thread::Task CreateConnectPeersTask(extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& connectionsConfig = state.config().Node.OutgoingConnections;
@@ -53,10 +56,36 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
+			chainSynchronizerConfig.MaxParallelSyncPeers = config.Node.MaxParallelSyncPeers;
 			return chainSynchronizerConfig;
 		}
 
-		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
+		chain::ParallelSyncPeersSupplier CreateParallelSyncPeersSupplier(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters) {
+			auto syncTimeout = state.config().Node.SyncTimeout;
+			const auto& transactionRegistry = state.pluginManager().transactionRegistry();
+			return [&packetWriters, syncTimeout, &transactionRegistry](auto numPeers) {
+				std::vector<chain::ParallelSyncPeer> peers;
+				for (const auto& packetIoPair : net::PickMultiple(packetWriters, numPeers, syncTimeout)) {
+					// extend the lifetime of packetIoPair (and its connection) until the api is destroyed
+					auto pChainApi = utils::UniqueToShared(api::CreateRemoteChainApi(
+							*packetIoPair.io(),
+							packetIoPair.node().identityKey(),
+							transactionRegistry));
+					auto pChainApiWithIo = std::shared_ptr<const api::RemoteChainApi>(pChainApi.get(), [pChainApi, packetIoPair](
+							const auto*) {});
+					peers.push_back(chain::ParallelSyncPeer{ packetIoPair.node().identityKey(), pChainApiWithIo });
+				}
+
+				return peers;
+			};
+		}
+
+		thread::Task CreateSynchronizerTask(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters,
+				const std::shared_ptr<chain::ParallelSyncStatistics>& pStatistics) {
 			const auto& config = state.config();
 			auto chainSynchronizer = chain::CreateChainSynchronizer(
 					api::CreateLocalChainApi(
@@ -64,7 +93,9 @@ namespace catapult { namespace sync {
 							[&score = state.score()]() { return score.get(); },
 							config.Node.MaxBlocksPerSyncAttempt),
 					CreateChainSynchronizerConfiguration(config),
-					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
+					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source),
+					CreateParallelSyncPeersSupplier(state, packetWriters),
+					pStatistics);
 
 			thread::Task task;
 			task.Name = "synchronizer task";
@@ -99,16 +130,29 @@ namespace catapult { namespace sync {
 				return { "Sync", extensions::ServiceRegistrarPhase::Post_Range_Consumers };
 			}
 
-			void registerServiceCounters(extensions::ServiceLocator&) override {
-				// no additional counters
+			void registerServiceCounters(extensions::ServiceLocator& locator) override {
+				using chain::ParallelSyncStatistics;
+				locator.registerServiceCounter<ParallelSyncStatistics>(Statistics_Service_Name, "PSYNC BYTES", [](const auto& statistics) {
+					return statistics.numBytes();
+				});
+				locator.registerServiceCounter<ParallelSyncStatistics>(Statistics_Service_Name, "PSYNC REASSGN", [](const auto& statistics) {
+					return statistics.numReassignedChunks();
+				});
+				locator.registerServiceCounter<ParallelSyncStatistics>(Statistics_Service_Name, "PSYNC PEERS", [](const auto& statistics) {
+					return statistics.peers().size();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				auto& packetWriters = *GetPacketWriters(locator);
 
+				// statistics are shared with the synchronizer task, so they need to be kept alive by the locator
+				auto pStatistics = std::make_shared<chain::ParallelSyncStatistics>();
+				locator.registerRootedService(Statistics_Service_Name, pStatistics);
+
 				// add tasks
 				state.tasks().push_back(CreateConnectPeersTask(state, packetWriters));
-				state.tasks().push_back(CreateSynchronizerTask(state, packetWriters));
+				state.tasks().push_back(CreateSynchronizerTask(state, packetWriters, pStatistics));
 				state.tasks().push_back(CreatePullUtTask(state, packetWriters));
 			}
 		};
@@ -59,9 +59,9 @@ namespace catapult { namespace sync {
 			bool operator()(const model::TransactionInfo& transactionInfo, const chain::UtUpdater::ThrottleContext& context) const {
 				auto cacheSize = context.TransactionsCache.size();
 
-				// always reject if cache is completely full
+				// when the cache is completely full, only accept transactions that can replace the lowest priority transaction
 				if (cacheSize >= m_config.MaxCacheSize)
-					return true;
+					return !context.TransactionsCache.canEvictFor(transactionInfo);
 
 				// do not apply throttle unless cache contains more transactions than can fit in a single block
 				if (m_config.MaxBlockSize > cacheSize)
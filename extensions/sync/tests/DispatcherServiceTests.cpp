@@ -128,8 +128,11 @@ namespace catapult { namespace sync {
 			using BaseType = test::ServiceLocatorTestContext<DispatcherServiceTraits>;
 
 		public:
-			TestContext()
-					: BaseType(CreateCatapultCacheForDispatcherTests())
+			TestContext() : TestContext(test::LoadLocalNodeConfiguration(""))
+			{}
+
+			explicit TestContext(config::LocalNodeConfiguration&& config)
+					: BaseType(CreateCatapultCacheForDispatcherTests(), std::move(config))
 					, m_numNewBlockSinkCalls(0)
 					, m_numNewTransactionsSinkCalls(0) {
 				// initialize the cache
@@ -398,6 +401,29 @@ namespace catapult { namespace sync {
 		});
 	}
 
+	TEST(TEST_CLASS, CanConsumeBlockRange_ValidElement_ParallelBlockExecution) {
+		// Arrange:
+		auto pNextBlock = CreateValidBlockForDispatcherTests(GetBlockSignerKeyPair());
+		auto range = test::CreateEntityRange({ pNextBlock.get() });
+
+		auto nodeConfig = test::CreateLocalNodeNodeConfiguration();
+		nodeConfig.ShouldEnableParallelBlockExecution = true;
+
+		TestContext context(test::LoadLocalNodeConfiguration(test::CreateLocalNodeBlockChainConfiguration(), std::move(nodeConfig), ""));
+		context.boot();
+		auto factory = context.testState().state().hooks().blockRangeConsumerFactory()(disruptor::InputSource::Local);
+
+		// Act:
+		factory(std::move(range));
+		WAIT_FOR_ONE_EXPR(context.counter(Block_Elements_Counter_Name));
+		WAIT_FOR_ONE_EXPR(context.numNewBlockSinkCalls());
+
+		// Assert: the block was processed and forwarded to the sink
+		EXPECT_EQ(1u, context.counter(Block_Elements_Counter_Name));
+		EXPECT_EQ(1u, context.numNewBlockSinkCalls());
+		EXPECT_EQ(0u, context.numNewTransactionsSinkCalls());
+	}
+
 	namespace {
 		template<typename THandler>
 		void AssertCanConsumeBlockRangeCompletionAware(model::BlockRange&& range, THandler handler) {
@@ -123,11 +123,11 @@ namespace catapult { namespace sync {
 			auto catapultCacheView = catapultCache.createView();
 			auto readOnlyCatapultCache = catapultCacheView.toReadOnly();
 
-			// - create a ut cache with some transactions
+			// - create a ut cache with some transactions that have higher priority than the new transaction
 			cache::MemoryUtCache utCache(cache::MemoryCacheOptions(1024, 1024));
 			auto utCacheModifier = utCache.modifier();
-			for (const auto& transactionInfo : test::CreateTransactionInfos(cacheSize))
-				utCacheModifier.add(transactionInfo);
+			for (auto i = 0u; i < cacheSize; ++i)
+				utCacheModifier.add(test::CreateTransactionInfoWithDeadlineAndFee(i + 1, Amount(10'000'000)));
 
 			auto throttleContext = CreateThrottleContext(readOnlyCatapultCache, utCacheModifier);
 
@@ -210,4 +210,59 @@ namespace catapult { namespace sync {
 	}
 
 	// endregion
+
+	// region CreateUtUpdaterThrottle (eviction)
+
+	namespace {
+		void AssertHigherPriorityTransactionReplacesLowestPriorityTransactionInFullCache(const ThrottleTestSettings& settings) {
+			// Arrange:
+			auto config = CreateLocalNodeConfigurationFromSettings(settings);
+
+			// - create a read only catapult cache (importance grouping needs to be nonzero)
+			auto catapultCache = test::CreateEmptyCatapultCache(config.BlockChain);
+			auto catapultCacheView = catapultCache.createView();
+			auto readOnlyCatapultCache = catapultCacheView.toReadOnly();
+
+			// - fill a ut cache (with the same max size as the throttle) with transactions that all have the same fee
+			cache::MemoryUtCache utCache(cache::MemoryCacheOptions(1024, settings.MaxCacheSize));
+			auto utCacheModifier = utCache.modifier();
+			std::vector<model::TransactionInfo> seedInfos;
+			for (auto i = 0u; i < settings.MaxCacheSize; ++i) {
+				seedInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(i + 1, Amount(100)));
+				utCacheModifier.add(seedInfos.back());
+			}
+
+			auto throttle = CreateUtUpdaterThrottle(config);
+			auto throttleContext = CreateThrottleContext(readOnlyCatapultCache, utCacheModifier);
+			auto lowFeeTransactionInfo = test::CreateTransactionInfoWithDeadlineAndFee(1000, Amount(100));
+			auto highFeeTransactionInfo = test::CreateTransactionInfoWithDeadlineAndFee(1001, Amount(200));
+
+			// Act:
+			auto isLowFeeTransactionThrottled = throttle(lowFeeTransactionInfo, throttleContext);
+			auto isHighFeeTransactionThrottled = throttle(highFeeTransactionInfo, throttleContext);
+			auto isHighFeeTransactionAdded = utCacheModifier.add(highFeeTransactionInfo);
+			auto evictedInfos = utCacheModifier.takeEvicted();
+
+			// Assert: only the higher fee transaction passed the throttle and it replaced the most recent (lowest priority) transaction
+			EXPECT_TRUE(isLowFeeTransactionThrottled);
+			EXPECT_FALSE(isHighFeeTransactionThrottled);
+			EXPECT_TRUE(isHighFeeTransactionAdded);
+			EXPECT_EQ(settings.MaxCacheSize, utCacheModifier.size());
+
+			ASSERT_EQ(1u, evictedInfos.size());
+			EXPECT_EQ(seedInfos.back().EntityHash, evictedInfos[0].EntityHash);
+		}
+	}
+
+	TEST(TEST_CLASS, UtUpdaterThrottleAllowsHigherPriorityTransactionToReplaceLowestPriorityTransaction_NoSpamFiltering) {
+		// Assert:
+		AssertHigherPriorityTransactionReplacesLowestPriorityTransactionInFullCache(No_Spam_Test_Settings);
+	}
+
+	TEST(TEST_CLASS, UtUpdaterThrottleAllowsHigherPriorityTransactionToReplaceLowestPriorityTransaction_SpamFiltering) {
+		// Assert:
+		AssertHigherPriorityTransactionReplacesLowestPriorityTransactionInFullCache(Spam_Test_Settings);
+	}
+
+	// endregion
 }}
@@ -55,6 +55,22 @@ namespace catapult { namespace sync {
 
 	ADD_SERVICE_REGISTRAR_INFO_TEST(Sync, Post_Range_Consumers)
 
+	TEST(TEST_CLASS, CanBootService) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert: writers and parallel sync statistics
+		EXPECT_EQ(2u, context.locator().numServices());
+		EXPECT_EQ(3u, context.locator().counters().size());
+
+		EXPECT_EQ(0u, context.counter("PSYNC BYTES"));
+		EXPECT_EQ(0u, context.counter("PSYNC REASSGN"));
+		EXPECT_EQ(0u, context.counter("PSYNC PEERS"));
+	}
+
 	// region tasks
 
 	TEST(TEST_CLASS, ConnectPeersTaskIsScheduled) {
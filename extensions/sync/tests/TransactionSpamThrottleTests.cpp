@@ -349,6 +349,9 @@ namespace catapult { namespace sync {
 		// Act + Assert: max importance to try to force acceptance
 		AssertThrottling(CreateSettings(1199, Importance(1'000'000), Amount()), false); // almost full
 		AssertThrottling(CreateSettings(1200, Importance(1'000'000), Amount()), true); // full
+
+		// - a transaction with a higher fee (density) than all cached transactions can replace the lowest priority transaction
+		AssertThrottling(CreateSettings(1200, Importance(), Amount(1)), false);
 	}
 
 	TEST(TEST_CLASS, ThrottlingBehavesAsExpected_HighFillLevel) {
@@ -46,6 +46,9 @@ namespace catapult { namespace plugins {
 				handlers::RegisterAccountInfosHandler(
 						handlers,
 						handlers::CreateAccountInfosProducerFactory(cache.sub<AccountStateCache>()));
+				handlers::RegisterAccountStateProofsHandler(
+						handlers,
+						handlers::CreateAccountStateProofsProducerFactory(cache.sub<AccountStateCache>()));
 			});
 
 			manager.addDiagnosticCounterHook([](auto& counters, const CatapultCache& cache) {
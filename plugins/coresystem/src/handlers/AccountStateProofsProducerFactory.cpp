@@ -0,0 +1,82 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AccountStateProofsProducerFactory.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/handlers/BasicProducer.h"
+#include "catapult/model/AccountStateProof.h"
+#include "catapult/tree/PatriciaTreeProof.h"
+#include "catapult/utils/Casting.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <cstring>
+
+namespace catapult { namespace handlers {
+
+	namespace {
+		std::shared_ptr<const model::AccountStateProof> CreateAccountStateProof(
+				const Address& address,
+				const Hash256& stateRoot,
+				const std::vector<tree::TreeNode>& nodePath) {
+			auto nodesBuffer = tree::SerializeTreeNodes(nodePath);
+			auto nodesSize = utils::checked_cast<size_t, uint32_t>(nodesBuffer.size());
+
+			uint32_t entitySize = sizeof(model::AccountStateProof) + nodesSize;
+			auto pProof = utils::MakeSharedWithSize<model::AccountStateProof>(entitySize);
+			pProof->Size = entitySize;
+			pProof->Address = address;
+			pProof->StateRoot = stateRoot;
+			pProof->NodesSize = nodesSize;
+			if (0 != nodesSize)
+				std::memcpy(pProof->NodesPtr(), nodesBuffer.data(), nodesSize);
+
+			return pProof;
+		}
+
+		class Producer : BasicProducer<model::AddressRange> {
+		public:
+			Producer(const cache::AccountStateCache& accountStateCache, const model::AddressRange& addresses)
+					: BasicProducer<model::AddressRange>(addresses)
+					, m_accountStateCache(accountStateCache)
+			{}
+
+		public:
+			auto operator()() {
+				return next([&accountStateCache = m_accountStateCache](const auto& address) {
+					// notice that every proof is self-contained (and contains its own state root),
+					// so the cache can change between proofs
+					Hash256 stateRoot;
+					std::vector<tree::TreeNode> nodePath;
+					return accountStateCache.tryLookupWithProof(address, stateRoot, nodePath)
+							? CreateAccountStateProof(address, stateRoot, nodePath)
+							: nullptr;
+				});
+			}
+
+		private:
+			const cache::AccountStateCache& m_accountStateCache;
+		};
+	}
+
+	AccountStateProofsProducerFactory CreateAccountStateProofsProducerFactory(const cache::AccountStateCache& accountStateCache) {
+		return [&accountStateCache](const auto& addresses) {
+			return Producer(accountStateCache, addresses);
+		};
+	}
+}}
@@ -0,0 +1,38 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/handlers/HandlerTypes.h"
+#include "catapult/model/RangeTypes.h"
+
+namespace catapult {
+	namespace cache { class AccountStateCache; }
+	namespace model { struct AccountStateProof; }
+}
+
+namespace catapult { namespace handlers {
+
+	/// Alias for creating an account state proof producer given a range of addresses.
+	using AccountStateProofsProducerFactory = SharedPointerProducerFactory<Address, model::AccountStateProof>;
+
+	/// Creates an account state proofs producer factory around \a accountStateCache.
+	/// \note Producers do not produce any proofs when \a accountStateCache does not have a state root.
+	AccountStateProofsProducerFactory CreateAccountStateProofsProducerFactory(const cache::AccountStateCache& accountStateCache);
+}}
@@ -20,6 +20,7 @@
 
 #include "CoreDiagnosticHandlers.h"
 #include "catapult/handlers/HandlerFactory.h"
+#include "catapult/model/AccountStateProof.h"
 
 namespace catapult { namespace handlers {
 
@@ -29,6 +30,12 @@ namespace catapult { namespace handlers {
 
 			static constexpr auto Packet_Type = ionet::PacketType::Account_Infos;
 		};
+
+		struct AccountStateProofsTraits {
+			using RequestStructureType = Address;
+
+			static constexpr auto Packet_Type = ionet::PacketType::Account_State_Proofs;
+		};
 	}
 
 	void RegisterAccountInfosHandler(
@@ -36,4 +43,10 @@ namespace catapult { namespace handlers {
 			const AccountInfosProducerFactory& accountInfosProducerFactory) {
 		BatchHandlerFactory<AccountInfosTraits>::RegisterOne(handlers, accountInfosProducerFactory);
 	}
+
+	void RegisterAccountStateProofsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const AccountStateProofsProducerFactory& accountStateProofsProducerFactory) {
+		BatchHandlerFactory<AccountStateProofsTraits>::RegisterOne(handlers, accountStateProofsProducerFactory);
+	}
 }}
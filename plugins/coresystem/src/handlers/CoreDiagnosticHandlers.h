@@ -20,6 +20,7 @@
 
 #pragma once
 #include "AccountInfosProducerFactory.h"
+#include "AccountStateProofsProducerFactory.h"
 #include "catapult/ionet/PacketHandlers.h"
 
 namespace catapult { namespace handlers {
@@ -29,4 +30,10 @@ namespace catapult { namespace handlers {
 	void RegisterAccountInfosHandler(
 			ionet::ServerPacketHandlers& handlers,
 			const AccountInfosProducerFactory& accountInfosProducerFactory);
+
+	/// Registers an account state proofs handler in \a handlers that responds with account state proofs
+	/// returned by a producer from \a accountStateProofsProducerFactory.
+	void RegisterAccountStateProofsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const AccountStateProofsProducerFactory& accountStateProofsProducerFactory);
 }}
@@ -26,7 +26,6 @@
 #include "catapult/utils/StackLogger.h"
 #include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
-#include <vector>
 
 namespace catapult { namespace observers {
 
@@ -40,29 +39,21 @@ namespace catapult { namespace observers {
 			void recalculate(model::ImportanceHeight importanceHeight, cache::AccountStateCacheDelta& cache) const override {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::Debug);
 
-				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
-				auto highValueAddresses = cache.highValueAddresses();
-				std::vector<state::AccountState*> highValueAccounts;
-				highValueAccounts.reserve(highValueAddresses.size());
+				// 1. get the sum of all high value account balances (notice that this only inspects changed accounts)
+				auto activeXem = cache.highValueBalance();
 
-				// 2. calculate sum
-				Amount activeXem;
-				for (const auto& address : highValueAddresses) {
-					auto& accountState = cache.get(address);
-					highValueAccounts.push_back(&accountState);
-					activeXem = activeXem + accountState.Balances.get(Xem_Id);
-				}
-
-				// 3. update accounts
-				for (auto* pAccountState : highValueAccounts) {
+				// 2. update accounts
+				size_t numHighValueAccounts = 0;
+				cache.forEachHighValueAccount([importanceHeight, activeXem, &numHighValueAccounts, this](auto& accountState) {
 					boost::multiprecision::uint128_t importance = m_totalChainBalance.microxem().unwrap();
-					importance *= pAccountState->Balances.get(Xem_Id).unwrap();
+					importance *= accountState.Balances.get(Xem_Id).unwrap();
 					importance /= activeXem.unwrap();
 					importance /= utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
-					pAccountState->ImportanceInfo.set(Importance(static_cast<Importance::ValueType>(importance)), importanceHeight);
-				}
+					accountState.ImportanceInfo.set(Importance(static_cast<Importance::ValueType>(importance)), importanceHeight);
+					++numHighValueAccounts;
+				});
 
-				CATAPULT_LOG(debug) << "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)";
+				CATAPULT_LOG(debug) << "recalculated importances (" << numHighValueAccounts << " / " << cache.size() << " eligible)";
 			}
 
 		private:
@@ -27,12 +27,10 @@ namespace catapult { namespace observers {
 		class RestoreImportanceCalculator final : public ImportanceCalculator {
 		public:
 			void recalculate(model::ImportanceHeight importanceHeight, cache::AccountStateCacheDelta& cache) const override {
-				auto highValueAddresses = cache.highValueAddresses();
-				for (const auto& address : highValueAddresses) {
-					auto& accountState = cache.get(address);
+				cache.forEachHighValueAccount([importanceHeight](auto& accountState) {
 					if (importanceHeight < accountState.ImportanceInfo.height())
 						accountState.ImportanceInfo.pop();
-				}
+				});
 			}
 		};
 	}
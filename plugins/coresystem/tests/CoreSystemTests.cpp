@@ -47,7 +47,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
-				return { ionet::PacketType::Account_Infos };
+				return { ionet::PacketType::Account_Infos, ionet::PacketType::Account_State_Proofs };
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
@@ -0,0 +1,175 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/handlers/AccountStateProofsProducerFactory.h"
+#include "catapult/cache/CachePatriciaTree.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/AccountStateProof.h"
+#include "catapult/state/AccountStateAdapter.h"
+#include "catapult/tree/PatriciaTreeProof.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace handlers {
+
+#define TEST_CLASS AccountStateProofsProducerFactoryTests
+
+	namespace {
+		constexpr size_t Num_Account_States = 5;
+
+		auto PrepareCache(bool shouldEnablePatriciaTrees, std::vector<Address>& addresses) {
+			cache::CacheConfiguration config;
+			config.ShouldEnablePatriciaTrees = shouldEnablePatriciaTrees;
+			auto pCache = std::make_unique<cache::AccountStateCache>(config, cache::AccountStateCacheTypes::Options{
+				model::NetworkIdentifier::Mijin_Test,
+				777,
+				Amount(std::numeric_limits<Amount::ValueType>::max())
+			});
+
+			auto delta = pCache->createDelta();
+			for (auto i = 0u; i < Num_Account_States; ++i) {
+				addresses.push_back(test::GenerateRandomData<Address_Decoded_Size>());
+				delta->addAccount(addresses.back(), Height(i + 1));
+			}
+
+			pCache->commit();
+			return pCache;
+		}
+
+		auto ToAddressRange(const std::vector<Address>& addresses) {
+			return model::AddressRange::CopyFixed(reinterpret_cast<const uint8_t*>(addresses.data()), addresses.size());
+		}
+
+		tree::TreeProofResult VerifyProof(const model::AccountStateProof& proof, Hash256& value) {
+			std::vector<tree::TreeNode> nodePath;
+			if (!tree::TryDeserializeTreeNodes({ proof.NodesPtr(), proof.NodesSize }, nodePath))
+				return tree::TreeProofResult::Invalid;
+
+			auto keyPath = tree::TreeNodePath(cache::CalculatePatriciaTreeKey(proof.Address));
+			return tree::VerifyTreeProof(keyPath, nodePath, proof.StateRoot, value);
+		}
+
+		Hash256 CalculateExpectedValue(const cache::AccountStateCache& cache, const Address& address) {
+			auto view = cache.createView();
+			auto pAccountInfo = state::ToAccountInfo(view->get(address));
+
+			Hash256 valueHash;
+			crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(pAccountInfo.get()), pAccountInfo->Size }, valueHash);
+			return valueHash;
+		}
+
+		Hash256 GetStateRoot(const cache::AccountStateCache& cache) {
+			Hash256 stateRoot;
+			cache.tryGetStateRoot(stateRoot);
+			return stateRoot;
+		}
+	}
+
+	TEST(TEST_CLASS, NoProofsAreProducedWhenPatriciaTreesAreDisabled) {
+		// Arrange:
+		std::vector<Address> addresses;
+		auto pCache = PrepareCache(false, addresses);
+		auto addressRange = ToAddressRange(addresses);
+
+		// Act:
+		auto producer = CreateAccountStateProofsProducerFactory(*pCache)(addressRange);
+
+		// Assert:
+		EXPECT_TRUE(test::ProduceAll(producer).empty());
+	}
+
+	TEST(TEST_CLASS, CanSupplyInclusionProofsForKnownAccounts) {
+		// Arrange:
+		std::vector<Address> addresses;
+		auto pCache = PrepareCache(true, addresses);
+		auto requestedAddresses = std::vector<Address>{ addresses[0], addresses[2], addresses[4] };
+		auto addressRange = ToAddressRange(requestedAddresses);
+
+		// Act:
+		auto producer = CreateAccountStateProofsProducerFactory(*pCache)(addressRange);
+		auto proofs = test::ProduceAll(producer);
+
+		// Assert:
+		ASSERT_EQ(3u, proofs.size());
+		for (auto i = 0u; i < proofs.size(); ++i) {
+			const auto& proof = *proofs[i];
+			EXPECT_EQ(model::AccountStateProof::CalculateRealSize(proof), proof.Size) << "proof at " << i;
+			EXPECT_EQ(requestedAddresses[i], proof.Address) << "proof at " << i;
+			EXPECT_EQ(GetStateRoot(*pCache), proof.StateRoot) << "proof at " << i;
+
+			Hash256 value;
+			EXPECT_EQ(tree::TreeProofResult::Inclusion, VerifyProof(proof, value)) << "proof at " << i;
+			EXPECT_EQ(CalculateExpectedValue(*pCache, requestedAddresses[i]), value) << "proof at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanSupplyExclusionProofsForUnknownAccounts) {
+		// Arrange:
+		std::vector<Address> addresses;
+		auto pCache = PrepareCache(true, addresses);
+		auto unknownAddresses = std::vector<Address>{
+			test::GenerateRandomData<Address_Decoded_Size>(),
+			test::GenerateRandomData<Address_Decoded_Size>()
+		};
+		auto addressRange = ToAddressRange(unknownAddresses);
+
+		// Act:
+		auto producer = CreateAccountStateProofsProducerFactory(*pCache)(addressRange);
+		auto proofs = test::ProduceAll(producer);
+
+		// Assert:
+		ASSERT_EQ(2u, proofs.size());
+		for (auto i = 0u; i < proofs.size(); ++i) {
+			const auto& proof = *proofs[i];
+			EXPECT_EQ(unknownAddresses[i], proof.Address) << "proof at " << i;
+			EXPECT_EQ(GetStateRoot(*pCache), proof.StateRoot) << "proof at " << i;
+
+			Hash256 value;
+			EXPECT_EQ(tree::TreeProofResult::Exclusion, VerifyProof(proof, value)) << "proof at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, ProofsReflectLatestCommittedState) {
+		// Arrange:
+		std::vector<Address> addresses;
+		auto pCache = PrepareCache(true, addresses);
+		auto addressRange = ToAddressRange({ addresses[1] });
+		auto originalStateRoot = GetStateRoot(*pCache);
+
+		{
+			auto delta = pCache->createDelta();
+			delta->get(addresses[1]).Balances.credit(Xem_Id, Amount(1234));
+			pCache->commit();
+		}
+
+		// Act:
+		auto producer = CreateAccountStateProofsProducerFactory(*pCache)(addressRange);
+		auto proofs = test::ProduceAll(producer);
+
+		// Assert:
+		ASSERT_EQ(1u, proofs.size());
+		EXPECT_NE(originalStateRoot, proofs[0]->StateRoot);
+		EXPECT_EQ(GetStateRoot(*pCache), proofs[0]->StateRoot);
+
+		Hash256 value;
+		EXPECT_EQ(tree::TreeProofResult::Inclusion, VerifyProof(*proofs[0], value));
+		EXPECT_EQ(CalculateExpectedValue(*pCache, addresses[1]), value);
+	}
+}}
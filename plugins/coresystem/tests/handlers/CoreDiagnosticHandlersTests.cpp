@@ -19,7 +19,9 @@
 **/
 
 #include "src/handlers/CoreDiagnosticHandlers.h"
+#include "catapult/model/AccountStateProof.h"
 #include "catapult/state/AccountStateAdapter.h"
+#include "catapult/utils/MemoryUtils.h"
 #include "tests/test/plugins/BatchHandlerTests.h"
 #include "tests/TestHarness.h"
 
@@ -72,4 +74,59 @@ namespace catapult { namespace handlers {
 	}
 
 	DEFINE_BATCH_HANDLER_TESTS(CoreDiagnosticHandlersTests, AccountInfos)
+
+	namespace {
+		struct AccountStateProofsTraits {
+		public:
+			using RequestStructureType = Address;
+			using ResponseType = std::vector<std::shared_ptr<const model::AccountStateProof>>;
+			static constexpr auto Packet_Type = ionet::PacketType::Account_State_Proofs;
+			static constexpr auto Valid_Request_Payload_Size = Address_Decoded_Size;
+			static constexpr auto Message() { return "address at "; }
+
+		public:
+			struct ResponseState {};
+
+		public:
+			template<typename TAction>
+			static void RegisterHandler(ionet::ServerPacketHandlers& handlers, TAction action) {
+				RegisterAccountStateProofsHandler(handlers, test::BatchHandlerSupplierActionToProducer<ResponseType>(action));
+			}
+
+			static ResponseType CreateResponse(size_t count, const ResponseState&) {
+				ResponseType proofs;
+				for (auto i = 0u; i < count; ++i) {
+					auto nodesSize = static_cast<uint32_t>(10 + i);
+					uint32_t entitySize = sizeof(model::AccountStateProof) + nodesSize;
+					auto pProof = utils::MakeSharedWithSize<model::AccountStateProof>(entitySize);
+					pProof->Size = entitySize;
+					pProof->Address = test::GenerateRandomData<Address_Decoded_Size>();
+					pProof->StateRoot = test::GenerateRandomData<Hash256_Size>();
+					pProof->NodesSize = nodesSize;
+					test::FillWithRandomData({ pProof->NodesPtr(), nodesSize });
+					proofs.push_back(pProof);
+				}
+
+				return proofs;
+			}
+
+			static size_t TotalSize(const ResponseType& result) {
+				return test::TotalSize(result);
+			}
+
+			static void AssertExpectedResponse(const ionet::PacketPayload& payload, const ResponseType& expectedResult) {
+				ASSERT_EQ(expectedResult.size(), payload.buffers().size());
+
+				auto i = 0u;
+				for (const auto& pExpectedProof : expectedResult) {
+					const auto& buffer = payload.buffers()[i];
+					ASSERT_EQ(pExpectedProof->Size, buffer.Size) << Message() << i;
+					EXPECT_TRUE(0 == std::memcmp(pExpectedProof.get(), buffer.pData, buffer.Size)) << Message() << i;
+					++i;
+				}
+			}
+		};
+	}
+
+	DEFINE_BATCH_HANDLER_TESTS(CoreDiagnosticHandlersTests, AccountStateProofs)
 }}
@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HashCache.h"
+#include "HashCacheStorage.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_set>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		const CacheConfiguration& CheckConfiguration(const CacheConfiguration& config) {
+			// pruned elements are not part of the deltas and can only be enumerated when the cache is not backed by a database
+			if (config.ShouldUseCacheDatabase && config.ShouldEnablePatriciaTrees)
+				CATAPULT_THROW_INVALID_ARGUMENT("hash cache does not support patricia trees when cache database is enabled");
+
+			return config;
+		}
+
+		// timestamped hashes are both keys and values, so the same (serialized) hash is used for both
+		Hash256 CalculatePatriciaTreeKeyValue(const state::TimestampedHash& timestampedHash) {
+			return CalculatePatriciaTreeValue(timestampedHash, HashCacheStorage::Save);
+		}
+	}
+
+	BasicHashCache::BasicHashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime)
+			: HashBasicCache(CheckConfiguration(config), HashCacheTypes::Options{ retentionTime })
+			, PatriciaTreeCacheMixin(config)
+	{}
+
+	void BasicHashCache::commit(const CacheDeltaType& delta) {
+		// patricia tree changes need to be captured before committing because committing clears the deltas
+		auto* pTree = patriciaTree();
+		if (pTree)
+			updatePatriciaTree(*pTree, delta);
+
+		HashBasicCache::commit(delta);
+	}
+
+	void BasicHashCache::updatePatriciaTree(CachePatriciaTree& tree, const CacheDeltaType& delta) const {
+		auto pruningBoundary = delta.pruningBoundary();
+		auto isPruned = [&pruningBoundary](const auto& timestampedHash) {
+			return pruningBoundary.isSet() && timestampedHash < pruningBoundary.value();
+		};
+
+		// elements added and pruned by the same commit are never part of the cache
+		std::vector<std::pair<Hash256, Hash256>> keyValuePairs;
+		for (const auto* pTimestampedHash : delta.addedElements()) {
+			if (!isPruned(*pTimestampedHash)) {
+				auto keyValue = CalculatePatriciaTreeKeyValue(*pTimestampedHash);
+				keyValuePairs.emplace_back(keyValue, keyValue);
+			}
+		}
+
+		std::vector<Hash256> removedKeys;
+		std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> removedKeySet;
+		for (const auto* pTimestampedHash : delta.removedElements()) {
+			removedKeys.push_back(CalculatePatriciaTreeKeyValue(*pTimestampedHash));
+			removedKeySet.insert(removedKeys.back());
+		}
+
+		// elements pruned from the committed cache are not part of the deltas, so they need to be found in the (ordered) cache
+		if (pruningBoundary.isSet()) {
+			auto view = createView();
+			auto pIterableView = view.tryMakeIterableView();
+			for (const auto& timestampedHash : *pIterableView) {
+				if (!isPruned(timestampedHash))
+					break;
+
+				auto key = CalculatePatriciaTreeKeyValue(timestampedHash);
+				if (removedKeySet.cend() == removedKeySet.find(key))
+					removedKeys.push_back(key);
+			}
+		}
+
+		tree.update(keyValuePairs, removedKeys);
+	}
+}}
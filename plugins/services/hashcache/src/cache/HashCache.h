@@ -22,6 +22,7 @@
 #include "HashCacheDelta.h"
 #include "HashCacheView.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/cache/CachePatriciaTree.h"
 
 namespace catapult { namespace cache {
 
@@ -29,12 +30,20 @@ namespace catapult { namespace cache {
 
 	/// Cache composed of timestamped hashes of (transaction) elements.
 	/// \note The cache can be pruned according to the retention time.
-	class BasicHashCache : public HashBasicCache {
+	class BasicHashCache
+			: public HashBasicCache
+			, public PatriciaTreeCacheMixin {
 	public:
 		/// Creates a cache around \a config with the specified retention time (\a retentionTime).
-		explicit BasicHashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime)
-				: HashBasicCache(config, HashCacheTypes::Options{ retentionTime })
-		{}
+		explicit BasicHashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime);
+
+	public:
+		/// Commits all pending changes to the underlying storage.
+		/// \note This hides HashBasicCache::commit.
+		void commit(const CacheDeltaType& delta);
+
+	private:
+		void updatePatriciaTree(CachePatriciaTree& tree, const CacheDeltaType& delta) const;
 	};
 
 	/// Synchronized cache composed of timestamped hashes of (transaction) elements.
@@ -26,6 +26,7 @@ namespace catapult { namespace cache {
 			: HashCacheDeltaMixins::Size(*hashSets.pPrimary)
 			, HashCacheDeltaMixins::Contains(*hashSets.pPrimary)
 			, HashCacheDeltaMixins::BasicInsertRemove(*hashSets.pPrimary)
+			, HashCacheDeltaMixins::DeltaElements(*hashSets.pPrimary)
 			, m_pOrderedDelta(hashSets.pPrimary)
 			, m_retentionTime(options.RetentionTime)
 	{}
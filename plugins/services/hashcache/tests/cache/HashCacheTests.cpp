@@ -111,4 +111,148 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region state root
+
+	namespace {
+		constexpr auto Retention_Time = utils::TimeSpan::FromHours(32);
+
+		CacheConfiguration CreatePatriciaTreeCacheConfiguration() {
+			CacheConfiguration config;
+			config.ShouldEnablePatriciaTrees = true;
+			return config;
+		}
+
+		Timestamp HoursToTimestamp(uint64_t hours) {
+			return Timestamp(hours * 60 * 60 * 1000);
+		}
+
+		std::vector<state::TimestampedHash> CreateTimestampedHashes(std::initializer_list<uint64_t> hours) {
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto hour : hours)
+				timestampedHashes.emplace_back(HoursToTimestamp(hour), test::GenerateRandomData<Hash256_Size>());
+
+			return timestampedHashes;
+		}
+
+		Hash256 GetStateRoot(const HashCache& cache) {
+			Hash256 stateRoot;
+			EXPECT_TRUE(cache.tryGetStateRoot(stateRoot));
+			return stateRoot;
+		}
+
+		Hash256 CalculateExpectedStateRoot(const std::vector<state::TimestampedHash>& timestampedHashes) {
+			std::vector<std::pair<Hash256, Hash256>> keyValuePairs;
+			for (const auto& timestampedHash : timestampedHashes) {
+				// timestamped hashes are serialized without padding
+				Hash256 hash;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&timestampedHash), sizeof(state::TimestampedHash) }, hash);
+				keyValuePairs.emplace_back(hash, hash);
+			}
+
+			CachePatriciaTree tree;
+			tree.update(keyValuePairs, {});
+			return tree.root();
+		}
+
+		void Insert(HashCache& cache, const std::vector<state::TimestampedHash>& timestampedHashes, uint64_t pruneHours = 0) {
+			auto delta = cache.createDelta();
+			for (const auto& timestampedHash : timestampedHashes)
+				delta->insert(timestampedHash);
+
+			if (0 != pruneHours)
+				delta->prune(HoursToTimestamp(pruneHours));
+
+			cache.commit();
+		}
+	}
+
+	TEST(TEST_CLASS, StateRootIsUnavailableWhenPatriciaTreesAreDisabled) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), Retention_Time);
+		Insert(cache, CreateTimestampedHashes({ 1, 2, 3 }));
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = cache.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	TEST(TEST_CLASS, CannotCreateCacheWithPatriciaTreesAndCacheDatabase) {
+		// Arrange:
+		CacheConfiguration config("hash_cache");
+		config.ShouldEnablePatriciaTrees = true;
+
+		// Act + Assert:
+		EXPECT_THROW(HashCache(config, Retention_Time), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CommitUpdatesStateRoot) {
+		// Arrange:
+		HashCache cache(CreatePatriciaTreeCacheConfiguration(), Retention_Time);
+		auto timestampedHashes = CreateTimestampedHashes({ 1, 2, 3 });
+
+		// Act:
+		Insert(cache, timestampedHashes);
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedStateRoot(timestampedHashes), GetStateRoot(cache));
+	}
+
+	TEST(TEST_CLASS, CommitRemovesRemovedElementsFromStateRoot) {
+		// Arrange:
+		HashCache cache(CreatePatriciaTreeCacheConfiguration(), Retention_Time);
+		auto timestampedHashes = CreateTimestampedHashes({ 1, 2, 3 });
+		Insert(cache, timestampedHashes);
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta->remove(timestampedHashes[1]);
+			cache.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedStateRoot({ timestampedHashes[0], timestampedHashes[2] }), GetStateRoot(cache));
+	}
+
+	TEST(TEST_CLASS, CommitRemovesPrunedElementsFromStateRoot) {
+		// Arrange:
+		HashCache cache(CreatePatriciaTreeCacheConfiguration(), Retention_Time);
+		auto timestampedHashes = CreateTimestampedHashes({ 1, 2, 3, 4, 5 });
+		Insert(cache, timestampedHashes);
+
+		// Act: prune all elements with timestamps before 3h (35h - 32h) and remove one of them explicitly too
+		{
+			auto delta = cache.createDelta();
+			delta->remove(timestampedHashes[0]);
+			delta->prune(HoursToTimestamp(35));
+			cache.commit();
+		}
+
+		// Sanity:
+		EXPECT_EQ(3u, cache.createView()->size());
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedStateRoot({ timestampedHashes[2], timestampedHashes[3], timestampedHashes[4] }), GetStateRoot(cache));
+	}
+
+	TEST(TEST_CLASS, ElementsAddedAndPrunedInSameCommitDoNotAffectStateRoot) {
+		// Arrange:
+		HashCache cache(CreatePatriciaTreeCacheConfiguration(), Retention_Time);
+		auto timestampedHashes = CreateTimestampedHashes({ 1, 2, 3, 4 });
+
+		// Act: prune all elements with timestamps before 3h (35h - 32h)
+		Insert(cache, timestampedHashes, 35);
+
+		// Sanity:
+		EXPECT_EQ(2u, cache.createView()->size());
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedStateRoot({ timestampedHashes[2], timestampedHashes[3] }), GetStateRoot(cache));
+	}
+
+	// endregion
 }}
@@ -72,6 +72,10 @@ namespace catapult { namespace cache {
 			typename HeightGroupingTypes::BaseSetType HeightGrouping;
 
 		public:
+			size_t generation() const {
+				return Primary.generation();
+			}
+
 			BaseSetDeltaPointers rebase() {
 				return { Primary.rebase(), HeightGrouping.rebase() };
 			}
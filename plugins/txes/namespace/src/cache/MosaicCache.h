@@ -22,6 +22,7 @@
 #include "MosaicCacheDelta.h"
 #include "MosaicCacheView.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/cache/CachePatriciaTree.h"
 
 namespace catapult { namespace cache {
 
@@ -30,7 +31,9 @@ namespace catapult { namespace cache {
 	using MosaicBasicCache = BasicCache<MosaicCacheDescriptor, MosaicCacheTypes::BaseSets, const size_t&>;
 
 	/// Cache composed of mosaic information.
-	class BasicMosaicCache : public MosaicBasicCache {
+	class BasicMosaicCache
+			: public MosaicBasicCache
+			, public PatriciaTreeCacheMixin {
 	public:
 		/// Creates a cache around \a config.
 		explicit BasicMosaicCache(const CacheConfiguration& config) : BasicMosaicCache(config, std::make_unique<size_t>())
@@ -39,16 +42,14 @@ namespace catapult { namespace cache {
 	private:
 		BasicMosaicCache(const CacheConfiguration& config, std::unique_ptr<size_t>&& pDeepSize)
 				: MosaicBasicCache(config, *pDeepSize)
+				, PatriciaTreeCacheMixin(config)
 				, m_pDeepSize(std::move(pDeepSize))
 		{}
 
 	public:
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides MosaicBasicCache::commit.
-		void commit(const CacheDeltaType& delta) {
-			MosaicBasicCache::commit(delta);
-			*m_pDeepSize = delta.deepSize();
-		}
+		void commit(const CacheDeltaType& delta);
 
 	private:
 		// unique pointer to allow reference to be valid after moves of this cache
@@ -146,6 +146,10 @@ namespace catapult { namespace cache {
 			HeightGroupingTypes::BaseSetType HeightGrouping;
 
 		public:
+			size_t generation() const {
+				return Primary.generation();
+			}
+
 			BaseSetDeltaPointers rebase() {
 				return { Primary.rebase(), NamespaceGrouping.rebase(), HeightGrouping.rebase() };
 			}
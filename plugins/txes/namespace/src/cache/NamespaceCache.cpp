@@ -0,0 +1,45 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NamespaceCache.h"
+#include "NamespaceCacheStorage.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		NamespaceId GetPatriciaTreeKey(const state::RootNamespaceHistory& history) {
+			return history.id();
+		}
+
+		void SavePatriciaTreeValue(const state::RootNamespaceHistory& history, io::OutputStream& output) {
+			NamespaceCacheStorage::Save(std::make_pair(history.id(), history), output);
+		}
+	}
+
+	void BasicNamespaceCache::commit(const CacheDeltaType& delta) {
+		// patricia tree changes need to be captured before committing because committing clears the deltas
+		auto* pTree = patriciaTree();
+		if (pTree)
+			UpdatePatriciaTree(*pTree, delta, GetPatriciaTreeKey, SavePatriciaTreeValue);
+
+		NamespaceBasicCache::commit(delta);
+		*m_pSizes = { delta.activeSize(), delta.deepSize() };
+	}
+}}
@@ -22,13 +22,16 @@
 #include "NamespaceCacheDelta.h"
 #include "NamespaceCacheView.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/cache/CachePatriciaTree.h"
 
 namespace catapult { namespace cache {
 
 	using NamespaceBasicCache = BasicCache<NamespaceCacheDescriptor, NamespaceCacheTypes::BaseSets, const NamespaceSizes&>;
 
 	/// Cache composed of namespace information.
-	class BasicNamespaceCache : public NamespaceBasicCache {
+	class BasicNamespaceCache
+			: public NamespaceBasicCache
+			, public PatriciaTreeCacheMixin {
 	public:
 		/// Creates a cache around \a config.
 		explicit BasicNamespaceCache(const CacheConfiguration& config)
@@ -38,16 +41,14 @@ namespace catapult { namespace cache {
 	private:
 		BasicNamespaceCache(const CacheConfiguration& config, std::unique_ptr<NamespaceSizes>&& pSizes)
 				: NamespaceBasicCache(config, *pSizes)
+				, PatriciaTreeCacheMixin(config)
 				, m_pSizes(std::move(pSizes))
 		{}
 
 	public:
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides NamespaceBasicCache::commit.
-		void commit(const CacheDeltaType& delta) {
-			NamespaceBasicCache::commit(delta);
-			*m_pSizes = { delta.activeSize(), delta.deepSize() };
-		}
+		void commit(const CacheDeltaType& delta);
 
 	private:
 		// unique pointer to allow reference to be valid after moves of this cache
@@ -127,6 +127,10 @@ namespace catapult { namespace cache {
 			HeightGroupingTypes::BaseSetType HeightGrouping;
 
 		public:
+			size_t generation() const {
+				return Primary.generation();
+			}
+
 			BaseSetDeltaPointers rebase() {
 				return { Primary.rebase(), FlatMap.rebase(), HeightGrouping.rebase() };
 			}
@@ -413,4 +413,92 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region state root
+
+	namespace {
+		class PatriciaTreeCache : public MosaicCache {
+		public:
+			PatriciaTreeCache() : MosaicCache(CreateConfiguration())
+			{}
+
+		private:
+			static CacheConfiguration CreateConfiguration() {
+				CacheConfiguration config;
+				config.ShouldEnablePatriciaTrees = true;
+				return config;
+			}
+		};
+
+		Hash256 GetStateRoot(const MosaicCache& cache) {
+			Hash256 stateRoot;
+			EXPECT_TRUE(cache.tryGetStateRoot(stateRoot));
+			return stateRoot;
+		}
+	}
+
+	TEST(TEST_CLASS, StateRootIsUnavailableWhenPatriciaTreesAreDisabled) {
+		// Arrange:
+		MosaicCacheMixinTraits::CacheType cache;
+		{
+			auto delta = cache.createDelta();
+			PopulateCache(delta);
+			cache.commit();
+		}
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = cache.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	TEST(TEST_CLASS, StateRootIsUpdatedByCommitAndRestoredByRemoval) {
+		// Arrange:
+		PatriciaTreeCache cache;
+		auto delta = cache.createDelta();
+		PopulateCache(delta);
+		cache.commit();
+		auto stateRoot = GetStateRoot(cache);
+
+		// Act: add a new entry to an existing mosaic history
+		delta->insert(CreateMosaicEntry(NamespaceId(111), MosaicId(5), Amount(123)));
+		cache.commit();
+		auto modifiedStateRoot = GetStateRoot(cache);
+
+		// - remove the new entry
+		delta->remove(MosaicId(5));
+		cache.commit();
+
+		// Assert:
+		EXPECT_NE(Hash256(), stateRoot);
+		EXPECT_NE(stateRoot, modifiedStateRoot);
+		EXPECT_EQ(stateRoot, GetStateRoot(cache));
+	}
+
+	TEST(TEST_CLASS, StateRootIsUpdatedByMosaicRemoval) {
+		// Arrange:
+		PatriciaTreeCache cache;
+		auto delta = cache.createDelta();
+		for (auto id : { 1u, 3u })
+			delta->insert(CreateMosaicEntry(NamespaceId(111), MosaicId(id), Amount(id * id)));
+
+		cache.commit();
+		auto stateRoot = GetStateRoot(cache);
+
+		// Act: add and remove a mosaic
+		delta->insert(CreateMosaicEntry(NamespaceId(111), MosaicId(5), Amount(25)));
+		cache.commit();
+		auto modifiedStateRoot = GetStateRoot(cache);
+
+		delta->remove(MosaicId(5));
+		cache.commit();
+
+		// Assert:
+		EXPECT_NE(stateRoot, modifiedStateRoot);
+		EXPECT_EQ(stateRoot, GetStateRoot(cache));
+	}
+
+	// endregion
 }}
@@ -855,4 +855,94 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region state root
+
+	namespace {
+		class PatriciaTreeCache : public NamespaceCache {
+		public:
+			PatriciaTreeCache() : NamespaceCache(CreateConfiguration())
+			{}
+
+		private:
+			static CacheConfiguration CreateConfiguration() {
+				CacheConfiguration config;
+				config.ShouldEnablePatriciaTrees = true;
+				return config;
+			}
+		};
+
+		Hash256 GetStateRoot(const NamespaceCache& cache) {
+			Hash256 stateRoot;
+			EXPECT_TRUE(cache.tryGetStateRoot(stateRoot));
+			return stateRoot;
+		}
+	}
+
+	TEST(TEST_CLASS, StateRootIsUnavailableWhenPatriciaTreesAreDisabled) {
+		// Arrange:
+		NamespaceCacheMixinTraits::CacheType cache;
+		{
+			auto delta = cache.createDelta();
+			PopulateCache(delta, test::CreateRandomOwner());
+			cache.commit();
+		}
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = cache.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	TEST(TEST_CLASS, StateRootIsUpdatedByCommitAndRestoredByRemoval) {
+		// Arrange:
+		PatriciaTreeCache cache;
+		auto delta = cache.createDelta();
+		PopulateCache(delta, test::CreateRandomOwner());
+		cache.commit();
+		auto stateRoot = GetStateRoot(cache);
+
+		// Act: add a child namespace
+		AddChildren(delta, delta->get(NamespaceId(3)).root(), { 11 });
+		cache.commit();
+		auto modifiedStateRoot = GetStateRoot(cache);
+
+		// - remove the child namespace
+		delta->remove(NamespaceId(11));
+		cache.commit();
+
+		// Assert:
+		EXPECT_NE(Hash256(), stateRoot);
+		EXPECT_NE(stateRoot, modifiedStateRoot);
+		EXPECT_EQ(stateRoot, GetStateRoot(cache));
+	}
+
+	TEST(TEST_CLASS, StateRootIsIndependentOfCommitGrouping) {
+		// Arrange:
+		auto owner = test::CreateRandomOwner();
+		PatriciaTreeCache cache1;
+		PatriciaTreeCache cache2;
+
+		// Act: add all roots to cache1 in a single commit and to cache2 in two commits
+		{
+			auto delta = cache1.createDelta();
+			AddRoots(delta, owner, { 1, 3, 5, 7 });
+			cache1.commit();
+		}
+
+		{
+			auto delta = cache2.createDelta();
+			AddRoots(delta, owner, { 7, 5 });
+			cache2.commit();
+			AddRoots(delta, owner, { 3, 1 });
+			cache2.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(GetStateRoot(cache1), GetStateRoot(cache2));
+	}
+
+	// endregion
 }}
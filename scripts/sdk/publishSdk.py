@@ -177,7 +177,9 @@ def publish_all():
     publisher = Publisher(args.root, args.publish)
     publisher.set_verbose(args.verbose)
 
-    for component in ['api', 'config', 'crypto', 'io', 'ionet', 'model', 'net', 'state', 'thread', 'utils', 'version']:
+    for component in [
+            'api', 'cache', 'cache_core', 'cache_db', 'config', 'crypto', 'deltaset', 'disruptor', 'io', 'ionet', 'model', 'net',
+            'state', 'thread', 'tree', 'utils', 'version']:
         publisher.publish_component(component)
 
     for transaction in ['aggregate', 'lock', 'multisig', 'namespace', 'transfer']:
@@ -195,6 +197,6 @@ def publish_all():
     for component in ['builders', 'extensions']:
         publisher.publish_sdk_extensions(component)
 
-    publisher.flush_master_header(['MacroBasedEnum.h'])
+    publisher.flush_master_header(['MacroBasedEnum.h', 'RocksInclude.h', 'UpdateSet.h'])
 
 publish_all()
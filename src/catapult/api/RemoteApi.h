@@ -0,0 +1,46 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult { namespace api {
+
+	/// Base class for apis interacting with a remote node.
+	class RemoteApi {
+	protected:
+		/// Creates a remote api for the node with \a remoteIdentityKey.
+		explicit RemoteApi(const Key& remoteIdentityKey) : m_remoteIdentityKey(remoteIdentityKey)
+		{}
+
+	public:
+		virtual ~RemoteApi() {}
+
+	public:
+		/// Gets the identity key of the remote node.
+		const Key& remoteIdentityKey() const {
+			return m_remoteIdentityKey;
+		}
+
+	private:
+		Key m_remoteIdentityKey;
+	};
+}}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "RemoteApi.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
 
@@ -27,16 +28,21 @@ namespace catapult { namespace ionet { class PacketIo; } }
 namespace catapult { namespace api {
 
 	/// An api for retrieving transaction information from a remote node.
-	class RemoteTransactionApi {
-	public:
-		virtual ~RemoteTransactionApi() {}
+	class RemoteTransactionApi : public RemoteApi {
+	protected:
+		/// Creates a remote transaction api for the node with \a remoteIdentityKey.
+		explicit RemoteTransactionApi(const Key& remoteIdentityKey) : RemoteApi(remoteIdentityKey)
+		{}
 
 	public:
 		/// Gets all unconfirmed transactions from the remote excluding those with hashes in \a knownShortHashes.
 		virtual thread::future<model::TransactionRange> unconfirmedTransactions(model::ShortHashRange&& knownShortHashes) const = 0;
 	};
 
-	/// Creates a transaction api for interacting with a remote node with the specified \a io
-	/// and transaction \a registry composed of supported transactions.
-	std::unique_ptr<RemoteTransactionApi> CreateRemoteTransactionApi(ionet::PacketIo& io, const model::TransactionRegistry& registry);
+	/// Creates a transaction api for interacting with a remote node with the specified \a io and identity key (\a remoteIdentityKey)
+	/// given transaction \a registry composed of supported transactions.
+	std::unique_ptr<RemoteTransactionApi> CreateRemoteTransactionApi(
+			ionet::PacketIo& io,
+			const Key& remoteIdentityKey,
+			const model::TransactionRegistry& registry);
 }}
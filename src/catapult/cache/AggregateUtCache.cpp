@@ -53,10 +53,31 @@ namespace catapult { namespace cache {
 			using BasicAggregateTransactionsCacheModifier<UtTraits, UtChangeSubscriberTraits>::BasicAggregateTransactionsCacheModifier;
 
 		public:
+			bool add(const model::TransactionInfo& transactionInfo) override {
+				if (!BasicAggregateTransactionsCacheModifier<UtTraits, UtChangeSubscriberTraits>::add(transactionInfo))
+					return false;
+
+				// evicted transactions are reported to subscribers as removes
+				for (auto& evictedTransactionInfo : modifier().takeEvicted()) {
+					remove(evictedTransactionInfo);
+					m_evictedTransactionInfos.push_back(std::move(evictedTransactionInfo));
+				}
+
+				return true;
+			}
+
 			size_t count(const Key& key) const override {
 				return modifier().count(key);
 			}
 
+			bool canEvictFor(const model::TransactionInfo& transactionInfo) const override {
+				return modifier().canEvictFor(transactionInfo);
+			}
+
+			bool canAdd(const model::TransactionInfo& transactionInfo) const override {
+				return modifier().canAdd(transactionInfo);
+			}
+
 			std::vector<model::TransactionInfo> removeAll() override {
 				auto transactionInfos = modifier().removeAll();
 				for (const auto& transactionInfo : transactionInfos)
@@ -64,6 +85,15 @@ namespace catapult { namespace cache {
 
 				return transactionInfos;
 			}
+
+			std::vector<model::TransactionInfo> takeEvicted() override {
+				std::vector<model::TransactionInfo> evictedTransactionInfos;
+				evictedTransactionInfos.swap(m_evictedTransactionInfos);
+				return evictedTransactionInfos;
+			}
+
+		private:
+			std::vector<model::TransactionInfo> m_evictedTransactionInfos;
 		};
 
 		using AggregateUtCache = BasicAggregateTransactionsCache<UtTraits, AggregateUtCacheModifier>;
@@ -64,6 +64,11 @@ namespace catapult { namespace cache {
 			Commit(m_set, delta, ContainerPolicy<TBaseSet>());
 		}
 
+		/// Gets the generation of this cache, which is incremented by every commit that changes the cache.
+		size_t generation() const {
+			return m_set.generation();
+		}
+
 	private:
 		template<typename TView, typename TSetView>
 		TView createSubView(const TSetView& setView) const {
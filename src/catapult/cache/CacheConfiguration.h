@@ -27,13 +27,16 @@ namespace catapult { namespace cache {
 	struct CacheConfiguration {
 	public:
 		/// Creates a default cache configuration.
-		CacheConfiguration() : ShouldUseCacheDatabase(false)
+		CacheConfiguration()
+				: ShouldUseCacheDatabase(false)
+				, ShouldEnablePatriciaTrees(false)
 		{}
 
 		/// Creates a cache configuration around \a databaseDirectory.
 		explicit CacheConfiguration(const std::string& databaseDirectory)
 				: ShouldUseCacheDatabase(true)
 				, CacheDatabaseDirectory(databaseDirectory)
+				, ShouldEnablePatriciaTrees(false)
 		{}
 
 	public:
@@ -42,5 +45,8 @@ namespace catapult { namespace cache {
 
 		/// Base directory to use for storing cache database.
 		std::string CacheDatabaseDirectory;
+
+		/// \c true if a patricia tree should be used to calculate the cache state root, \c false otherwise.
+		bool ShouldEnablePatriciaTrees;
 	};
 }}
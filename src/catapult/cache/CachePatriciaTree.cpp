@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CachePatriciaTree.h"
+
+namespace catapult { namespace cache {
+
+	// region CachePatriciaTree
+
+	CachePatriciaTree::CachePatriciaTree() : m_tree(m_dataSource)
+	{}
+
+	Hash256 CachePatriciaTree::root() const {
+		return m_tree.root();
+	}
+
+	size_t CachePatriciaTree::numNodes() const {
+		return m_dataSource.size();
+	}
+
+	std::vector<tree::TreeNode> CachePatriciaTree::lookupWithProof(const Hash256& key) const {
+		return m_tree.lookupWithProof(key);
+	}
+
+	void CachePatriciaTree::update(
+			const std::vector<std::pair<Hash256, Hash256>>& keyValuePairs,
+			const std::vector<Hash256>& removedKeys) {
+		if (keyValuePairs.empty() && removedKeys.empty())
+			return;
+
+		m_tree.batchSet(keyValuePairs);
+		m_tree.batchUnset(removedKeys);
+		m_tree.commit();
+	}
+
+	// endregion
+
+	// region HashingOutputStream
+
+	void HashingOutputStream::write(const RawBuffer& buffer) {
+		m_hashBuilder.update(buffer);
+	}
+
+	void HashingOutputStream::flush()
+	{}
+
+	Hash256 HashingOutputStream::hash() {
+		Hash256 hash;
+		m_hashBuilder.final(hash);
+		return hash;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,174 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CacheConfiguration.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/io/Stream.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "catapult/utils/traits/Traits.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Patricia tree that is used to calculate the state root of a cache.
+	/// \note Tree keys are hashes of cache keys and tree values are hashes of serialized cache values.
+	class CachePatriciaTree {
+	private:
+		class PassThroughEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const ValueType& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using TreeType = tree::PatriciaTree<PassThroughEncoder, tree::MemoryDataSource>;
+
+	public:
+		/// Creates an empty tree.
+		CachePatriciaTree();
+
+	public:
+		/// Gets the root hash of the tree.
+		Hash256 root() const;
+
+		/// Gets the number of nodes in the tree.
+		size_t numNodes() const;
+
+		/// Gets all nodes on the path from the root towards \a key.
+		std::vector<tree::TreeNode> lookupWithProof(const Hash256& key) const;
+
+	public:
+		/// Updates the tree by setting all (key, value) pairs in \a keyValuePairs and removing all \a removedKeys.
+		/// \note All keys are expected to be unique.
+		void update(const std::vector<std::pair<Hash256, Hash256>>& keyValuePairs, const std::vector<Hash256>& removedKeys);
+
+	private:
+		tree::MemoryDataSource m_dataSource;
+		TreeType m_tree;
+	};
+
+	/// Mixin that adds optional patricia tree (state root) support to a basic cache.
+	class PatriciaTreeCacheMixin {
+	protected:
+		/// Creates a mixin around \a config.
+		explicit PatriciaTreeCacheMixin(const CacheConfiguration& config)
+				: m_pTree(config.ShouldEnablePatriciaTrees ? std::make_unique<CachePatriciaTree>() : nullptr)
+		{}
+
+	public:
+		/// Gets the cache state root (\a stateRoot) and returns \c true if patricia tree support is enabled.
+		bool tryGetStateRoot(Hash256& stateRoot) const {
+			if (!m_pTree)
+				return false;
+
+			stateRoot = m_pTree->root();
+			return true;
+		}
+
+		/// Gets the cache state root (\a stateRoot) and all patricia tree nodes on the path from the root towards
+		/// cache \a key (\a nodePath) and returns \c true if patricia tree support is enabled.
+		template<typename TKey>
+		bool tryLookupWithProof(const TKey& key, Hash256& stateRoot, std::vector<tree::TreeNode>& nodePath) const;
+
+	protected:
+		/// Gets a pointer to the patricia tree or \c nullptr if patricia tree support is disabled.
+		CachePatriciaTree* patriciaTree() {
+			return m_pTree.get();
+		}
+
+	private:
+		// unique pointer to allow the tree to be valid after moves of this cache
+		std::unique_ptr<CachePatriciaTree> m_pTree;
+	};
+
+	/// Output stream that hashes all written data.
+	class HashingOutputStream final : public io::OutputStream {
+	public:
+		void write(const RawBuffer& buffer) override;
+
+		void flush() override;
+
+	public:
+		/// Gets the hash of all written data.
+		Hash256 hash();
+
+	private:
+		crypto::Sha3_256_Builder m_hashBuilder;
+	};
+
+	/// Calculates the patricia tree key corresponding to cache \a key.
+	template<typename TKey>
+	Hash256 CalculatePatriciaTreeKey(const TKey& key) {
+		static_assert(utils::traits::is_pod<TKey>::value, "patricia tree keys can only be calculated for pod cache keys");
+
+		Hash256 keyHash;
+		crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&key), sizeof(TKey) }, keyHash);
+		return keyHash;
+	}
+
+	/// Calculates the patricia tree value corresponding to \a element, which is serialized using \a save.
+	template<typename TElement, typename TSave>
+	Hash256 CalculatePatriciaTreeValue(const TElement& element, TSave save) {
+		HashingOutputStream stream;
+		save(element, stream);
+		return stream.hash();
+	}
+
+	template<typename TKey>
+	bool PatriciaTreeCacheMixin::tryLookupWithProof(const TKey& key, Hash256& stateRoot, std::vector<tree::TreeNode>& nodePath) const {
+		if (!m_pTree)
+			return false;
+
+		stateRoot = m_pTree->root();
+		nodePath = m_pTree->lookupWithProof(CalculatePatriciaTreeKey(key));
+		return true;
+	}
+
+	/// Updates \a tree with all elements added to, modified in and removed from \a delta.
+	/// \a getKey returns the cache key of an element and \a save serializes an element.
+	template<typename TCacheDelta, typename TGetKey, typename TSave>
+	void UpdatePatriciaTree(CachePatriciaTree& tree, const TCacheDelta& delta, TGetKey getKey, TSave save) {
+		std::vector<std::pair<Hash256, Hash256>> keyValuePairs;
+		auto addKeyValuePairs = [&keyValuePairs, getKey, save](const auto& elements) {
+			for (const auto* pElement : elements)
+				keyValuePairs.emplace_back(CalculatePatriciaTreeKey(getKey(*pElement)), CalculatePatriciaTreeValue(*pElement, save));
+		};
+
+		addKeyValuePairs(delta.addedElements());
+		addKeyValuePairs(delta.modifiedElements());
+
+		std::vector<Hash256> removedKeys;
+		for (const auto* pElement : delta.removedElements())
+			removedKeys.push_back(CalculatePatriciaTreeKey(getKey(*pElement)));
+
+		tree.update(keyValuePairs, removedKeys);
+	}
+}}
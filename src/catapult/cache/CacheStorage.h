@@ -22,6 +22,11 @@
 #include "CacheStorageInclude.h"
 #include <string>
 
+namespace catapult {
+	namespace cache { class CatapultCacheView; }
+	namespace thread { class IoServiceThreadPool; }
+}
+
 namespace catapult { namespace cache {
 
 	/// Interface for loading and saving cache data.
@@ -33,11 +38,21 @@ namespace catapult { namespace cache {
 		/// Gets the cache name.
 		virtual const std::string& name() const = 0;
 
+		/// Gets the cache generation, which changes whenever cache data is changed.
+		/// \note This is not synchronized, so the caller must either hold a cache view or be the committing thread.
+		virtual size_t generation() const = 0;
+
 	public:
 		/// Saves cache data to \a output.
 		virtual void saveAll(io::OutputStream& output) const = 0;
 
+		/// Saves cache data from the (already locked) \a cacheView to \a output.
+		virtual void saveAll(const CatapultCacheView& cacheView, io::OutputStream& output) const = 0;
+
 		/// Loads cache data from \a input in batches of \a batchSize.
 		virtual void loadAll(io::InputStream& input, size_t batchSize) = 0;
+
+		/// Loads cache data from \a input in batches of \a batchSize using \a pool to parse entries in each batch.
+		virtual void loadAll(io::InputStream& input, size_t batchSize, thread::IoServiceThreadPool& pool) = 0;
 	};
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "CacheStorage.h"
+#include "CatapultCacheView.h"
 #include "ChunkedDataLoader.h"
 
 namespace catapult { namespace cache {
@@ -39,16 +40,18 @@ namespace catapult { namespace cache {
 			return m_name;
 		}
 
+		size_t generation() const override {
+			return m_cache.generation();
+		}
+
 	public:
 		void saveAll(io::OutputStream& output) const override {
 			auto view = m_cache.createView();
-			io::Write64(output, view->size());
-
-			auto pIterableView = view->tryMakeIterableView();
-			for (const auto& value : *pIterableView)
-				TStorageTraits::Save(value, output);
+			SaveAll(*view, output);
+		}
 
-			output.flush();
+		void saveAll(const CatapultCacheView& cacheView, io::OutputStream& output) const override {
+			SaveAll(cacheView.sub<TCache>(), output);
 		}
 
 		void loadAll(io::InputStream& input, size_t batchSize) override {
@@ -61,6 +64,27 @@ namespace catapult { namespace cache {
 			}
 		}
 
+		void loadAll(io::InputStream& input, size_t batchSize, thread::IoServiceThreadPool& pool) override {
+			auto delta = m_cache.createDelta();
+
+			ChunkedDataLoader<TStorageTraits> loader(input);
+			while (loader.hasNext()) {
+				loader.next(batchSize, *delta, pool);
+				m_cache.commit();
+			}
+		}
+
+	private:
+		static void SaveAll(const typename TStorageTraits::SourceType& view, io::OutputStream& output) {
+			io::Write64(output, view.size());
+
+			auto pIterableView = view.tryMakeIterableView();
+			for (const auto& value : *pIterableView)
+				TStorageTraits::Save(value, output);
+
+			output.flush();
+		}
+
 	private:
 		TCache& m_cache;
 		std::string m_name;
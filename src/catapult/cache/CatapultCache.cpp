@@ -25,6 +25,9 @@
 #include "SubCachePluginAdapter.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <chrono>
 
 namespace catapult { namespace cache {
 
@@ -62,6 +65,17 @@ namespace catapult { namespace cache {
 		return m_pCacheHeight->get();
 	}
 
+	std::vector<std::pair<size_t, Hash256>> CatapultCacheView::stateRoots() const {
+		std::vector<std::pair<size_t, Hash256>> stateRoots;
+		for (auto i = 0u; i < m_subViews.size(); ++i) {
+			Hash256 stateRoot;
+			if (m_subViews[i] && m_subViews[i]->tryGetStateRoot(stateRoot))
+				stateRoots.emplace_back(i, stateRoot);
+		}
+
+		return stateRoots;
+	}
+
 	ReadOnlyCatapultCache CatapultCacheView::toReadOnly() const {
 		return ReadOnlyCatapultCache(ExtractReadOnlyViews(m_subViews));
 	}
@@ -163,6 +177,7 @@ namespace catapult { namespace cache {
 	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
 			: m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_subCaches(std::move(subCaches))
+			, m_commitMillis(m_subCaches.size())
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -194,19 +209,79 @@ namespace catapult { namespace cache {
 		return CatapultCacheDetachableDelta(std::move(pCacheHeightView), std::move(detachedSubViews));
 	}
 
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		uint64_t GetElapsedMillis(Clock::time_point start) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count());
+		}
+	}
+
 	void CatapultCache::commit(Height height) {
 		// use the height writer lock to lock the entire cache during commit
 		auto cacheHeightModifier = m_pCacheHeight->modifier();
 
-		for (const auto& pSubCache : m_subCaches) {
-			if (pSubCache)
-				pSubCache->commit();
+		for (auto i = 0u; i < m_subCaches.size(); ++i) {
+			if (!m_subCaches[i])
+				continue;
+
+			auto start = Clock::now();
+			m_subCaches[i]->commit();
+			m_commitMillis[i] = GetElapsedMillis(start);
 		}
 
 		// finally, update the cache height
 		cacheHeightModifier.set(height);
 	}
 
+	void CatapultCache::commit(Height height, thread::IoServiceThreadPool& pool) {
+		// use the height writer lock to lock the entire cache during commit
+		auto cacheHeightModifier = m_pCacheHeight->modifier();
+
+		std::vector<size_t> ids;
+		for (auto i = 0u; i < m_subCaches.size(); ++i) {
+			if (m_subCaches[i])
+				ids.push_back(i);
+		}
+
+		// subcaches are independent, so they can be committed concurrently
+		std::vector<std::exception_ptr> exceptions(ids.size());
+		auto numPartitions = std::min<size_t>(pool.numWorkerThreads(), ids.size());
+		thread::ParallelFor(pool.service(), ids, numPartitions, [this, &exceptions](auto id, auto index) {
+			try {
+				auto start = Clock::now();
+				m_subCaches[id]->commit();
+				m_commitMillis[id] = GetElapsedMillis(start);
+			} catch (...) {
+				exceptions[index] = std::current_exception();
+			}
+
+			return true;
+		}).get();
+
+		for (const auto& pException : exceptions) {
+			if (pException)
+				std::rethrow_exception(pException);
+		}
+
+		// finally, update the cache height after all subcaches have been committed
+		cacheHeightModifier.set(height);
+	}
+
+	std::vector<std::pair<size_t, std::string>> CatapultCache::subCacheNames() const {
+		std::vector<std::pair<size_t, std::string>> names;
+		for (auto i = 0u; i < m_subCaches.size(); ++i) {
+			if (m_subCaches[i])
+				names.emplace_back(i, m_subCaches[i]->name());
+		}
+
+		return names;
+	}
+
+	uint64_t CatapultCache::lastCommitMillis(size_t id) const {
+		return m_commitMillis[id];
+	}
+
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
 		return MapSubCaches<const CacheStorage>(
 				m_subCaches,
@@ -23,6 +23,7 @@
 #include "CatapultCacheDetachableDelta.h"
 #include "CatapultCacheView.h"
 #include "SubCachePlugin.h"
+#include <atomic>
 
 namespace catapult {
 	namespace cache {
@@ -31,6 +32,7 @@ namespace catapult {
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockChainConfiguration; }
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -71,6 +73,17 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
 		void commit(Height height);
 
+		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
+		/// \note Subcaches are committed in parallel using \a pool but the height is only set after all commits complete.
+		void commit(Height height, thread::IoServiceThreadPool& pool);
+
+	public:
+		/// Gets the ids and names of all subcaches.
+		std::vector<std::pair<size_t, std::string>> subCacheNames() const;
+
+		/// Gets the duration (in milliseconds) of the last commit of the subcache with \a id.
+		uint64_t lastCommitMillis(size_t id) const;
+
 	public:
 		/// Gets cache storages for all subcaches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
@@ -81,5 +94,6 @@ namespace catapult { namespace cache {
 	private:
 		std::unique_ptr<CacheHeight> m_pCacheHeight; // use a unique_ptr to allow fwd declare
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::vector<std::atomic<uint64_t>> m_commitMillis;
 	};
 }}
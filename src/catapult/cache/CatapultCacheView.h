@@ -54,6 +54,15 @@ namespace catapult { namespace cache {
 			return *static_cast<const typename TCache::CacheViewType*>(m_subViews[TCache::Id]->get());
 		}
 
+		/// Gets the state root of a specific subcache (\a stateRoot) and returns \c true if the subcache supports state roots.
+		template<typename TCache>
+		bool tryGetStateRoot(Hash256& stateRoot) const {
+			return m_subViews[TCache::Id]->tryGetStateRoot(stateRoot);
+		}
+
+		/// Gets the (subcache id, state root) pairs of all subcaches that support state roots.
+		std::vector<std::pair<size_t, Hash256>> stateRoots() const;
+
 	public:
 		/// Gets the cache height associated with the read lock.
 		Height height() const;
@@ -21,7 +21,11 @@
 #pragma once
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/functions.h"
+#include <exception>
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -35,6 +39,9 @@ namespace catapult { namespace cache {
 		using BasicLoaderFlag = std::integral_constant<LoaderType, LoaderType::Basic>;
 		using StatefulLoaderFlag = std::integral_constant<LoaderType, LoaderType::Stateful>;
 
+		using SequentialParserFlag = std::false_type;
+		using ParallelParserFlag = std::true_type;
+
 	public:
 		/// Creates a chunked loader around \a input.
 		explicit ChunkedDataLoader(io::InputStream& input)
@@ -57,6 +64,70 @@ namespace catapult { namespace cache {
 				m_loader(m_input, destination);
 		}
 
+		/// Loads the next data chunk of at most \a numRequestedEntries into \a destination using \a pool to parse entries.
+		/// \note Entries are read from the input sequentially, parsed concurrently and then added to \a destination in order.
+		///       Storage traits that do not support split parsing are loaded sequentially.
+		void next(
+				uint64_t numRequestedEntries,
+				typename TStorageTraits::DestinationType& destination,
+				thread::IoServiceThreadPool& pool) {
+			next(numRequestedEntries, destination, pool, ParsedTypeAccessor<TStorageTraits>());
+		}
+
+	private:
+		void next(
+				uint64_t numRequestedEntries,
+				typename TStorageTraits::DestinationType& destination,
+				thread::IoServiceThreadPool&,
+				SequentialParserFlag) {
+			next(numRequestedEntries, destination);
+		}
+
+		void next(
+				uint64_t numRequestedEntries,
+				typename TStorageTraits::DestinationType& destination,
+				thread::IoServiceThreadPool& pool,
+				ParallelParserFlag) {
+			numRequestedEntries = std::min(numRequestedEntries, m_numRemainingEntries);
+			m_numRemainingEntries -= numRequestedEntries;
+
+			using SerializedType = decltype(TStorageTraits::Load(m_input));
+			std::vector<SerializedType> serializedEntries;
+			serializedEntries.reserve(numRequestedEntries);
+			while (numRequestedEntries--)
+				serializedEntries.push_back(TStorageTraits::Load(m_input));
+
+			// parse each partition into a separate vector so that all entries can be added in their original order
+			auto numPartitions = std::max<size_t>(1, pool.numWorkerThreads());
+			std::vector<std::vector<typename TStorageTraits::ParsedType>> parsedPartitions(numPartitions);
+			std::vector<std::exception_ptr> partitionExceptions(numPartitions);
+			thread::ParallelForPartition(pool.service(), serializedEntries, numPartitions, [&parsedPartitions, &partitionExceptions](
+					auto itBegin,
+					auto itEnd,
+					auto,
+					auto batchIndex) {
+				// exceptions must not escape pool threads
+				try {
+					auto& parsedEntries = parsedPartitions[batchIndex];
+					parsedEntries.reserve(static_cast<size_t>(std::distance(itBegin, itEnd)));
+					for (auto iter = itBegin; itEnd != iter; ++iter)
+						parsedEntries.push_back(TStorageTraits::Parse(*iter));
+				} catch (...) {
+					partitionExceptions[batchIndex] = std::current_exception();
+				}
+			}).get();
+
+			for (const auto& pException : partitionExceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
+
+			for (auto& parsedEntries : parsedPartitions) {
+				for (auto& parsedEntry : parsedEntries)
+					TStorageTraits::AddParsed(destination, std::move(parsedEntry));
+			}
+		}
+
 	private:
 		template<typename T, typename = void>
 		struct LoadStateAccessor : BasicLoaderFlag
@@ -66,6 +137,14 @@ namespace catapult { namespace cache {
 		struct LoadStateAccessor<T, typename utils::traits::enable_if_type<typename T::LoadStateType>::type> : StatefulLoaderFlag
 		{};
 
+		template<typename T, typename = void>
+		struct ParsedTypeAccessor : SequentialParserFlag
+		{};
+
+		template<typename T>
+		struct ParsedTypeAccessor<T, typename utils::traits::enable_if_type<typename T::ParsedType>::type> : ParallelParserFlag
+		{};
+
 	private:
 		static LoaderFunc CreateLoader(BasicLoaderFlag) {
 			return TStorageTraits::LoadInto;
@@ -22,6 +22,7 @@
 #include "AccountCounters.h"
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
+#include <boost/multiprecision/cpp_int.hpp>
 
 namespace catapult { namespace cache {
 
@@ -46,15 +47,32 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	// region TransactionDataPriorityComparer
+
+	bool TransactionDataPriorityComparer::operator()(const TransactionData* pLhs, const TransactionData* pRhs) const {
+		// compare fee densities exactly by cross multiplying fees and sizes
+		using boost::multiprecision::uint128_t;
+		auto lhsWeightedFee = uint128_t(pLhs->pEntity->Fee.unwrap()) * pRhs->pEntity->Size;
+		auto rhsWeightedFee = uint128_t(pRhs->pEntity->Fee.unwrap()) * pLhs->pEntity->Size;
+		if (lhsWeightedFee != rhsWeightedFee)
+			return lhsWeightedFee > rhsWeightedFee;
+
+		return pLhs->Id < pRhs->Id;
+	}
+
+	// endregion
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
+			const TransactionDataPriorityIndex& priorityIndex,
 			const IdLookup& idLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_priorityIndex(priorityIndex)
 			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
@@ -74,6 +92,13 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEachByPriority(const TransactionInfoConsumer& consumer) const {
+		for (const auto* pData : m_priorityIndex) {
+			if (!consumer(*pData))
+				return;
+		}
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -116,12 +141,14 @@ namespace catapult { namespace cache {
 					uint64_t maxCacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
+					TransactionDataPriorityIndex& priorityIndex,
 					IdLookup& idLookup,
 					AccountCounters& counters,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
+					, m_priorityIndex(priorityIndex)
 					, m_idLookup(idLookup)
 					, m_counters(counters)
 					, m_readLock(std::move(readLock))
@@ -134,14 +161,15 @@ namespace catapult { namespace cache {
 			}
 
 			bool add(const model::TransactionInfo& transactionInfo) override {
-				if (m_maxCacheSize <= m_transactionDataContainer.size())
+				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
 					return false;
 
-				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+				if (m_maxCacheSize <= m_transactionDataContainer.size() && !tryEvictLowestPriority(transactionInfo))
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_priorityIndex.insert(&*dataIter);
 
 				m_counters.increment(transactionInfo.pEntity->Signer);
 
@@ -156,11 +184,8 @@ namespace catapult { namespace cache {
 
 				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
 				auto erasedInfo = dataIter->copy();
-
-				m_counters.decrement(dataIter->pEntity->Signer);
-
-				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
+				erase(dataIter);
 				return erasedInfo;
 			}
 
@@ -168,6 +193,24 @@ namespace catapult { namespace cache {
 				return m_counters.count(key);
 			}
 
+			bool canEvictFor(const model::TransactionInfo& transactionInfo) const override {
+				if (m_priorityIndex.empty())
+					return false;
+
+				// the new transaction will be assigned the next (highest) id, so it can only replace the lowest priority
+				// transaction if it has a strictly higher fee density
+				TransactionData candidateData(m_idSequence + 1);
+				candidateData.pEntity = transactionInfo.pEntity;
+				return TransactionDataPriorityComparer()(&candidateData, *--m_priorityIndex.cend());
+			}
+
+			bool canAdd(const model::TransactionInfo& transactionInfo) const override {
+				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+					return false;
+
+				return m_maxCacheSize > m_transactionDataContainer.size() || canEvictFor(transactionInfo);
+			}
+
 			std::vector<model::TransactionInfo> removeAll() override {
 				if (!m_transactionDataContainer.empty())
 					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
@@ -179,18 +222,45 @@ namespace catapult { namespace cache {
 				for (const auto& data : m_transactionDataContainer)
 					transactionInfosCopy.emplace_back(data.copy());
 
+				m_priorityIndex.clear();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_counters.reset();
 				return transactionInfosCopy;
 			}
 
+			std::vector<model::TransactionInfo> takeEvicted() override {
+				std::vector<model::TransactionInfo> evictedTransactionInfos;
+				evictedTransactionInfos.swap(m_evictedTransactionInfos);
+				return evictedTransactionInfos;
+			}
+
+		private:
+			bool tryEvictLowestPriority(const model::TransactionInfo& transactionInfo) {
+				if (!canEvictFor(transactionInfo))
+					return false;
+
+				const auto& lowestData = **--m_priorityIndex.cend();
+				m_evictedTransactionInfos.push_back(lowestData.copy());
+				m_idLookup.erase(lowestData.EntityHash);
+				erase(m_transactionDataContainer.find(lowestData));
+				return true;
+			}
+
+			void erase(TransactionDataContainer::const_iterator dataIter) {
+				m_counters.decrement(dataIter->pEntity->Signer);
+				m_priorityIndex.erase(&*dataIter);
+				m_transactionDataContainer.erase(dataIter);
+			}
+
 		private:
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
+			TransactionDataPriorityIndex& m_priorityIndex;
 			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
+			std::vector<model::TransactionInfo> m_evictedTransactionInfos;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -202,6 +272,7 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
+		TransactionDataPriorityIndex PriorityIndex;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
 	};
@@ -215,7 +286,12 @@ namespace catapult { namespace cache {
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, m_lock.acquireReader());
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->PriorityIndex,
+				m_pImpl->IdLookup,
+				m_lock.acquireReader());
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -223,6 +299,7 @@ namespace catapult { namespace cache {
 				m_options.MaxCacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->PriorityIndex,
 				m_pImpl->IdLookup,
 				m_pImpl->Counters,
 				m_lock.acquireReader()));
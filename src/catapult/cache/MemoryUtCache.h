@@ -36,6 +36,16 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Orders transaction data by descending fee density (fee per byte) and then by ascending arrival.
+	struct TransactionDataPriorityComparer {
+	public:
+		/// Returns \c true if \a pLhs has a higher priority than \a pRhs.
+		bool operator()(const TransactionData* pLhs, const TransactionData* pRhs) const;
+	};
+
+	/// Secondary index of (pointers to) transaction data ordered by priority.
+	using TransactionDataPriorityIndex = std::set<const TransactionData*, TransactionDataPriorityComparer>;
+
 	/// A read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -45,10 +55,12 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), a priority index (\a priorityIndex) and an id lookup (\a idLookup)
+		/// with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
+				const TransactionDataPriorityIndex& priorityIndex,
 				const IdLookup& idLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
@@ -62,6 +74,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos ordered by descending fee density (fee per byte) until all are consumed
+		/// or \c false is returned by consumer.
+		/// \note Transaction infos with equal fee density are ordered by arrival.
+		void forEachByPriority(const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// A short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -72,11 +89,14 @@ namespace catapult { namespace cache {
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
+		const TransactionDataPriorityIndex& m_priorityIndex;
 		const IdLookup& m_idLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Cache for all unconfirmed transactions.
+	/// \note When the cache is full, adding a transaction evicts the lowest priority transaction if the new transaction has
+	///        a higher priority.
 	class MemoryUtCache : public UtCache {
 	public:
 		/// Creates an unconfirmed transactions cache around \a options.
@@ -54,6 +54,11 @@ namespace catapult { namespace cache {
 			typename TPrimaryTypes::BaseSetType Primary;
 
 		public:
+			/// Gets the generation of the primary set.
+			size_t generation() const {
+				return Primary.generation();
+			}
+
 			/// Returns a delta based on the same original elements as this set.
 			BaseSetDeltaPointers rebase() {
 				return { Primary.rebase() };
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/types.h"
 #include <memory>
 #include <string>
 
@@ -45,6 +46,10 @@ namespace catapult { namespace cache {
 
 		/// Returns a read-only view of this view.
 		virtual const void* asReadOnly() const = 0;
+
+		/// Gets the subcache state root (\a stateRoot) and returns \c true if it is available.
+		/// \note State roots are only available for views of subcaches with state root support (and never for deltas).
+		virtual bool tryGetStateRoot(Hash256& stateRoot) const = 0;
 	};
 
 	/// A detached subcache view.
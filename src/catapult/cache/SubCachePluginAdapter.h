@@ -44,7 +44,15 @@ namespace catapult { namespace cache {
 
 	public:
 		std::unique_ptr<const SubCacheView> createView() const override {
-			return std::make_unique<const SubCacheViewAdapter<decltype(m_pCache->createView())>>(m_pCache->createView());
+			using ViewAdapter = SubCacheViewAdapter<decltype(m_pCache->createView())>;
+
+			// capture the state root before creating the view because the view holds a reader lock and reader locks cannot be nested
+			// (the state root is consistent with the view when CatapultCache creates the view because it prevents concurrent commits)
+			Hash256 stateRoot;
+			if (!m_pCache->tryGetStateRoot(stateRoot))
+				return std::make_unique<const ViewAdapter>(m_pCache->createView());
+
+			return std::make_unique<const ViewAdapter>(m_pCache->createView(), stateRoot);
 		}
 
 		std::unique_ptr<SubCacheView> createDelta() override {
@@ -81,7 +89,16 @@ namespace catapult { namespace cache {
 		template<typename TView>
 		class SubCacheViewAdapter : public SubCacheView {
 		public:
-			explicit SubCacheViewAdapter(TView&& view) : m_view(std::move(view))
+			explicit SubCacheViewAdapter(TView&& view)
+					: m_view(std::move(view))
+					, m_hasStateRoot(false)
+					, m_stateRoot()
+			{}
+
+			SubCacheViewAdapter(TView&& view, const Hash256& stateRoot)
+					: m_view(std::move(view))
+					, m_hasStateRoot(true)
+					, m_stateRoot(stateRoot)
 			{}
 
 		public:
@@ -97,8 +114,18 @@ namespace catapult { namespace cache {
 				return &m_view->asReadOnly();
 			}
 
+			bool tryGetStateRoot(Hash256& stateRoot) const override {
+				if (!m_hasStateRoot)
+					return false;
+
+				stateRoot = m_stateRoot;
+				return true;
+			}
+
 		private:
 			TView m_view;
+			bool m_hasStateRoot;
+			Hash256 m_stateRoot;
 		};
 
 		template<typename TLockableCacheDelta>
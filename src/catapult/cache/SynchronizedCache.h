@@ -21,7 +21,12 @@
 #pragma once
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/traits/Traits.h"
+#include "catapult/types.h"
 #include <boost/optional.hpp>
+#include <vector>
+
+namespace catapult { namespace tree { class TreeNode; } }
 
 namespace catapult { namespace cache {
 
@@ -254,6 +259,63 @@ namespace catapult { namespace cache {
 			++m_commitCounter;
 		}
 
+		/// Gets the generation of this cache, which is incremented by every commit that changes the cache.
+		/// \note When the underlying cache does not track changes, every commit is treated as a change.
+		/// \note This does not acquire a lock, so the caller must either hold a view of this cache or be the committing thread.
+		size_t generation() const {
+			return GetGeneration(m_cache, m_commitCounter, GenerationPolicy<TCache>());
+		}
+
+		/// Gets the cache state root (\a stateRoot) and returns \c true if the underlying cache supports state roots.
+		bool tryGetStateRoot(Hash256& stateRoot) const {
+			auto readerLock = m_lock.acquireReader();
+			return TryGetStateRoot(m_cache, stateRoot, StateRootPolicy<TCache>());
+		}
+
+		/// Gets the cache state root (\a stateRoot) and all state tree nodes on the path from the root towards \a key (\a nodePath).
+		/// Returns \c true if state roots are enabled.
+		/// \note This is only supported by caches that support state proofs.
+		template<typename TKey>
+		bool tryLookupWithProof(const TKey& key, Hash256& stateRoot, std::vector<tree::TreeNode>& nodePath) const {
+			auto readerLock = m_lock.acquireReader();
+			return m_cache.tryLookupWithProof(key, stateRoot, nodePath);
+		}
+
+	private:
+		template<typename TContainer, typename = void>
+		struct StateRootPolicy : std::false_type
+		{};
+
+		template<typename TContainer>
+		struct StateRootPolicy<TContainer, typename utils::traits::enable_if_type<decltype(&TContainer::tryGetStateRoot)>::type>
+				: std::true_type
+		{};
+
+		template<typename TContainer, typename = void>
+		struct GenerationPolicy : std::false_type
+		{};
+
+		template<typename TContainer>
+		struct GenerationPolicy<TContainer, typename utils::traits::enable_if_type<decltype(&TContainer::generation)>::type>
+				: std::true_type
+		{};
+
+		static size_t GetGeneration(const TCache&, size_t commitCounter, std::false_type) {
+			return commitCounter;
+		}
+
+		static size_t GetGeneration(const TCache& cache, size_t, std::true_type) {
+			return cache.generation();
+		}
+
+		static bool TryGetStateRoot(const TCache&, Hash256&, std::false_type) {
+			return false;
+		}
+
+		static bool TryGetStateRoot(const TCache& cache, Hash256& stateRoot, std::true_type) {
+			return cache.tryGetStateRoot(stateRoot);
+		}
+
 	private:
 		TCache m_cache;
 		size_t m_commitCounter;
@@ -30,8 +30,17 @@ namespace catapult { namespace cache {
 		/// Gets the number of transactions an account with public \a key has placed into the cache.
 		virtual size_t count(const Key& key) const = 0;
 
+		/// Returns \c true if the lowest priority transaction in the cache can be evicted to make room for \a transactionInfo.
+		virtual bool canEvictFor(const model::TransactionInfo& transactionInfo) const = 0;
+
+		/// Returns \c true if \a transactionInfo is not in the cache and can be added to it (possibly by evicting a transaction).
+		virtual bool canAdd(const model::TransactionInfo& transactionInfo) const = 0;
+
 		/// Removes all transactions from the cache.
 		virtual std::vector<model::TransactionInfo> removeAll() = 0;
+
+		/// Gets and clears all transactions that have been evicted from the cache to make room for higher priority transactions.
+		virtual std::vector<model::TransactionInfo> takeEvicted() = 0;
 	};
 
 	/// A delegating proxy around a UtCacheModifier.
@@ -46,10 +55,25 @@ namespace catapult { namespace cache {
 			return modifier().count(key);
 		}
 
+		/// Returns \c true if the lowest priority transaction in the cache can be evicted to make room for \a transactionInfo.
+		bool canEvictFor(const model::TransactionInfo& transactionInfo) const {
+			return modifier().canEvictFor(transactionInfo);
+		}
+
+		/// Returns \c true if \a transactionInfo is not in the cache and can be added to it (possibly by evicting a transaction).
+		bool canAdd(const model::TransactionInfo& transactionInfo) const {
+			return modifier().canAdd(transactionInfo);
+		}
+
 		/// Removes all transactions from the cache.
 		std::vector<model::TransactionInfo> removeAll() {
 			return modifier().removeAll();
 		}
+
+		/// Gets and clears all transactions that have been evicted from the cache to make room for higher priority transactions.
+		std::vector<model::TransactionInfo> takeEvicted() {
+			return modifier().takeEvicted();
+		}
 	};
 
 	/// An interface for caching unconfirmed transactions.
@@ -0,0 +1,75 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AccountStateCache.h"
+#include "catapult/state/AccountStateAdapter.h"
+#include <atomic>
+#include <chrono>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		const Address& GetPatriciaTreeKey(const state::AccountState& accountState) {
+			return accountState.Address;
+		}
+
+		void SavePatriciaTreeValue(const state::AccountState& accountState, io::OutputStream& output) {
+			// serialize account states the same way as AccountStateCacheStorage
+			auto pAccountInfo = state::ToAccountInfo(accountState);
+			output.write({ reinterpret_cast<const uint8_t*>(pAccountInfo.get()), pAccountInfo->Size });
+		}
+
+		struct CommitCounters {
+			std::atomic<uint64_t> NumCommits;
+			std::atomic<uint64_t> NumAccounts;
+			std::atomic<uint64_t> NumMicros;
+		};
+
+		CommitCounters& GetCommitCounters() {
+			static CommitCounters counters{};
+			return counters;
+		}
+	}
+
+	AccountStateCacheCommitStatistics GetAccountStateCacheCommitStatistics() {
+		const auto& counters = GetCommitCounters();
+		return { counters.NumCommits.load(), counters.NumAccounts.load(), counters.NumMicros.load() };
+	}
+
+	void BasicAccountStateCache::commit(const CacheDeltaType& delta) {
+		auto start = std::chrono::steady_clock::now();
+		auto numAccounts = delta.numChangedAccounts();
+
+		// high value accounts and patricia tree need to be updated before committing because committing clears the deltas
+		delta.updateHighValueAccounts(*m_pHighValueAccounts);
+
+		auto* pTree = patriciaTree();
+		if (pTree)
+			UpdatePatriciaTree(*pTree, delta, GetPatriciaTreeKey, SavePatriciaTreeValue);
+
+		AccountStateBasicCache::commit(delta);
+
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		auto& counters = GetCommitCounters();
+		++counters.NumCommits;
+		counters.NumAccounts += numAccounts;
+		counters.NumMicros += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+	}
+}}
@@ -21,46 +21,61 @@
 #pragma once
 #include "AccountStateCacheDelta.h"
 #include "AccountStateCacheView.h"
+#include "HighValueAccounts.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/cache/CachePatriciaTree.h"
 
 namespace catapult { namespace cache {
 
+	/// Commit statistics of all account state caches.
+	struct AccountStateCacheCommitStatistics {
+		/// Number of commits.
+		uint64_t NumCommits;
+
+		/// Number of added, modified and removed accounts that were committed.
+		uint64_t NumAccounts;
+
+		/// Total commit time in microseconds.
+		uint64_t NumMicros;
+	};
+
+	/// Gets the commit statistics of all account state caches.
+	AccountStateCacheCommitStatistics GetAccountStateCacheCommitStatistics();
+
 	using AccountStateBasicCache = BasicCache<
 		AccountStateCacheDescriptor,
 		AccountStateCacheTypes::BaseSets,
 		AccountStateCacheTypes::Options,
-		const model::AddressSet&>;
+		const HighValueAccounts&>;
 
 	/// Cache composed of stateful account information.
-	class BasicAccountStateCache : public AccountStateBasicCache {
+	class BasicAccountStateCache
+			: public AccountStateBasicCache
+			, public PatriciaTreeCacheMixin {
 	public:
 		/// Creates a cache around \a config and \a options.
 		explicit BasicAccountStateCache(const CacheConfiguration& config, const AccountStateCacheTypes::Options& options)
-				: BasicAccountStateCache(config, options, std::make_unique<model::AddressSet>())
+				: BasicAccountStateCache(config, options, std::make_unique<HighValueAccounts>())
 		{}
 
 	private:
 		BasicAccountStateCache(
 				const CacheConfiguration& config,
 				const AccountStateCacheTypes::Options& options,
-				std::unique_ptr<model::AddressSet>&& pHighValueAddresses)
-				: AccountStateBasicCache(config, AccountStateCacheTypes::Options(options), *pHighValueAddresses)
-				, m_pHighValueAddresses(std::move(pHighValueAddresses))
+				std::unique_ptr<HighValueAccounts>&& pHighValueAccounts)
+				: AccountStateBasicCache(config, AccountStateCacheTypes::Options(options), *pHighValueAccounts)
+				, PatriciaTreeCacheMixin(config)
+				, m_pHighValueAccounts(std::move(pHighValueAccounts))
 		{}
 
 	public:
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides AccountStateBasicCache::commit.
-		void commit(const CacheDeltaType& delta) {
-			// high value addresses need to be captured before committing because committing clears the deltas
-			auto highValueAddresses = delta.highValueAddresses();
-			AccountStateBasicCache::commit(delta);
-			*m_pHighValueAddresses = std::move(highValueAddresses);
-		}
+		void commit(const CacheDeltaType& delta);
 
 	private:
-		// unique pointer to allow set reference to be valid after moves of this cache
-		std::unique_ptr<model::AddressSet> m_pHighValueAddresses;
+		// unique pointer to allow reference to be valid after moves of this cache
+		std::unique_ptr<HighValueAccounts> m_pHighValueAccounts;
 	};
 
 	/// Synchronized cache composed of stateful account information.
@@ -21,6 +21,7 @@
 #include "AccountStateCacheDelta.h"
 #include "catapult/model/Address.h"
 #include "catapult/state/AccountStateAdapter.h"
+#include "catapult/state/AccountStatePool.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/functions.h"
@@ -30,11 +31,11 @@ namespace catapult { namespace cache {
 	BasicAccountStateCacheDelta::BasicAccountStateCacheDelta(
 			const AccountStateCacheTypes::BaseSetDeltaPointers& accountStateSets,
 			const AccountStateCacheTypes::Options& options,
-			const model::AddressSet& highValueAddresses)
+			const HighValueAccounts& highValueAccounts)
 			: BasicAccountStateCacheDelta(
 					accountStateSets,
 					options,
-					highValueAddresses,
+					highValueAccounts,
 					std::make_unique<AccountStateCacheDeltaMixins::KeyLookupAdapter>(
 							*accountStateSets.pKeyLookupMap,
 							*accountStateSets.pPrimary))
@@ -43,7 +44,7 @@ namespace catapult { namespace cache {
 	BasicAccountStateCacheDelta::BasicAccountStateCacheDelta(
 			const AccountStateCacheTypes::BaseSetDeltaPointers& accountStateSets,
 			const AccountStateCacheTypes::Options& options,
-			const model::AddressSet& highValueAddresses,
+			const HighValueAccounts& highValueAccounts,
 			std::unique_ptr<AccountStateCacheDeltaMixins::KeyLookupAdapter>&& pKeyLookupAdapter)
 			: AccountStateCacheDeltaMixins::Size(*accountStateSets.pPrimary)
 			, AccountStateCacheDeltaMixins::ContainsAddress(*accountStateSets.pPrimary)
@@ -56,7 +57,7 @@ namespace catapult { namespace cache {
 			, m_pStateByAddress(accountStateSets.pPrimary)
 			, m_pKeyToAddress(accountStateSets.pKeyLookupMap)
 			, m_options(options)
-			, m_highValueAddresses(highValueAddresses)
+			, m_highValueAccounts(highValueAccounts)
 			, m_pKeyLookupAdapter(std::move(pKeyLookupAdapter))
 	{}
 
@@ -83,7 +84,7 @@ namespace catapult { namespace cache {
 		if (pCurrentState)
 			return *pCurrentState;
 
-		auto pAccountState = std::make_shared<state::AccountState>(address, height);
+		auto pAccountState = state::MakePooledAccountState(address, height);
 		m_pStateByAddress->insert(pAccountState);
 		return *pAccountState;
 	}
@@ -104,7 +105,15 @@ namespace catapult { namespace cache {
 		if (pCurrentState)
 			return *pCurrentState;
 
-		auto pAccountState = std::make_shared<state::AccountState>(state::ToAccountState(accountInfo));
+		return addAccount(state::ToAccountState(accountInfo));
+	}
+
+	state::AccountState& BasicAccountStateCacheDelta::addAccount(state::AccountState&& accountState) {
+		auto* pCurrentState = this->tryGet(accountState.Address);
+		if (pCurrentState)
+			return *pCurrentState;
+
+		auto pAccountState = state::MakePooledAccountState(std::move(accountState));
 		if (Height(0) != pAccountState->PublicKeyHeight)
 			m_pKeyToAddress->emplace(pAccountState->PublicKey, pAccountState->Address);
 
@@ -164,6 +173,10 @@ namespace catapult { namespace cache {
 	namespace {
 		using DeltasSet = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
 
+		bool HasHighValue(const state::AccountState& accountState, Amount minBalance) {
+			return accountState.Balances.get(Xem_Id) >= minBalance;
+		}
+
 		void UpdateAddresses(model::AddressSet& addresses, const DeltasSet& source, const predicate<const state::AccountState&>& include) {
 			for (const auto& pair : source) {
 				const auto& accountState = *pair.second;
@@ -177,11 +190,13 @@ namespace catapult { namespace cache {
 
 	model::AddressSet BasicAccountStateCacheDelta::highValueAddresses() const {
 		// 1. copy original high value addresses
-		auto highValueAddresses = m_highValueAddresses;
+		model::AddressSet highValueAddresses;
+		for (const auto& pair : m_highValueAccounts.balances())
+			highValueAddresses.insert(pair.first);
 
 		// 2. update for changes
 		auto hasHighValue = [minBalance = m_options.MinHighValueAccountBalance](const auto& accountState) {
-			return accountState.Balances.get(Xem_Id) >= minBalance;
+			return HasHighValue(accountState, minBalance);
 		};
 
 		auto deltas = m_pStateByAddress->deltas();
@@ -190,4 +205,40 @@ namespace catapult { namespace cache {
 		UpdateAddresses(highValueAddresses, deltas.Removed, [](const auto&) { return false; });
 		return highValueAddresses;
 	}
+
+	Amount BasicAccountStateCacheDelta::highValueBalance() const {
+		return m_highValueAccounts.calculateBalance(m_pStateByAddress->deltas(), m_options.MinHighValueAccountBalance);
+	}
+
+	void BasicAccountStateCacheDelta::forEachHighValueAccount(const consumer<state::AccountState&>& consumer) {
+		auto minBalance = m_options.MinHighValueAccountBalance;
+
+		// 1. visit committed high value accounts that have not been removed and are still high value
+		//    (notice that this can add copies to the deltas, so the deltas are visited afterwards)
+		for (const auto& pair : m_highValueAccounts.balances()) {
+			auto pAccountState = m_pStateByAddress->find(pair.first);
+			if (pAccountState && HasHighValue(*pAccountState, minBalance))
+				consumer(*pAccountState);
+		}
+
+		// 2. visit changed accounts that have become high value
+		//    (all copied accounts that are committed high value accounts have already been visited)
+		auto deltas = m_pStateByAddress->deltas();
+		for (const auto* pSource : { &deltas.Added, &deltas.Copied }) {
+			for (const auto& pair : *pSource) {
+				auto& accountState = *pair.second;
+				if (HasHighValue(accountState, minBalance) && !m_highValueAccounts.contains(accountState.Address))
+					consumer(accountState);
+			}
+		}
+	}
+
+	void BasicAccountStateCacheDelta::updateHighValueAccounts(HighValueAccounts& highValueAccounts) const {
+		highValueAccounts.update(m_pStateByAddress->deltas(), m_options.MinHighValueAccountBalance);
+	}
+
+	size_t BasicAccountStateCacheDelta::numChangedAccounts() const {
+		auto deltas = m_pStateByAddress->deltas();
+		return deltas.Added.size() + deltas.Copied.size() + deltas.Removed.size();
+	}
 }}
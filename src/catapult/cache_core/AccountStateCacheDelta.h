@@ -20,10 +20,12 @@
 
 #pragma once
 #include "AccountStateCacheTypes.h"
+#include "HighValueAccounts.h"
 #include "ReadOnlyAccountStateCache.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/model/ContainerTypes.h"
+#include "catapult/functions.h"
 
 namespace catapult { namespace model { struct AccountInfo; } }
 
@@ -68,17 +70,17 @@ namespace catapult { namespace cache {
 		using ReadOnlyView = ReadOnlyAccountStateCache;
 
 	public:
-		/// Creates a delta around \a accountStateSets, \a options and \a highValueAddresses.
+		/// Creates a delta around \a accountStateSets, \a options and \a highValueAccounts.
 		BasicAccountStateCacheDelta(
 				const AccountStateCacheTypes::BaseSetDeltaPointers& accountStateSets,
 				const AccountStateCacheTypes::Options& options,
-				const model::AddressSet& highValueAddresses);
+				const HighValueAccounts& highValueAccounts);
 
 	private:
 		BasicAccountStateCacheDelta(
 				const AccountStateCacheTypes::BaseSetDeltaPointers& accountStateSets,
 				const AccountStateCacheTypes::Options& options,
-				const model::AddressSet& highValueAddresses,
+				const HighValueAccounts& highValueAccounts,
 				std::unique_ptr<AccountStateCacheDeltaMixins::KeyLookupAdapter>&& pKeyLookupAdapter);
 
 	public:
@@ -116,6 +118,10 @@ namespace catapult { namespace cache {
 		/// Returns an account state.
 		state::AccountState& addAccount(const model::AccountInfo& accountInfo);
 
+		/// If not present, adds \a accountState to the cache.
+		/// Returns an account state.
+		state::AccountState& addAccount(state::AccountState&& accountState);
+
 	public:
 		/// If \a height matches the height at which account was added, queues removal of account's \a address
 		/// information from the cache, therefore queuing complete removal of the account from the cache.
@@ -132,6 +138,19 @@ namespace catapult { namespace cache {
 		/// Gets all high value addresses.
 		model::AddressSet highValueAddresses() const;
 
+		/// Gets the total balance of all high value accounts.
+		Amount highValueBalance() const;
+
+		/// Calls \a consumer with (mutable) account states of all high value accounts.
+		void forEachHighValueAccount(const consumer<state::AccountState&>& consumer);
+
+		/// Applies all pending changes to \a highValueAccounts.
+		/// \note This needs to be called before pending changes are committed.
+		void updateHighValueAccounts(HighValueAccounts& highValueAccounts) const;
+
+		/// Gets the number of added, modified and removed accounts.
+		size_t numChangedAccounts() const;
+
 	private:
 		Address getAddress(const Key& publicKey);
 
@@ -160,7 +179,7 @@ namespace catapult { namespace cache {
 		AccountStateCacheTypes::KeyLookupMapTypes::BaseSetDeltaPointerType m_pKeyToAddress;
 
 		const AccountStateCacheTypes::Options& m_options;
-		const model::AddressSet& m_highValueAddresses;
+		const HighValueAccounts& m_highValueAccounts;
 		std::unique_ptr<AccountStateCacheDeltaMixins::KeyLookupAdapter> m_pKeyLookupAdapter;
 
 		QueuedRemovalSet<Address> m_queuedRemoveByAddress;
@@ -170,12 +189,12 @@ namespace catapult { namespace cache {
 	/// Delta on top of the account state cache.
 	class AccountStateCacheDelta : public ReadOnlyViewSupplier<BasicAccountStateCacheDelta> {
 	public:
-		/// Creates a delta around \a accountStateSets, \a options and \a highValueAddresses.
+		/// Creates a delta around \a accountStateSets, \a options and \a highValueAccounts.
 		AccountStateCacheDelta(
 				const AccountStateCacheTypes::BaseSetDeltaPointers& accountStateSets,
 				const AccountStateCacheTypes::Options& options,
-				const model::AddressSet& highValueAddresses)
-				: ReadOnlyViewSupplier(accountStateSets, options, highValueAddresses)
+				const HighValueAccounts& highValueAccounts)
+				: ReadOnlyViewSupplier(accountStateSets, options, highValueAccounts)
 		{}
 	};
 }}
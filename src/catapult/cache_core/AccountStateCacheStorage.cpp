@@ -67,4 +67,12 @@ namespace catapult { namespace cache {
 		ReadAccountInfo(input, accountInfoSize, accountInfo);
 		cacheDelta.addAccount(accountInfo);
 	}
+
+	state::AccountState AccountStateCacheStorage::Parse(const std::unique_ptr<model::AccountInfo>& pAccountInfo) {
+		return state::ToAccountState(*pAccountInfo);
+	}
+
+	void AccountStateCacheStorage::AddParsed(DestinationType& cacheDelta, state::AccountState&& accountState) {
+		cacheDelta.addAccount(std::move(accountState));
+	}
 }}
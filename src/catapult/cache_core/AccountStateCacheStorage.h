@@ -21,6 +21,7 @@
 #pragma once
 #include "AccountStateCache.h"
 #include "catapult/cache/CacheStorageInclude.h"
+#include "catapult/model/AccountInfo.h"
 #include <vector>
 
 namespace catapult { namespace cache {
@@ -28,6 +29,7 @@ namespace catapult { namespace cache {
 	/// Policy for saving and loading account state cache data.
 	struct AccountStateCacheStorage : public MapCacheStorageFromDescriptor<AccountStateCacheDescriptor> {
 		using LoadStateType = std::vector<uint8_t>;
+		using ParsedType = state::AccountState;
 
 		/// Saves \a element to \a output.
 		static void Save(const StorageType& element, io::OutputStream& output);
@@ -37,5 +39,11 @@ namespace catapult { namespace cache {
 
 		/// Loads a single value from \a input into \a cacheDelta using \a state.
 		static void LoadInto(io::InputStream& input, DestinationType& cacheDelta, LoadStateType& state);
+
+		/// Parses a single value (\a pAccountInfo) previously loaded by Load.
+		static state::AccountState Parse(const std::unique_ptr<model::AccountInfo>& pAccountInfo);
+
+		/// Adds a single parsed value (\a accountState) to \a cacheDelta.
+		static void AddParsed(DestinationType& cacheDelta, state::AccountState&& accountState);
 	};
 }}
@@ -23,7 +23,7 @@
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/deltaset/BaseSetDelta.h"
 #include "catapult/model/NetworkInfo.h"
-#include "catapult/state/AccountState.h"
+#include "catapult/state/AccountStatePool.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/Hashers.h"
 
@@ -157,8 +157,20 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region element traits
+
+	private:
+		// account state copies made by deltas are allocated from the same pool as all other account states
+		struct AccountStateElementTraits : public deltaset::MutableTypeTraits<AccountStateCacheDescriptor::ValueType> {
+			static AccountStateCacheDescriptor::ValueType Copy(const std::shared_ptr<const state::AccountState>& pAccountState) {
+				return state::MakePooledAccountState(*pAccountState);
+			}
+		};
+
+	// endregion
+
 	public:
-		using PrimaryTypes = MutableUnorderedMapAdapter<AccountStateCacheDescriptor, utils::ArrayHasher<Address>>;
+		using PrimaryTypes = detail::UnorderedMapAdapter<AccountStateElementTraits, AccountStateCacheDescriptor, utils::ArrayHasher<Address>>;
 		using KeyLookupMapTypes = ImmutableUnorderedMapAdapter<KeyLookupMapTypesDescriptor, utils::ArrayHasher<Key>>;
 
 	public:
@@ -198,6 +210,10 @@ namespace catapult { namespace cache {
 			KeyLookupMapTypes::BaseSetType KeyLookupMap;
 
 		public:
+			size_t generation() const {
+				return Primary.generation();
+			}
+
 			BaseSetDeltaPointers rebase() {
 				return { Primary.rebase(), KeyLookupMap.rebase() };
 			}
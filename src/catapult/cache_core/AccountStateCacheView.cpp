@@ -27,11 +27,11 @@ namespace catapult { namespace cache {
 	BasicAccountStateCacheView::BasicAccountStateCacheView(
 			const AccountStateCacheTypes::BaseSets& accountStateSets,
 			const AccountStateCacheTypes::Options& options,
-			const model::AddressSet& highValueAddresses)
+			const HighValueAccounts& highValueAccounts)
 			: BasicAccountStateCacheView(
 					accountStateSets,
 					options,
-					highValueAddresses,
+					highValueAccounts,
 					std::make_unique<AccountStateCacheViewMixins::KeyLookupAdapter>(
 							accountStateSets.KeyLookupMap,
 							accountStateSets.Primary))
@@ -40,7 +40,7 @@ namespace catapult { namespace cache {
 	BasicAccountStateCacheView::BasicAccountStateCacheView(
 			const AccountStateCacheTypes::BaseSets& accountStateSets,
 			const AccountStateCacheTypes::Options& options,
-			const model::AddressSet& highValueAddresses,
+			const HighValueAccounts& highValueAccounts,
 			std::unique_ptr<AccountStateCacheViewMixins::KeyLookupAdapter>&& pKeyLookupAdapter)
 			: AccountStateCacheViewMixins::Size(accountStateSets.Primary)
 			, AccountStateCacheViewMixins::ContainsAddress(accountStateSets.Primary)
@@ -50,7 +50,7 @@ namespace catapult { namespace cache {
 			, AccountStateCacheViewMixins::ConstAccessorKey(*pKeyLookupAdapter)
 			, m_networkIdentifier(options.NetworkIdentifier)
 			, m_importanceGrouping(options.ImportanceGrouping)
-			, m_highValueAddresses(highValueAddresses)
+			, m_highValueAccounts(highValueAccounts)
 			, m_pKeyLookupAdapter(std::move(pKeyLookupAdapter))
 	{}
 
@@ -63,6 +63,6 @@ namespace catapult { namespace cache {
 	}
 
 	size_t BasicAccountStateCacheView::highValueAddressesSize() const {
-		return m_highValueAddresses.size();
+		return m_highValueAccounts.size();
 	}
 }}
@@ -20,10 +20,10 @@
 
 #pragma once
 #include "AccountStateCacheTypes.h"
+#include "HighValueAccounts.h"
 #include "ReadOnlyAccountStateCache.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
-#include "catapult/model/ContainerTypes.h"
 
 namespace catapult { namespace cache {
 
@@ -60,17 +60,17 @@ namespace catapult { namespace cache {
 		using ReadOnlyView = ReadOnlyAccountStateCache;
 
 	public:
-		/// Creates a view around \a accountStateSets, \a options and \a highValueAddresses.
+		/// Creates a view around \a accountStateSets, \a options and \a highValueAccounts.
 		BasicAccountStateCacheView(
 				const AccountStateCacheTypes::BaseSets& accountStateSets,
 				const AccountStateCacheTypes::Options& options,
-				const model::AddressSet& highValueAddresses);
+				const HighValueAccounts& highValueAccounts);
 
 	private:
 		BasicAccountStateCacheView(
 				const AccountStateCacheTypes::BaseSets& accountStateSets,
 				const AccountStateCacheTypes::Options& options,
-				const model::AddressSet& highValueAddresses,
+				const HighValueAccounts& highValueAccounts,
 				std::unique_ptr<AccountStateCacheViewMixins::KeyLookupAdapter>&& pKeyLookupAdapter);
 
 	public:
@@ -97,19 +97,19 @@ namespace catapult { namespace cache {
 	private:
 		const model::NetworkIdentifier m_networkIdentifier;
 		const uint64_t m_importanceGrouping;
-		const model::AddressSet& m_highValueAddresses;
+		const HighValueAccounts& m_highValueAccounts;
 		std::unique_ptr<AccountStateCacheViewMixins::KeyLookupAdapter> m_pKeyLookupAdapter;
 	};
 
 	/// View on top of the account state cache.
 	class AccountStateCacheView : public ReadOnlyViewSupplier<BasicAccountStateCacheView> {
 	public:
-		/// Creates a view around \a accountStateSets, \a options and \a highValueAddresses.
+		/// Creates a view around \a accountStateSets, \a options and \a highValueAccounts.
 		AccountStateCacheView(
 				const AccountStateCacheTypes::BaseSets& accountStateSets,
 				const AccountStateCacheTypes::Options& options,
-				const model::AddressSet& highValueAddresses)
-				: ReadOnlyViewSupplier(accountStateSets, options, highValueAddresses)
+				const HighValueAccounts& highValueAccounts)
+				: ReadOnlyViewSupplier(accountStateSets, options, highValueAccounts)
 		{}
 	};
 }}
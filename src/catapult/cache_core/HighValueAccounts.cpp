@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HighValueAccounts.h"
+#include "catapult/constants.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		using DeltasSet = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::MemorySetType;
+
+		bool IsHighValue(Amount balance, Amount minBalance) {
+			return balance >= minBalance;
+		}
+
+		Amount GetHighValueBalance(const state::AccountState& accountState, Amount minBalance) {
+			auto balance = accountState.Balances.get(Xem_Id);
+			return IsHighValue(balance, minBalance) ? balance : Amount(0);
+		}
+	}
+
+	size_t HighValueAccounts::size() const {
+		return m_balances.size();
+	}
+
+	Amount HighValueAccounts::balance() const {
+		return m_balance;
+	}
+
+	const HighValueAccounts::BalanceMap& HighValueAccounts::balances() const {
+		return m_balances;
+	}
+
+	bool HighValueAccounts::contains(const Address& address) const {
+		return m_balances.cend() != m_balances.find(address);
+	}
+
+	Amount HighValueAccounts::calculateBalance(const DeltaElements& deltas, Amount minBalance) const {
+		// added accounts do not have committed contributions
+		auto balance = m_balance;
+		for (const auto& pair : deltas.Added)
+			balance = balance + GetHighValueBalance(*pair.second, minBalance);
+
+		// copied and removed accounts replace their committed contributions (if any)
+		auto getCommittedBalance = [&balances = m_balances](const auto& address) {
+			auto iter = balances.find(address);
+			return balances.cend() == iter ? Amount(0) : iter->second;
+		};
+
+		for (const auto& pair : deltas.Copied)
+			balance = balance + GetHighValueBalance(*pair.second, minBalance) - getCommittedBalance(pair.first);
+
+		for (const auto& pair : deltas.Removed)
+			balance = balance - getCommittedBalance(pair.first);
+
+		return balance;
+	}
+
+	void HighValueAccounts::update(const DeltaElements& deltas, Amount minBalance) {
+		m_balance = calculateBalance(deltas, minBalance);
+
+		auto updateAll = [&balances = m_balances, minBalance](const DeltasSet& source) {
+			for (const auto& pair : source) {
+				auto balance = pair.second->Balances.get(Xem_Id);
+				if (IsHighValue(balance, minBalance))
+					balances[pair.first] = balance;
+				else
+					balances.erase(pair.first);
+			}
+		};
+
+		updateAll(deltas.Added);
+		updateAll(deltas.Copied);
+
+		for (const auto& pair : deltas.Removed)
+			m_balances.erase(pair.first);
+	}
+}}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "AccountStateCacheTypes.h"
+#include "catapult/deltaset/DeltaElements.h"
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	/// Committed high value accounts and their total balance.
+	/// \note Balances are the xem balances of the accounts at the time of the last commit.
+	class HighValueAccounts {
+	public:
+		/// Map of high value account addresses to balances.
+		using BalanceMap = std::unordered_map<Address, Amount, utils::ArrayHasher<Address>>;
+
+		/// Account state delta elements.
+		using DeltaElements = deltaset::DeltaElements<AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::MemorySetType>;
+
+	public:
+		/// Creates empty high value accounts.
+		HighValueAccounts() = default;
+
+	public:
+		/// Gets the number of high value accounts.
+		size_t size() const;
+
+		/// Gets the total balance of all high value accounts.
+		Amount balance() const;
+
+		/// Gets the balances of all high value accounts.
+		const BalanceMap& balances() const;
+
+		/// Returns \c true if the account with \a address is a high value account.
+		bool contains(const Address& address) const;
+
+	public:
+		/// Calculates the total balance of all high value accounts after applying \a deltas
+		/// given the minimum high value account balance (\a minBalance).
+		/// \note Only changed accounts are inspected.
+		Amount calculateBalance(const DeltaElements& deltas, Amount minBalance) const;
+
+		/// Applies \a deltas given the minimum high value account balance (\a minBalance).
+		void update(const DeltaElements& deltas, Amount minBalance);
+
+	private:
+		BalanceMap m_balances;
+		Amount m_balance;
+	};
+}}
@@ -40,6 +40,10 @@ namespace catapult { namespace cache {
 				: static_cast<size_t>(*reinterpret_cast<const uint64_t*>(iter.storage().data()));
 	}
 
+	RocksDatabase& RdbColumnContainer::database() {
+		return m_database;
+	}
+
 	size_t RdbColumnContainer::size() const {
 		return m_size;
 	}
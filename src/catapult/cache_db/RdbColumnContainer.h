@@ -37,6 +37,9 @@ namespace catapult { namespace cache {
 		RdbColumnContainer(RocksDatabase& database, size_t columnId);
 
 	public:
+		/// Returns the underlying database.
+		RocksDatabase& database();
+
 		/// Returns size of the column.
 		size_t size() const;
 
@@ -95,6 +95,11 @@ namespace catapult { namespace cache {
 		{}
 
 	public:
+		/// Returns the underlying database.
+		auto& database() {
+			return m_container.database();
+		}
+
 		/// Returns size of the container.
 		size_t size() const {
 			return m_container.size();
@@ -66,7 +66,10 @@ namespace catapult { namespace cache {
 		return { reinterpret_cast<const uint8_t*>(storage().data()), storage().size() };
 	}
 
-	RocksDatabase::RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames) : m_dbDir(dbDir) {
+	RocksDatabase::RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames)
+			: m_dbDir(dbDir)
+			, m_batchDepth(0)
+			, m_isWriteAheadLogEnabled(true) {
 		boost::system::error_code ec;
 		boost::filesystem::create_directories(dbDir, ec);
 
@@ -110,7 +113,12 @@ namespace catapult { namespace cache {
 	}
 
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
-		auto status = m_pDb->Put(rocksdb::WriteOptions(), m_handles[columnId], key, value);
+		if (isBatchActive()) {
+			m_pWriteBatch->Put(m_handles[columnId], key, value);
+			return;
+		}
+
+		auto status = m_pDb->Put(writeOptions(), m_handles[columnId], key, value);
 
 		if (!status.ok())
 			ThrowError("could not store value in db (column, key)", columnId, key);
@@ -119,9 +127,72 @@ namespace catapult { namespace cache {
 	void RocksDatabase::del(size_t columnId, const rocksdb::Slice& key) {
 		// note: using SingleDelete can result in undefined result if value has ever been overwritten
 		// that can't be guaranteed, so Delete is used instead
-		auto status = m_pDb->Delete(rocksdb::WriteOptions(), m_handles[columnId], key);
+		if (isBatchActive()) {
+			m_pWriteBatch->Delete(m_handles[columnId], key);
+			return;
+		}
+
+		auto status = m_pDb->Delete(writeOptions(), m_handles[columnId], key);
 
 		if (!status.ok())
 			ThrowError("could not remove value from db (column, key)", columnId, key);
 	}
+
+	bool RocksDatabase::isBatchActive() const {
+		return 0 != m_batchDepth;
+	}
+
+	void RocksDatabase::beginBatch() {
+		if (!m_pWriteBatch)
+			m_pWriteBatch = std::make_unique<rocksdb::WriteBatch>();
+
+		++m_batchDepth;
+	}
+
+	void RocksDatabase::flushBatch() {
+		if (!isBatchActive())
+			CATAPULT_THROW_RUNTIME_ERROR("cannot flush batch because no batch is active");
+
+		if (0 != --m_batchDepth)
+			return;
+
+		auto status = m_pDb->Write(writeOptions(), m_pWriteBatch.get());
+		m_pWriteBatch->Clear();
+
+		if (!status.ok())
+			CATAPULT_THROW_RUNTIME_ERROR_2("could not write batch to db", m_dbDir, status.ToString());
+	}
+
+	void RocksDatabase::discardBatch() {
+		if (m_pWriteBatch)
+			m_pWriteBatch->Clear();
+
+		m_batchDepth = 0;
+	}
+
+	void RocksDatabase::setWriteAheadLogEnabled(bool isEnabled) {
+		m_isWriteAheadLogEnabled = isEnabled;
+	}
+
+	rocksdb::WriteOptions RocksDatabase::writeOptions() const {
+		rocksdb::WriteOptions options;
+		options.disableWAL = !m_isWriteAheadLogEnabled;
+		return options;
+	}
+
+	RdbWriteBatchGuard::RdbWriteBatchGuard(RocksDatabase& database)
+			: m_database(database)
+			, m_isCommitted(false) {
+		m_database.beginBatch();
+	}
+
+	RdbWriteBatchGuard::~RdbWriteBatchGuard() {
+		if (!m_isCommitted)
+			m_database.discardBatch();
+	}
+
+	void RdbWriteBatchGuard::commit() {
+		m_isCommitted = true;
+		m_database.flushBatch();
+	}
 }}
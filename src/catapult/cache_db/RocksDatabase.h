@@ -29,6 +29,8 @@ namespace rocksdb {
 	class DB;
 	class PinnableSlice;
 	class Slice;
+	class WriteBatch;
+	struct WriteOptions;
 }
 
 namespace catapult { namespace cache {
@@ -96,9 +98,55 @@ namespace catapult { namespace cache {
 		/// Deletes \a key from \a columnId.
 		void del(size_t columnId, const rocksdb::Slice& key);
 
+	public:
+		/// Returns \c true if writes are currently being batched.
+		bool isBatchActive() const;
+
+		/// Starts batching all subsequent puts and deletes (across all columns).
+		/// \note Batches can be nested and batched writes are only applied when the outermost batch is flushed.
+		/// \note Batched writes are not visible to reads until they are applied.
+		void beginBatch();
+
+		/// Ends the innermost batch and atomically applies all batched writes if it is the outermost batch.
+		void flushBatch();
+
+		/// Drops all batched writes and ends all active batches.
+		void discardBatch();
+
+		/// Sets whether or not writes should be recorded in the write ahead log (\a isEnabled).
+		/// \note Disabling the write ahead log speeds up bulk writes (e.g. during replay) at the expense of durability
+		///       of writes that have not been flushed from memory.
+		void setWriteAheadLogEnabled(bool isEnabled);
+
+	private:
+		rocksdb::WriteOptions writeOptions() const;
+
 	private:
 		std::string m_dbDir;
 		std::shared_ptr<rocksdb::DB> m_pDb;
 		std::vector<rocksdb::ColumnFamilyHandle*> m_handles;
+		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
+		size_t m_batchDepth;
+		bool m_isWriteAheadLogEnabled;
+	};
+
+	/// RAII guard that batches all writes to a database and atomically applies them when committed.
+	/// \note When the guard is destroyed without being committed, all batched writes (including ones from outer batches)
+	///       are discarded.
+	class RdbWriteBatchGuard {
+	public:
+		/// Creates a guard around \a database.
+		explicit RdbWriteBatchGuard(RocksDatabase& database);
+
+		/// Destroys the guard.
+		~RdbWriteBatchGuard();
+
+	public:
+		/// Commits all batched writes.
+		void commit();
+
+	private:
+		RocksDatabase& m_database;
+		bool m_isCommitted;
 	};
 }}
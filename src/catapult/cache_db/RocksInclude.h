@@ -26,6 +26,7 @@
 #endif
 
 #include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -25,8 +25,10 @@
 namespace catapult { namespace cache {
 
 	/// Applies all changes in \a deltas to \a elements.
+	/// \note All changes (including the size update) are applied atomically with a single database write.
 	template<typename TKeyTraits, typename TDescriptor, typename TContainer, typename TMemorySet>
 	void UpdateSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const deltaset::DeltaElements<TMemorySet>& deltas) {
+		RdbWriteBatchGuard batchGuard(elements.database());
 		auto size = elements.size();
 
 		for (const auto& added : deltas.Added)
@@ -41,5 +43,6 @@ namespace catapult { namespace cache {
 		size += deltas.Added.size();
 		size -= deltas.Removed.size();
 		elements.saveSize(size);
+		batchGuard.commit();
 	}
 }}
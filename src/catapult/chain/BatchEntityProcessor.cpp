@@ -19,8 +19,12 @@
 **/
 
 #include "BatchEntityProcessor.h"
+#include "ConflictFreeBatches.h"
 #include "ProcessingNotificationSubscriber.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/utils/SpinReaderWriterLock.h"
 
 using namespace catapult::validators;
 
@@ -58,9 +62,168 @@ namespace catapult { namespace chain {
 		private:
 			ExecutionConfiguration m_config;
 		};
+
+		// region locked validator / observer
+
+		// validators only read cache state, so they can run concurrently with each other
+		class ReaderLockedValidator : public stateful::NotificationValidator {
+		public:
+			ReaderLockedValidator(const stateful::NotificationValidator& validator, utils::SpinReaderWriterLock& lock)
+					: m_validator(validator)
+					, m_lock(lock)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_validator.name();
+			}
+
+			ValidationResult validate(const model::Notification& notification, const ValidatorContext& context) const override {
+				auto readLock = m_lock.acquireReader();
+				return m_validator.validate(notification, context);
+			}
+
+		private:
+			const stateful::NotificationValidator& m_validator;
+			utils::SpinReaderWriterLock& m_lock;
+		};
+
+		// observers modify cache state, so they need exclusive access
+		class WriterLockedObserver : public observers::NotificationObserver {
+		public:
+			WriterLockedObserver(const observers::NotificationObserver& observer, utils::SpinReaderWriterLock& lock)
+					: m_observer(observer)
+					, m_lock(lock)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_observer.name();
+			}
+
+			void notify(const model::Notification& notification, const observers::ObserverContext& context) const override {
+				auto readLock = m_lock.acquireReader();
+				auto writeLock = readLock.promoteToWriter();
+				m_observer.notify(notification, context);
+			}
+
+		private:
+			const observers::NotificationObserver& m_observer;
+			utils::SpinReaderWriterLock& m_lock;
+		};
+
+		// endregion
+
+		class ParallelBatchEntityProcessor {
+		private:
+			struct ExecutionContext {
+			public:
+				ExecutionContext(
+						Height height,
+						Timestamp timestamp,
+						const model::NetworkInfo& network,
+						const observers::ObserverState& state)
+						: ReadOnlyCache(state.Cache.toReadOnly())
+						, ValidatorContext(height, timestamp, network, ReadOnlyCache)
+						, ObserverContext(state, height, observers::NotifyMode::Commit)
+				{}
+
+			public:
+				cache::ReadOnlyCatapultCache ReadOnlyCache;
+				validators::ValidatorContext ValidatorContext;
+				observers::ObserverContext ObserverContext;
+			};
+
+		public:
+			ParallelBatchEntityProcessor(
+					const ExecutionConfiguration& config,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+					: m_config(config)
+					, m_pPool(pPool)
+			{}
+
+		public:
+			ValidationResult operator()(
+					Height height,
+					Timestamp timestamp,
+					const model::WeakEntityInfos& entityInfos,
+					const observers::ObserverState& state) const {
+				if (entityInfos.empty())
+					return ValidationResult::Neutral;
+
+				ExecutionContext context(height, timestamp, m_config.Network, state);
+				for (const auto& batch : GroupConflictFreeBatches(entityInfos, *m_config.pNotificationPublisher)) {
+					using DifferenceType = model::WeakEntityInfos::difference_type;
+					auto batchBegin = entityInfos.cbegin() + static_cast<DifferenceType>(batch.StartIndex);
+					auto batchEntityInfos = model::WeakEntityInfos(batchBegin, batchBegin + static_cast<DifferenceType>(batch.Count));
+					auto result = 1 == batch.Count
+							? processSequential(batchEntityInfos[0], context)
+							: processParallel(batchEntityInfos, context);
+					if (!IsValidationResultSuccess(result))
+						return result;
+				}
+
+				return ValidationResult::Success;
+			}
+
+		private:
+			ValidationResult processSequential(const model::WeakEntityInfo& entityInfo, const ExecutionContext& context) const {
+				ProcessingNotificationSubscriber sub(
+						*m_config.pValidator,
+						context.ValidatorContext,
+						*m_config.pObserver,
+						context.ObserverContext);
+				m_config.pNotificationPublisher->publish(entityInfo, sub);
+				return sub.result();
+			}
+
+			ValidationResult processParallel(model::WeakEntityInfos& entityInfos, const ExecutionContext& context) const {
+				utils::SpinReaderWriterLock lock;
+				ReaderLockedValidator validator(*m_config.pValidator, lock);
+				WriterLockedObserver observer(*m_config.pObserver, lock);
+
+				std::vector<ValidationResult> results(entityInfos.size(), ValidationResult::Success);
+				std::vector<std::exception_ptr> exceptions(entityInfos.size());
+				const auto& publisher = *m_config.pNotificationPublisher;
+				auto numPartitions = std::min<size_t>(m_pPool->numWorkerThreads(), entityInfos.size());
+				thread::ParallelFor(m_pPool->service(), entityInfos, numPartitions, [&](const auto& entityInfo, auto index) {
+					try {
+						ProcessingNotificationSubscriber sub(validator, context.ValidatorContext, observer, context.ObserverContext);
+						publisher.publish(entityInfo, sub);
+						results[index] = sub.result();
+					} catch (...) {
+						exceptions[index] = std::current_exception();
+					}
+
+					return true;
+				}).get();
+
+				// since all entities in a batch are independent, the first failure (in entity order) is the same failure
+				// that would have been produced by sequential processing
+				for (auto i = 0u; i < entityInfos.size(); ++i) {
+					if (exceptions[i])
+						std::rethrow_exception(exceptions[i]);
+
+					if (!IsValidationResultSuccess(results[i]))
+						return results[i];
+				}
+
+				return ValidationResult::Success;
+			}
+
+		private:
+			ExecutionConfiguration m_config;
+			std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+		};
 	}
 
 	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config) {
 		return DefaultBatchEntityProcessor(config);
 	}
+
+	BatchEntityProcessor CreateParallelBatchEntityProcessor(
+			const ExecutionConfiguration& config,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
+		return ParallelBatchEntityProcessor(config, pPool);
+	}
 }}
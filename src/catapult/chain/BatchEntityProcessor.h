@@ -21,6 +21,8 @@
 #pragma once
 #include "ExecutionConfiguration.h"
 
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
 namespace catapult { namespace chain {
 
 	/// Function signature for validating and executing a batch of entity infos with a shared height and time and updating
@@ -33,4 +35,12 @@ namespace catapult { namespace chain {
 
 	/// Creates a batch entity processor around \a config.
 	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config);
+
+	/// Creates a batch entity processor around \a config that uses \a pPool to concurrently execute consecutive entities
+	/// touching disjoint sets of accounts.
+	/// \note Entities that touch global state are executed sequentially and the resulting state and validation result
+	///       are identical to the ones produced by the processor returned by CreateBatchEntityProcessor.
+	BatchEntityProcessor CreateParallelBatchEntityProcessor(
+			const ExecutionConfiguration& config,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool);
 }}
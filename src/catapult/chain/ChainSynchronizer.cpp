@@ -22,8 +22,13 @@
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/thread/FutureUtils.h"
+#include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <queue>
 
 namespace catapult { namespace chain {
@@ -140,6 +145,10 @@ namespace catapult { namespace chain {
 		}
 
 		class RangeAggregator {
+		public:
+			RangeAggregator() : m_numBlocks(0)
+			{}
+
 		public:
 			void add(model::BlockRange&& range) {
 				m_numBlocks += range.size();
@@ -217,6 +226,242 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		// region parallel sync
+
+		struct ChunkResult {
+			bool IsError;
+			model::BlockRange Range;
+		};
+
+		thread::future<ChunkResult> PullChunk(
+				const ParallelSyncPeer& peer,
+				Height height,
+				const api::BlocksFromOptions& options,
+				const std::shared_ptr<ParallelSyncStatistics>& pStatistics) {
+			using Clock = std::chrono::steady_clock;
+
+			auto startTime = Clock::now();
+			return peer.pChainApi->blocksFrom(height, options).then([identityKey = peer.IdentityKey, pStatistics, startTime](
+					auto&& blocksFuture) {
+				try {
+					auto range = blocksFuture.get();
+					auto elapsedMillis = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime).count();
+					pStatistics->addChunk(identityKey, range.totalSize(), static_cast<uint64_t>(elapsedMillis));
+					return ChunkResult{ false, std::move(range) };
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning)
+							<< "exception thrown while requesting blocks from " << utils::HexFormat(identityKey) << ": " << e.what();
+					pStatistics->addFailedChunk(identityKey);
+					return ChunkResult{ true, model::BlockRange() };
+				}
+			});
+		}
+
+		// pulls consecutive chunks of blocks from multiple peers concurrently and reassembles them in order
+		// (peer 0 is the peer being synchronized with and all other peers are helpers)
+		class ParallelBlocksPuller : public std::enable_shared_from_this<ParallelBlocksPuller> {
+		public:
+			ParallelBlocksPuller(
+					const ParallelSyncPeer& syncPeer,
+					std::vector<ParallelSyncPeer>&& helperPeers,
+					Height startHeight,
+					const api::BlocksFromOptions& options,
+					const std::shared_ptr<ParallelSyncStatistics>& pStatistics,
+					const std::shared_ptr<UnprocessedElements>& pUnprocessedElements)
+					: m_helperPeers(std::move(helperPeers))
+					, m_startHeight(startHeight)
+					, m_options(options)
+					, m_pStatistics(pStatistics)
+					, m_pUnprocessedElements(pUnprocessedElements)
+					, m_chunkSize(0)
+					, m_chunkNumBytes(0)
+					, m_numChunks(0) {
+				m_peers.push_back(syncPeer);
+			}
+
+		public:
+			// pulls blocks from the synchronizing peer and all helpers with a chain score equal to \a syncPeerScore
+			NodeInteractionFuture pull(const model::ChainScore& syncPeerScore) {
+				std::vector<thread::future<api::ChainInfo>> chainInfoFutures;
+				for (const auto& peer : m_helperPeers)
+					chainInfoFutures.push_back(peer.pChainApi->chainInfo());
+
+				auto chainInfosFuture = thread::when_all(std::move(chainInfoFutures));
+				return thread::compose(std::move(chainInfosFuture), [pThis = shared_from_this(), syncPeerScore](auto&& chainInfosFuture) {
+					pThis->addHelpersOnSameChain(chainInfosFuture.get(), syncPeerScore);
+					return pThis->pullChunks();
+				});
+			}
+
+		private:
+			void addHelpersOnSameChain(
+					std::vector<thread::future<api::ChainInfo>>&& chainInfoFutures,
+					const model::ChainScore& syncPeerScore) {
+				for (auto i = 0u; i < chainInfoFutures.size(); ++i) {
+					const auto& peer = m_helperPeers[i];
+					try {
+						auto chainInfo = chainInfoFutures[i].get();
+						if (syncPeerScore == chainInfo.Score) {
+							m_peers.push_back(peer);
+							continue;
+						}
+
+						CATAPULT_LOG(debug)
+								<< "excluding parallel sync peer " << utils::HexFormat(peer.IdentityKey)
+								<< " with chain score " << chainInfo.Score << " (expected " << syncPeerScore << ")";
+					} catch (const catapult_runtime_error& e) {
+						CATAPULT_LOG(warning)
+								<< "exception thrown while requesting chain info from " << utils::HexFormat(peer.IdentityKey)
+								<< ": " << e.what();
+					}
+				}
+			}
+
+			NodeInteractionFuture pullChunks() {
+				// each peer is assigned at most one chunk so that there is never more than one pending request per connection
+				auto numPeers = static_cast<uint32_t>(m_peers.size());
+				m_chunkSize = (m_options.NumBlocks + numPeers - 1) / numPeers;
+				m_numChunks = 0 == m_chunkSize ? 0 : (m_options.NumBlocks + m_chunkSize - 1) / m_chunkSize;
+				if (0 == m_numChunks)
+					return thread::make_ready_future(NodeInteractionResult::Neutral);
+
+				// the byte limit applies to the whole sync attempt, so it is shared by all chunks
+				m_chunkNumBytes = static_cast<uint32_t>((m_options.NumBytes + m_numChunks - 1) / m_numChunks);
+				m_chunkOwners.resize(m_numChunks);
+				for (auto i = 0u; i < m_numChunks; ++i)
+					m_chunkOwners[i] = i;
+
+				std::vector<thread::future<ChunkResult>> chunkFutures;
+				for (auto i = 0u; i < m_numChunks; ++i)
+					chunkFutures.push_back(PullChunk(m_peers[i], chunkHeight(i), chunkOptions(i), m_pStatistics));
+
+				CATAPULT_LOG(debug)
+						<< "pulling " << m_numChunks << " chunks of " << m_chunkSize
+						<< " blocks in parallel starting at height " << m_startHeight;
+				return thread::compose(thread::when_all(std::move(chunkFutures)), [pThis = shared_from_this()](auto&& chunksFuture) {
+					// chunk futures are never exceptional because PullChunk converts exceptions into errors
+					for (auto& chunkFuture : chunksFuture.get())
+						pThis->m_chunks.push_back(chunkFuture.get());
+
+					return pThis->assemble(0);
+				});
+			}
+
+			Height chunkHeight(size_t index) const {
+				return m_startHeight + Height(index * m_chunkSize);
+			}
+
+			api::BlocksFromOptions chunkOptions(size_t index) const {
+				auto chunkOffset = static_cast<uint32_t>(index) * m_chunkSize;
+				return api::BlocksFromOptions(std::min(m_chunkSize, m_options.NumBlocks - chunkOffset), m_chunkNumBytes);
+			}
+
+			NodeInteractionFuture assemble(size_t index) {
+				if (m_numChunks == index)
+					return complete();
+
+				const auto& chunk = m_chunks[index];
+				if (!chunk.IsError && !chunk.Range.empty() && isLinked(chunk.Range, index))
+					return addChunk(index);
+
+				auto ownerIndex = m_chunkOwners[index];
+				if (0 == ownerIndex)
+					return completeWithUnusableChunk(chunk, index);
+
+				// the helper did not return a usable chunk, so reassign it to the peer being synchronized with
+				if (!chunk.IsError)
+					m_pStatistics->addFailedChunk(m_peers[ownerIndex].IdentityKey);
+
+				CATAPULT_LOG(info) << "reassigning chunk at height " << chunkHeight(index) << " to synchronizing peer";
+				m_pStatistics->addReassignedChunk();
+				m_chunkOwners[index] = 0;
+				auto chunkFuture = PullChunk(m_peers[0], chunkHeight(index), chunkOptions(index), m_pStatistics);
+				return thread::compose(std::move(chunkFuture), [pThis = shared_from_this(), index](auto&& reassignedChunkFuture) {
+					pThis->m_chunks[index] = reassignedChunkFuture.get();
+					return pThis->assemble(index);
+				});
+			}
+
+			bool isLinked(const model::BlockRange& range, size_t index) {
+				auto expectedHeight = chunkHeight(index);
+				auto hasPreviousBlockHash = 0 != index;
+				auto previousBlockHash = m_lastBlockHash;
+				for (const auto& block : range) {
+					if (expectedHeight != block.Height || (hasPreviousBlockHash && previousBlockHash != block.PreviousBlockHash))
+						return false;
+
+					previousBlockHash = model::CalculateHash(block);
+					hasPreviousBlockHash = true;
+					expectedHeight = expectedHeight + Height(1);
+				}
+
+				m_nextLastBlockHash = previousBlockHash;
+				return true;
+			}
+
+			NodeInteractionFuture addChunk(size_t index) {
+				auto& range = m_chunks[index].Range;
+				auto isPartialChunk = range.size() < chunkOptions(index).NumBlocks;
+				m_lastBlockHash = m_nextLastBlockHash;
+				m_rangeAggregator.add(std::move(range));
+
+				// a partial chunk (e.g. limited by size) leaves a gap, so all following chunks need to be discarded
+				return isPartialChunk ? complete() : assemble(index + 1);
+			}
+
+			NodeInteractionFuture completeWithUnusableChunk(const ChunkResult& chunk, size_t index) {
+				if (chunk.IsError)
+					return thread::make_ready_future(NodeInteractionResult::Failure);
+
+				if (!chunk.Range.empty()) {
+					CATAPULT_LOG(warning) << "synchronizing peer returned unlinked blocks at height " << chunkHeight(index);
+
+					// only blame the synchronizing peer when none of its blocks could be linked
+					if (0 == index)
+						return thread::make_ready_future(NodeInteractionResult::Failure);
+				}
+
+				return complete();
+			}
+
+			NodeInteractionFuture complete() {
+				for (const auto& peer : m_pStatistics->peers()) {
+					if (isParticipant(peer.IdentityKey)) {
+						CATAPULT_LOG(info)
+								<< "parallel sync peer " << utils::HexFormat(peer.IdentityKey) << " throughput: "
+								<< peer.bytesPerSecond() << " B/s (" << peer.NumChunks << " chunks, "
+								<< peer.NumFailedChunks << " failures)";
+					}
+				}
+
+				return CompleteChainBlocksFrom(m_rangeAggregator, *m_pUnprocessedElements);
+			}
+
+			bool isParticipant(const Key& identityKey) const {
+				return std::any_of(m_peers.cbegin(), m_peers.cend(), [&identityKey](const auto& peer) {
+					return identityKey == peer.IdentityKey;
+				});
+			}
+
+		private:
+			std::vector<ParallelSyncPeer> m_helperPeers;
+			Height m_startHeight;
+			api::BlocksFromOptions m_options;
+			std::shared_ptr<ParallelSyncStatistics> m_pStatistics;
+			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
+			std::vector<ParallelSyncPeer> m_peers;
+			uint32_t m_chunkSize;
+			uint32_t m_chunkNumBytes;
+			size_t m_numChunks;
+			std::vector<size_t> m_chunkOwners;
+			std::vector<ChunkResult> m_chunks;
+			RangeAggregator m_rangeAggregator;
+			Hash256 m_lastBlockHash;
+			Hash256 m_nextLastBlockHash;
+		};
+
+		// endregion
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -227,10 +472,15 @@ namespace catapult { namespace chain {
 			explicit DefaultChainSynchronizer(
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
-					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
+					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+					const ParallelSyncPeersSupplier& parallelSyncPeersSupplier,
+					const std::shared_ptr<ParallelSyncStatistics>& pStatistics)
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
 					, m_blocksFromOptions(config.MaxRollbackBlocks, config.MaxChainBytesPerSyncAttempt)
+					, m_maxParallelSyncPeers(config.MaxParallelSyncPeers)
+					, m_parallelSyncPeersSupplier(parallelSyncPeersSupplier)
+					, m_pStatistics(pStatistics)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
 							3 * config.MaxChainBytesPerSyncAttempt))
@@ -290,18 +540,77 @@ namespace catapult { namespace chain {
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
+
+				// forks are always resolved by the synchronizing peer alone
+				auto startHeight = compareResult.CommonBlockHeight + Height(1);
+				if (0 == compareResult.ForkDepth && m_maxParallelSyncPeers > 1)
+					return pullInParallel(remoteChainApi, startHeight);
+
+				return pullFromPeer(remoteChainApi, startHeight, compareResult.ForkDepth);
+			}
+
+			NodeInteractionFuture pullFromPeer(const RemoteApiType& remoteChainApi, Height startHeight, uint64_t forkDepth) const {
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
-						compareResult.CommonBlockHeight + Height(1),
-						compareResult.ForkDepth,
+						startHeight,
+						forkDepth,
 						std::make_shared<RangeAggregator>(),
 						*m_pUnprocessedElements);
 			}
 
+			NodeInteractionFuture pullInParallel(const RemoteApiType& remoteChainApi, Height startHeight) const {
+				// the remote chain info determines how many blocks can be pulled and which helpers are on the same chain
+				return thread::compose(remoteChainApi.chainInfo(), [this, &remoteChainApi, startHeight](auto&& chainInfoFuture) {
+					try {
+						return this->pullInParallel(remoteChainApi, startHeight, chainInfoFuture.get());
+					} catch (const catapult_runtime_error& e) {
+						CATAPULT_LOG(warning) << "exception thrown while requesting chain info: " << e.what();
+						return thread::make_ready_future(NodeInteractionResult::Failure);
+					}
+				});
+			}
+
+			NodeInteractionFuture pullInParallel(
+					const RemoteApiType& remoteChainApi,
+					Height startHeight,
+					const api::ChainInfo& remoteChainInfo) const {
+				auto numBlocks = remoteChainInfo.Height < startHeight
+						? 0u
+						: static_cast<uint32_t>(std::min<uint64_t>(
+								m_blocksFromOptions.NumBlocks,
+								(remoteChainInfo.Height - startHeight).unwrap() + 1));
+				auto chunkSize = (m_blocksFromOptions.NumBlocks + m_maxParallelSyncPeers - 1) / m_maxParallelSyncPeers;
+
+				// helpers are only requested when the remote is more than one chunk ahead
+				std::vector<ParallelSyncPeer> helperPeers;
+				if (numBlocks > chunkSize)
+					helperPeers = m_parallelSyncPeersSupplier((numBlocks + chunkSize - 1) / chunkSize - 1);
+
+				if (helperPeers.empty())
+					return pullFromPeer(remoteChainApi, startHeight, 0);
+
+				// the synchronizing peer is owned by the caller and outlives the sync operation
+				auto syncPeer = ParallelSyncPeer{
+					remoteChainApi.remoteIdentityKey(),
+					std::shared_ptr<const RemoteApiType>(&remoteChainApi, [](const auto*) {})
+				};
+				auto pPuller = std::make_shared<ParallelBlocksPuller>(
+						syncPeer,
+						std::move(helperPeers),
+						startHeight,
+						api::BlocksFromOptions(numBlocks, m_blocksFromOptions.NumBytes),
+						m_pStatistics,
+						m_pUnprocessedElements);
+				return pPuller->pull(remoteChainInfo.Score);
+			}
+
 		private:
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
+			uint32_t m_maxParallelSyncPeers;
+			ParallelSyncPeersSupplier m_parallelSyncPeersSupplier;
+			std::shared_ptr<ParallelSyncStatistics> m_pStatistics;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
 		};
 	}
@@ -310,7 +619,26 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
-		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer);
+		return CreateChainSynchronizer(
+				pLocalChainApi,
+				config,
+				blockRangeConsumer,
+				[](auto) { return std::vector<ParallelSyncPeer>(); },
+				std::make_shared<ParallelSyncStatistics>());
+	}
+
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+			const ParallelSyncPeersSupplier& parallelSyncPeersSupplier,
+			const std::shared_ptr<ParallelSyncStatistics>& pStatistics) {
+		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
+				pLocalChainApi,
+				config,
+				blockRangeConsumer,
+				parallelSyncPeersSupplier,
+				pStatistics);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "ParallelSyncStatistics.h"
 #include "RemoteNodeSynchronizer.h"
 #include "catapult/disruptor/DisruptorTypes.h"
 #include "catapult/model/RangeTypes.h"
@@ -51,12 +52,43 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// Maximum number of peers (including the peer being synchronized with) that blocks are concurrently pulled from.
+		/// \note Parallel sync is disabled when this is less than \c 2.
+		uint32_t MaxParallelSyncPeers;
 	};
 
+	/// An additional peer that blocks can be pulled from during parallel sync.
+	struct ParallelSyncPeer {
+		/// Identity of the peer.
+		Key IdentityKey;
+
+		/// Chain api for interacting with the peer.
+		/// \note Any resources backing the api (e.g. the connection) must be kept alive as long as the api is referenced.
+		std::shared_ptr<const api::RemoteChainApi> pChainApi;
+	};
+
+	/// Function signature for retrieving at most the specified number of additional parallel sync peers.
+	using ParallelSyncPeersSupplier = std::function<std::vector<ParallelSyncPeer> (size_t)>;
+
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
 	/// a block range consumer (\a blockRangeConsumer).
 	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
+	/// a block range consumer (\a blockRangeConsumer) that pulls blocks in parallel from additional peers
+	/// retrieved from \a parallelSyncPeersSupplier and collects per peer throughputs in \a pStatistics.
+	/// \note Blocks following the common block are split into one chunk per peer. Helpers are only used when the peer being
+	///       synchronized with is more than one chunk ahead and only if they report the same chain score as that peer.
+	///       Chunks that cannot be pulled from or that do not link to the preceding chunk are reassigned to the peer being
+	///       synchronized with.
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+			const ParallelSyncPeersSupplier& parallelSyncPeersSupplier,
+			const std::shared_ptr<ParallelSyncStatistics>& pStatistics);
 }}
@@ -0,0 +1,115 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ConflictFreeBatches.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/ContainerTypes.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
+#include <algorithm>
+
+namespace catapult { namespace chain {
+
+	bool IsAddressScopedNotificationType(model::NotificationType type) {
+		if (!IsSet(type, model::NotificationChannel::Observer))
+			return true;
+
+		// notice that all core notifications except block notifications only modify the states of registered accounts
+		auto facilityCode = static_cast<model::FacilityCode>((utils::to_underlying_type(type) >> 16) & 0xFF);
+		return model::FacilityCode::Core == facilityCode && !AreEqualExcludingChannel(model::Core_Block_Notification, type);
+	}
+
+	namespace {
+		class AccessSetCollector : public model::NotificationSubscriber {
+		public:
+			explicit AccessSetCollector(model::NetworkIdentifier networkIdentifier)
+					: m_networkIdentifier(networkIdentifier)
+					, m_isAddressScoped(true)
+			{}
+
+		public:
+			const model::AddressSet& addresses() const {
+				return m_addresses;
+			}
+
+			bool isAddressScoped() const {
+				return m_isAddressScoped;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (!IsAddressScopedNotificationType(notification.Type))
+					m_isAddressScoped = false;
+
+				if (model::Core_Register_Account_Address_Notification == notification.Type) {
+					m_addresses.insert(static_cast<const model::AccountAddressNotification&>(notification).Address);
+				} else if (model::Core_Register_Account_Public_Key_Notification == notification.Type) {
+					const auto& publicKey = static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey;
+					m_addresses.insert(model::PublicKeyToAddress(publicKey, m_networkIdentifier));
+				}
+			}
+
+		private:
+			model::NetworkIdentifier m_networkIdentifier;
+			model::AddressSet m_addresses;
+			bool m_isAddressScoped;
+		};
+
+		bool HasIntersection(const model::AddressSet& lhs, const model::AddressSet& rhs) {
+			return std::any_of(lhs.cbegin(), lhs.cend(), [&rhs](const auto& address) {
+				return rhs.cend() != rhs.find(address);
+			});
+		}
+	}
+
+	std::vector<ConflictFreeBatch> GroupConflictFreeBatches(
+			const model::WeakEntityInfos& entityInfos,
+			const model::NotificationPublisher& publisher) {
+		std::vector<ConflictFreeBatch> batches;
+		model::AddressSet batchAddresses;
+		auto isBatchOpen = false;
+		for (auto i = 0u; i < entityInfos.size(); ++i) {
+			const auto& entityInfo = entityInfos[i];
+			AccessSetCollector collector(entityInfo.entity().Network());
+			publisher.publish(entityInfo, collector);
+
+			// entities that touch global state must be executed in isolation
+			if (!collector.isAddressScoped()) {
+				batches.push_back({ i, 1 });
+				isBatchOpen = false;
+				continue;
+			}
+
+			const auto& addresses = collector.addresses();
+			if (isBatchOpen && !HasIntersection(addresses, batchAddresses)) {
+				++batches.back().Count;
+				batchAddresses.insert(addresses.cbegin(), addresses.cend());
+				continue;
+			}
+
+			batches.push_back({ i, 1 });
+			batchAddresses = addresses;
+			isBatchOpen = true;
+		}
+
+		return batches;
+	}
+}}
@@ -0,0 +1,51 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/NotificationType.h"
+#include "catapult/model/WeakEntityInfo.h"
+#include <vector>
+
+namespace catapult { namespace model { class NotificationPublisher; } }
+
+namespace catapult { namespace chain {
+
+	/// A range of consecutive entities that touch disjoint sets of accounts and can be executed concurrently.
+	struct ConflictFreeBatch {
+		/// Index of the first entity in the batch.
+		size_t StartIndex;
+
+		/// Number of entities in the batch.
+		size_t Count;
+	};
+
+	/// Returns \c true if notifications with \a type only modify state associated with the accounts registered
+	/// by the publishing entity.
+	/// \note Validator-only notifications are considered address-scoped because they never modify state.
+	bool IsAddressScopedNotificationType(model::NotificationType type);
+
+	/// Groups \a entityInfos into consecutive batches of entities with pairwise disjoint address sets using \a publisher
+	/// to extract the addresses touched by each entity.
+	/// \note Entities publishing any notification that is not address-scoped (e.g. blocks, namespace and mosaic changes)
+	///       are placed into single-entity batches.
+	std::vector<ConflictFreeBatch> GroupConflictFreeBatches(
+			const model::WeakEntityInfos& entityInfos,
+			const model::NotificationPublisher& publisher);
+}}
@@ -0,0 +1,75 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelSyncStatistics.h"
+
+namespace catapult { namespace chain {
+
+	ParallelSyncStatistics::ParallelSyncStatistics()
+			: m_numBytes(0)
+			, m_numReassignedChunks(0)
+	{}
+
+	uint64_t ParallelSyncStatistics::numBytes() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numBytes;
+	}
+
+	uint64_t ParallelSyncStatistics::numReassignedChunks() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numReassignedChunks;
+	}
+
+	std::vector<PeerSyncThroughput> ParallelSyncStatistics::peers() const {
+		std::vector<PeerSyncThroughput> peers;
+		utils::SpinLockGuard guard(m_lock);
+		for (const auto& pair : m_peers)
+			peers.push_back(pair.second);
+
+		return peers;
+	}
+
+	void ParallelSyncStatistics::addChunk(const Key& identityKey, uint64_t numBytes, uint64_t numMillis) {
+		utils::SpinLockGuard guard(m_lock);
+		auto& peer = find(identityKey);
+		++peer.NumChunks;
+		peer.NumBytes += numBytes;
+		peer.NumMillis += numMillis;
+		m_numBytes += numBytes;
+	}
+
+	void ParallelSyncStatistics::addFailedChunk(const Key& identityKey) {
+		utils::SpinLockGuard guard(m_lock);
+		++find(identityKey).NumFailedChunks;
+	}
+
+	void ParallelSyncStatistics::addReassignedChunk() {
+		utils::SpinLockGuard guard(m_lock);
+		++m_numReassignedChunks;
+	}
+
+	PeerSyncThroughput& ParallelSyncStatistics::find(const Key& identityKey) {
+		auto iter = m_peers.find(identityKey);
+		if (m_peers.cend() != iter)
+			return iter->second;
+
+		return m_peers.emplace(identityKey, PeerSyncThroughput{ identityKey, 0, 0, 0, 0 }).first->second;
+	}
+}}
@@ -0,0 +1,90 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/types.h"
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace chain {
+
+	/// Throughput of a single peer during parallel sync.
+	struct PeerSyncThroughput {
+		/// Identity of the peer.
+		/// \note The peer that is being synchronized with is reported with a zero key.
+		Key IdentityKey;
+
+		/// Number of chunks successfully pulled from the peer.
+		uint64_t NumChunks;
+
+		/// Number of chunk requests that failed or returned unusable blocks.
+		uint64_t NumFailedChunks;
+
+		/// Total number of bytes pulled from the peer.
+		uint64_t NumBytes;
+
+		/// Total number of milliseconds spent waiting for successful chunk responses from the peer.
+		uint64_t NumMillis;
+
+	public:
+		/// Gets the average number of bytes pulled per second.
+		uint64_t bytesPerSecond() const {
+			return 0 == NumMillis ? NumBytes * 1000 : NumBytes * 1000 / NumMillis;
+		}
+	};
+
+	/// Statistics collected while pulling blocks from multiple peers in parallel.
+	class ParallelSyncStatistics {
+	public:
+		/// Creates empty statistics.
+		ParallelSyncStatistics();
+
+	public:
+		/// Gets the total number of bytes pulled from all peers.
+		uint64_t numBytes() const;
+
+		/// Gets the number of chunks that were reassigned to the peer being synchronized with.
+		uint64_t numReassignedChunks() const;
+
+		/// Gets the throughputs of all peers.
+		std::vector<PeerSyncThroughput> peers() const;
+
+	public:
+		/// Records that a chunk of \a numBytes was pulled from the peer identified by \a identityKey in \a numMillis milliseconds.
+		void addChunk(const Key& identityKey, uint64_t numBytes, uint64_t numMillis);
+
+		/// Records that a chunk request to the peer identified by \a identityKey failed.
+		void addFailedChunk(const Key& identityKey);
+
+		/// Records that a chunk was reassigned.
+		void addReassignedChunk();
+
+	private:
+		PeerSyncThroughput& find(const Key& identityKey);
+
+	private:
+		uint64_t m_numBytes;
+		uint64_t m_numReassignedChunks;
+		std::unordered_map<Key, PeerSyncThroughput, utils::ArrayHasher<Key>> m_peers;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -41,6 +41,9 @@ namespace catapult { namespace chain {
 		validators::ValidationResult result() const;
 
 	public:
+		/// Disables validation of subsequent notifications so that they are only observed.
+		void disableValidation();
+
 		/// Enables subsequent notifications to be undone.
 		void enableUndo();
 
@@ -61,6 +64,7 @@ namespace catapult { namespace chain {
 		const observers::ObserverContext& m_observerContext;
 
 		validators::ValidationResult m_aggregateResult;
+		bool m_isValidationEnabled;
 		bool m_isUndoEnabled;
 		std::vector<std::vector<uint8_t>> m_notificationBuffers;
 	};
@@ -56,7 +56,10 @@ namespace catapult { namespace chain {
 			}
 
 			// pass in a non-owning pointer to the registry
-			auto pRemoteApi = utils::UniqueToShared(apiFactory(*packetIoPair.io(), m_transactionRegistry));
+			auto pRemoteApi = utils::UniqueToShared(apiFactory(
+					*packetIoPair.io(),
+					packetIoPair.node().identityKey(),
+					m_transactionRegistry));
 
 			// extend the lifetimes of pRemoteApi and packetIoPair until the completion of the action
 			// (pRemoteApi is a pointer so that the reference taken by action is valid throughout the entire asynchronous action)
@@ -25,20 +25,35 @@
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache/RelockableDetachedCatapultCache.h"
 #include "catapult/cache/UtCache.h"
+#include "catapult/model/TransactionUtils.h"
 #include "catapult/utils/HexFormatter.h"
 
 namespace catapult { namespace chain {
 
 	namespace {
 		struct ApplyState {
-			constexpr ApplyState(cache::UtCacheModifierProxy& modifier, cache::CatapultCacheDelta& unconfirmedCatapultCache)
+			constexpr ApplyState(
+					cache::UtCacheModifierProxy& modifier,
+					cache::CatapultCacheDelta& unconfirmedCatapultCache,
+					model::AddressSet& evictedAddresses)
 					: Modifier(modifier)
 					, UnconfirmedCatapultCache(unconfirmedCatapultCache)
+					, EvictedAddresses(evictedAddresses)
 			{}
 
 			cache::UtCacheModifierProxy& Modifier;
 			cache::CatapultCacheDelta& UnconfirmedCatapultCache;
+			model::AddressSet& EvictedAddresses;
 		};
+
+		bool ContainsAny(const model::AddressSet& addresses, const model::AddressSet& candidates) {
+			for (const auto& candidate : candidates) {
+				if (addresses.cend() != addresses.find(candidate))
+					return true;
+			}
+
+			return false;
+		}
 	}
 
 	class UtUpdater::Impl final {
@@ -70,45 +85,69 @@ namespace catapult { namespace chain {
 				return;
 			}
 
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
-			apply(applyState, utInfos, TransactionSource::New);
+			// 2. evictions are batched so that all new transactions cause at most a single reapply
+			model::AddressSet evictedAddresses;
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, evictedAddresses);
+			if (0 != apply(applyState, utInfos, TransactionSource::New))
+				reapplyAfterEvictions(modifier, pUnconfirmedCatapultCache, evictedAddresses);
 		}
 
-		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const model::AddressSet* pChangedAddresses) {
 			if (!confirmedTransactionHashes.empty() || !utInfos.empty()) {
 				CATAPULT_LOG(debug)
 						<< "confirmed " << confirmedTransactionHashes.size() << " transactions, "
 						<< "reverted " << utInfos.size() << " transactions";
 			}
 
-			// 1. lock the catapult cache and rebase the unconfirmed catapult cache
+			// 1. lock the UT cache (this serializes all rebases of the unconfirmed catapult cache)
+			auto modifier = m_transactionsCache.modifier();
+
+			// 2. lock the catapult cache and rebase the unconfirmed catapult cache
 			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
 
-			// 2. lock and clear the UT cache
-			auto modifier = m_transactionsCache.modifier();
+			// 3. clear the UT cache and add back reverted txes
+			model::AddressSet evictedAddresses;
 			auto originalTransactionInfos = modifier.removeAll();
-
-			// 3. add back reverted txes
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
-			apply(applyState, utInfos, TransactionSource::Reverted);
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, evictedAddresses);
+			auto numEvictions = apply(applyState, utInfos, TransactionSource::Reverted);
 
 			// 4. add back original txes that have not been confirmed
-			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
+			//    (reverted txes are applied before all original txes, so changes are only tracked when there are none)
+			auto isUnconfirmed = [&confirmedTransactionHashes](const auto& info) {
 				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
-			});
+			};
+
+			if (!pChangedAddresses || !utInfos.empty()) {
+				numEvictions += apply(applyState, originalTransactionInfos, TransactionSource::Existing, isUnconfirmed, nullptr);
+			} else {
+				auto changedAddresses = *pChangedAddresses;
+				numEvictions += apply(applyState, originalTransactionInfos, TransactionSource::Existing, isUnconfirmed, &changedAddresses);
+			}
+
+			if (0 != numEvictions)
+				reapplyAfterEvictions(modifier, pUnconfirmedCatapultCache, evictedAddresses);
 		}
 
 	private:
-		void apply(const ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
-			apply(applyState, utInfos, transactionSource, [](const auto&) { return true; });
+		size_t apply(const ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
+			return apply(applyState, utInfos, transactionSource, [](const auto&) { return true; }, nullptr);
 		}
 
-		void apply(
+		// when pChangedAddresses is provided, transactions that are independent of all changed addresses are only observed
+		// and the addresses of all other transactions are added to it, because their effects might have changed
+		// returns the number of transactions that were evicted from the UT cache to make room for the applied transactions
+		// (their addresses are added to the apply state because their effects remain in the unconfirmed catapult cache)
+		size_t apply(
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
-				const predicate<const model::TransactionInfo&>& filter) {
+				const predicate<const model::TransactionInfo&>& filter,
+				model::AddressSet* pChangedAddresses) {
 			auto currentTime = m_timeSupplier();
+			size_t numEvictions = 0;
 
 			auto readOnlyCache = applyState.UnconfirmedCatapultCache.toReadOnly();
 
@@ -128,18 +167,40 @@ namespace catapult { namespace chain {
 				if (!filter(utInfo))
 					continue;
 
+				auto shouldValidate = true;
+				std::shared_ptr<const model::AddressSet> pAddresses;
+				if (pChangedAddresses) {
+					pAddresses = extractAddresses(utInfo);
+					shouldValidate = entity.Deadline < currentTime || ContainsAny(*pChangedAddresses, *pAddresses);
+					if (shouldValidate)
+						pChangedAddresses->insert(pAddresses->cbegin(), pAddresses->cend());
+				}
+
 				if (throttle(utInfo, transactionSource, applyState, readOnlyCache)) {
 					CATAPULT_LOG(warning) << "dropping transaction " << utils::HexFormat(entityHash) << " due to throttle";
 					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+
+					if (pChangedAddresses)
+						pChangedAddresses->insert(pAddresses->cbegin(), pAddresses->cend());
+
 					continue;
 				}
 
-				if (!applyState.Modifier.add(utInfo))
+				// the transaction is executed before it is added, so that an invalid transaction cannot evict a valid one
+				if (!applyState.Modifier.canAdd(utInfo)) {
+					if (pChangedAddresses)
+						pChangedAddresses->insert(pAddresses->cbegin(), pAddresses->cend());
+
 					continue;
+				}
 
 				// notice that subscriber is created within loop because aggregate result needs to be reset each iteration
 				ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
-				sub.enableUndo();
+				if (shouldValidate)
+					sub.enableUndo();
+				else
+					sub.disableValidation();
+
 				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
 				m_config.pNotificationPublisher->publish(entityInfo, sub);
 				if (!IsValidationResultSuccess(sub.result())) {
@@ -151,10 +212,61 @@ namespace catapult { namespace chain {
 						m_failedTransactionSink(entity, entityHash, sub.result());
 
 					sub.undo();
-					applyState.Modifier.remove(entityHash);
 					continue;
 				}
+
+				// canAdd guarantees that the transaction is added (possibly by evicting the lowest priority transaction)
+				applyState.Modifier.add(utInfo);
+				numEvictions += dropEvicted(applyState.Modifier, &applyState.EvictedAddresses);
 			}
+
+			return numEvictions;
+		}
+
+		size_t dropEvicted(cache::UtCacheModifierProxy& modifier, model::AddressSet* pEvictedAddresses) {
+			auto evictedTransactionInfos = modifier.takeEvicted();
+			for (const auto& evictedTransactionInfo : evictedTransactionInfos) {
+				const auto& entityHash = evictedTransactionInfo.EntityHash;
+				CATAPULT_LOG(debug) << "evicted transaction " << utils::HexFormat(entityHash) << " from full cache";
+				m_failedTransactionSink(*evictedTransactionInfo.pEntity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+
+				if (pEvictedAddresses) {
+					auto pAddresses = extractAddresses(evictedTransactionInfo);
+					pEvictedAddresses->insert(pAddresses->cbegin(), pAddresses->cend());
+				}
+			}
+
+			return evictedTransactionInfos.size();
+		}
+
+		void reapplyAfterEvictions(
+				cache::UtCacheModifierProxy& modifier,
+				std::unique_ptr<cache::CatapultCacheDelta>& pUnconfirmedCatapultCache,
+				const model::AddressSet& evictedAddresses) {
+			// the effects of an evicted transaction cannot be undone in isolation because subsequent transactions can depend on
+			// them, so all remaining transactions are observed again on a fresh copy of the confirmed state
+			auto cacheHeight = m_detachedCatapultCache.height();
+			pUnconfirmedCatapultCache.reset();
+			pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
+
+			// if the confirmed state changed in the meantime, a forthcoming block update will reapply all transactions
+			if (cacheHeight != m_detachedCatapultCache.height())
+				return;
+
+			// only transactions that (transitively) depend on an evicted transaction are revalidated
+			// (remaining transactions fit into the cache, so they cannot evict each other)
+			model::AddressSet ignoredEvictedAddresses;
+			auto changedAddresses = evictedAddresses;
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, ignoredEvictedAddresses);
+			auto alwaysTrue = [](const auto&) { return true; };
+			apply(applyState, modifier.removeAll(), TransactionSource::Existing, alwaysTrue, &changedAddresses);
+		}
+
+		std::shared_ptr<const model::AddressSet> extractAddresses(const model::TransactionInfo& utInfo) const {
+			if (utInfo.OptionalExtractedAddresses)
+				return utInfo.OptionalExtractedAddresses;
+
+			return std::make_shared<model::AddressSet>(model::ExtractAddresses(*utInfo.pEntity, *m_config.pNotificationPublisher));
 		}
 
 		bool throttle(
@@ -166,8 +278,10 @@ namespace catapult { namespace chain {
 		}
 
 		void addAll(cache::UtCacheModifierProxy& modifier, const std::vector<model::TransactionInfo>& utInfos) {
-			for (const auto& utInfo : utInfos)
-				modifier.add(utInfo);
+			for (const auto& utInfo : utInfos) {
+				if (modifier.add(utInfo))
+					dropEvicted(modifier, nullptr);
+			}
 		}
 
 	private:
@@ -202,6 +316,13 @@ namespace catapult { namespace chain {
 	}
 
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
-		m_pImpl->update(confirmedTransactionHashes, utInfos);
+		m_pImpl->update(confirmedTransactionHashes, utInfos, nullptr);
+	}
+
+	void UtUpdater::update(
+			const utils::HashPointerSet& confirmedTransactionHashes,
+			const std::vector<model::TransactionInfo>& utInfos,
+			const model::AddressSet& changedAddresses) {
+		m_pImpl->update(confirmedTransactionHashes, utInfos, &changedAddresses);
 	}
 }}
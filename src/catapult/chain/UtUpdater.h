@@ -21,6 +21,7 @@
 #pragma once
 #include "ChainFunctions.h"
 #include "ExecutionConfiguration.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/utils/ArraySet.h"
@@ -36,6 +37,8 @@ namespace catapult {
 namespace catapult { namespace chain {
 
 	/// Provides batch updating of an unconfirmed transactions cache.
+	/// \note Transactions that are evicted from a full cache are passed to the failed transaction sink and
+	///       the unconfirmed state is rebuilt without them.
 	class UtUpdater {
 	public:
 		/// Sources of transactions that can be updated.
@@ -90,6 +93,17 @@ namespace catapult { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+		/// Updates this cache by applying new transaction infos in \a utInfos and
+		/// removing transactions with hashes in \a confirmedTransactionHashes.
+		/// Existing transactions are only revalidated if they involve an account in \a changedAddresses,
+		/// an account involved in a previously revalidated or dropped transaction or if they have expired.
+		/// \note \a changedAddresses must contain all accounts changed by the confirmed blocks and the confirmed blocks
+		///       must not have changed any other state that is read by transaction validators.
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const model::AddressSet& changedAddresses);
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
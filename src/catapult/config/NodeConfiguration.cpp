@@ -40,12 +40,16 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(ShouldAllowAddressReuse);
 		LOAD_NODE_PROPERTY(ShouldUseSingleThreadPool);
 		LOAD_NODE_PROPERTY(ShouldUseCacheDatabaseStorage);
+		LOAD_NODE_PROPERTY(ShouldEnableCachePatriciaTrees);
+		LOAD_NODE_PROPERTY(ShouldUsePackedBlockStorage);
+		LOAD_NODE_PROPERTY(ShouldEnableBlockGroupCommit);
 
 		LOAD_NODE_PROPERTY(ShouldEnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxParallelSyncPeers);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -54,6 +58,10 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(ShouldEnableIncrementalUtUpdates);
+
+		LOAD_NODE_PROPERTY(BlockStorageCacheMaxSize);
+		LOAD_NODE_PROPERTY(StateCheckpointInterval);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -66,10 +74,13 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
 		LOAD_NODE_PROPERTY(TransactionDisruptorSize);
 		LOAD_NODE_PROPERTY(TransactionElementTraceInterval);
+		LOAD_NODE_PROPERTY(DispatcherWaitStrategy);
 
 		LOAD_NODE_PROPERTY(ShouldAbortWhenDispatcherIsFull);
 		LOAD_NODE_PROPERTY(ShouldAuditDispatcherInputs);
 		LOAD_NODE_PROPERTY(ShouldPrecomputeTransactionAddresses);
+		LOAD_NODE_PROPERTY(ShouldEnableParallelBlockExecution);
+		LOAD_NODE_PROPERTY(ShouldEnableParallelCacheCommit);
 
 		LOAD_NODE_PROPERTY(OutgoingSecurityMode);
 		LOAD_NODE_PROPERTY(IncomingSecurityModes);
@@ -103,7 +114,7 @@ namespace catapult { namespace config {
 		auto extensionsPair = utils::ExtractSectionAsUnorderedSet(bag, "extensions");
 		config.Extensions = extensionsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 29 + 4 + 2 + 3 + extensionsPair.second);
+		utils::VerifyBagSizeLte(bag, 38 + 4 + 2 + 3 + extensionsPair.second);
 		return config;
 	}
 
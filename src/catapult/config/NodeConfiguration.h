@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/disruptor/WaitStrategy.h"
 #include "catapult/ionet/ConnectionSecurityMode.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/utils/FileSize.h"
@@ -47,6 +48,15 @@ namespace catapult { namespace config {
 		/// \c true if cache data should be saved in a database.
 		bool ShouldUseCacheDatabaseStorage;
 
+		/// \c true if patricia trees should be used to calculate cache state roots.
+		bool ShouldEnableCachePatriciaTrees;
+
+		/// \c true if blocks should be saved in packed segment files instead of individual block files.
+		bool ShouldUsePackedBlockStorage;
+
+		/// \c true if blocks saved together should be committed to file-based storage at once.
+		bool ShouldEnableBlockGroupCommit;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool ShouldEnableTransactionSpamThrottling;
 
@@ -59,6 +69,9 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of peers that blocks are concurrently pulled from during a sync attempt (\c 1 disables parallel sync).
+		uint32_t MaxParallelSyncPeers;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -77,6 +90,18 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		uint32_t UnconfirmedTransactionsCacheMaxSize;
 
+		/// \c true if unconfirmed transactions should only be revalidated after a block commit when they depend on changed accounts.
+		/// \note This assumes that transaction validators only read account dependent state that can be changed by blocks.
+		/// \note This setting is ignored when cache data is saved in a database.
+		bool ShouldEnableIncrementalUtUpdates;
+
+		/// Maximum size of recent block elements kept in memory by the block storage cache.
+		utils::FileSize BlockStorageCacheMaxSize;
+
+		/// Minimum interval between background checkpoints of the cache state (\c 0 disables checkpointing).
+		/// \note This setting is ignored when cache data is saved in a database.
+		utils::TimeSpan StateCheckpointInterval;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -105,6 +130,9 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a transaction element should be traced through queue and completion.
 		uint32_t TransactionElementTraceInterval;
 
+		/// Strategy used by idle dispatcher consumers to wait for new elements.
+		disruptor::WaitStrategy DispatcherWaitStrategy;
+
 		/// \c true if the process should terminate when any dispatcher is full.
 		bool ShouldAbortWhenDispatcherIsFull;
 
@@ -114,6 +142,13 @@ namespace catapult { namespace config {
 		/// \c true if all transaction addresses should be extracted during dispatcher processing.
 		bool ShouldPrecomputeTransactionAddresses;
 
+		/// \c true if transactions touching disjoint sets of accounts should be executed in parallel during block sync.
+		/// \note This setting is ignored when cache data is saved in a database.
+		bool ShouldEnableParallelBlockExecution;
+
+		/// \c true if subcaches should be committed in parallel at the end of block sync.
+		bool ShouldEnableParallelCacheCommit;
+
 		/// Security mode of outgoing connections initiated by this node.
 		ionet::ConnectionSecurityMode OutgoingSecurityMode;
 
@@ -21,12 +21,15 @@
 #include "BlockConsumers.h"
 #include "ConsumerResultFactory.h"
 #include "InputUtils.h"
+#include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/utils/Casting.h"
+#include <unordered_map>
 
 namespace catapult { namespace consumers {
 
@@ -48,6 +51,22 @@ namespace catapult { namespace consumers {
 			}
 		};
 
+		using CacheGenerations = std::unordered_map<std::string, size_t>;
+
+		CacheGenerations GetCacheGenerations(const cache::CatapultCache& cache) {
+			CacheGenerations generations;
+			for (const auto& pStorage : cache.storages())
+				generations.emplace(pStorage->name(), pStorage->generation());
+
+			return generations;
+		}
+
+		template<typename TAccountStates>
+		void AddAccountAddresses(model::AddressSet& addresses, const TAccountStates& accountStates) {
+			for (const auto* pAccountState : accountStates)
+				addresses.insert(pAccountState->Address);
+		}
+
 		struct SyncState {
 		public:
 			SyncState() = default;
@@ -76,6 +95,10 @@ namespace catapult { namespace consumers {
 				return *m_pCacheDelta;
 			}
 
+			const cache::CatapultCache& originalCache() const {
+				return *m_pOriginalCache;
+			}
+
 		public:
 			TransactionInfos detachRemovedTransactionInfos() {
 				return std::move(m_removedTransactionInfos);
@@ -94,8 +117,12 @@ namespace catapult { namespace consumers {
 				m_removedTransactionInfos = std::move(removedTransactionInfos);
 			}
 
-			void commit(Height height) {
-				m_pOriginalCache->commit(height);
+			void commit(Height height, const BlockChainSyncHandlers::CommitCacheFunc& commitCache) {
+				if (commitCache)
+					commitCache(*m_pOriginalCache, height);
+				else
+					m_pOriginalCache->commit(height);
+
 				m_pCacheDelta.reset(); // release the delta after commit so that the UT updater can acquire a lock
 
 				*m_pOriginalState = m_stateCopy;
@@ -253,14 +280,34 @@ namespace catapult { namespace consumers {
 				m_handlers.StateChange(StateChangeInfo(syncState.cacheDelta(), syncState.scoreDelta(), newHeight));
 
 				// 3. commit changes to the in-memory cache
-				syncState.commit(newHeight);
+				auto confirmedStateChanges = commitCache(newHeight, syncState);
 
 				// 4. update the unconfirmed transactions
 				auto peerTransactionHashes = ExtractTransactionHashes(elements);
 				auto revertedTransactionInfos = CollectRevertedTransactionInfos(
 						peerTransactionHashes,
 						syncState.detachRemovedTransactionInfos());
-				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos });
+				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos, &confirmedStateChanges });
+			}
+
+			ConfirmedStateChanges commitCache(Height height, SyncState& syncState) const {
+				// collect the changed accounts before the delta is released by the commit
+				ConfirmedStateChanges changes;
+				const auto& accountStateCacheDelta = syncState.cacheDelta().sub<cache::AccountStateCache>();
+				AddAccountAddresses(changes.ChangedAddresses, accountStateCacheDelta.addedElements());
+				AddAccountAddresses(changes.ChangedAddresses, accountStateCacheDelta.modifiedElements());
+				AddAccountAddresses(changes.ChangedAddresses, accountStateCacheDelta.removedElements());
+
+				// generations are only changed by commit, which is performed by this thread
+				auto originalGenerations = GetCacheGenerations(syncState.originalCache());
+				syncState.commit(height, m_handlers.CommitCache);
+				for (const auto& pair : GetCacheGenerations(syncState.originalCache())) {
+					auto iter = originalGenerations.find(pair.first);
+					if (originalGenerations.cend() == iter || pair.second != iter->second)
+						changes.ChangedCacheNames.insert(pair.first);
+				}
+
+				return changes;
 			}
 
 			void commitToStorage(Height commonBlockHeight, const BlockElements& elements) const {
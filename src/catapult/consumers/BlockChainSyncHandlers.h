@@ -21,7 +21,10 @@
 #pragma once
 #include "BlockChainProcessor.h"
 #include "StateChangeInfo.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/utils/ArraySet.h"
+#include <string>
+#include <unordered_set>
 
 namespace catapult {
 	namespace cache { class CatapultCache; }
@@ -30,6 +33,15 @@ namespace catapult {
 
 namespace catapult { namespace consumers {
 
+	/// Confirmed state changes caused by committing a block chain.
+	struct ConfirmedStateChanges {
+		/// Addresses of all accounts that were added, modified or removed.
+		model::AddressSet ChangedAddresses;
+
+		/// Names of all cache storages that were changed.
+		std::unordered_set<std::string> ChangedCacheNames;
+	};
+
 	/// Information passed to a transactions change handler.
 	struct TransactionsChangeInfo {
 	public:
@@ -37,8 +49,18 @@ namespace catapult { namespace consumers {
 		TransactionsChangeInfo(
 				const utils::HashPointerSet& addedTransactionHashes,
 				const std::vector<model::TransactionInfo>& revertedTransactionInfos)
+				: TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos, nullptr)
+		{}
+
+		/// Creates a new transactions change info around \a addedTransactionHashes, \a revertedTransactionInfos
+		/// and optional confirmed state changes (\a pConfirmedStateChanges).
+		TransactionsChangeInfo(
+				const utils::HashPointerSet& addedTransactionHashes,
+				const std::vector<model::TransactionInfo>& revertedTransactionInfos,
+				const ConfirmedStateChanges* pConfirmedStateChanges)
 				: AddedTransactionHashes(addedTransactionHashes)
 				, RevertedTransactionInfos(revertedTransactionInfos)
+				, pConfirmedStateChanges(pConfirmedStateChanges)
 		{}
 
 	public:
@@ -47,6 +69,9 @@ namespace catapult { namespace consumers {
 
 		/// Infos of the transactions that were reverted (previously confirmed).
 		const std::vector<model::TransactionInfo>& RevertedTransactionInfos;
+
+		/// Confirmed state changes (optional).
+		const ConfirmedStateChanges* pConfirmedStateChanges;
 	};
 
 	/// Handlers used by the block chain sync consumer.
@@ -64,6 +89,9 @@ namespace catapult { namespace consumers {
 		/// Prototype for transaction change notification.
 		using TransactionsChangeFunc = consumer<const TransactionsChangeInfo&>;
 
+		/// Prototype for committing all pending cache changes at a height.
+		using CommitCacheFunc = consumer<cache::CatapultCache&, Height>;
+
 	public:
 		/// Checks all difficulties in a block chain for correctness.
 		DifficultyCheckerFunc DifficultyChecker;
@@ -79,5 +107,9 @@ namespace catapult { namespace consumers {
 
 		/// Called with the hashes of confirmed transactions and the infos of reverted transactions when transaction statuses change.
 		TransactionsChangeFunc TransactionsChange;
+
+		/// Commits all pending cache changes and sets the cache height.
+		/// \note This handler is optional and the cache is committed sequentially when it is not set.
+		CommitCacheFunc CommitCache;
 	};
 }}
@@ -24,6 +24,7 @@
 #include "HashCheckOptions.h"
 #include "InputUtils.h"
 #include "catapult/chain/ChainFunctions.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/disruptor/DisruptorConsumer.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
 
@@ -39,6 +40,12 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry
+	/// and hashes block transactions merkle tree levels using \a merkleLevelHasher.
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const crypto::MerkleHashBuilder::LevelHasher& merkleLevelHasher);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	disruptor::ConstBlockConsumer CreateBlockHashCheckConsumer(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options);
@@ -30,8 +30,11 @@ namespace catapult { namespace consumers {
 	namespace {
 		class BlockHashCalculatorConsumer {
 		public:
-			explicit BlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry)
+			BlockHashCalculatorConsumer(
+					const model::TransactionRegistry& transactionRegistry,
+					const crypto::MerkleHashBuilder::LevelHasher& merkleLevelHasher)
 					: m_transactionRegistry(transactionRegistry)
+					, m_merkleLevelHasher(merkleLevelHasher)
 			{}
 
 		public:
@@ -42,14 +45,18 @@ namespace catapult { namespace consumers {
 				for (auto& element : elements) {
 					// note that disruptor input elements have been extracted from a packet (or created within this
 					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
 
+					std::vector<model::TransactionElement*> transactionElements;
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+
+					model::UpdateHashes(m_transactionRegistry, transactionElements);
+
+					crypto::MerkleHashBuilder transactionsHashBuilder(element.Transactions.size(), m_merkleLevelHasher);
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -64,11 +71,20 @@ namespace catapult { namespace consumers {
 
 		private:
 			const model::TransactionRegistry& m_transactionRegistry;
+			crypto::MerkleHashBuilder::LevelHasher m_merkleLevelHasher;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(transactionRegistry);
+		return CreateBlockHashCalculatorConsumer(transactionRegistry, [](const auto& inputs, auto* pHashes) {
+			crypto::Sha3_256_MultiBuffer(inputs, pHashes);
+		});
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const crypto::MerkleHashBuilder::LevelHasher& merkleLevelHasher) {
+		return BlockHashCalculatorConsumer(transactionRegistry, merkleLevelHasher);
 	}
 
 	namespace {
@@ -83,8 +99,11 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				std::vector<model::TransactionElement*> transactionElements;
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, element);
+					transactionElements.push_back(&element);
+
+				model::UpdateHashes(m_transactionRegistry, transactionElements);
 
 				return Continue();
 			}
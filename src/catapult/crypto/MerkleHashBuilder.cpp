@@ -19,13 +19,15 @@
 **/
 
 #include "MerkleHashBuilder.h"
-#include "Hashes.h"
-#include "catapult/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
 	namespace {
-		Hash256 Final(std::vector<Hash256>& hashes, const consumer<const Hash256*, size_t>& hashConsumer) {
+		Hash256 Final(
+				std::vector<Hash256>& hashes,
+				const MerkleHashBuilder::LevelHasher& levelHasher,
+				const consumer<const Hash256*, size_t>& hashConsumer) {
 			if (hashes.empty()) {
 				Hash256 hash{};
 				hashConsumer(&hash, 1);
@@ -33,6 +35,8 @@ namespace catapult { namespace crypto {
 			}
 
 			// build the merkle tree
+			std::vector<MultiBufferHashInput> inputs;
+			std::vector<Hash256> levelHashes;
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
 			while (numRemainingHashes > 1) {
@@ -41,31 +45,31 @@ namespace catapult { namespace crypto {
 				if (1 == numRemainingHashes % 2)
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256_Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
+				// hash all nodes of the next level together because they are independent of each other
+				inputs.clear();
+				for (auto i = 0u; i < numRemainingHashes; i += 2) {
 					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
-					++numRemainingHashes;
+					const auto& rightHash = i + 1 < numRemainingHashes ? hashes[i + 1] : hashes[i];
+					inputs.push_back({ hashes[i], rightHash });
 				}
 
-				numRemainingHashes /= 2;
+				levelHashes.resize(inputs.size());
+				levelHasher(inputs, levelHashes.data());
+				std::copy(levelHashes.cbegin(), levelHashes.cend(), hashes.begin());
+				hashConsumer(hashes.data(), levelHashes.size());
+
+				numRemainingHashes = levelHashes.size();
 			}
 
 			return hashes[0];
 		}
 	}
 
-	MerkleHashBuilder::MerkleHashBuilder(size_t capacity) {
+	MerkleHashBuilder::MerkleHashBuilder(size_t capacity)
+			: MerkleHashBuilder(capacity, [](const auto& inputs, auto* pHashes) { Sha3_256_MultiBuffer(inputs, pHashes); })
+	{}
+
+	MerkleHashBuilder::MerkleHashBuilder(size_t capacity, const LevelHasher& levelHasher) : m_levelHasher(levelHasher) {
 		m_hashes.reserve(capacity);
 	}
 
@@ -75,13 +79,13 @@ namespace catapult { namespace crypto {
 
 	void MerkleHashBuilder::final(Hash256& hash) {
 		// build the merkle root
-		hash = Final(m_hashes, [](const auto*, auto) {});
+		hash = Final(m_hashes, m_levelHasher, [](const auto*, auto) {});
 	}
 
 	void MerkleHashBuilder::final(std::vector<Hash256>& tree) {
 		// build the complete merkle tree
 		tree.reserve(TreeSize(m_hashes.size()));
-		Final(m_hashes, [&tree](const Hash256* pHash, size_t count) {
+		Final(m_hashes, m_levelHasher, [&tree](const Hash256* pHash, size_t count) {
 			for (auto i = 0u; i < count; ++i)
 				tree.push_back(*pHash++);
 		});
@@ -19,6 +19,8 @@
 **/
 
 #pragma once
+#include "MultiBufferHashes.h"
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <vector>
 
@@ -26,10 +28,17 @@ namespace catapult { namespace crypto {
 
 	/// Builder for creating a merkle hash.
 	class MerkleHashBuilder {
+	public:
+		/// Hashes all (independent) nodes of a single tree level by calculating the hashes of all inputs into the output pointer.
+		using LevelHasher = consumer<const std::vector<MultiBufferHashInput>&, Hash256*>;
+
 	public:
 		/// Creates a new merkle hash builder with the specified initial \a capacity.
 		explicit MerkleHashBuilder(size_t capacity = 0);
 
+		/// Creates a new merkle hash builder with the specified initial \a capacity that hashes tree levels using \a levelHasher.
+		MerkleHashBuilder(size_t capacity, const LevelHasher& levelHasher);
+
 	public:
 		/// Adds \a hash to the merkle hash.
 		void update(const Hash256& hash);
@@ -46,5 +55,6 @@ namespace catapult { namespace crypto {
 
 	private:
 		std::vector<Hash256> m_hashes;
+		LevelHasher m_levelHasher;
 	};
 }}
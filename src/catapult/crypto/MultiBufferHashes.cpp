@@ -0,0 +1,419 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiBufferHashes.h"
+#include "Hashes.h"
+#include "catapult/utils/Casting.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define CATAPULT_KECCAK_X86
+#define CATAPULT_KECCAK_TARGET(ISA) __attribute__((target(ISA)))
+// fully unroll permutation steps so that state words can be kept in registers
+#define CATAPULT_KECCAK_UNROLL _Pragma("GCC unroll 25")
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define CATAPULT_KECCAK_X86
+#define CATAPULT_KECCAK_TARGET(ISA)
+#define CATAPULT_KECCAK_UNROLL
+#endif
+
+namespace catapult { namespace crypto {
+
+	MultiBufferHashInput::MultiBufferHashInput(std::initializer_list<RawBuffer> parts)
+			: m_numParts(parts.size())
+			, m_size(0) {
+		if (m_numParts > Max_Parts)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("too many parts in multi-buffer hash input", m_numParts);
+
+		std::copy(parts.begin(), parts.end(), m_parts.begin());
+		for (const auto& part : parts)
+			m_size += part.Size;
+	}
+
+	namespace {
+		// region keccak constants
+
+		constexpr size_t Num_State_Words = 25;
+		constexpr size_t Num_Rounds = 24;
+
+		// rate of 256-bit SHA3 in bytes and words
+		constexpr size_t Rate = 136;
+		constexpr size_t Num_Rate_Words = Rate / sizeof(uint64_t);
+
+#ifdef SIGNATURE_SCHEME_NIS1
+		constexpr uint8_t Delimited_Suffix = 0x01; // keccak padding
+#else
+		constexpr uint8_t Delimited_Suffix = 0x06; // SHA3 padding
+#endif
+
+#ifdef CATAPULT_KECCAK_X86
+		constexpr uint64_t Round_Constants[Num_Rounds] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// rotation offsets (rho) indexed by x + 5 * y
+		constexpr int Rotation_Offsets[Num_State_Words] = {
+			0, 1, 62, 28, 27,
+			36, 44, 6, 55, 20,
+			3, 10, 43, 25, 39,
+			41, 45, 15, 21, 8,
+			18, 2, 61, 56, 14
+		};
+
+		// destination (pi) of the word at x + 5 * y, which is y + 5 * ((2 * x + 3 * y) % 5)
+		constexpr size_t Pi_Destinations[Num_State_Words] = {
+			0, 10, 20, 5, 15,
+			16, 1, 11, 21, 6,
+			7, 17, 2, 12, 22,
+			23, 8, 18, 3, 13,
+			14, 24, 9, 19, 4
+		};
+#endif
+
+		// endregion
+
+		// region permutations
+
+		// all permutations operate on interleaved states where word w of lane l is stored at index w * Num_Lanes + l
+
+#ifdef CATAPULT_KECCAK_X86
+		CATAPULT_KECCAK_TARGET("avx2")
+		inline __m256i RotateLeftAvx2(__m256i value, int shift) {
+			return _mm256_or_si256(_mm256_slli_epi64(value, shift), _mm256_srli_epi64(value, 64 - shift));
+		}
+
+		CATAPULT_KECCAK_TARGET("avx2")
+		void KeccakF1600Avx2(uint64_t* pState) {
+			__m256i A[Num_State_Words];
+			__m256i B[Num_State_Words];
+			__m256i C[5];
+			CATAPULT_KECCAK_UNROLL
+			for (auto i = 0u; i < Num_State_Words; ++i)
+				A[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pState + 4 * i));
+
+			for (auto round = 0u; round < Num_Rounds; ++round) {
+				// theta
+				CATAPULT_KECCAK_UNROLL
+				for (auto x = 0u; x < 5; ++x) {
+					auto partial = _mm256_xor_si256(_mm256_xor_si256(A[x], A[x + 5]), A[x + 10]);
+					C[x] = _mm256_xor_si256(_mm256_xor_si256(partial, A[x + 15]), A[x + 20]);
+				}
+
+				CATAPULT_KECCAK_UNROLL
+				for (auto x = 0u; x < 5; ++x) {
+					auto D = _mm256_xor_si256(C[(x + 4) % 5], RotateLeftAvx2(C[(x + 1) % 5], 1));
+					CATAPULT_KECCAK_UNROLL
+					for (auto y = 0u; y < 25; y += 5)
+						A[x + y] = _mm256_xor_si256(A[x + y], D);
+				}
+
+				// rho and pi
+				CATAPULT_KECCAK_UNROLL
+				for (auto i = 0u; i < Num_State_Words; ++i)
+					B[Pi_Destinations[i]] = RotateLeftAvx2(A[i], Rotation_Offsets[i]);
+
+				// chi
+				CATAPULT_KECCAK_UNROLL
+				for (auto y = 0u; y < 25; y += 5) {
+					CATAPULT_KECCAK_UNROLL
+					for (auto x = 0u; x < 5; ++x)
+						A[x + y] = _mm256_xor_si256(B[x + y], _mm256_andnot_si256(B[(x + 1) % 5 + y], B[(x + 2) % 5 + y]));
+				}
+
+				// iota
+				A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x(static_cast<int64_t>(Round_Constants[round])));
+			}
+
+			CATAPULT_KECCAK_UNROLL
+			for (auto i = 0u; i < Num_State_Words; ++i)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(pState + 4 * i), A[i]);
+		}
+
+		CATAPULT_KECCAK_TARGET("avx512f")
+		void KeccakF1600Avx512(uint64_t* pState) {
+			// ternary logic immediates
+			constexpr int Xor3 = 0x96; // a ^ b ^ c
+			constexpr int XorAndNot = 0xD2; // a ^ (~b & c)
+
+			__m512i A[Num_State_Words];
+			__m512i B[Num_State_Words];
+			__m512i C[5];
+			CATAPULT_KECCAK_UNROLL
+			for (auto i = 0u; i < Num_State_Words; ++i)
+				A[i] = _mm512_loadu_si512(pState + 8 * i);
+
+			for (auto round = 0u; round < Num_Rounds; ++round) {
+				// theta
+				CATAPULT_KECCAK_UNROLL
+				for (auto x = 0u; x < 5; ++x) {
+					auto partial = _mm512_ternarylogic_epi64(A[x], A[x + 5], A[x + 10], Xor3);
+					C[x] = _mm512_ternarylogic_epi64(partial, A[x + 15], A[x + 20], Xor3);
+				}
+
+				CATAPULT_KECCAK_UNROLL
+				for (auto x = 0u; x < 5; ++x) {
+					auto rotated = _mm512_rolv_epi64(C[(x + 1) % 5], _mm512_set1_epi64(1));
+					CATAPULT_KECCAK_UNROLL
+					for (auto y = 0u; y < 25; y += 5)
+						A[x + y] = _mm512_ternarylogic_epi64(A[x + y], C[(x + 4) % 5], rotated, Xor3);
+				}
+
+				// rho and pi
+				CATAPULT_KECCAK_UNROLL
+				for (auto i = 0u; i < Num_State_Words; ++i)
+					B[Pi_Destinations[i]] = _mm512_rolv_epi64(A[i], _mm512_set1_epi64(Rotation_Offsets[i]));
+
+				// chi
+				CATAPULT_KECCAK_UNROLL
+				for (auto y = 0u; y < 25; y += 5) {
+					CATAPULT_KECCAK_UNROLL
+					for (auto x = 0u; x < 5; ++x)
+						A[x + y] = _mm512_ternarylogic_epi64(B[x + y], B[(x + 1) % 5 + y], B[(x + 2) % 5 + y], XorAndNot);
+				}
+
+				// iota
+				A[0] = _mm512_xor_si512(A[0], _mm512_set1_epi64(static_cast<int64_t>(Round_Constants[round])));
+			}
+
+			CATAPULT_KECCAK_UNROLL
+			for (auto i = 0u; i < Num_State_Words; ++i)
+				_mm512_storeu_si512(pState + 8 * i, A[i]);
+		}
+#endif
+
+		// endregion
+
+		// region sponge
+
+		// sequentially reads the (concatenated) parts of an input
+		class InputReader {
+		public:
+			explicit InputReader(const MultiBufferHashInput& input)
+					: m_pPart(input.begin())
+					, m_pPartEnd(input.end())
+					, m_partOffset(0)
+			{}
+
+		public:
+			size_t read(uint8_t* pOut, size_t size) {
+				size_t numBytesRead = 0;
+				while (numBytesRead < size && m_pPart != m_pPartEnd) {
+					auto numBytesToCopy = std::min(size - numBytesRead, m_pPart->Size - m_partOffset);
+					if (0 != numBytesToCopy)
+						std::memcpy(pOut + numBytesRead, m_pPart->pData + m_partOffset, numBytesToCopy);
+
+					numBytesRead += numBytesToCopy;
+					m_partOffset += numBytesToCopy;
+					if (m_partOffset == m_pPart->Size) {
+						++m_pPart;
+						m_partOffset = 0;
+					}
+				}
+
+				return numBytesRead;
+			}
+
+		private:
+			const RawBuffer* m_pPart;
+			const RawBuffer* m_pPartEnd;
+			size_t m_partOffset;
+		};
+
+		size_t CalculateNumBlocks(const MultiBufferHashInput& input) {
+			// the last block always contains padding
+			return input.size() / Rate + 1;
+		}
+
+		template<size_t Num_Lanes>
+		void HashLanes(
+				const std::vector<MultiBufferHashInput>& inputs,
+				const size_t* pIndexes,
+				size_t numActiveLanes,
+				Hash256* pHashes,
+				void (*permute)(uint64_t*)) {
+			uint64_t state[Num_State_Words * Num_Lanes] = {};
+			std::vector<InputReader> readers;
+			size_t numBlocks[Num_Lanes] = {};
+			size_t maxNumBlocks = 0;
+			for (auto lane = 0u; lane < numActiveLanes; ++lane) {
+				const auto& input = inputs[pIndexes[lane]];
+				readers.emplace_back(input);
+				numBlocks[lane] = CalculateNumBlocks(input);
+				maxNumBlocks = std::max(maxNumBlocks, numBlocks[lane]);
+			}
+
+			uint8_t block[Rate];
+			for (auto blockIndex = 0u; blockIndex < maxNumBlocks; ++blockIndex) {
+				for (auto lane = 0u; lane < numActiveLanes; ++lane) {
+					if (blockIndex >= numBlocks[lane])
+						continue;
+
+					// absorb next block of lane (with padding if last)
+					std::memset(block, 0, Rate);
+					auto numBytesRead = readers[lane].read(block, Rate);
+					if (blockIndex + 1 == numBlocks[lane]) {
+						block[numBytesRead] ^= Delimited_Suffix;
+						block[Rate - 1] ^= 0x80;
+					}
+
+					for (auto i = 0u; i < Num_Rate_Words; ++i) {
+						uint64_t word;
+						std::memcpy(&word, block + i * sizeof(uint64_t), sizeof(uint64_t));
+						state[i * Num_Lanes + lane] ^= word;
+					}
+				}
+
+				permute(state);
+
+				// squeeze lanes that absorbed their last block
+				for (auto lane = 0u; lane < numActiveLanes; ++lane) {
+					if (blockIndex + 1 != numBlocks[lane])
+						continue;
+
+					auto& hash = pHashes[pIndexes[lane]];
+					for (auto i = 0u; i < Hash256_Size / sizeof(uint64_t); ++i)
+						std::memcpy(hash.data() + i * sizeof(uint64_t), &state[i * Num_Lanes + lane], sizeof(uint64_t));
+				}
+			}
+		}
+
+		template<size_t Num_Lanes>
+		void HashAll(const std::vector<MultiBufferHashInput>& inputs, Hash256* pHashes, void (*permute)(uint64_t*)) {
+			// group inputs with similar sizes in order to minimize the number of permutations of idle lanes
+			std::vector<size_t> indexes(inputs.size());
+			std::iota(indexes.begin(), indexes.end(), 0);
+			std::stable_sort(indexes.begin(), indexes.end(), [&inputs](auto lhs, auto rhs) {
+				return inputs[lhs].size() < inputs[rhs].size();
+			});
+
+			for (auto i = 0u; i < indexes.size(); i += Num_Lanes) {
+				auto numActiveLanes = std::min(Num_Lanes, indexes.size() - i);
+				HashLanes<Num_Lanes>(inputs, &indexes[i], numActiveLanes, pHashes, permute);
+			}
+		}
+
+		void HashAllPortable(const std::vector<MultiBufferHashInput>& inputs, Hash256* pHashes) {
+			for (const auto& input : inputs) {
+				Sha3_256_Builder builder;
+				for (const auto& part : input)
+					builder.update(part);
+
+				builder.final(*pHashes++);
+			}
+		}
+
+		// endregion
+
+		// region cpu detection
+
+		struct CpuFeatures {
+			bool HasAvx2 = false;
+			bool HasAvx512 = false;
+		};
+
+		CpuFeatures DetectCpuFeatures() {
+			CpuFeatures features;
+#if defined(CATAPULT_KECCAK_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 1);
+			auto isOsXsaveEnabled = 0 != (info[2] & (1 << 27));
+			auto xcr0 = isOsXsaveEnabled ? _xgetbv(0) : 0;
+			auto isYmmStateEnabled = 0x06 == (xcr0 & 0x06);
+			auto isZmmStateEnabled = 0xE6 == (xcr0 & 0xE6);
+
+			__cpuidex(info, 7, 0);
+			features.HasAvx2 = isYmmStateEnabled && 0 != (info[1] & (1 << 5));
+			features.HasAvx512 = isZmmStateEnabled && 0 != (info[1] & (1 << 16));
+#elif defined(CATAPULT_KECCAK_X86)
+			__builtin_cpu_init();
+			features.HasAvx2 = __builtin_cpu_supports("avx2");
+			features.HasAvx512 = __builtin_cpu_supports("avx512f");
+#endif
+			return features;
+		}
+
+		const CpuFeatures& GetCpuFeatures() {
+			static const auto features = DetectCpuFeatures();
+			return features;
+		}
+
+		// endregion
+	}
+
+	bool IsSupported(MultiBufferKeccakImplementation implementation) {
+		switch (implementation) {
+		case MultiBufferKeccakImplementation::Portable:
+			return true;
+		case MultiBufferKeccakImplementation::Avx2:
+			return GetCpuFeatures().HasAvx2;
+		case MultiBufferKeccakImplementation::Avx512:
+			return GetCpuFeatures().HasAvx512;
+		}
+
+		return false;
+	}
+
+	MultiBufferKeccakImplementation GetDefaultMultiBufferKeccakImplementation() {
+		if (IsSupported(MultiBufferKeccakImplementation::Avx512))
+			return MultiBufferKeccakImplementation::Avx512;
+
+		if (IsSupported(MultiBufferKeccakImplementation::Avx2))
+			return MultiBufferKeccakImplementation::Avx2;
+
+		return MultiBufferKeccakImplementation::Portable;
+	}
+
+	void Sha3_256_MultiBuffer(const std::vector<MultiBufferHashInput>& inputs, Hash256* pHashes) {
+		static const auto implementation = GetDefaultMultiBufferKeccakImplementation();
+
+		// there is nothing to parallelize with a single input
+		Sha3_256_MultiBuffer(inputs, pHashes, inputs.size() < 2 ? MultiBufferKeccakImplementation::Portable : implementation);
+	}
+
+	void Sha3_256_MultiBuffer(
+			const std::vector<MultiBufferHashInput>& inputs,
+			Hash256* pHashes,
+			MultiBufferKeccakImplementation implementation) {
+		if (!IsSupported(implementation))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported multi-buffer keccak implementation", utils::to_underlying_type(implementation));
+
+		switch (implementation) {
+#ifdef CATAPULT_KECCAK_X86
+		case MultiBufferKeccakImplementation::Avx2:
+			return HashAll<4>(inputs, pHashes, KeccakF1600Avx2);
+		case MultiBufferKeccakImplementation::Avx512:
+			return HashAll<8>(inputs, pHashes, KeccakF1600Avx512);
+#endif
+		default:
+			return HashAllPortable(inputs, pHashes);
+		}
+	}
+}}
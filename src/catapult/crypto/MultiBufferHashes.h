@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <array>
+#include <initializer_list>
+#include <vector>
+
+namespace catapult { namespace crypto {
+
+	/// Input of multi-buffer hashing that is composed of (up to Max_Parts) buffers, which are hashed as if concatenated.
+	class MultiBufferHashInput {
+	public:
+		/// Maximum number of parts composing a single input.
+		static constexpr size_t Max_Parts = 3;
+
+	public:
+		/// Creates an input around \a parts.
+		MultiBufferHashInput(std::initializer_list<RawBuffer> parts);
+
+	public:
+		/// Gets the parts composing this input.
+		const RawBuffer* begin() const {
+			return m_parts.data();
+		}
+
+		/// Gets the end of the parts composing this input.
+		const RawBuffer* end() const {
+			return m_parts.data() + m_numParts;
+		}
+
+		/// Gets the total size of all parts.
+		size_t size() const {
+			return m_size;
+		}
+
+	private:
+		std::array<RawBuffer, Max_Parts> m_parts;
+		size_t m_numParts;
+		size_t m_size;
+	};
+
+	/// Keccak implementations that can be used by multi-buffer hashing.
+	enum class MultiBufferKeccakImplementation {
+		/// Inputs are hashed one at a time.
+		Portable,
+
+		/// Four inputs are hashed together using AVX2.
+		Avx2,
+
+		/// Eight inputs are hashed together using AVX-512.
+		Avx512
+	};
+
+	/// Returns \c true if \a implementation is supported by the current cpu.
+	bool IsSupported(MultiBufferKeccakImplementation implementation);
+
+	/// Gets the fastest implementation supported by the current cpu.
+	MultiBufferKeccakImplementation GetDefaultMultiBufferKeccakImplementation();
+
+	/// Calculates the 256-bit SHA3 hashes of all \a inputs into \a pHashes.
+	/// \note Independent inputs are hashed together when supported by the current cpu.
+	void Sha3_256_MultiBuffer(const std::vector<MultiBufferHashInput>& inputs, Hash256* pHashes);
+
+	/// Calculates the 256-bit SHA3 hashes of all \a inputs into \a pHashes using \a implementation.
+	void Sha3_256_MultiBuffer(
+			const std::vector<MultiBufferHashInput>& inputs,
+			Hash256* pHashes,
+			MultiBufferKeccakImplementation implementation);
+}}
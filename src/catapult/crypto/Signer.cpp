@@ -22,7 +22,10 @@
 #include "CryptoUtils.h"
 #include "Hashes.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <random>
 #include <ref10/crypto_verify_32.h>
 
 extern "C" {
@@ -168,4 +171,302 @@ namespace catapult { namespace crypto {
 		ge_tobytes(checkr, &R);
 		return 0 == crypto_verify_32(checkr, encodedR);
 	}
+
+	namespace {
+		/// Maximum number of signatures combined into a single check.
+		constexpr size_t Max_Batch_Chunk_Size = 64;
+
+		/// Number of random bytes in each coefficient used to combine verification equations.
+		constexpr size_t Coefficient_Size = 16;
+
+		using Scalar = std::array<uint8_t, Encoded_Size>;
+
+		bool IsIdentity(const ge_p2& point) {
+			// identity is (0 : Z : Z)
+			fe yMinusZ;
+			fe_sub(yMinusZ, point.Y, point.Z);
+			return !fe_isnonzero(point.X) && !fe_isnonzero(yMinusZ);
+		}
+
+		// signed sliding window (odd digits in [-15, 15]) representation of \a a (port of ref10 slide)
+		void Slide(int8_t* r, const uint8_t* a) {
+			for (auto i = 0; i < 256; ++i)
+				r[i] = static_cast<int8_t>(1 & (a[i >> 3] >> (i & 7)));
+
+			for (auto i = 0; i < 256; ++i) {
+				if (!r[i])
+					continue;
+
+				for (auto b = 1; b <= 6 && i + b < 256; ++b) {
+					if (!r[i + b])
+						continue;
+
+					if (r[i] + (r[i + b] << b) <= 15) {
+						r[i] = static_cast<int8_t>(r[i] + (r[i + b] << b));
+						r[i + b] = 0;
+					} else if (r[i] - (r[i + b] << b) >= -15) {
+						r[i] = static_cast<int8_t>(r[i] - (r[i + b] << b));
+						for (auto k = i + b; k < 256; ++k) {
+							if (!r[k]) {
+								r[k] = 1;
+								break;
+							}
+
+							r[k] = 0;
+						}
+					} else {
+						break;
+					}
+				}
+			}
+		}
+
+		// calculates sum of scalar * point over all added terms using interleaved (Straus) multiplication
+		class MultiScalarMultiplier {
+		private:
+			struct Term {
+				std::array<ge_cached, 8> Multiples; // P, 3P, 5P, ..., 15P
+				std::array<int8_t, 256> Digits;
+			};
+
+		public:
+			explicit MultiScalarMultiplier(size_t numTerms) {
+				m_terms.reserve(numTerms);
+			}
+
+		public:
+			void add(const ge_p3& point, const Scalar& scalar) {
+				m_terms.emplace_back();
+				auto& term = m_terms.back();
+				Slide(term.Digits.data(), scalar.data());
+
+				ge_p1p1 t;
+				ge_p3 u;
+				ge_p3 doublePoint;
+				ge_p3_dbl(&t, &point);
+				ge_p1p1_to_p3(&doublePoint, &t);
+
+				ge_p3_to_cached(&term.Multiples[0], &point);
+				for (auto i = 1u; i < term.Multiples.size(); ++i) {
+					ge_add(&t, &doublePoint, &term.Multiples[i - 1]);
+					ge_p1p1_to_p3(&u, &t);
+					ge_p3_to_cached(&term.Multiples[i], &u);
+				}
+			}
+
+			bool isSumIdentity() const {
+				auto i = 255;
+				while (i >= 0 && std::none_of(m_terms.cbegin(), m_terms.cend(), [i](const auto& term) { return 0 != term.Digits[i]; }))
+					--i;
+
+				ge_p2 sum;
+				ge_p2_0(&sum);
+
+				ge_p1p1 t;
+				ge_p3 u;
+				for (; i >= 0; --i) {
+					ge_p2_dbl(&t, &sum);
+
+					for (const auto& term : m_terms) {
+						auto digit = term.Digits[static_cast<size_t>(i)];
+						if (digit > 0) {
+							ge_p1p1_to_p3(&u, &t);
+							ge_add(&t, &u, &term.Multiples[static_cast<size_t>(digit / 2)]);
+						} else if (digit < 0) {
+							ge_p1p1_to_p3(&u, &t);
+							ge_sub(&t, &u, &term.Multiples[static_cast<size_t>(-digit / 2)]);
+						}
+					}
+
+					ge_p1p1_to_p2(&sum, &t);
+				}
+
+				return IsIdentity(sum);
+			}
+
+		private:
+			std::vector<Term> m_terms;
+		};
+
+		struct BatchItem {
+			ge_p3 NegativeA;
+			ge_p3 NegativeR;
+			Scalar H;
+		};
+
+		enum class BatchItemPreparationResult {
+			/// Input is definitely not verifiable.
+			Reject,
+
+			/// Input needs to be verified individually.
+			Verify_Individually,
+
+			/// Input can be verified as part of a combined check.
+			Batch
+		};
+
+		// 2^252 + 27742317777372353535851937790883648493, little endian
+		constexpr Scalar Group_Order{ {
+			0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+		} };
+
+		bool IsTorsionFree(const ge_p3& point) {
+			// point is in the prime order subgroup if and only if multiplying it by the group order yields the identity
+			const Scalar Zero_Scalar{};
+			ge_p2 product;
+			ge_double_scalarmult_vartime(&product, Group_Order.data(), &point, Zero_Scalar.data());
+			return IsIdentity(product);
+		}
+
+		bool IsCanonicalEncoding(const ge_p3& point, const uint8_t* encoded) {
+			// point is affine (Z == 1) after decoding
+			Scalar encodedY;
+			fe_tobytes(encodedY.data(), point.Y);
+
+			auto isSignBitSet = 0 != (encoded[Encoded_Size - 1] & 0x80);
+			if (isSignBitSet && !fe_isnonzero(point.X))
+				return false;
+
+			encodedY[Encoded_Size - 1] = static_cast<uint8_t>(encodedY[Encoded_Size - 1] | (encoded[Encoded_Size - 1] & 0x80));
+			return 0 == std::memcmp(encodedY.data(), encoded, Encoded_Size);
+		}
+
+		// prepares \a item for \a input
+		BatchItemPreparationResult PrepareBatchItem(const SignatureInput& input, BatchItem& item) {
+			const uint8_t *RESTRICT encodedR = input.Signature.data();
+			const uint8_t *RESTRICT encodedS = input.Signature.data() + Encoded_Size;
+
+			// reject in all cases that are rejected by Verify without considering the verification equation
+			const Key Zero_Key{};
+			if (!IsCanonicalS(encodedS) || Zero_Key == input.PublicKey)
+				return BatchItemPreparationResult::Reject;
+
+			if (0 != ge_frombytes_negate_vartime(&item.NegativeA, input.PublicKey.data()))
+				return BatchItemPreparationResult::Reject;
+
+			// Verify compares against a canonical encoding, so R must be canonically encoded
+			if (0 != ge_frombytes_negate_vartime(&item.NegativeR, encodedR) || !IsCanonicalEncoding(item.NegativeR, encodedR))
+				return BatchItemPreparationResult::Reject;
+
+			// a combined check can only detect small order components with some probability (when the random coefficient
+			// is not a multiple of their order), so only points in the prime order subgroup are checked together
+			// (in this case, the combined check passes if and only if the equation checked by Verify holds for all inputs)
+			if (!IsTorsionFree(item.NegativeA) || !IsTorsionFree(item.NegativeR))
+				return BatchItemPreparationResult::Verify_Individually;
+
+			// h = H(encodedR || public || data) mod group order
+			Hash512 h;
+			Sha3_512_Builder sha3_h;
+			sha3_h.update({ { encodedR, Encoded_Size }, input.PublicKey, input.Data });
+			sha3_h.final(h);
+			sc_reduce(h.data());
+			std::memcpy(item.H.data(), h.data(), Encoded_Size);
+			return BatchItemPreparationResult::Batch;
+		}
+
+		// generates unpredictable coefficients by hashing a counter with a random key that is only drawn once per thread
+		class CoefficientGenerator {
+		public:
+			CoefficientGenerator() : m_counter(0) {
+				std::random_device generator;
+				for (auto i = 0u; i < m_key.size(); i += sizeof(uint32_t)) {
+					auto randomValue = static_cast<uint32_t>(generator());
+					std::memcpy(m_key.data() + i, &randomValue, sizeof(uint32_t));
+				}
+			}
+
+		public:
+			void next(Scalar& coefficient) {
+				Hash256 hash;
+				Sha3_256_Builder builder;
+				builder.update({ m_key, { reinterpret_cast<const uint8_t*>(&m_counter), sizeof(uint64_t) } });
+				builder.final(hash);
+				++m_counter;
+
+				coefficient = Scalar();
+				std::memcpy(coefficient.data(), hash.data(), Coefficient_Size);
+			}
+
+		private:
+			Hash256 m_key;
+			uint64_t m_counter;
+		};
+
+		bool VerifyIndividually(const SignatureInput& input) {
+			return Verify(input.PublicKey, input.Data, input.Signature);
+		}
+
+		void VerifyBatchChunk(
+				const std::vector<SignatureInput>& inputs,
+				size_t startIndex,
+				size_t endIndex,
+				CoefficientGenerator& generator,
+				std::vector<bool>& results) {
+			// for all candidates, check that sum(z_i * (S_i * B - h_i * A_i - R_i)) is identity for random z_i
+			const Scalar Zero_Scalar{};
+			Scalar combinedS{};
+			MultiScalarMultiplier multiplier(2 * (endIndex - startIndex) + 1);
+			std::vector<size_t> candidateIndexes;
+
+			BatchItem item;
+			for (auto i = startIndex; i < endIndex; ++i) {
+				auto preparationResult = PrepareBatchItem(inputs[i], item);
+				if (BatchItemPreparationResult::Reject == preparationResult)
+					continue;
+
+				if (BatchItemPreparationResult::Verify_Individually == preparationResult) {
+					results[i] = VerifyIndividually(inputs[i]);
+					continue;
+				}
+
+				Scalar z;
+				generator.next(z);
+
+				// multiples of -R_i and -A_i
+				Scalar zh;
+				sc_muladd(zh.data(), z.data(), item.H.data(), Zero_Scalar.data());
+				multiplier.add(item.NegativeR, z);
+				multiplier.add(item.NegativeA, zh);
+
+				// accumulate multiple of B
+				sc_muladd(combinedS.data(), z.data(), inputs[i].Signature.data() + Encoded_Size, combinedS.data());
+				candidateIndexes.push_back(i);
+			}
+
+			// a combined check has no benefit for a single candidate
+			if (candidateIndexes.size() > 1) {
+				Scalar one{};
+				one[0] = 1;
+				ge_p3 basePoint;
+				ge_scalarmult_base(&basePoint, one.data());
+				multiplier.add(basePoint, combinedS);
+
+				if (multiplier.isSumIdentity()) {
+					for (auto index : candidateIndexes)
+						results[index] = true;
+
+					return;
+				}
+			}
+
+			// fall back to individual verification in order to identify the invalid signature(s)
+			for (auto index : candidateIndexes)
+				results[index] = VerifyIndividually(inputs[index]);
+		}
+	}
+
+	std::vector<bool> VerifyBatch(const std::vector<SignatureInput>& inputs) {
+		std::vector<bool> results(inputs.size(), false);
+		if (inputs.empty())
+			return results;
+
+		thread_local CoefficientGenerator generator;
+		for (size_t startIndex = 0; startIndex < inputs.size(); startIndex += Max_Batch_Chunk_Size) {
+			auto endIndex = std::min<size_t>(startIndex + Max_Batch_Chunk_Size, inputs.size());
+			VerifyBatchChunk(inputs, startIndex, endIndex, generator, results);
+		}
+
+		return results;
+	}
 }}
@@ -39,4 +39,26 @@ namespace catapult { namespace crypto {
 	/// Verifies that \a signature of data in \a buffersList is valid, using public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature);
+
+	/// A single signature verification request.
+	struct SignatureInput {
+		/// Public key of the signer.
+		const Key& PublicKey;
+
+		/// Signed data.
+		RawBuffer Data;
+
+		/// Signature of data.
+		const catapult::Signature& Signature;
+	};
+
+	/// Verifies all signatures in \a inputs at once.
+	/// Returns a vector containing \c true for each valid signature and \c false for each invalid signature.
+	/// \note Signatures are checked in chunks with a single random linear combination of their verification equations.
+	///       When a combined check fails, all signatures in the corresponding chunk are verified individually.
+	/// \note Signatures with public keys or R parts that have small order components are always verified individually,
+	///       so the results are the same as the results of Verify.
+	/// \note The prime order subgroup checks make this slower than calling Verify for each signature (see the signature benchmark),
+	///       so validation and cosignature processing use Verify.
+	std::vector<bool> VerifyBatch(const std::vector<SignatureInput>& inputs);
 }}
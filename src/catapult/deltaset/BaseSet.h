@@ -60,7 +60,9 @@ namespace catapult { namespace deltaset {
 		/// Creates a base set.
 		/// \a args are forwarded to the underlying container.
 		template<typename... TArgs>
-		explicit BaseSet(TArgs&&... args) : m_elements(std::forward<TArgs>(args)...)
+		explicit BaseSet(TArgs&&... args)
+				: m_elements(std::forward<TArgs>(args)...)
+				, m_generation(0)
 		{}
 
 	public:
@@ -87,6 +89,11 @@ namespace catapult { namespace deltaset {
 			return m_elements.cend() != m_elements.find(key);
 		}
 
+		/// Gets the generation of this set, which is incremented by every commit that changes the set.
+		size_t generation() const {
+			return m_generation;
+		}
+
 	public:
 		/// Returns a delta based on the same original elements as this set.
 		std::shared_ptr<DeltaType> rebase() {
@@ -113,13 +120,20 @@ namespace catapult { namespace deltaset {
 			if (!pDelta)
 				CATAPULT_THROW_RUNTIME_ERROR("attempting to commit changes to a set without any outstanding attached deltas");
 
+			// notice that the size check is required to detect changes made by commit policies (e.g. pruning)
 			auto deltas = pDelta->deltas();
+			auto hasChanges = !deltas.Added.empty() || !deltas.Removed.empty() || !deltas.Copied.empty();
+			auto originalSize = m_elements.size();
 			TCommitPolicy::Update(m_elements, deltas, std::forward<TArgs>(args)...);
 			pDelta->reset();
+
+			if (hasChanges || originalSize != m_elements.size())
+				++m_generation;
 		}
 
 	private:
 		SetType m_elements;
+		size_t m_generation;
 		std::weak_ptr<DeltaType> m_pWeakDelta;
 
 	private:
@@ -25,10 +25,29 @@
 namespace catapult { namespace deltaset {
 
 	/// Mixin that wraps BaseSetDelta and provides a facade on top of BaseSetDelta::deltas().
-	/// \note This only works for map-based delta sets.
 	template<typename TSetDelta>
 	class DeltaElementsMixin {
 	private:
+		// used to select values from map-based (key value pairs) and set-based (values) delta sets
+
+		template<typename TElement>
+		struct ElementSelectorT {
+			using ValueType = TElement;
+
+			static const ValueType& Select(const TElement& element) {
+				return element;
+			}
+		};
+
+		template<typename TKey, typename TValue>
+		struct ElementSelectorT<std::pair<TKey, TValue>> {
+			using ValueType = TValue;
+
+			static const ValueType& Select(const std::pair<TKey, TValue>& pair) {
+				return pair.second;
+			}
+		};
+
 		// used to dereference values and values pointed to by shared_ptr
 		// (this is required to support shared_ptr value types in BaseSet)
 
@@ -51,7 +70,8 @@ namespace catapult { namespace deltaset {
 		};
 
 	private:
-		using DerefHelper = DerefHelperT<typename TSetDelta::SetType::value_type::second_type>;
+		using ElementSelector = ElementSelectorT<typename TSetDelta::SetType::value_type>;
+		using DerefHelper = DerefHelperT<typename ElementSelector::ValueType>;
 		using PointerContainer = std::unordered_set<typename DerefHelper::const_pointer_type>;
 
 	public:
@@ -79,8 +99,8 @@ namespace catapult { namespace deltaset {
 		template<typename TSource>
 		static PointerContainer CollectAllPointers(const TSource& source) {
 			PointerContainer dest;
-			for (const auto& pair : source)
-				dest.insert(&DerefHelper::Deref(pair.second));
+			for (const auto& element : source)
+				dest.insert(&DerefHelper::Deref(ElementSelector::Select(element)));
 
 			return dest;
 		}
@@ -23,7 +23,6 @@
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/Functional.h"
-#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -58,6 +57,7 @@ namespace catapult { namespace disruptor {
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_elementTraceInterval(options.ElementTraceInterval)
 			, m_shouldThrowIfFull(options.ShouldThrowIfFull)
+			, m_waitStrategy(options.WaitStrategy)
 			, m_keepRunning(true)
 			, m_barriers(consumers.size() + 1)
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
@@ -68,14 +68,18 @@ namespace catapult { namespace disruptor {
 			ConsumerEntry consumerEntry(currentLevel++);
 			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+				auto& barrier = pThis->m_barriers[consumerEntry.level()];
+				size_t numIdleIterations = 0;
 				while (pThis->m_keepRunning) {
 					try {
 						auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 						if (!pDisruptorElement) {
-							std::this_thread::sleep_for(std::chrono::milliseconds(10));
+							WaitForBarrier(pThis->m_waitStrategy, barrier, consumerEntry.position(), numIdleIterations++);
 							continue;
 						}
 
+						numIdleIterations = 0;
+
 						auto result = consumer(pDisruptorElement->input());
 						if (CompletionStatus::Aborted == result.CompletionStatus)
 							pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
@@ -92,7 +96,9 @@ namespace catapult { namespace disruptor {
 			});
 		}
 
-		CATAPULT_LOG(info) << options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers";
+		CATAPULT_LOG(info)
+				<< options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size()
+				<< " workers with wait strategy " << m_waitStrategy;
 	}
 
 	ConsumerDispatcher::~ConsumerDispatcher() {
@@ -101,6 +107,11 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+
+		// wake up all blocked consumers so that they can observe the shutdown
+		for (auto i = 0u; i < m_barriers.size(); ++i)
+			m_barriers[i].notifyAll();
+
 		m_threads.join_all();
 	}
 
@@ -82,6 +82,7 @@ namespace catapult { namespace disruptor {
 	private:
 		size_t m_elementTraceInterval;
 		bool m_shouldThrowIfFull;
+		WaitStrategy m_waitStrategy;
 		std::atomic_bool m_keepRunning;
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
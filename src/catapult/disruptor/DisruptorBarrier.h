@@ -23,6 +23,9 @@
 #include "catapult/utils/Logging.h"
 #include "catapult/preprocessor.h"
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -36,11 +39,30 @@ namespace catapult { namespace disruptor {
 		DisruptorBarrier(size_t level, PositionType position)
 				: m_level(level)
 				, m_position(position)
+				, m_numWaiters(0)
 		{}
 
-		/// Advances the barrier.
+		/// Advances the barrier and wakes up any consumers blocked on it.
 		CATAPULT_INLINE void advance() {
 			++m_position;
+
+			// only acquire the lock when there is at least one blocked consumer
+			if (0 != m_numWaiters)
+				notifyAll();
+		}
+
+		/// Blocks until the barrier position is different from \a position or \a timeout elapses.
+		void waitFor(PositionType position, const std::chrono::milliseconds& timeout) {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			++m_numWaiters;
+			m_condition.wait_for(lock, timeout, [this, position]() { return position != m_position; });
+			--m_numWaiters;
+		}
+
+		/// Wakes up all consumers blocked on the barrier.
+		void notifyAll() {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_condition.notify_all();
 		}
 
 		/// Returns level of the barrier.
@@ -56,5 +78,9 @@ namespace catapult { namespace disruptor {
 	private:
 		const size_t m_level;
 		std::atomic<PositionType> m_position;
+
+		std::atomic<size_t> m_numWaiters;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
 	};
 }}
@@ -0,0 +1,76 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "WaitStrategy.h"
+#include "DisruptorBarrier.h"
+#include "catapult/utils/ConfigurationValueParsers.h"
+#include "catapult/utils/MacroBasedEnumIncludes.h"
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define DEFINE_ENUM WaitStrategy
+#define ENUM_LIST WAIT_STRATEGY_LIST
+#include "catapult/utils/MacroBasedEnum.h"
+#undef ENUM_LIST
+#undef DEFINE_ENUM
+
+	namespace {
+		const std::array<std::pair<const char*, WaitStrategy>, 4> String_To_Wait_Strategy_Pairs{{
+			{ "Sleep", WaitStrategy::Sleep },
+			{ "BusySpin", WaitStrategy::Busy_Spin },
+			{ "SpinThenYield", WaitStrategy::Spin_Then_Yield },
+			{ "Blocking", WaitStrategy::Blocking }
+		}};
+
+		// number of idle iterations after which a spinning consumer starts yielding
+		constexpr size_t Max_Spin_Iterations = 1000;
+
+		// maximum amount of time a blocked consumer waits before rechecking its state (e.g. to detect shutdown)
+		constexpr auto Max_Blocking_Wait = std::chrono::milliseconds(10);
+
+		// amount of time a sleeping consumer waits before polling again
+		constexpr auto Sleep_Interval = std::chrono::milliseconds(10);
+	}
+
+	bool TryParseValue(const std::string& str, WaitStrategy& strategy) {
+		return utils::TryParseEnumValue(String_To_Wait_Strategy_Pairs, str, strategy);
+	}
+
+	void WaitForBarrier(WaitStrategy strategy, DisruptorBarrier& barrier, PositionType position, size_t numIdleIterations) {
+		switch (strategy) {
+		case WaitStrategy::Busy_Spin:
+			break;
+
+		case WaitStrategy::Spin_Then_Yield:
+			if (numIdleIterations >= Max_Spin_Iterations)
+				std::this_thread::yield();
+			break;
+
+		case WaitStrategy::Blocking:
+			barrier.waitFor(position, Max_Blocking_Wait);
+			break;
+
+		default:
+			std::this_thread::sleep_for(Sleep_Interval);
+			break;
+		}
+	}
+}}
@@ -0,0 +1,59 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DisruptorTypes.h"
+#include <iosfwd>
+#include <string>
+
+namespace catapult { namespace disruptor { class DisruptorBarrier; } }
+
+namespace catapult { namespace disruptor {
+
+#define WAIT_STRATEGY_LIST \
+	/* Idle consumers sleep for a fixed interval before polling their barriers again. */ \
+	ENUM_VALUE(Sleep) \
+	\
+	/* Idle consumers continuously poll their barriers. */ \
+	ENUM_VALUE(Busy_Spin) \
+	\
+	/* Idle consumers poll their barriers for a bounded number of iterations and then yield between polls. */ \
+	ENUM_VALUE(Spin_Then_Yield) \
+	\
+	/* Idle consumers block until their barriers are advanced. */ \
+	ENUM_VALUE(Blocking)
+
+#define ENUM_VALUE(LABEL) LABEL,
+	/// Possible strategies used by idle consumers to wait for their barriers to advance.
+	enum class WaitStrategy : uint8_t {
+		WAIT_STRATEGY_LIST
+	};
+#undef ENUM_VALUE
+
+	/// Insertion operator for outputting \a value to \a out.
+	std::ostream& operator<<(std::ostream& out, WaitStrategy value);
+
+	/// Tries to parse \a str into a wait \a strategy.
+	bool TryParseValue(const std::string& str, WaitStrategy& strategy);
+
+	/// Waits for \a barrier to advance beyond \a position according to \a strategy.
+	/// \a numIdleIterations is the number of consecutive waits that have not been followed by any progress.
+	void WaitForBarrier(WaitStrategy strategy, DisruptorBarrier& barrier, PositionType position, size_t numIdleIterations);
+}}
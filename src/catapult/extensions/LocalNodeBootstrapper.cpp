@@ -29,6 +29,7 @@ namespace catapult { namespace extensions {
 		plugins::StorageConfiguration CreateStorageConfiguration(const config::LocalNodeConfiguration& config) {
 			plugins::StorageConfiguration storageConfig;
 			storageConfig.PreferCacheDatabase = config.Node.ShouldUseCacheDatabaseStorage;
+			storageConfig.EnableCachePatriciaTrees = config.Node.ShouldEnableCachePatriciaTrees;
 			storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 			return storageConfig;
 		}
@@ -54,6 +54,12 @@ namespace catapult { namespace io {
 				m_pBlockChangeSubscriber->notifyBlock(blockElement);
 			}
 
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				m_pStorage->saveBlocks(blockElements);
+				for (const auto& blockElement : blockElements)
+					m_pBlockChangeSubscriber->notifyBlock(blockElement);
+			}
+
 			void dropBlocksAfter(Height height) override {
 				m_pStorage->dropBlocksAfter(height);
 				m_pBlockChangeSubscriber->notifyDropBlocksAfter(height);
@@ -24,6 +24,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/NonCopyable.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace io {
 
@@ -42,6 +43,13 @@ namespace catapult { namespace io {
 		/// Saves \a blockElement.
 		virtual void saveBlock(const model::BlockElement& blockElement) = 0;
 
+		/// Saves all \a blockElements, which must have consecutive heights.
+		/// \note By default, block elements are saved one at a time.
+		virtual void saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements)
+				saveBlock(blockElement);
+		}
+
 		/// Drops all blocks after \a height.
 		virtual void dropBlocksAfter(Height height) = 0;
 	};
@@ -20,7 +20,11 @@
 
 #include "BlockStorageCache.h"
 #include "catapult/model/Elements.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
@@ -61,62 +65,135 @@ namespace catapult { namespace io {
 
 			return pBlockElement;
 		}
+
+		uint64_t GetBlockElementSize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement);
+		}
 	}
 
 	/// Cached data holder.
 	struct CachedData {
+	private:
+		struct CacheEntry {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			uint64_t Size;
+		};
+
+		using CacheEntries = std::list<CacheEntry>;
+
 	public:
-		CachedData() = default;
+		/// Creates cached data that holds at most \a maxSize bytes of block elements.
+		explicit CachedData(utils::FileSize maxSize)
+				: m_maxSize(maxSize.bytes())
+				, m_size(0)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
 
+	public:
 		/// Returns cached height.
 		Height getHeight() const {
 			return m_chainHeight;
 		}
 
-		/// Returns \c true if cache contains element at \a height.
-		bool contains(Height height) const {
-			return m_pBlockElement && height == m_pBlockElement->Block.Height;
+		/// Returns the cached block element at \a height or \c nullptr if it is not cached.
+		std::shared_ptr<const model::BlockElement> find(Height height) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_entryMap.find(height);
+			if (m_entryMap.cend() == iter) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			// mark the element as most recently used
+			m_entries.splice(m_entries.begin(), m_entries, iter->second);
+			++m_numHits;
+			return iter->second->pBlockElement;
 		}
 
-		/// Returns cached block element.
-		std::shared_ptr<const model::BlockElement> getBlockElement(Height) const {
-			return m_pBlockElement;
+		/// Returns cache statistics.
+		BlockStorageCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return { m_numHits, m_numMisses, m_entries.size(), utils::FileSize::FromBytes(m_size) };
 		}
 
-		/// Returns cached block.
-		std::shared_ptr<const model::Block> getBlock(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		/// Gets the maximum size of all cached block elements.
+		uint64_t maxSize() const {
+			return m_maxSize;
 		}
 
+	public:
 		/// Updates cache with block element (\a blockElement).
 		void update(const model::BlockElement& blockElement) {
-			// note: update receives elements during loadBlock, but also saveBlock. We get them from BlockChainSyncConsumer,
+			// note: update receives elements during saveBlock. We get them from BlockChainSyncConsumer,
 			// and it gets them from disruptor... in order NOT to copy here we'd need to take ownership of those.
 			// Currently we can't/shouldn't do it, as there's "new block" consumer afterwards and possibly ProcessingCompleteFunc.
-			m_pBlockElement = Copy(blockElement);
+			insert(Copy(blockElement));
+		}
+
+		/// Updates cache with shared block element (\a pBlockElement).
+		void insert(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			utils::SpinLockGuard guard(m_lock);
+			remove(pBlockElement->Block.Height);
+
+			auto size = GetBlockElementSize(*pBlockElement);
+			m_entries.push_front({ pBlockElement, size });
+			m_entryMap.emplace(pBlockElement->Block.Height, m_entries.begin());
+			m_size += size;
+
+			// evict least recently used elements but always keep the most recent one
+			while (m_size > m_maxSize && m_entries.size() > 1)
+				remove(m_entries.back().pBlockElement->Block.Height);
 		}
 
 		/// Updates cached height to \a height.
 		void update(Height height) {
 			m_chainHeight = height;
 
-			if (m_pBlockElement && height < m_pBlockElement->Block.Height)
-				m_pBlockElement.reset();
+			utils::SpinLockGuard guard(m_lock);
+			std::vector<Height> invalidHeights;
+			for (const auto& pair : m_entryMap) {
+				if (height < pair.first)
+					invalidHeights.push_back(pair.first);
+			}
+
+			for (auto invalidHeight : invalidHeights)
+				remove(invalidHeight);
+		}
+
+	private:
+		void remove(Height height) {
+			auto iter = m_entryMap.find(height);
+			if (m_entryMap.cend() == iter)
+				return;
+
+			m_size -= iter->second->Size;
+			m_entries.erase(iter->second);
+			m_entryMap.erase(iter);
 		}
 
 	private:
 		// note: the reason to have them separated is drop blocks, which
 		// updates the height, but we don't want to touch cached block(s).
 		Height m_chainHeight;
-		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+
+		uint64_t m_maxSize;
+		uint64_t m_size;
+		uint64_t m_numHits;
+		uint64_t m_numMisses;
+		CacheEntries m_entries; // ordered from most to least recently used
+		std::unordered_map<Height, CacheEntries::iterator, utils::BaseValueHasher<Height>> m_entryMap;
+		mutable utils::SpinLock m_lock; // views share a reader lock, so cache lookups need to be synchronized
 	};
 
 	BlockStorageCache::~BlockStorageCache() = default;
 
 	// This ctor takes r-value, to move the storage (that's not a move ctor).
-	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage)
+	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, utils::FileSize maxCacheSize)
 			: m_pStorage(std::move(pStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCacheSize)) {
 		m_pCachedData->update(m_pStorage->chainHeight());
 	}
 
@@ -127,23 +204,21 @@ namespace catapult { namespace io {
 	}
 
 	std::shared_ptr<const model::Block> BlockStorageView::loadBlock(Height height) const {
-		if (height > chainHeight())
-			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
-
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlock(height);
-
-		return m_storage.loadBlock(height);
+		return BlockElementAsSharedBlock(loadBlockElement(height));
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlockElement(height);
+		auto pBlockElement = m_cachedData.find(height);
+		if (pBlockElement)
+			return pBlockElement;
 
-		return m_storage.loadBlockElement(height);
+		// note: block elements are loaded (instead of blocks) on a miss so that they can be used to serve either type of request
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.insert(pBlockElement);
+		return pBlockElement;
 	}
 
 	model::HashRange BlockStorageView::loadHashesFrom(Height height, size_t maxHashes) const {
@@ -161,6 +236,21 @@ namespace catapult { namespace io {
 
 			cachedData.update(blockElement);
 		}
+
+		size_t FindFirstCacheableIndex(const CachedData& cachedData, const std::vector<model::BlockElement>& blockElements) {
+			// only copy the elements at the end of the range that fit into the cache (but always at least the last one)
+			auto index = blockElements.size() - 1;
+			auto size = GetBlockElementSize(blockElements[index]);
+			while (index > 0) {
+				size += GetBlockElementSize(blockElements[index - 1]);
+				if (size > cachedData.maxSize())
+					break;
+
+				--index;
+			}
+
+			return index;
+		}
 	}
 
 	void BlockStorageModifier::saveBlock(const model::BlockElement& blockElement) {
@@ -172,10 +262,10 @@ namespace catapult { namespace io {
 		if (blockElements.empty())
 			return;
 
-		for (const auto& blockElement : blockElements)
-			m_storage.saveBlock(blockElement);
+		m_storage.saveBlocks(blockElements);
 
-		CacheBlockElement(m_cachedData, blockElements.back());
+		for (auto i = FindFirstCacheableIndex(m_cachedData, blockElements); i < blockElements.size(); ++i)
+			CacheBlockElement(m_cachedData, blockElements[i]);
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
@@ -195,5 +285,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, m_lock.acquireReader(), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
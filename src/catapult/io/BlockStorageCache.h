@@ -20,6 +20,7 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
@@ -33,7 +34,7 @@ namespace catapult { namespace io {
 		explicit BlockStorageView(
 				const BlockStorage& storage,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-				const CachedData& cachedData)
+				CachedData& cachedData)
 				: m_storage(storage)
 				, m_readLock(std::move(readLock))
 				, m_cachedData(cachedData)
@@ -55,7 +56,7 @@ namespace catapult { namespace io {
 	private:
 		const BlockStorage& m_storage;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		const CachedData& m_cachedData;
+		CachedData& m_cachedData;
 	};
 
 	/// A write only view on top of block storage.
@@ -89,12 +90,28 @@ namespace catapult { namespace io {
 		CachedData& m_cachedData;
 	};
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of block loads served from memory.
+		uint64_t NumHits;
+
+		/// Number of block loads served from the underlying storage.
+		uint64_t NumMisses;
+
+		/// Number of cached block elements.
+		size_t NumCachedElements;
+
+		/// Total size of all cached block elements.
+		utils::FileSize CachedSize;
+	};
+
 	/// A cache around a BlockStorage.
-	/// \note Currently this "cache" only provides synchronization.
+	/// \note In addition to providing synchronization, this cache keeps recently saved and loaded block elements in memory.
 	class BlockStorageCache {
 	public:
-		/// Creates a new cache around \a pStorage.
-		explicit BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage);
+		/// Creates a new cache around \a pStorage that keeps at most \a maxCacheSize bytes of block elements in memory.
+		/// \note The most recently cached block element is always retained, even when it is larger than \a maxCacheSize.
+		explicit BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, utils::FileSize maxCacheSize = utils::FileSize());
 
 		/// Destroys the cache.
 		~BlockStorageCache();
@@ -106,6 +123,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
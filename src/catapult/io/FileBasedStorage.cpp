@@ -140,6 +140,8 @@ namespace catapult { namespace io {
 	void FileBasedStorage::HashFile::save(Height height, const Hash256& hash) {
 		auto currentId = height.unwrap() / Files_Per_Directory;
 		if (m_cachedDirectoryId != currentId) {
+			// the previous hash file might contain uncommitted hashes
+			flush();
 			m_pCachedHashFile = OpenHashFile(m_dataDirectory, height, OpenMode::Read_Append);
 			m_cachedDirectoryId = currentId;
 		}
@@ -148,24 +150,30 @@ namespace catapult { namespace io {
 		m_pCachedHashFile->write(hash);
 	}
 
-	FileBasedStorage::FileBasedStorage(const std::string& dataDirectory)
-			: m_dataDirectory(dataDirectory)
-			, m_hashFile(m_dataDirectory)
-	{}
+	void FileBasedStorage::HashFile::flush() {
+		if (m_pCachedHashFile)
+			m_pCachedHashFile->flush();
+	}
 
 	namespace {
-		void SetHeight(const std::string& baseDirectory, Height height) {
-			auto pJournalFile = OpenJournalFile(baseDirectory, OpenMode::Read_Write);
-			Write(*pJournalFile, height);
+		Height LoadHeight(const std::string& baseDirectory) {
+			if (!HasJournal(baseDirectory))
+				return Height(1);
+
+			auto pJournalFile = OpenJournalFile(baseDirectory);
+			return Read<Height>(*pJournalFile);
 		}
 	}
 
-	Height FileBasedStorage::chainHeight() const {
-		if (!HasJournal(m_dataDirectory))
-			return Height(1);
+	FileBasedStorage::FileBasedStorage(const std::string& dataDirectory, FileBasedStorageCommitMode commitMode)
+			: m_dataDirectory(dataDirectory)
+			, m_commitMode(commitMode)
+			, m_hashFile(m_dataDirectory)
+			, m_chainHeight(LoadHeight(m_dataDirectory))
+	{}
 
-		auto pJournalFile = OpenJournalFile(m_dataDirectory);
-		return Read<Height>(*pJournalFile);
+	Height FileBasedStorage::chainHeight() const {
+		return m_chainHeight;
 	}
 
 	namespace {
@@ -244,39 +252,96 @@ namespace catapult { namespace io {
 	}
 
 	void FileBasedStorage::saveBlock(const model::BlockElement& blockElement) {
-		auto currentHeight = chainHeight();
 		auto height = blockElement.Block.Height;
-
-		if (height != currentHeight + Height(1))
+		if (height != chainHeight() + Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
 
-		{
-			auto pBlockFile = OpenBlockFile(m_dataDirectory, height, OpenMode::Read_Write);
-			pBlockFile->write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
-			pBlockFile->write(blockElement.EntityHash);
-			pBlockFile->write(blockElement.GenerationHash);
-
-			// we should probably save it in a separate file, but temporarily we can just store it here.
-			auto transactionsCount = static_cast<uint32_t>(blockElement.Transactions.size());
-			pBlockFile->write({ reinterpret_cast<const uint8_t*>(&transactionsCount), sizeof(uint32_t) });
-			std::vector<Hash256> hashes(2 * transactionsCount);
-			auto iter = hashes.begin();
-			for (const auto& transactionElement : blockElement.Transactions) {
-				*iter++ = transactionElement.EntityHash;
-				*iter++ = transactionElement.MerkleComponentHash;
-			}
+		saveBlockFile(blockElement);
+		m_hashFile.save(height, blockElement.EntityHash);
+		commit(height);
+	}
 
-			pBlockFile->write({ reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+	void FileBasedStorage::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+		if (FileBasedStorageCommitMode::Per_Block == m_commitMode) {
+			PrunableBlockStorage::saveBlocks(blockElements);
+			return;
 		}
 
-		m_hashFile.save(height, blockElement.EntityHash);
+		if (blockElements.empty())
+			return;
+
+		auto expectedHeight = chainHeight();
+		for (const auto& blockElement : blockElements) {
+			expectedHeight = expectedHeight + Height(1);
+			if (expectedHeight != blockElement.Block.Height)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", blockElement.Block.Height);
+		}
+
+		// write (and flush) all files and then commit them together
+		for (const auto& blockElement : blockElements) {
+			saveBlockFile(blockElement);
+			m_hashFile.save(blockElement.Block.Height, blockElement.EntityHash);
+		}
+
+		commit(expectedHeight);
+	}
 
-		if (height > currentHeight)
-			SetHeight(m_dataDirectory, height);
+	void FileBasedStorage::saveBlockFile(const model::BlockElement& blockElement) {
+		auto pBlockFile = OpenBlockFile(m_dataDirectory, blockElement.Block.Height, OpenMode::Read_Write);
+		pBlockFile->write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
+		pBlockFile->write(blockElement.EntityHash);
+		pBlockFile->write(blockElement.GenerationHash);
+
+		// we should probably save it in a separate file, but temporarily we can just store it here.
+		auto transactionsCount = static_cast<uint32_t>(blockElement.Transactions.size());
+		pBlockFile->write({ reinterpret_cast<const uint8_t*>(&transactionsCount), sizeof(uint32_t) });
+		std::vector<Hash256> hashes(2 * transactionsCount);
+		auto iter = hashes.begin();
+		for (const auto& transactionElement : blockElement.Transactions) {
+			*iter++ = transactionElement.EntityHash;
+			*iter++ = transactionElement.MerkleComponentHash;
+		}
+
+		pBlockFile->write({ reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+		pBlockFile->flush();
 	}
 
 	void FileBasedStorage::dropBlocksAfter(Height height) {
-		SetHeight(m_dataDirectory, height);
+		setHeight(height);
+	}
+
+	void FileBasedStorage::commit(Height height) {
+		// block files are flushed when written, so only the hashes and the new directory entries need to be made durable
+		// before the index references them
+		m_hashFile.flush();
+
+		auto startHeight = chainHeight() + Height(1);
+		auto isDirectoryCreated = false;
+		for (auto id = startHeight.unwrap() / Files_Per_Directory; id <= height.unwrap() / Files_Per_Directory; ++id) {
+			auto directoryStartHeight = Height(std::max<uint64_t>(1, id * Files_Per_Directory));
+			isDirectoryCreated = isDirectoryCreated || startHeight <= directoryStartHeight;
+			FlushDirectory(GetDirectoryPath(m_dataDirectory, directoryStartHeight).generic_string());
+		}
+
+		if (isDirectoryCreated)
+			FlushDirectory(m_dataDirectory);
+
+		setHeight(height);
+	}
+
+	void FileBasedStorage::setHeight(Height height) {
+		// overwrite the index in place (instead of truncating it) so that a valid height is always persisted
+		auto isIndexCreated = !HasJournal(m_dataDirectory);
+		{
+			auto pJournalFile = OpenJournalFile(m_dataDirectory, OpenMode::Read_Append);
+			Write(*pJournalFile, height);
+			pJournalFile->flush();
+		}
+
+		if (isIndexCreated)
+			FlushDirectory(m_dataDirectory);
+
+		m_chainHeight = height;
 	}
 
 	void FileBasedStorage::pruneBlocksBefore(Height pruneHeight) {
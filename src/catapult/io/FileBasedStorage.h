@@ -25,11 +25,24 @@
 
 namespace catapult { namespace io {
 
+	/// Defines how blocks saved together are committed by file-based storage.
+	enum class FileBasedStorageCommitMode {
+		/// Each block is committed individually.
+		Per_Block,
+
+		/// All blocks saved together are committed at once by a single index update.
+		Group
+	};
+
 	/// File-based block storage.
+	/// \note Block files, hash files and their directories are flushed before the chain height referencing them is persisted.
 	class FileBasedStorage final : public PrunableBlockStorage {
 	public:
-		/// Creates a file-based storage, where blocks will be stored inside \a dataDirectory.
-		explicit FileBasedStorage(const std::string& dataDirectory);
+		/// Creates a file-based storage, where blocks will be stored inside \a dataDirectory
+		/// and committed according to \a commitMode.
+		explicit FileBasedStorage(
+				const std::string& dataDirectory,
+				FileBasedStorageCommitMode commitMode = FileBasedStorageCommitMode::Per_Block);
 
 	public:
 		Height chainHeight() const override;
@@ -41,6 +54,7 @@ namespace catapult { namespace io {
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
 
 		void saveBlock(const model::BlockElement& blockElement) override;
+		void saveBlocks(const std::vector<model::BlockElement>& blockElements) override;
 		void dropBlocksAfter(Height height) override;
 
 	public:
@@ -53,6 +67,7 @@ namespace catapult { namespace io {
 
 			model::HashRange loadHashesFrom(Height height, size_t numHashes) const;
 			void save(Height height, const Hash256& hash);
+			void flush();
 
 		private:
 			const std::string& m_dataDirectory;
@@ -62,7 +77,15 @@ namespace catapult { namespace io {
 			std::unique_ptr<RawFile> m_pCachedHashFile;
 		};
 
+	private:
+		void saveBlockFile(const model::BlockElement& blockElement);
+		void commit(Height height);
+		void setHeight(Height height);
+
+	private:
 		std::string m_dataDirectory;
+		FileBasedStorageCommitMode m_commitMode;
 		HashFile m_hashFile;
+		Height m_chainHeight;
 	};
 }}
@@ -0,0 +1,137 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/exceptions.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace catapult { namespace io {
+
+	namespace {
+		static const char* Error_Open = "couldn't open the file";
+		static const char* Error_Size = "couldn't determine file size";
+		static const char* Error_Map = "couldn't map the file";
+	}
+
+// note that this macro can only be used within MemoryMappedFile member functions
+#define CATAPULT_THROW_AND_LOG_MAPPED_FILE_ERROR(MESSAGE) \
+	do { \
+		CATAPULT_LOG(error) << MESSAGE << " " << m_pathname; \
+		CATAPULT_THROW_FILE_IO_ERROR(MESSAGE); \
+	} while (false)
+
+#ifdef _MSC_VER
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname)
+			: m_pathname(pathname)
+			, m_pData(nullptr)
+			, m_size(0)
+			, m_hFile(INVALID_HANDLE_VALUE)
+			, m_hMapping(nullptr) {
+		m_hFile = ::CreateFileA(
+				m_pathname.c_str(),
+				GENERIC_READ,
+				FILE_SHARE_READ | FILE_SHARE_WRITE,
+				nullptr,
+				OPEN_EXISTING,
+				FILE_ATTRIBUTE_NORMAL,
+				nullptr);
+		if (INVALID_HANDLE_VALUE == m_hFile)
+			CATAPULT_THROW_AND_LOG_MAPPED_FILE_ERROR(Error_Open);
+
+		LARGE_INTEGER fileSize;
+		if (!::GetFileSizeEx(m_hFile, &fileSize)) {
+			::CloseHandle(m_hFile);
+			CATAPULT_THROW_AND_LOG_MAPPED_FILE_ERROR(Error_Size);
+		}
+
+		m_size = static_cast<uint64_t>(fileSize.QuadPart);
+		if (0 == m_size)
+			return;
+
+		m_hMapping = ::CreateFileMappingA(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		auto pData = m_hMapping ? ::MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (!pData) {
+			if (m_hMapping)
+				::CloseHandle(m_hMapping);
+
+			::CloseHandle(m_hFile);
+			CATAPULT_THROW_AND_LOG_MAPPED_FILE_ERROR(Error_Map);
+		}
+
+		m_pData = static_cast<const uint8_t*>(pData);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			::UnmapViewOfFile(m_pData);
+
+		if (m_hMapping)
+			::CloseHandle(m_hMapping);
+
+		::CloseHandle(m_hFile);
+	}
+
+#else
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname)
+			: m_pathname(pathname)
+			, m_pData(nullptr)
+			, m_size(0) {
+		auto fd = ::open(m_pathname.c_str(), O_RDONLY);
+		if (-1 == fd)
+			CATAPULT_THROW_AND_LOG_MAPPED_FILE_ERROR(Error_Open);
+
+		struct stat fileStat;
+		if (-1 == ::fstat(fd, &fileStat)) {
+			::close(fd);
+			CATAPULT_THROW_AND_LOG_MAPPED_FILE_ERROR(Error_Size);
+		}
+
+		m_size = static_cast<uint64_t>(fileStat.st_size);
+		if (0 == m_size) {
+			::close(fd);
+			return;
+		}
+
+		// the mapping keeps its own reference to the file, so the descriptor can be closed immediately
+		auto pData = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (MAP_FAILED == pData)
+			CATAPULT_THROW_AND_LOG_MAPPED_FILE_ERROR(Error_Map);
+
+		m_pData = static_cast<const uint8_t*>(pData);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			::munmap(const_cast<uint8_t*>(m_pData), m_size);
+	}
+
+#endif
+}}
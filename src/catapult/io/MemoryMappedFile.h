@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include <string>
+#include <stdint.h>
+
+namespace catapult { namespace io {
+
+	/// Read only memory mapping of a file.
+	/// \note The mapping covers the file contents at the time of construction.
+	class MemoryMappedFile final : public utils::NonCopyable {
+	public:
+		/// Maps the file pointed to by \a pathname into memory.
+		explicit MemoryMappedFile(const std::string& pathname);
+
+		/// Unmaps the file.
+		~MemoryMappedFile();
+
+	public:
+		/// Gets a pointer to the mapped data.
+		const uint8_t* data() const {
+			return m_pData;
+		}
+
+		/// Gets the size of the mapped data.
+		uint64_t size() const {
+			return m_size;
+		}
+
+	private:
+		std::string m_pathname;
+		const uint8_t* m_pData;
+		uint64_t m_size;
+#ifdef _MSC_VER
+		void* m_hFile;
+		void* m_hMapping;
+#endif
+	};
+}}
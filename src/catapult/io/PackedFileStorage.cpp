@@ -0,0 +1,418 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PackedFileStorage.h"
+#include "FileBasedStorage.h"
+#include "MemoryMappedFile.h"
+#include "PodIoUtils.h"
+#include "RawFile.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <inttypes.h>
+
+using catapult::model::Block;
+using catapult::model::BlockElement;
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Index_File = "packed_index.dat";
+		constexpr auto File_Based_Index_File = "index.dat";
+		constexpr auto File_Based_Nemesis_File = "00000/00001.dat";
+		constexpr uint64_t Import_Log_Interval = 10'000;
+		constexpr auto Blocks_File_Extension = ".blocks";
+		constexpr auto Offsets_File_Extension = ".offsets";
+		constexpr auto Hashes_File_Extension = ".hashes";
+
+		// each offset entry is composed of the offset and size of a block element record in the blocks file
+		constexpr uint64_t Offset_Entry_Size = 2 * sizeof(uint64_t);
+
+#ifdef _MSC_VER
+#define SPRINTF sprintf_s
+#else
+#define SPRINTF sprintf
+#endif
+
+		uint64_t GetSegmentId(Height height) {
+			return height.unwrap() / PackedFileStorage::Blocks_Per_Segment;
+		}
+
+		uint64_t GetSegmentIndex(Height height) {
+			return height.unwrap() % PackedFileStorage::Blocks_Per_Segment;
+		}
+
+		std::string GetSegmentFilePath(const std::string& baseDirectory, uint64_t segmentId, const char* extension) {
+			char filename[32];
+			SPRINTF(filename, "%05" PRIu64 "%s", segmentId, extension);
+			boost::filesystem::path path = baseDirectory;
+			path /= filename;
+			return path.generic_string();
+		}
+
+		std::string GetFilePath(const std::string& baseDirectory, const char* filename) {
+			boost::filesystem::path path = baseDirectory;
+			path /= filename;
+			return path.generic_string();
+		}
+
+		std::string GetIndexFilePath(const std::string& baseDirectory) {
+			return GetFilePath(baseDirectory, Index_File);
+		}
+
+		bool ContainsFileBasedStorage(const std::string& baseDirectory) {
+			// a seeded file based storage contains the nemesis block but does not necessarily contain an index
+			return boost::filesystem::is_regular_file(GetFilePath(baseDirectory, File_Based_Index_File))
+					|| boost::filesystem::is_regular_file(GetFilePath(baseDirectory, File_Based_Nemesis_File));
+		}
+
+		void SeekWithPadding(RawFile& file, uint64_t position) {
+			// RawFile does not allow seeking past the end of a file, so pad any gap with zeros
+			if (position > file.size()) {
+				file.seek(file.size());
+				file.write(std::vector<uint8_t>(position - file.size()));
+			}
+
+			file.seek(position);
+		}
+
+		uint64_t GetRecordSize(const BlockElement& blockElement) {
+			return blockElement.Block.Size
+					+ 2 * Hash256_Size
+					+ sizeof(uint32_t)
+					+ 2 * Hash256_Size * blockElement.Transactions.size();
+		}
+
+		void WriteRecord(RawFile& blocksFile, const BlockElement& blockElement) {
+			// use the same block element serialization as FileBasedStorage
+			blocksFile.write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
+			blocksFile.write(blockElement.EntityHash);
+			blocksFile.write(blockElement.GenerationHash);
+
+			auto transactionsCount = static_cast<uint32_t>(blockElement.Transactions.size());
+			Write32(blocksFile, transactionsCount);
+			std::vector<Hash256> hashes(2 * transactionsCount);
+			auto iter = hashes.begin();
+			for (const auto& transactionElement : blockElement.Transactions) {
+				*iter++ = transactionElement.EntityHash;
+				*iter++ = transactionElement.MerkleComponentHash;
+			}
+
+			blocksFile.write({ reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+		}
+
+		// region RecordReader
+
+		// reads data from a mapped block element record
+		class RecordReader {
+		public:
+			explicit RecordReader(const RawBuffer& record)
+					: m_record(record)
+					, m_position(0)
+			{}
+
+		public:
+			void read(const MutableRawBuffer& buffer) {
+				if (m_record.Size - m_position < buffer.Size)
+					CATAPULT_THROW_RUNTIME_ERROR_1("block element record is truncated", m_record.Size);
+
+				std::memcpy(buffer.pData, m_record.pData + m_position, buffer.Size);
+				m_position += buffer.Size;
+			}
+
+		private:
+			RawBuffer m_record;
+			size_t m_position;
+		};
+
+		// endregion
+
+		std::shared_ptr<Block> ReadBlock(RecordReader& reader) {
+			auto size = Read32(reader);
+
+			auto pBlock = utils::MakeSharedWithSize<Block>(size);
+			reinterpret_cast<uint32_t&>(*pBlock) = size;
+			reader.read({ reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(uint32_t), size - sizeof(uint32_t) });
+			return pBlock;
+		}
+
+		std::shared_ptr<BlockElement> ReadBlockElement(RecordReader& reader) {
+			auto size = Read32(reader);
+
+			// allocate memory for both the element and the block in one shot (Block data is appended)
+			auto pData = utils::MakeUniqueWithSize<uint8_t>(sizeof(BlockElement) + size);
+
+			// read the block data
+			auto pBlockData = pData.get() + sizeof(BlockElement);
+			reinterpret_cast<uint32_t&>(*pBlockData) = size;
+			reader.read({ pBlockData + sizeof(uint32_t), size - sizeof(uint32_t) });
+
+			// create the block element and transfer ownership from pData to pBlockElement
+			auto pBlockElementRaw = new (pData.get()) BlockElement(*reinterpret_cast<Block*>(pBlockData));
+			auto pBlockElement = std::shared_ptr<BlockElement>(pBlockElementRaw);
+			pData.release();
+
+			// read metadata
+			reader.read(pBlockElement->EntityHash);
+			reader.read(pBlockElement->GenerationHash);
+
+			auto numTransactions = Read32(reader);
+			std::vector<Hash256> hashes(2 * numTransactions);
+			reader.read({ reinterpret_cast<uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+
+			size_t i = 0;
+			for (const auto& transaction : pBlockElement->Block.Transactions()) {
+				pBlockElement->Transactions.push_back(model::TransactionElement(transaction));
+				pBlockElement->Transactions.back().EntityHash = hashes[i++];
+				pBlockElement->Transactions.back().MerkleComponentHash = hashes[i++];
+			}
+
+			return pBlockElement;
+		}
+
+		uint64_t GetOffsetEntryEnd(Height height) {
+			return (GetSegmentIndex(height) + 1) * Offset_Entry_Size;
+		}
+
+		struct OffsetEntry {
+			uint64_t Offset;
+			uint64_t Size;
+		};
+
+		OffsetEntry ReadOffsetEntry(const MemoryMappedFile& offsetsFile, Height height) {
+			auto entryEnd = GetOffsetEntryEnd(height);
+			if (offsetsFile.size() < entryEnd)
+				CATAPULT_THROW_RUNTIME_ERROR_1("offsets file does not contain entry for height", height);
+
+			OffsetEntry entry;
+			std::memcpy(&entry, offsetsFile.data() + entryEnd - Offset_Entry_Size, Offset_Entry_Size);
+			if (0 == entry.Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("offsets file contains empty entry for height", height);
+
+			return entry;
+		}
+	}
+
+	PackedFileStorage::PackedFileStorage(const std::string& dataDirectory) : PackedFileStorage(dataDirectory, dataDirectory)
+	{}
+
+	PackedFileStorage::PackedFileStorage(const std::string& dataDirectory, const std::string& seedDirectory)
+			: m_dataDirectory(dataDirectory)
+			// match FileBasedStorage, which assumes the presence of the nemesis block
+			, m_chainHeight(1) {
+		auto indexFilePath = GetIndexFilePath(m_dataDirectory);
+		if (boost::filesystem::is_regular_file(indexFilePath)) {
+			RawFile indexFile(indexFilePath, OpenMode::Read_Only);
+			Read(indexFile, m_chainHeight);
+			return;
+		}
+
+		if (ContainsFileBasedStorage(seedDirectory))
+			importBlocks(seedDirectory);
+	}
+
+	PackedFileStorage::~PackedFileStorage() = default;
+
+	Height PackedFileStorage::chainHeight() const {
+		return m_chainHeight;
+	}
+
+	std::shared_ptr<const model::Block> PackedFileStorage::loadBlock(Height height) const {
+		if (height > chainHeight())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
+
+		auto recordMapping = mapRecord(height);
+		RecordReader reader(recordMapping.Record);
+		return ReadBlock(reader);
+	}
+
+	std::shared_ptr<const model::BlockElement> PackedFileStorage::loadBlockElement(Height height) const {
+		if (height > chainHeight())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
+
+		auto recordMapping = mapRecord(height);
+		RecordReader reader(recordMapping.Record);
+		return ReadBlockElement(reader);
+	}
+
+	model::HashRange PackedFileStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		auto currentHeight = chainHeight();
+		if (Height(0) == height || currentHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+		while (numHashes) {
+			auto segmentIndex = GetSegmentIndex(height);
+			auto count = std::min<size_t>(numHashes, Blocks_Per_Segment - segmentIndex);
+			auto pHashesFile = mapSegmentFile(GetSegmentId(height), SegmentFileType::Hashes, (segmentIndex + count) * Hash256_Size);
+			if (pHashesFile->size() < (segmentIndex + count) * Hash256_Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("hashes file does not contain hashes starting at height", height);
+
+			std::memcpy(pData, pHashesFile->data() + segmentIndex * Hash256_Size, count * Hash256_Size);
+
+			pData += count * Hash256_Size;
+			numHashes -= count;
+			height = height + Height(count);
+		}
+
+		return range;
+	}
+
+	void PackedFileStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		if (height != chainHeight() + Height(1))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
+
+		writeBlock(blockElement);
+		setHeight(height);
+	}
+
+	void PackedFileStorage::dropBlocksAfter(Height height) {
+		setHeight(height);
+	}
+
+	void PackedFileStorage::importBlocks(const std::string& seedDirectory) {
+		FileBasedStorage seedStorage(seedDirectory);
+		auto seedHeight = seedStorage.chainHeight();
+		CATAPULT_LOG(info) << "importing " << seedHeight << " blocks from file based storage in " << seedDirectory;
+
+		for (auto height = Height(1); height <= seedHeight; height = height + Height(1)) {
+			writeBlock(*seedStorage.loadBlockElement(height));
+
+			if (0 == height.unwrap() % Import_Log_Interval)
+				CATAPULT_LOG(info) << "imported " << height << " / " << seedHeight << " blocks";
+		}
+
+		// the index is only written after all blocks have been imported so that an interrupted import is restarted
+		setHeight(seedHeight);
+	}
+
+	void PackedFileStorage::writeBlock(const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		auto segmentId = GetSegmentId(height);
+		auto segmentIndex = GetSegmentIndex(height);
+		RawFile offsetsFile(GetSegmentFilePath(m_dataDirectory, segmentId, Offsets_File_Extension), OpenMode::Read_Append);
+
+		// append the record directly after the previous block in the same segment
+		// (any records of dropped blocks following the previous block are overwritten)
+		uint64_t offset = 0;
+		if (segmentIndex > 0 && offsetsFile.size() >= segmentIndex * Offset_Entry_Size) {
+			offsetsFile.seek((segmentIndex - 1) * Offset_Entry_Size);
+			auto previousOffset = Read64(offsetsFile);
+			auto previousSize = Read64(offsetsFile);
+			offset = previousOffset + previousSize;
+		}
+
+		{
+			RawFile blocksFile(GetSegmentFilePath(m_dataDirectory, segmentId, Blocks_File_Extension), OpenMode::Read_Append);
+			blocksFile.seek(offset);
+			WriteRecord(blocksFile, blockElement);
+		}
+
+		SeekWithPadding(offsetsFile, segmentIndex * Offset_Entry_Size);
+		Write64(offsetsFile, offset);
+		Write64(offsetsFile, GetRecordSize(blockElement));
+
+		{
+			RawFile hashesFile(GetSegmentFilePath(m_dataDirectory, segmentId, Hashes_File_Extension), OpenMode::Read_Append);
+			SeekWithPadding(hashesFile, segmentIndex * Hash256_Size);
+			hashesFile.write(blockElement.EntityHash);
+		}
+
+		// existing (shared) mappings observe overwritten data and are only remapped when they are too short (see mapSegmentFile)
+	}
+
+	void PackedFileStorage::pruneBlocksBefore(Height height) {
+		if (height > chainHeight())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("prune requested with height", height);
+
+		// only whole segments can be pruned and the first segment (containing the nemesis block) is never pruned
+		for (auto segmentId = 1u; (segmentId + 1) * Blocks_Per_Segment <= height.unwrap(); ++segmentId) {
+			unmapSegment(segmentId);
+			boost::filesystem::remove(GetSegmentFilePath(m_dataDirectory, segmentId, Blocks_File_Extension));
+		}
+	}
+
+	PackedFileStorage::RecordMapping PackedFileStorage::mapRecord(Height height) const {
+		auto segmentId = GetSegmentId(height);
+		auto pOffsetsFile = mapSegmentFile(segmentId, SegmentFileType::Offsets, GetOffsetEntryEnd(height));
+		auto entry = ReadOffsetEntry(*pOffsetsFile, height);
+
+		auto pBlocksFile = mapSegmentFile(segmentId, SegmentFileType::Blocks, entry.Offset + entry.Size);
+		if (pBlocksFile->size() < entry.Offset || pBlocksFile->size() - entry.Offset < entry.Size)
+			CATAPULT_THROW_RUNTIME_ERROR_1("blocks file does not contain record for height", height);
+
+		return { pBlocksFile, { pBlocksFile->data() + entry.Offset, static_cast<size_t>(entry.Size) } };
+	}
+
+	std::shared_ptr<const MemoryMappedFile> PackedFileStorage::mapSegmentFile(
+			uint64_t segmentId,
+			SegmentFileType fileType,
+			uint64_t requiredSize) const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto& mappings = m_segmentMappings[segmentId];
+
+		std::shared_ptr<const MemoryMappedFile>* ppMapping;
+		const char* extension;
+		switch (fileType) {
+		case SegmentFileType::Blocks:
+			ppMapping = &mappings.pBlocks;
+			extension = Blocks_File_Extension;
+			break;
+
+		case SegmentFileType::Offsets:
+			ppMapping = &mappings.pOffsets;
+			extension = Offsets_File_Extension;
+			break;
+
+		case SegmentFileType::Hashes:
+			ppMapping = &mappings.pHashes;
+			extension = Hashes_File_Extension;
+			break;
+		}
+
+		// blocks are appended after a file is mapped, so remap it when the mapping does not cover the requested data
+		if (!*ppMapping || (*ppMapping)->size() < requiredSize)
+			*ppMapping = std::make_shared<MemoryMappedFile>(GetSegmentFilePath(m_dataDirectory, segmentId, extension));
+
+		return *ppMapping;
+	}
+
+	void PackedFileStorage::unmapSegment(uint64_t segmentId) {
+		// note that outstanding loads keep their mappings alive
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_segmentMappings.erase(segmentId);
+	}
+
+	void PackedFileStorage::setHeight(Height height) {
+		RawFile indexFile(GetIndexFilePath(m_dataDirectory), OpenMode::Read_Write);
+		Write(indexFile, height);
+		m_chainHeight = height;
+	}
+
+	bool ContainsPackedFileStorage(const std::string& dataDirectory) {
+		return boost::filesystem::is_regular_file(GetIndexFilePath(dataDirectory));
+	}
+}}
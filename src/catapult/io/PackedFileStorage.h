@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BlockStorage.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace catapult { namespace io { class MemoryMappedFile; } }
+
+namespace catapult { namespace io {
+
+	/// File-based block storage that packs blocks into large segment files.
+	/// \note Each segment holds up to 65536 consecutive blocks in three files:
+	///       - `<segment>.blocks`: serialized block elements appended one after another
+	///       - `<segment>.offsets`: fixed-width (offset, size) entries indexed by height
+	///       - `<segment>.hashes`: fixed-width block hashes indexed by height
+	///       Reads are served from read only memory mappings of the segment files.
+	/// \note The chain height is stored in its own index file so that packed and file based storages never share an index.
+	///       A new packed storage imports all blocks of a file based storage (e.g. a seeded nemesis block) when one is present.
+	class PackedFileStorage final : public PrunableBlockStorage {
+	public:
+		/// Number of blocks stored in a single segment.
+		static constexpr uint32_t Blocks_Per_Segment = 65536u;
+
+	public:
+		/// Creates a packed file storage, where blocks will be stored inside \a dataDirectory.
+		explicit PackedFileStorage(const std::string& dataDirectory);
+
+		/// Creates a packed file storage, where blocks will be stored inside \a dataDirectory
+		/// and a new storage is seeded with the blocks of the file based storage in \a seedDirectory.
+		PackedFileStorage(const std::string& dataDirectory, const std::string& seedDirectory);
+
+		/// Destroys the storage.
+		~PackedFileStorage();
+
+	public:
+		Height chainHeight() const override;
+
+	public:
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+	public:
+		void pruneBlocksBefore(Height height) override;
+
+	private:
+		enum class SegmentFileType { Blocks, Offsets, Hashes };
+
+		struct SegmentMappings {
+			std::shared_ptr<const MemoryMappedFile> pBlocks;
+			std::shared_ptr<const MemoryMappedFile> pOffsets;
+			std::shared_ptr<const MemoryMappedFile> pHashes;
+		};
+
+	private:
+		struct RecordMapping {
+			std::shared_ptr<const MemoryMappedFile> pBlocksFile;
+			RawBuffer Record;
+		};
+
+	private:
+		void importBlocks(const std::string& seedDirectory);
+		void writeBlock(const model::BlockElement& blockElement);
+
+		RecordMapping mapRecord(Height height) const;
+		std::shared_ptr<const MemoryMappedFile> mapSegmentFile(uint64_t segmentId, SegmentFileType fileType, uint64_t requiredSize) const;
+		void unmapSegment(uint64_t segmentId);
+
+		void setHeight(Height height);
+
+	private:
+		std::string m_dataDirectory;
+		Height m_chainHeight;
+
+		mutable std::mutex m_mutex; // guards m_segmentMappings because (concurrent) loads map segment files lazily
+		mutable std::unordered_map<uint64_t, SegmentMappings> m_segmentMappings;
+	};
+
+	/// Returns \c true if \a dataDirectory contains a packed file storage.
+	bool ContainsPackedFileStorage(const std::string& dataDirectory);
+}}
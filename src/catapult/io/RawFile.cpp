@@ -28,6 +28,8 @@
 
 #ifdef _MSC_VER
 #include <io.h>
+#include <stdlib.h>
+#include <windows.h>
 #else
 #include <unistd.h>
 #include <sys/file.h>
@@ -46,6 +48,8 @@ namespace catapult { namespace io {
 		static const char* Error_Write = "couldn't write to file";
 		static const char* Error_Read = "couldn't read from file";
 		static const char* Error_Seek = "couldn't seek in file";
+		static const char* Error_Flush = "couldn't flush file";
+		static const char* Error_Flush_Directory = "couldn't flush directory";
 		static const char* Error_Desc = "invalid file descriptor";
 
 #ifdef _MSC_VER
@@ -64,6 +68,7 @@ namespace catapult { namespace io {
 		constexpr auto read = ::_read;
 		constexpr auto lseek = ::_lseeki64;
 		constexpr auto fstat = ::_fstati64;
+		constexpr auto fsync = ::_commit;
 		using StatStruct = struct ::_stat64;
 
 		template<typename TSize>
@@ -88,6 +93,12 @@ namespace catapult { namespace io {
 		constexpr auto File_Locking_Exclusive = LOCK_NB | LOCK_EX;
 		constexpr auto File_Locking_Shared_Read = LOCK_NB | LOCK_SH;
 		constexpr auto File_Locking_None = LOCK_NB | LOCK_SH;
+#ifdef __linux__
+		// file size changes are flushed too, so the remaining metadata (e.g. timestamps) does not need to be flushed
+		constexpr auto fsync = ::fdatasync;
+#else
+		constexpr auto fsync = ::fsync;
+#endif
 		using StatStruct = struct stat;
 
 		template<typename TSize>
@@ -153,6 +164,28 @@ namespace catapult { namespace io {
 			return offset == r;
 		}
 
+		bool nemFlush(int fd) {
+			return 0 == fsync(fd);
+		}
+
+#ifdef _MSC_VER
+		bool nemFlushDirectory(const char* name) {
+			// directory entries are recorded in the (journaled) file system metadata, so only check that the directory exists
+			auto attributes = ::GetFileAttributesA(name);
+			return INVALID_FILE_ATTRIBUTES != attributes && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+		}
+#else
+		bool nemFlushDirectory(const char* name) {
+			auto fd = ::open(name, O_RDONLY | O_DIRECTORY);
+			if (Invalid_Descriptor == fd)
+				return false;
+
+			auto result = 0 == ::fsync(fd);
+			::close(fd);
+			return result;
+		}
+#endif
+
 		bool nemFileSize(int fd, uint64_t& fileSize) {
 			StatStruct st;
 			fileSize = 0;
@@ -252,6 +285,11 @@ namespace catapult { namespace io {
 		m_position = position;
 	}
 
+	void RawFile::flush() {
+		if (!nemFlush(m_fd.raw()))
+			CATAPULT_THROW_AND_LOG_RAW_FILE_ERROR(Error_Flush);
+	}
+
 	uint64_t RawFile::size() const {
 		return m_fileSize;
 	}
@@ -259,4 +297,11 @@ namespace catapult { namespace io {
 	uint64_t RawFile::position() const {
 		return m_position;
 	}
+
+	void FlushDirectory(const std::string& pathname) {
+		if (!nemFlushDirectory(pathname.c_str())) {
+			CATAPULT_LOG(error) << Error_Flush_Directory << " " << pathname;
+			CATAPULT_THROW_FILE_IO_ERROR(Error_Flush_Directory);
+		}
+	}
 }}
@@ -71,6 +71,10 @@ namespace catapult { namespace io {
 		/// Throws catapult_file_io_error exception if requested amount of data could not be read.
 		void read(const MutableRawBuffer& dataBuffer);
 
+		/// Flushes all written data to the underlying storage device.
+		/// Throws catapult_file_io_error exception if flush has failed.
+		void flush();
+
 		/// Returns size of the file.
 		uint64_t size() const;
 
@@ -99,4 +103,9 @@ namespace catapult { namespace io {
 		uint64_t m_fileSize;
 		uint64_t m_position;
 	};
+
+	/// Flushes the entries (e.g. created or renamed files) of the directory \a pathname to the underlying storage device.
+	/// Throws catapult_file_io_error exception if flush has failed.
+	/// \note This needs to be called after flushing new files so that they can be found after a crash.
+	void FlushDirectory(const std::string& pathname);
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "PacketPayload.h"
+#include "SignedPacketPayloadCache.h"
 
 namespace catapult { namespace ionet {
 
@@ -56,6 +57,10 @@ namespace catapult { namespace ionet {
 		return m_buffers;
 	}
 
+	const std::shared_ptr<SignedPacketPayloadCache>& PacketPayload::signedPayloadCache() const {
+		return m_pSignedPayloadCache;
+	}
+
 	PacketPayload PacketPayload::Merge(const std::shared_ptr<const Packet>& pPacket, const PacketPayload& payload) {
 		// pPacket should envelop payload
 		PacketPayload mergedPayload(pPacket);
@@ -74,4 +79,10 @@ namespace catapult { namespace ionet {
 		mergedPayload.m_buffers.insert(mergedPayload.m_buffers.end(), payload.m_buffers.cbegin(), payload.m_buffers.cend());
 		return mergedPayload;
 	}
+
+	PacketPayload PacketPayload::WithSharedSigning(const PacketPayload& payload) {
+		auto sharedPayload = payload;
+		sharedPayload.m_pSignedPayloadCache = std::make_shared<SignedPacketPayloadCache>();
+		return sharedPayload;
+	}
 }}
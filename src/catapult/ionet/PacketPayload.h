@@ -23,6 +23,8 @@
 #include "catapult/types.h"
 #include <vector>
 
+namespace catapult { namespace ionet { class SignedPacketPayloadCache; } }
+
 namespace catapult { namespace ionet {
 
 	/// A packet payload that can be written.
@@ -47,10 +49,16 @@ namespace catapult { namespace ionet {
 		/// Packet data.
 		const std::vector<RawBuffer>& buffers() const;
 
+		/// Gets the cache of signed envelopes shared by all copies of this payload or \c nullptr if envelopes are not shared.
+		const std::shared_ptr<SignedPacketPayloadCache>& signedPayloadCache() const;
+
 	public:
 		/// Merges a packet (\a pPacket) and a packet \a payload into a new packet payload.
 		static PacketPayload Merge(const std::shared_ptr<const Packet>& pPacket, const PacketPayload& payload);
 
+		/// Creates a copy of \a payload that is signed at most once per signer when it is written to multiple secure signed packet ios.
+		static PacketPayload WithSharedSigning(const PacketPayload& payload);
+
 	private:
 		PacketHeader m_header;
 		std::vector<RawBuffer> m_buffers;
@@ -58,6 +66,8 @@ namespace catapult { namespace ionet {
 		// the backing data
 		std::vector<std::shared_ptr<const void>> m_entities;
 
+		std::shared_ptr<SignedPacketPayloadCache> m_pSignedPayloadCache;
+
 	private:
 		friend class PacketPayloadBuilder;
 	};
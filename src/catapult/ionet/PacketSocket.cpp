@@ -25,6 +25,7 @@
 #include "catapult/thread/StrandOwnerLifetimeExtender.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/Logging.h"
+#include <algorithm>
 #include <deque>
 #include <memory>
 
@@ -74,6 +75,7 @@ namespace catapult { namespace ionet {
 					, m_wrapper(wrapper)
 					, m_buffer(options)
 					, m_maxPacketDataSize(options.MaxPacketDataSize)
+					, m_maxWriteBufferCount(options.MaxWriteBufferCount)
 			{}
 
 		public:
@@ -84,35 +86,34 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
+				// the header and payload buffers are submitted together as gather writes in order to minimize write calls
+				auto pContext = std::make_shared<WriteContext>(payload, callback, m_maxWriteBufferCount);
+				writeNext(boost::system::error_code(), pContext);
 			}
 
 		private:
 			struct WriteContext {
 			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
+				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback, size_t maxWriteBufferCount)
 						: m_payload(payload)
 						, m_callback(callback)
+						, m_maxWriteBufferCount(std::max<size_t>(1, maxWriteBufferCount))
 						, m_nextBufferIndex(0)
 				{}
 
 			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
-				}
+				// buffer index zero corresponds to the header and all other indexes correspond to payload buffers
+				const std::vector<boost::asio::const_buffer>& nextDataBuffers() {
+					m_dataBuffers.clear();
+					while (m_dataBuffers.size() < m_maxWriteBufferCount && m_nextBufferIndex < numBuffers())
+						m_dataBuffers.push_back(buffer(m_nextBufferIndex++));
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+					return m_dataBuffers;
 				}
 
 				bool tryComplete(const boost::system::error_code& ec) {
 					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
+					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= numBuffers()) {
 						m_callback(lastCode);
 						return true;
 					}
@@ -120,18 +121,35 @@ namespace catapult { namespace ionet {
 					return false;
 				}
 
+			private:
+				size_t numBuffers() const {
+					return 1 + m_payload.buffers().size();
+				}
+
+				boost::asio::const_buffer buffer(size_t index) const {
+					if (0 == index) {
+						const auto& header = m_payload.header();
+						return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+					}
+
+					auto rawBuffer = m_payload.buffers()[index - 1];
+					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+				}
+
 			private:
 				const PacketPayload m_payload;
 				const PacketSocket::WriteCallback m_callback;
+				size_t m_maxWriteBufferCount;
 				size_t m_nextBufferIndex;
+				std::vector<boost::asio::const_buffer> m_dataBuffers;
 			};
 
 			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
 				if (pContext->tryComplete(lastEc))
 					return;
 
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
+				const auto& buffers = pContext->nextDataBuffers();
+				boost::asio::async_write(m_socket, buffers, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
 					this->writeNext(ec, pContext);
 				}));
 			}
@@ -239,6 +257,7 @@ namespace catapult { namespace ionet {
 			TSocketCallbackWrapper& m_wrapper;
 			WorkingBuffer m_buffer;
 			size_t m_maxPacketDataSize;
+			size_t m_maxWriteBufferCount;
 		};
 
 		/// Implements PacketSocket using an explicit strand and ensures deterministic shutdown by using
@@ -33,5 +33,8 @@ namespace catapult { namespace ionet {
 
 		/// Maximum packet data size.
 		size_t MaxPacketDataSize;
+
+		/// Maximum number of buffers (including the packet header) submitted by a single gather write.
+		size_t MaxWriteBufferCount;
 	};
 }}
@@ -108,7 +108,10 @@ namespace catapult { namespace ionet {
 	ENUM_VALUE(Mosaic_Infos, 1004) \
 	\
 	/* Node infos for active nodes have been requested. */ \
-	ENUM_VALUE(Active_Node_Infos, 1005)
+	ENUM_VALUE(Active_Node_Infos, 1005) \
+	\
+	/* Account state proofs have been requested by a client. */ \
+	ENUM_VALUE(Account_State_Proofs, 1006)
 
 #define ENUM_VALUE(LABEL, VALUE) LABEL = VALUE,
 	/// An enumeration of known packet types.
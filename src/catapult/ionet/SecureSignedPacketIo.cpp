@@ -21,6 +21,7 @@
 #include "SecureSignedPacketIo.h"
 #include "BatchPacketReader.h"
 #include "PacketIo.h"
+#include "SignedPacketPayloadCache.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/utils/HexFormatter.h"
@@ -107,11 +108,12 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
-				auto payloadHash = CalculatePayloadHash(payload);
-				auto pSecurePacketHeader = CreateSharedPacket<SecurePacketHeader>(0);
-				crypto::Sign(m_sourceKeyPair, payloadHash, pSecurePacketHeader->Signature);
-
-				m_pIo->write(PacketPayload::Merge(pSecurePacketHeader, payload), callback);
+				// reuse the envelope of a payload that has already been signed by the same key pair for a different io
+				const auto& pSignedPayloadCache = payload.signedPayloadCache();
+				auto signedPayload = pSignedPayloadCache
+						? pSignedPayloadCache->getOrCreate(m_sourceKeyPair.publicKey(), [this, &payload]() { return sign(payload); })
+						: sign(payload);
+				m_pIo->write(signedPayload, callback);
 			}
 
 			void read(const ReadCallback& callback) override {
@@ -120,6 +122,14 @@ namespace catapult { namespace ionet {
 				});
 			}
 
+		private:
+			PacketPayload sign(const PacketPayload& payload) const {
+				auto payloadHash = CalculatePayloadHash(payload);
+				auto pSecurePacketHeader = CreateSharedPacket<SecurePacketHeader>(0);
+				crypto::Sign(m_sourceKeyPair, payloadHash, pSecurePacketHeader->Signature);
+				return PacketPayload::Merge(pSecurePacketHeader, payload);
+			}
+
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
 			const crypto::KeyPair& m_sourceKeyPair;
@@ -0,0 +1,40 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SignedPacketPayloadCache.h"
+#include <algorithm>
+
+namespace catapult { namespace ionet {
+
+	PacketPayload SignedPacketPayloadCache::getOrCreate(const Key& signer, const SignedPayloadFactory& factory) {
+		// hold the lock while signing so that concurrent writers wait for (and reuse) the first signature
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = std::find_if(m_signedPayloads.cbegin(), m_signedPayloads.cend(), [&signer](const auto& pair) {
+			return signer == pair.first;
+		});
+
+		if (m_signedPayloads.cend() != iter)
+			return iter->second;
+
+		auto signedPayload = factory();
+		m_signedPayloads.emplace_back(signer, signedPayload);
+		return signedPayload;
+	}
+}}
@@ -0,0 +1,44 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketPayload.h"
+#include "catapult/functions.h"
+#include <mutex>
+
+namespace catapult { namespace ionet {
+
+	/// Cache of signed envelopes of a single packet payload.
+	/// \note This allows a payload that is written to multiple secure signed packet ios to be signed once per signer.
+	class SignedPacketPayloadCache {
+	public:
+		/// Factory for creating a signed envelope.
+		using SignedPayloadFactory = supplier<PacketPayload>;
+
+	public:
+		/// Gets the envelope signed by \a signer, calling \a factory to create it if it is not cached.
+		PacketPayload getOrCreate(const Key& signer, const SignedPayloadFactory& factory);
+
+	private:
+		// there is usually a single signer, so a vector is sufficient
+		std::vector<std::pair<Key, PacketPayload>> m_signedPayloads;
+		std::mutex m_mutex;
+	};
+}}
@@ -31,10 +31,25 @@
 #include "catapult/plugins/PluginLoader.h"
 #include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/StackLogger.h"
+#include <cctype>
 
 namespace catapult { namespace local {
 
 	namespace {
+		utils::DiagnosticCounterId CreateCommitCounterId(const std::string& subCacheName) {
+			// use (up to) the first six letters of the subcache name (e.g. AccountStateCache => ACCOUN CMT MS)
+			std::string prefix;
+			for (auto ch : subCacheName) {
+				if (6 == prefix.size())
+					break;
+
+				if (std::isalpha(ch))
+					prefix.push_back(static_cast<char>(std::toupper(ch)));
+			}
+
+			return utils::DiagnosticCounterId(prefix + " CMT MS");
+		}
+
 		class BasicLocalNode final : public BootedLocalNode {
 		public:
 			BasicLocalNode(std::unique_ptr<extensions::LocalNodeBootstrapper>&& pBootstrapper, const crypto::KeyPair& keyPair)
@@ -43,7 +58,7 @@ namespace catapult { namespace local {
 					, m_pBlockChainStorage(m_pBootstrapper->extensionManager().createBlockChainStorage())
 					, m_config(m_pBootstrapper->config())
 					, m_catapultCache({}) // note that subcaches are added in boot
-					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage())
+					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage(), m_config.Node.BlockStorageCacheMaxSize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(GetUtCacheOptions(m_config.Node)))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pStateChangeSubscriber(m_pBootstrapper->subscriptionManager().createStateChangeSubscriber())
@@ -113,9 +128,21 @@ namespace catapult { namespace local {
 			void registerCounters() {
 				AddMemoryCounters(m_counters);
 				m_pluginManager.addDiagnosticCounters(m_counters, m_catapultCache); // add cache counters
+				for (const auto& pair : m_catapultCache.subCacheNames()) {
+					m_counters.emplace_back(CreateCommitCounterId(pair.second), [&cache = m_catapultCache, id = pair.first]() {
+						return cache.lastCommitMillis(id);
+					});
+				}
+
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE HIT"), [&storage = m_storage]() {
+					return storage.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE MISS"), [&storage = m_storage]() {
+					return storage.statistics().NumMisses;
+				});
 			}
 
 		public:
@@ -19,8 +19,11 @@
 **/
 
 #include "MemoryCounters.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/state/AccountStatePool.h"
 #include "catapult/utils/DiagnosticCounter.h"
 #include "catapult/utils/FileSize.h"
+#include <algorithm>
 #include <fstream>
 
 #ifdef _WIN32
@@ -84,6 +87,23 @@ namespace catapult { namespace local {
 		utils::DiagnosticCounterId MakeId(const char* name) {
 			return utils::DiagnosticCounterId(std::string("MEM ") + name);
 		}
+
+		void AddAccountStatePoolCounters(std::vector<utils::DiagnosticCounter>& counters) {
+			counters.emplace_back(MakeId("ACNT SLAB"), []() {
+				return utils::FileSize::FromBytes(state::GetAccountStatePool().statistics().NumReservedBytes).megabytes();
+			});
+			counters.emplace_back(MakeId("ACNT BPA"), []() {
+				// reserved (instead of used) bytes are reported so that slab overhead is included
+				// (this is not compared against a heap baseline, so it does not show a memory improvement from pooling)
+				auto statistics = state::GetAccountStatePool().statistics();
+				return 0 == statistics.NumBlocks ? 0 : statistics.NumReservedBytes / statistics.NumBlocks;
+			});
+			counters.emplace_back(MakeId("ACNT CAPS"), []() {
+				// committed (added, modified or removed) accounts per second across all account state cache commits
+				auto statistics = cache::GetAccountStateCacheCommitStatistics();
+				return statistics.NumAccounts * 1'000'000 / std::max<uint64_t>(1, statistics.NumMicros);
+			});
+		}
 	}
 
 	void AddMemoryCounters(std::vector<utils::DiagnosticCounter>& counters) {
@@ -102,5 +122,7 @@ namespace catapult { namespace local {
 		counters.emplace_back(MakeId("CUR VIRT"), []() { return GET_MEMORY_VALUE(size); });
 		counters.emplace_back(MakeId("SHR RSS"), []() { return GET_MEMORY_VALUE(shared); });
 #endif
-		}
+
+		AddAccountStatePoolCounters(counters);
+	}
 }}
@@ -25,6 +25,6 @@ namespace catapult { namespace utils { class DiagnosticCounter; } }
 
 namespace catapult { namespace local {
 
-	/// Adds process memory counters to \a counters.
+	/// Adds process memory, account state pool and account state commit throughput counters to \a counters.
 	void AddMemoryCounters(std::vector<utils::DiagnosticCounter>& counters);
 }}
@@ -0,0 +1,64 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TrailingVariableDataLayout.h"
+#include "catapult/types.h"
+
+namespace catapult { namespace model {
+
+#pragma pack(push, 1)
+
+	/// Binary layout for an account state proof.
+	/// \note Proof nodes are serialized patricia tree nodes (see tree::SerializeTreeNodes) on the path from the account state
+	///       tree root towards the tree key of the account address.
+	struct AccountStateProof : public TrailingVariableDataLayout<AccountStateProof, uint8_t> {
+	public:
+		/// Address of the account.
+		catapult::Address Address;
+
+		/// Root of the account state tree.
+		Hash256 StateRoot;
+
+		/// Size of the serialized proof nodes.
+		uint32_t NodesSize;
+
+		// followed by serialized proof nodes if NodesSize != 0
+
+	public:
+		/// Returns a const pointer to the serialized proof nodes contained in this proof.
+		const uint8_t* NodesPtr() const {
+			return NodesSize ? ToTypedPointer(PayloadStart(*this)) : nullptr;
+		}
+
+		/// Returns a pointer to the serialized proof nodes contained in this proof.
+		uint8_t* NodesPtr() {
+			return NodesSize ? ToTypedPointer(PayloadStart(*this)) : nullptr;
+		}
+
+	public:
+		/// Calculates the real size of \a proof.
+		static constexpr uint64_t CalculateRealSize(const AccountStateProof& proof) noexcept {
+			return sizeof(AccountStateProof) + proof.NodesSize;
+		}
+	};
+
+#pragma pack(pop)
+}}
@@ -39,7 +39,7 @@ namespace catapult { namespace model {
 	// region hashes
 
 	void CalculateBlockTransactionsHash(const std::vector<const TransactionInfo*>& transactionInfos, Hash256& blockTransactionsHash) {
-		crypto::MerkleHashBuilder builder;
+		crypto::MerkleHashBuilder builder(transactionInfos.size());
 		for (const auto* pTransactionInfo : transactionInfos)
 			builder.update(pTransactionInfo->MerkleComponentHash);
 
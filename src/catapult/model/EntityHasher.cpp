@@ -23,6 +23,7 @@
 #include "TransactionPlugin.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/MultiBufferHashes.h"
 
 namespace catapult { namespace model {
 
@@ -95,4 +96,32 @@ namespace catapult { namespace model {
 				transactionElement.EntityHash,
 				transactionRegistry);
 	}
+
+	void UpdateHashes(const TransactionRegistry& transactionRegistry, const std::vector<TransactionElement*>& transactionElements) {
+		std::vector<crypto::MultiBufferHashInput> inputs;
+		inputs.reserve(transactionElements.size());
+		for (const auto* pTransactionElement : transactionElements) {
+			const auto& transaction = pTransactionElement->Transaction;
+			const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
+
+			// same parts as CalculateHash(const VerifiableEntity&, const RawBuffer&)
+			inputs.push_back({
+				{ transaction.Signature.data(), Signature_Size / 2 },
+				transaction.Signer,
+				plugin.dataBuffer(transaction)
+			});
+		}
+
+		std::vector<Hash256> entityHashes(transactionElements.size());
+		crypto::Sha3_256_MultiBuffer(inputs, entityHashes.data());
+
+		auto i = 0u;
+		for (auto* pTransactionElement : transactionElements) {
+			pTransactionElement->EntityHash = entityHashes[i++];
+			pTransactionElement->MerkleComponentHash = CalculateMerkleComponentHash(
+					pTransactionElement->Transaction,
+					pTransactionElement->EntityHash,
+					transactionRegistry);
+		}
+	}
 }}
@@ -51,4 +51,8 @@ namespace catapult { namespace model {
 
 	/// Calculates the hashes for \a transactionElement in place using transaction information from \a transactionRegistry.
 	void UpdateHashes(const TransactionRegistry& transactionRegistry, TransactionElement& transactionElement);
+
+	/// Calculates the hashes for all \a transactionElements in place using transaction information from \a transactionRegistry.
+	/// \note Entity hashes of independent transactions are calculated together using multi-buffer hashing.
+	void UpdateHashes(const TransactionRegistry& transactionRegistry, const std::vector<TransactionElement*>& transactionElements);
 }}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationType.h"
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// A table that maps notification types (excluding channel) to the handlers registered for them.
+	/// \note Handlers for each type are kept in registration order.
+	template<typename THandler>
+	class NotificationDispatchTable {
+	public:
+		/// Adds \a handler that is selected only for notifications with \a type.
+		void add(NotificationType type, const THandler& handler) {
+			auto key = ToKey(type);
+			auto iter = m_typedHandlers.find(key);
+			if (m_typedHandlers.cend() == iter) {
+				// all untyped handlers registered so far precede the new handler
+				iter = m_typedHandlers.emplace(key, m_untypedHandlers).first;
+			}
+
+			iter->second.push_back(handler);
+		}
+
+		/// Adds \a handler that is selected for all notifications.
+		void addAll(const THandler& handler) {
+			m_untypedHandlers.push_back(handler);
+			for (auto& pair : m_typedHandlers)
+				pair.second.push_back(handler);
+		}
+
+	public:
+		/// Gets all handlers that should be invoked for notifications with \a type.
+		const std::vector<THandler>& select(NotificationType type) const {
+			auto iter = m_typedHandlers.find(ToKey(type));
+			return m_typedHandlers.cend() == iter ? m_untypedHandlers : iter->second;
+		}
+
+	private:
+		static uint32_t ToKey(NotificationType type) {
+			return 0x00FFFFFFu & utils::to_underlying_type(type);
+		}
+
+	private:
+		std::vector<THandler> m_untypedHandlers;
+		std::unordered_map<uint32_t, std::vector<THandler>> m_typedHandlers;
+	};
+}}
@@ -37,6 +37,7 @@ namespace catapult { namespace net {
 				, SocketWorkingBufferSize(utils::FileSize::FromKilobytes(4))
 				, SocketWorkingBufferSensitivity(0) // memory reclamation disabled
 				, MaxPacketDataSize(utils::FileSize::FromMegabytes(100))
+				, SocketMaxWriteBufferCount(64)
 				, OutgoingSecurityMode(ionet::ConnectionSecurityMode::None)
 				, IncomingSecurityModes(ionet::ConnectionSecurityMode::None)
 		{}
@@ -57,6 +58,9 @@ namespace catapult { namespace net {
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
+		/// Maximum number of buffers submitted by a single socket gather write.
+		size_t SocketMaxWriteBufferCount;
+
 		/// Security mode of outgoing connections initiated by this node.
 		ionet::ConnectionSecurityMode OutgoingSecurityMode;
 
@@ -70,6 +74,7 @@ namespace catapult { namespace net {
 			options.WorkingBufferSize = SocketWorkingBufferSize.bytes();
 			options.WorkingBufferSensitivity = SocketWorkingBufferSensitivity;
 			options.MaxPacketDataSize = MaxPacketDataSize.bytes();
+			options.MaxWriteBufferCount = SocketMaxWriteBufferCount;
 			return options;
 		}
 	};
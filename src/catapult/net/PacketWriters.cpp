@@ -286,7 +286,9 @@ namespace catapult { namespace net {
 
 		public:
 			void broadcast(const ionet::PacketPayload& payload) override {
-				m_writers.forEach([pThis = shared_from_this(), payload](const auto& state) {
+				// the same payload is written to all writers, so secure writers should only sign it once
+				auto sharedPayload = ionet::PacketPayload::WithSharedSigning(payload);
+				m_writers.forEach([pThis = shared_from_this(), payload = sharedPayload](const auto& state) {
 					state.pBufferedIo->write(payload, [pThis, pSocket = state.pSocket](auto code) {
 						if (ionet::SocketOperationCode::Success == code)
 							return;
@@ -39,9 +39,11 @@ namespace catapult { namespace plugins {
 	}
 
 	cache::CacheConfiguration PluginManager::cacheConfig(const std::string& name) const {
-		return m_storageConfig.PreferCacheDatabase
+		auto config = m_storageConfig.PreferCacheDatabase
 				? cache::CacheConfiguration((boost::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string())
 				: cache::CacheConfiguration();
+		config.ShouldEnablePatriciaTrees = m_storageConfig.EnableCachePatriciaTrees;
+		return config;
 	}
 
 	// endregion
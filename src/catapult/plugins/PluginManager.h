@@ -39,6 +39,9 @@ namespace catapult { namespace plugins {
 		/// Prefer using a database for cache storage.
 		bool PreferCacheDatabase = false;
 
+		/// Enable calculation of cache state roots using patricia trees.
+		bool EnableCachePatriciaTrees = false;
+
 		/// Base directory to use for storing cache database.
 		std::string CacheDatabaseDirectory;
 	};
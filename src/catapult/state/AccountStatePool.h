@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "AccountState.h"
+#include "catapult/utils/SlabPool.h"
+
+namespace catapult { namespace state {
+
+	/// Gets the slab pool from which cached account states are allocated.
+	utils::SlabPool& GetAccountStatePool();
+
+	/// A stateless allocator that allocates all objects from the account state pool.
+	/// \note In contrast to utils::SlabAllocator, this allocator does not need to be stored next to each shared account state.
+	template<typename T>
+	class AccountStateAllocator {
+	public:
+		using value_type = T;
+
+	public:
+		/// Creates an allocator.
+		AccountStateAllocator() = default;
+
+		/// Creates an allocator from \a allocator.
+		template<typename U>
+		AccountStateAllocator(const AccountStateAllocator<U>&) noexcept
+		{}
+
+	public:
+		/// Allocates storage for \a count objects.
+		T* allocate(size_t count) {
+			return utils::SlabAllocator<T>(GetAccountStatePool()).allocate(count);
+		}
+
+		/// Deallocates storage (\a pObjects) for \a count objects.
+		void deallocate(T* pObjects, size_t count) noexcept {
+			utils::SlabAllocator<T>(GetAccountStatePool()).deallocate(pObjects, count);
+		}
+
+	public:
+		/// Returns \c true because all account state allocators are equal.
+		template<typename U>
+		bool operator==(const AccountStateAllocator<U>&) const noexcept {
+			return true;
+		}
+
+		/// Returns \c false because all account state allocators are equal.
+		template<typename U>
+		bool operator!=(const AccountStateAllocator<U>&) const noexcept {
+			return false;
+		}
+	};
+
+	/// Creates an account state around \a args that is allocated from the account state pool.
+	/// \note The shared pointer reference counts are placed in the same pooled block as the account state.
+	///       This gives the locality of an intrusive reference count without one. Intrusive counting would need a
+	///       different pointer type in the account state cache sets, deltaset element traits, storage and mongo mappers.
+	template<typename... TArgs>
+	std::shared_ptr<AccountState> MakePooledAccountState(TArgs&&... args) {
+		return std::allocate_shared<AccountState>(AccountStateAllocator<AccountState>(), std::forward<TArgs>(args)...);
+	}
+}}
@@ -29,12 +29,31 @@
 #include "catapult/cache/AggregateUtCache.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/PackedFileStorage.h"
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::PrunableBlockStorage> CreateFileStorage(const config::LocalNodeConfiguration& config) {
+			const auto& dataDirectory = config.User.DataDirectory;
+			if (config.Node.ShouldUsePackedBlockStorage)
+				return std::make_unique<io::PackedFileStorage>(dataDirectory);
+
+			// blocks saved to a packed storage are not visible to a file based storage sharing the same data directory
+			if (io::ContainsPackedFileStorage(dataDirectory))
+				CATAPULT_THROW_RUNTIME_ERROR_1("file based storage cannot be used with packed storage data", dataDirectory);
+
+			auto commitMode = config.Node.ShouldEnableBlockGroupCommit
+					? io::FileBasedStorageCommitMode::Group
+					: io::FileBasedStorageCommitMode::Per_Block;
+			return std::make_unique<io::FileBasedStorage>(dataDirectory, commitMode);
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::LocalNodeConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBasedStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(CreateFileStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
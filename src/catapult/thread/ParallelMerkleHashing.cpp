@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelMerkleHashing.h"
+#include "IoServiceThreadPool.h"
+#include <boost/asio.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		// minimum number of nodes hashed by a single chunk in order to amortize scheduling costs
+		constexpr size_t Min_Chunk_Size = 128;
+
+		// chunks are claimed by both the calling thread and pool workers, so pool workers that start after all chunks have been
+		// claimed do not access inputs or outputs and the calling thread only waits for chunks that are actively being hashed
+		class ParallelLevelHashContext {
+		public:
+			ParallelLevelHashContext(const std::vector<crypto::MultiBufferHashInput>& inputs, Hash256* pHashes, size_t numChunks)
+					: m_inputs(inputs)
+					, m_pHashes(pHashes)
+					, m_numChunks(numChunks)
+					, m_chunkSize((inputs.size() + numChunks - 1) / numChunks)
+					, m_nextChunk(0)
+					, m_numCompletedChunks(0)
+			{}
+
+		public:
+			void hashChunks() {
+				std::vector<crypto::MultiBufferHashInput> chunkInputs;
+				for (;;) {
+					auto chunk = m_nextChunk++;
+					if (chunk >= m_numChunks)
+						return;
+
+					auto startIndex = chunk * m_chunkSize;
+					auto endIndex = std::min(startIndex + m_chunkSize, m_inputs.size());
+					chunkInputs.assign(&m_inputs[startIndex], &m_inputs[0] + endIndex);
+					crypto::Sha3_256_MultiBuffer(chunkInputs, m_pHashes + startIndex);
+
+					if (m_numChunks == ++m_numCompletedChunks) {
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_completedCondition.notify_all();
+					}
+				}
+			}
+
+			void waitForCompletion() {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_completedCondition.wait(lock, [this]() { return m_numChunks == m_numCompletedChunks; });
+			}
+
+		private:
+			const std::vector<crypto::MultiBufferHashInput>& m_inputs;
+			Hash256* m_pHashes;
+			size_t m_numChunks;
+			size_t m_chunkSize;
+			std::atomic<size_t> m_nextChunk;
+			std::atomic<size_t> m_numCompletedChunks;
+			std::mutex m_mutex;
+			std::condition_variable m_completedCondition;
+		};
+	}
+
+	crypto::MerkleHashBuilder::LevelHasher CreateParallelMerkleLevelHasher(
+			const std::shared_ptr<IoServiceThreadPool>& pPool,
+			size_t levelThreshold) {
+		return [pPool, levelThreshold](const auto& inputs, auto* pHashes) {
+			auto numWorkerThreads = pPool->numWorkerThreads();
+			if (inputs.size() < std::max<size_t>(levelThreshold, 2 * Min_Chunk_Size) || 0 == numWorkerThreads)
+				return crypto::Sha3_256_MultiBuffer(inputs, pHashes);
+
+			// split the level into one chunk per worker and one for the calling thread
+			auto numChunks = std::min<size_t>(numWorkerThreads + 1, inputs.size() / Min_Chunk_Size);
+			auto pContext = std::make_shared<ParallelLevelHashContext>(inputs, pHashes, numChunks);
+			for (auto i = 1u; i < numChunks; ++i)
+				pPool->service().post([pContext]() { pContext->hashChunks(); });
+
+			pContext->hashChunks();
+			pContext->waitForCompletion();
+		};
+	}
+}}
@@ -0,0 +1,37 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/crypto/MerkleHashBuilder.h"
+#include <memory>
+
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
+namespace catapult { namespace thread {
+
+	/// Default minimum number of nodes in a merkle tree level for the level to be split across pool workers.
+	constexpr size_t Default_Parallel_Merkle_Level_Threshold = 1024;
+
+	/// Creates a merkle level hasher that splits tree levels with at least \a levelThreshold nodes across the workers of \a pPool.
+	/// \note The calling thread participates in hashing, so the hasher can be safely used from a worker of \a pPool.
+	crypto::MerkleHashBuilder::LevelHasher CreateParallelMerkleLevelHasher(
+			const std::shared_ptr<IoServiceThreadPool>& pPool,
+			size_t levelThreshold = Default_Parallel_Merkle_Level_Threshold);
+}}
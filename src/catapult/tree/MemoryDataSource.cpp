@@ -0,0 +1,69 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryDataSource.h"
+
+namespace catapult { namespace tree {
+
+	size_t MemoryDataSource::size() const {
+		return m_nodes.size();
+	}
+
+	const TreeNode* MemoryDataSource::get(const Hash256& hash) const {
+		auto iter = m_nodes.find(hash);
+		return m_nodes.cend() != iter ? &iter->second.Node : nullptr;
+	}
+
+	void MemoryDataSource::set(const TreeNode& node) {
+		if (node.empty())
+			return;
+
+		if (!tryAddReference(node.hash()))
+			m_nodes.emplace(node.hash(), NodeEntry{ node.copy(), 1 });
+	}
+
+	void MemoryDataSource::set(const LeafTreeNode& node) {
+		if (!tryAddReference(node.hash()))
+			m_nodes.emplace(node.hash(), NodeEntry{ TreeNode(node), 1 });
+	}
+
+	void MemoryDataSource::set(const BranchTreeNode& node) {
+		if (!tryAddReference(node.hash()))
+			m_nodes.emplace(node.hash(), NodeEntry{ TreeNode(node), 1 });
+	}
+
+	void MemoryDataSource::remove(const Hash256& hash) {
+		auto iter = m_nodes.find(hash);
+		if (m_nodes.end() == iter)
+			return;
+
+		if (0 == --iter->second.RefCount)
+			m_nodes.erase(iter);
+	}
+
+	bool MemoryDataSource::tryAddReference(const Hash256& hash) {
+		auto iter = m_nodes.find(hash);
+		if (m_nodes.end() == iter)
+			return false;
+
+		++iter->second.RefCount;
+		return true;
+	}
+}}
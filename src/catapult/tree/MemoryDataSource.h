@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
+
+namespace catapult { namespace tree {
+
+	/// Patricia tree data source that stores all nodes in memory.
+	/// \note Nodes are reference counted because identical nodes can be referenced by multiple branches.
+	class MemoryDataSource {
+	public:
+		/// Gets the number of (unique) nodes in the data source.
+		size_t size() const;
+
+		/// Gets the node with \a hash or \c nullptr if no such node is present.
+		const TreeNode* get(const Hash256& hash) const;
+
+	public:
+		/// Adds a reference to \a node.
+		void set(const TreeNode& node);
+
+		/// Adds a reference to a leaf \a node.
+		void set(const LeafTreeNode& node);
+
+		/// Adds a reference to a branch \a node.
+		void set(const BranchTreeNode& node);
+
+		/// Removes a reference to the node with \a hash and removes the node when it is no longer referenced.
+		void remove(const Hash256& hash);
+
+	private:
+		bool tryAddReference(const Hash256& hash);
+
+	private:
+		struct NodeEntry {
+			TreeNode Node;
+			size_t RefCount;
+		};
+
+	private:
+		std::unordered_map<Hash256, NodeEntry, utils::ArrayHasher<Hash256>> m_nodes;
+	};
+}}
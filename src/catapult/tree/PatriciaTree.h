@@ -20,6 +20,10 @@
 
 #pragma once
 #include "TreeNode.h"
+#include "catapult/utils/IntegerMath.h"
+#include "catapult/exceptions.h"
+#include "catapult/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace tree {
 
@@ -30,6 +34,10 @@ namespace catapult { namespace tree {
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
 
+	public:
+		/// Runs all actions (potentially in parallel) and returns when all of them have completed.
+		using ParallelExecutor = consumer<const std::vector<action>&>;
+
 	public:
 		/// Creates a tree around a \a dataSource.
 		explicit PatriciaTree(TDataSource& dataSource) : m_dataSource(dataSource)
@@ -37,15 +45,22 @@ namespace catapult { namespace tree {
 
 	public:
 		/// Gets the root hash that uniquely identifies this tree.
+		/// \note Batched changes are not reflected until they are committed.
 		Hash256 root() const {
 			return m_rootNode.hash();
 		}
 
+		/// Returns \c true if there are batched changes that have not been committed.
+		bool hasPendingChanges() const {
+			return !!m_pPendingRoot;
+		}
+
 		// region set
 
 	public:
 		/// Sets \a key to \a value in the tree.
 		void set(const KeyType& key, const ValueType& value) {
+			requireNoPendingChanges();
 			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
 			auto encodedValue = TEncoder::EncodeValue(value);
 			m_rootNode = set(m_rootNode, { keyPath, encodedValue});
@@ -162,6 +177,7 @@ namespace catapult { namespace tree {
 	public:
 		/// Removes the value associated with \a key from the tree.
 		bool unset(const KeyType& key) {
+			requireNoPendingChanges();
 			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
 			auto canMerge = true;
 			return unset(m_rootNode, keyPath, m_rootNode, canMerge);
@@ -231,6 +247,7 @@ namespace catapult { namespace tree {
 	public:
 		/// Finds the value associated with \a key in the tree or \c nullptr if no value is set.
 		const Hash256* lookup(const KeyType& key) const {
+			requireNoPendingChanges();
 			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
 			return lookup(m_rootNode, keyPath);
 		}
@@ -262,6 +279,396 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region lookupWithProof
+
+	public:
+		/// Gets all nodes on the path from the root towards \a key in the tree.
+		/// \note The returned nodes are an inclusion proof when the last node is a leaf matching \a key
+		///       and an exclusion proof otherwise (see VerifyTreeProof).
+		std::vector<TreeNode> lookupWithProof(const KeyType& key) const {
+			requireNoPendingChanges();
+
+			std::vector<TreeNode> nodePath;
+			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
+			const auto* pNode = &m_rootNode;
+			while (!pNode->empty()) {
+				nodePath.push_back(pNode->copy());
+
+				// stop at the first node that does not lead towards `keyPath`
+				auto differenceIndex = FindFirstDifferenceIndex(pNode->path(), keyPath);
+				if (!pNode->isBranch() || differenceIndex != pNode->path().size() || differenceIndex == keyPath.size())
+					break;
+
+				const auto& branchNode = pNode->asBranchNode();
+				auto nodeLinkIndex = keyPath.nibbleAt(differenceIndex);
+				if (!branchNode.hasLink(nodeLinkIndex))
+					break;
+
+				// if the tree state is valid, the referenced node must exist
+				pNode = m_dataSource.get(branchNode.link(nodeLinkIndex));
+				if (!pNode)
+					CATAPULT_THROW_RUNTIME_ERROR("tree node referenced by branch is not in data source");
+
+				keyPath = keyPath.subpath(differenceIndex + 1);
+			}
+
+			return nodePath;
+		}
+
+		// endregion
+
+
+		// region batch
+
+		// batched changes are applied to an in memory copy of all affected nodes (pending nodes), which are only normalized,
+		// hashed and saved when the batch is committed, so each modified node is hashed and saved exactly once
+		// (nodes replaced by a committed batch are removed from the data source, which is expected to be reference counted)
+
+	public:
+		/// Sets all keys in \a keyValuePairs to their associated values as part of the current batch.
+		/// \note If a key is contained multiple times, its last value is used.
+		void batchSet(const std::vector<std::pair<KeyType, ValueType>>& keyValuePairs) {
+			std::vector<std::pair<TreeNodePath, Hash256>> pathValuePairs;
+			pathValuePairs.reserve(keyValuePairs.size());
+			for (const auto& pair : keyValuePairs)
+				pathValuePairs.emplace_back(TreeNodePath(TEncoder::EncodeKey(pair.first)), TEncoder::EncodeValue(pair.second));
+
+			// sort changes so that consecutive changes share the longest possible prefix of (already loaded) nodes
+			std::stable_sort(pathValuePairs.begin(), pathValuePairs.end(), [](const auto& lhs, const auto& rhs) {
+				return IsPathLess(lhs.first, rhs.first);
+			});
+
+			auto& pRootNode = pendingRoot();
+			for (const auto& pair : pathValuePairs)
+				batchSet(pRootNode, pair.first, pair.second);
+		}
+
+		/// Removes the values associated with all \a keys as part of the current batch.
+		void batchUnset(const std::vector<KeyType>& keys) {
+			std::vector<TreeNodePath> paths;
+			paths.reserve(keys.size());
+			for (const auto& key : keys)
+				paths.emplace_back(TEncoder::EncodeKey(key));
+
+			std::sort(paths.begin(), paths.end(), IsPathLess);
+
+			auto& pRootNode = pendingRoot();
+			for (const auto& path : paths)
+				batchUnset(pRootNode, path);
+		}
+
+		/// Commits all batched changes by hashing and saving all modified nodes.
+		void commit() {
+			commit([](const auto& actions) {
+				for (const auto& action : actions)
+					action();
+			});
+		}
+
+		/// Commits all batched changes by hashing and saving all modified nodes, using \a executor to hash independent subtrees.
+		void commit(const ParallelExecutor& executor) {
+			if (!m_pPendingRoot)
+				return;
+
+			auto& pRootNode = *m_pPendingRoot;
+			normalize(pRootNode);
+
+			if (pRootNode) {
+				// hash (independent) subtrees rooted at the second level in parallel and then all nodes above them
+				std::vector<PendingNode*> subtrees;
+				collectDirtySubtrees(*pRootNode, Num_Parallel_Levels, subtrees);
+
+				std::vector<action> actions;
+				for (auto* pSubtree : subtrees)
+					actions.push_back([pSubtree]() { hash(*pSubtree); });
+
+				executor(actions);
+				hash(*pRootNode);
+
+				savePending(*pRootNode);
+				if (pRootNode->IsDirty)
+					m_rootNode = std::move(pRootNode->Node);
+			} else {
+				m_rootNode = TreeNode();
+			}
+
+			// remove replaced nodes only after saving all new nodes because the data source is reference counted
+			for (const auto& hash : m_replacedNodeHashes)
+				m_dataSource.remove(hash);
+
+			m_replacedNodeHashes.clear();
+			m_pPendingRoot.reset();
+		}
+
+	private:
+		static constexpr size_t Num_Parallel_Levels = 2;
+
+		struct PendingNode {
+		public:
+			PendingNode(const TreeNodePath& path, bool isLeaf)
+					: Path(path)
+					, IsLeaf(isLeaf)
+					, Value()
+					, Links()
+					, Hash()
+					, IsDirty(true)
+					, IsHashed(false)
+			{}
+
+		public:
+			TreeNodePath Path;
+			bool IsLeaf;
+
+			// leaf data
+			Hash256 Value;
+
+			// branch data, where loaded children take precedence over links
+			std::array<Hash256, 16> Links;
+			std::bitset<16> LinkSet;
+			std::array<std::unique_ptr<PendingNode>, 16> Children;
+
+			// hash of original node when not dirty, otherwise hash of updated node (after hashing)
+			Hash256 Hash;
+			bool IsDirty;
+
+			// updated node (after hashing)
+			TreeNode Node;
+			bool IsHashed;
+		};
+
+		using PendingNodePointer = std::unique_ptr<PendingNode>;
+
+	private:
+		static bool IsPathLess(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+			auto differenceIndex = FindFirstDifferenceIndex(lhs, rhs);
+			return differenceIndex < lhs.size() && differenceIndex < rhs.size()
+					? lhs.nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex)
+					: lhs.size() < rhs.size();
+		}
+
+		static PendingNodePointer CreatePendingLeaf(const TreeNodePath& path, const Hash256& value) {
+			auto pNode = std::make_unique<PendingNode>(path, true);
+			pNode->Value = value;
+			return pNode;
+		}
+
+		static PendingNodePointer LoadPendingNode(const TreeNode& node) {
+			if (node.empty())
+				return nullptr;
+
+			auto pNode = std::make_unique<PendingNode>(node.path(), node.isLeaf());
+			if (node.isLeaf()) {
+				pNode->Value = node.asLeafNode().value();
+			} else {
+				const auto& branchNode = node.asBranchNode();
+				for (auto i = 0u; i < pNode->Links.size(); ++i) {
+					if (!branchNode.hasLink(i))
+						continue;
+
+					pNode->Links[i] = branchNode.link(i);
+					pNode->LinkSet.set(i);
+				}
+			}
+
+			pNode->Hash = node.hash();
+			pNode->IsDirty = false;
+			return pNode;
+		}
+
+		void requireNoPendingChanges() const {
+			if (m_pPendingRoot)
+				CATAPULT_THROW_RUNTIME_ERROR("operation is not supported when tree has pending changes");
+		}
+
+		PendingNodePointer& pendingRoot() {
+			if (!m_pPendingRoot)
+				m_pPendingRoot = std::make_unique<PendingNodePointer>(LoadPendingNode(m_rootNode));
+
+			return *m_pPendingRoot;
+		}
+
+		void markDirty(PendingNode& node) {
+			// the first modification of a node loaded from the data source replaces the original node
+			if (!node.IsDirty)
+				m_replacedNodeHashes.push_back(node.Hash);
+
+			node.IsDirty = true;
+		}
+
+		PendingNodePointer& child(PendingNode& node, uint8_t index) {
+			auto& pChild = node.Children[index];
+			if (!pChild && node.LinkSet.test(index)) {
+				// if the tree state is valid, the referenced node must exist
+				const auto* pChildNode = m_dataSource.get(node.Links[index]);
+				if (!pChildNode)
+					CATAPULT_THROW_RUNTIME_ERROR("tree node referenced by branch is not in data source");
+
+				pChild = LoadPendingNode(*pChildNode);
+			}
+
+			return pChild;
+		}
+
+		void batchSet(PendingNodePointer& pNode, const TreeNodePath& path, const Hash256& value) {
+			// if the node is empty, just create a new leaf
+			if (!pNode) {
+				pNode = CreatePendingLeaf(path, value);
+				return;
+			}
+
+			markDirty(*pNode);
+			auto differenceIndex = FindFirstDifferenceIndex(pNode->Path, path);
+
+			// if leaf node already points to desired location, just change value
+			if (pNode->IsLeaf && differenceIndex == pNode->Path.size()) {
+				pNode->Value = value;
+				return;
+			}
+
+			// if the path is only partially shared, the node needs to be split into a branch
+			if (differenceIndex < pNode->Path.size()) {
+				auto pBranchNode = std::make_unique<PendingNode>(pNode->Path.subpath(0, differenceIndex), false);
+				auto existingLinkIndex = pNode->Path.nibbleAt(differenceIndex);
+				auto newLinkIndex = path.nibbleAt(differenceIndex);
+
+				pNode->Path = pNode->Path.subpath(differenceIndex + 1);
+				pBranchNode->Children[existingLinkIndex] = std::move(pNode);
+				pBranchNode->Children[newLinkIndex] = CreatePendingLeaf(path.subpath(differenceIndex + 1), value);
+				pBranchNode->LinkSet.set(existingLinkIndex);
+				pBranchNode->LinkSet.set(newLinkIndex);
+				pNode = std::move(pBranchNode);
+				return;
+			}
+
+			// the branch path is completely shared, so attach the new node to the connecting node
+			auto linkIndex = path.nibbleAt(differenceIndex);
+			batchSet(child(*pNode, linkIndex), path.subpath(differenceIndex + 1), value);
+			pNode->LinkSet.set(linkIndex);
+		}
+
+		bool batchUnset(PendingNodePointer& pNode, const TreeNodePath& path) {
+			// if the node is empty, there is nothing to do
+			if (!pNode)
+				return false;
+
+			auto differenceIndex = FindFirstDifferenceIndex(pNode->Path, path);
+			if (pNode->IsLeaf) {
+				if (differenceIndex != path.size())
+					return false;
+
+				// matching node was found, so clear it
+				markDirty(*pNode);
+				pNode.reset();
+				return true;
+			}
+
+			// look up the branch connecting with `path`, if it is not found (or not found recursively), no node in the tree can match
+			if (differenceIndex < pNode->Path.size())
+				return false;
+
+			auto linkIndex = path.nibbleAt(differenceIndex);
+			auto& pChild = child(*pNode, linkIndex);
+			if (!batchUnset(pChild, path.subpath(differenceIndex + 1)))
+				return false;
+
+			// branches with less than two links are collapsed during normalization
+			if (!pChild)
+				pNode->LinkSet.reset(linkIndex);
+
+			markDirty(*pNode);
+			return true;
+		}
+
+		void normalize(PendingNodePointer& pNode) {
+			if (!pNode || !pNode->IsDirty || pNode->IsLeaf)
+				return;
+
+			for (auto i = 0u; i < pNode->Children.size(); ++i) {
+				auto& pChild = pNode->Children[i];
+				if (!pChild)
+					continue;
+
+				normalize(pChild);
+				if (!pChild)
+					pNode->LinkSet.reset(i);
+			}
+
+			auto numLinks = pNode->LinkSet.count();
+			if (0 == numLinks) {
+				pNode.reset();
+				return;
+			}
+
+			if (1 != numLinks)
+				return;
+
+			// merge the branch with its single remaining child
+			auto linkIndex = static_cast<uint8_t>(utils::Log2(pNode->LinkSet.to_ulong()));
+			auto pChild = std::move(child(*pNode, linkIndex));
+			pChild->Path = TreeNodePath::Join(pNode->Path, linkIndex, pChild->Path);
+			markDirty(*pChild);
+			pNode = std::move(pChild);
+		}
+
+		static void collectDirtySubtrees(PendingNode& node, size_t depth, std::vector<PendingNode*>& subtrees) {
+			if (!node.IsDirty)
+				return;
+
+			if (0 == depth || node.IsLeaf) {
+				subtrees.push_back(&node);
+				return;
+			}
+
+			for (auto& pChild : node.Children) {
+				if (pChild)
+					collectDirtySubtrees(*pChild, depth - 1, subtrees);
+			}
+		}
+
+		static void hash(PendingNode& node) {
+			// skip nodes that are unchanged or have already been hashed
+			if (!node.IsDirty || node.IsHashed)
+				return;
+
+			node.IsHashed = true;
+			if (node.IsLeaf) {
+				node.Node = TreeNode(LeafTreeNode(node.Path, node.Value));
+				node.Hash = node.Node.hash();
+				return;
+			}
+
+			auto branchNode = BranchTreeNode(node.Path);
+			for (auto i = 0u; i < node.Children.size(); ++i) {
+				if (!node.LinkSet.test(i))
+					continue;
+
+				const auto& pChild = node.Children[i];
+				if (pChild) {
+					hash(*pChild);
+					branchNode.setLink(pChild->Hash, i);
+				} else {
+					branchNode.setLink(node.Links[i], i);
+				}
+			}
+
+			node.Hash = branchNode.hash();
+			node.Node = TreeNode(branchNode);
+		}
+
+		void savePending(const PendingNode& node) {
+			if (!node.IsDirty)
+				return;
+
+			for (const auto& pChild : node.Children) {
+				if (pChild)
+					savePending(*pChild);
+			}
+
+			m_dataSource.set(node.Node);
+		}
+
+		// endregion
+
 	private:
 		template<typename TNode>
 		void save(TNode& node) {
@@ -271,6 +678,8 @@ namespace catapult { namespace tree {
 	private:
 		TDataSource& m_dataSource;
 		TreeNode m_rootNode;
+		std::unique_ptr<PendingNodePointer> m_pPendingRoot;
+		std::vector<Hash256> m_replacedNodeHashes;
 	};
 }}
 
@@ -0,0 +1,235 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeProof.h"
+#include "catapult/exceptions.h"
+#include <array>
+#include <cstring>
+
+namespace catapult { namespace tree {
+
+	// region VerifyTreeProof
+
+	TreeProofResult VerifyTreeProof(
+			const TreeNodePath& keyPath,
+			const std::vector<TreeNode>& nodePath,
+			const Hash256& root,
+			Hash256& value) {
+		// only an empty tree (with a zero root) can be proven by an empty path
+		if (nodePath.empty())
+			return Hash256() == root ? TreeProofResult::Exclusion : TreeProofResult::Invalid;
+
+		auto expectedHash = root;
+		auto remainingPath = keyPath;
+		for (auto i = 0u; i < nodePath.size(); ++i) {
+			const auto& node = nodePath[i];
+			if (node.empty() || expectedHash != node.hash())
+				return TreeProofResult::Invalid;
+
+			auto isLastNode = nodePath.size() == i + 1;
+			if (node.isLeaf()) {
+				if (!isLastNode)
+					return TreeProofResult::Invalid;
+
+				if (node.path() != remainingPath)
+					return TreeProofResult::Exclusion;
+
+				value = node.asLeafNode().value();
+				return TreeProofResult::Inclusion;
+			}
+
+			// a branch that diverges from `remainingPath` proves exclusion
+			auto differenceIndex = FindFirstDifferenceIndex(node.path(), remainingPath);
+			if (differenceIndex == remainingPath.size())
+				return TreeProofResult::Invalid;
+
+			if (differenceIndex != node.path().size())
+				return isLastNode ? TreeProofResult::Exclusion : TreeProofResult::Invalid;
+
+			// a missing link proves exclusion
+			// (check the link hash instead of the link flag because unset links are hashed as zero hashes)
+			const auto& link = node.asBranchNode().link(remainingPath.nibbleAt(differenceIndex));
+			if (Hash256() == link)
+				return isLastNode ? TreeProofResult::Exclusion : TreeProofResult::Invalid;
+
+			// a present link must be followed by the linked node
+			if (isLastNode)
+				return TreeProofResult::Invalid;
+
+			expectedHash = link;
+			remainingPath = remainingPath.subpath(differenceIndex + 1);
+		}
+
+		return TreeProofResult::Invalid;
+	}
+
+	// endregion
+
+	// region serialization
+
+	// each node is serialized as:
+	// - node type (uint8_t; 0 for branch, 1 for leaf)
+	// - number of path nibbles (uint8_t) followed by the packed path nibbles (high nibble first)
+	// - leaf: value (Hash256)
+	// - branch: link mask (uint16_t, little endian) followed by all set links (Hash256) in ascending index order
+
+	namespace {
+		constexpr uint8_t Branch_Node_Type = 0;
+		constexpr uint8_t Leaf_Node_Type = 1;
+		constexpr size_t Max_Path_Nibbles = 0xFF;
+		constexpr size_t Num_Branch_Links = 16;
+
+		void Append(std::vector<uint8_t>& buffer, const uint8_t* pData, size_t size) {
+			buffer.insert(buffer.end(), pData, pData + size);
+		}
+
+		void AppendPath(std::vector<uint8_t>& buffer, const TreeNodePath& path) {
+			if (path.size() > Max_Path_Nibbles)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("tree node path is too long to serialize", path.size());
+
+			buffer.push_back(static_cast<uint8_t>(path.size()));
+			for (auto i = 0u; i < path.size(); i += 2) {
+				auto byte = static_cast<uint8_t>(path.nibbleAt(i) << 4);
+				if (i + 1 < path.size())
+					byte = static_cast<uint8_t>(byte | path.nibbleAt(i + 1));
+
+				buffer.push_back(byte);
+			}
+		}
+
+		class NodeReader {
+		public:
+			explicit NodeReader(const RawBuffer& buffer)
+					: m_buffer(buffer)
+					, m_offset(0)
+			{}
+
+		public:
+			bool hasData() const {
+				return m_offset < m_buffer.Size;
+			}
+
+			bool tryRead(uint8_t* pData, size_t size) {
+				if (m_buffer.Size - m_offset < size)
+					return false;
+
+				std::memcpy(pData, m_buffer.pData + m_offset, size);
+				m_offset += size;
+				return true;
+			}
+
+			bool tryReadPath(TreeNodePath& path) {
+				uint8_t numNibbles;
+				if (!tryRead(&numNibbles, 1))
+					return false;
+
+				std::array<uint8_t, (Max_Path_Nibbles + 1) / 2> packedPath{};
+				if (!tryRead(packedPath.data(), (numNibbles + 1u) / 2))
+					return false;
+
+				path = TreeNodePath(packedPath).subpath(0, numNibbles);
+				return true;
+			}
+
+		private:
+			const RawBuffer& m_buffer;
+			size_t m_offset;
+		};
+
+		bool TryReadNode(NodeReader& reader, std::vector<TreeNode>& nodes) {
+			uint8_t nodeType;
+			TreeNodePath path;
+			if (!reader.tryRead(&nodeType, 1) || !reader.tryReadPath(path))
+				return false;
+
+			if (Leaf_Node_Type == nodeType) {
+				Hash256 value;
+				if (!reader.tryRead(value.data(), value.size()))
+					return false;
+
+				nodes.emplace_back(LeafTreeNode(path, value));
+				return true;
+			}
+
+			uint16_t linkMask;
+			if (Branch_Node_Type != nodeType || !reader.tryRead(reinterpret_cast<uint8_t*>(&linkMask), sizeof(uint16_t)))
+				return false;
+
+			BranchTreeNode branchNode(path);
+			for (auto i = 0u; i < Num_Branch_Links; ++i) {
+				if (0 == (linkMask & (1u << i)))
+					continue;
+
+				Hash256 link;
+				if (!reader.tryRead(link.data(), link.size()))
+					return false;
+
+				branchNode.setLink(link, i);
+			}
+
+			nodes.emplace_back(branchNode);
+			return true;
+		}
+	}
+
+	std::vector<uint8_t> SerializeTreeNodes(const std::vector<TreeNode>& nodes) {
+		std::vector<uint8_t> buffer;
+		for (const auto& node : nodes) {
+			if (node.empty())
+				CATAPULT_THROW_INVALID_ARGUMENT("cannot serialize empty tree node");
+
+			buffer.push_back(node.isLeaf() ? Leaf_Node_Type : Branch_Node_Type);
+			AppendPath(buffer, node.path());
+
+			if (node.isLeaf()) {
+				const auto& value = node.asLeafNode().value();
+				Append(buffer, value.data(), value.size());
+				continue;
+			}
+
+			const auto& branchNode = node.asBranchNode();
+			uint16_t linkMask = 0;
+			for (auto i = 0u; i < Num_Branch_Links; ++i) {
+				if (branchNode.hasLink(i))
+					linkMask = static_cast<uint16_t>(linkMask | (1u << i));
+			}
+
+			Append(buffer, reinterpret_cast<const uint8_t*>(&linkMask), sizeof(uint16_t));
+			for (auto i = 0u; i < Num_Branch_Links; ++i) {
+				if (branchNode.hasLink(i))
+					Append(buffer, branchNode.link(i).data(), Hash256_Size);
+			}
+		}
+
+		return buffer;
+	}
+
+	bool TryDeserializeTreeNodes(const RawBuffer& buffer, std::vector<TreeNode>& nodes) {
+		NodeReader reader(buffer);
+		while (reader.hasData()) {
+			if (!TryReadNode(reader, nodes))
+				return false;
+		}
+
+		return true;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	/// Possible results of verifying a patricia tree proof.
+	enum class TreeProofResult {
+		/// Proof is not valid for the key and root.
+		Invalid,
+
+		/// Proof shows that the key is contained in the tree.
+		Inclusion,
+
+		/// Proof shows that the key is not contained in the tree.
+		Exclusion
+	};
+
+	/// Verifies that \a nodePath is a proof for \a keyPath in a tree with \a root.
+	/// On inclusion, \a value is set to the value associated with \a keyPath.
+	/// \note \a nodePath is expected to be composed of all nodes on the path from the root towards \a keyPath
+	///       (as returned by PatriciaTree::lookupWithProof); no data source is required because all node hashes are recalculated.
+	TreeProofResult VerifyTreeProof(
+			const TreeNodePath& keyPath,
+			const std::vector<TreeNode>& nodePath,
+			const Hash256& root,
+			Hash256& value);
+
+	/// Serializes all \a nodes into a compact binary representation.
+	std::vector<uint8_t> SerializeTreeNodes(const std::vector<TreeNode>& nodes);
+
+	/// Deserializes all tree nodes in \a buffer into \a nodes.
+	/// Returns \c false if \a buffer is malformed.
+	bool TryDeserializeTreeNodes(const RawBuffer& buffer, std::vector<TreeNode>& nodes);
+}}
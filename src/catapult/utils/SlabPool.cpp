@@ -0,0 +1,167 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SlabPool.h"
+
+namespace catapult { namespace utils {
+
+	namespace {
+		size_t GetSizeClassIndex(size_t size) {
+			// zero sized allocations are served from the smallest size class
+			return 0 == size ? 0 : (size - 1) / SlabPool::Block_Alignment;
+		}
+
+		size_t GetBlockSize(size_t sizeClassIndex) {
+			return (sizeClassIndex + 1) * SlabPool::Block_Alignment;
+		}
+	}
+
+	SlabPool::SlabPool(size_t slabSize)
+			: m_slabSize(slabSize < Max_Block_Size ? Max_Block_Size : slabSize)
+			, m_numSlabs(0)
+			, m_numBlocks(0)
+			, m_numBlockBytes(0)
+	{}
+
+	SlabPoolStatistics SlabPool::statistics() const {
+		auto numSlabs = m_numSlabs.load();
+		return { numSlabs, numSlabs * m_slabSize, m_numBlocks.load(), m_numBlockBytes.load() };
+	}
+
+	void* SlabPool::allocate(size_t size) {
+		if (size > Max_Block_Size)
+			return ::operator new(size);
+
+		auto sizeClassIndex = GetSizeClassIndex(size);
+		auto blockSize = GetBlockSize(sizeClassIndex);
+		auto& sizeClass = m_sizeClasses[sizeClassIndex];
+
+		void* pBlock;
+		{
+			SpinLockGuard guard(sizeClass.Lock);
+			auto* pSlab = sizeClass.pActiveSlab;
+			if (!pSlab || !pSlab->hasFreeBlock()) {
+				// switch to an inactive slab with a free block instead of scanning all slabs
+				pSlab = sizeClass.pAvailableSlabs;
+				if (pSlab)
+					unlinkAvailableSlab(sizeClass, *pSlab);
+				else
+					pSlab = &addSlab(sizeClass, blockSize);
+
+				sizeClass.pActiveSlab = pSlab;
+			}
+
+			if (pSlab->pFreeList) {
+				pBlock = pSlab->pFreeList;
+				pSlab->pFreeList = pSlab->pFreeList->pNext;
+			} else {
+				pBlock = pSlab->pCurrent;
+				pSlab->pCurrent += blockSize;
+			}
+
+			++pSlab->NumBlocks;
+		}
+
+		++m_numBlocks;
+		m_numBlockBytes += blockSize;
+		return pBlock;
+	}
+
+	void SlabPool::deallocate(void* pBlock, size_t size) {
+		if (size > Max_Block_Size)
+			return ::operator delete(pBlock);
+
+		auto sizeClassIndex = GetSizeClassIndex(size);
+		auto& sizeClass = m_sizeClasses[sizeClassIndex];
+
+		// released slab memory is freed after the lock is released
+		std::unique_ptr<uint8_t[]> pReleasedSlabData;
+		{
+			SpinLockGuard guard(sizeClass.Lock);
+			auto iter = --sizeClass.Slabs.upper_bound(static_cast<const uint8_t*>(pBlock));
+			auto& slab = iter->second;
+
+			auto* pFreeBlock = static_cast<FreeBlock*>(pBlock);
+			pFreeBlock->pNext = slab.pFreeList;
+			slab.pFreeList = pFreeBlock;
+			--slab.NumBlocks;
+
+			// the active slab is retained so that alternating allocations and deallocations do not repeatedly reserve slabs
+			if (&slab != sizeClass.pActiveSlab) {
+				if (0 == slab.NumBlocks) {
+					if (slab.IsAvailable)
+						unlinkAvailableSlab(sizeClass, slab);
+
+					pReleasedSlabData = std::move(slab.pData);
+					sizeClass.Slabs.erase(iter);
+					--m_numSlabs;
+				} else if (!slab.IsAvailable) {
+					linkAvailableSlab(sizeClass, slab);
+				}
+			}
+		}
+
+		--m_numBlocks;
+		m_numBlockBytes -= GetBlockSize(sizeClassIndex);
+	}
+
+	void SlabPool::linkAvailableSlab(SizeClass& sizeClass, Slab& slab) {
+		slab.pPreviousAvailable = nullptr;
+		slab.pNextAvailable = sizeClass.pAvailableSlabs;
+		if (slab.pNextAvailable)
+			slab.pNextAvailable->pPreviousAvailable = &slab;
+
+		sizeClass.pAvailableSlabs = &slab;
+		slab.IsAvailable = true;
+	}
+
+	void SlabPool::unlinkAvailableSlab(SizeClass& sizeClass, Slab& slab) {
+		if (slab.pPreviousAvailable)
+			slab.pPreviousAvailable->pNextAvailable = slab.pNextAvailable;
+		else
+			sizeClass.pAvailableSlabs = slab.pNextAvailable;
+
+		if (slab.pNextAvailable)
+			slab.pNextAvailable->pPreviousAvailable = slab.pPreviousAvailable;
+
+		slab.pPreviousAvailable = nullptr;
+		slab.pNextAvailable = nullptr;
+		slab.IsAvailable = false;
+	}
+
+	SlabPool::Slab& SlabPool::addSlab(SizeClass& sizeClass, size_t blockSize) {
+		// each size class carves blocks out of its own slabs so that blocks of the same size are contiguous
+		// (the remainder of a slab, if any, is smaller than a single block and is not used)
+		// note: slab memory is intentionally left uninitialized
+		Slab slab;
+		slab.pData = std::unique_ptr<uint8_t[]>(new uint8_t[m_slabSize]);
+		slab.pCurrent = slab.pData.get();
+		slab.pEnd = slab.pCurrent + m_slabSize / blockSize * blockSize;
+		slab.pFreeList = nullptr;
+		slab.NumBlocks = 0;
+		slab.pPreviousAvailable = nullptr;
+		slab.pNextAvailable = nullptr;
+		slab.IsAvailable = false;
+
+		auto* pSlabStart = slab.pCurrent;
+		++m_numSlabs;
+		return sizeClass.Slabs.emplace(pSlabStart, std::move(slab)).first->second;
+	}
+}}
@@ -0,0 +1,173 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include "SpinLock.h"
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+
+namespace catapult { namespace utils {
+
+	/// Slab pool statistics.
+	struct SlabPoolStatistics {
+		/// Number of allocated slabs.
+		uint64_t NumSlabs;
+
+		/// Number of bytes reserved by all slabs.
+		uint64_t NumReservedBytes;
+
+		/// Number of blocks currently handed out by the pool.
+		uint64_t NumBlocks;
+
+		/// Number of bytes currently handed out by the pool (including block rounding).
+		uint64_t NumBlockBytes;
+	};
+
+	/// A thread safe pool that carves small fixed size blocks out of large slabs.
+	/// \note Blocks are grouped into size classes, each with its own slabs and lock. Freed blocks are reused by later
+	///       allocations of the same size class and empty slabs are released unless they are being allocated from.
+	class SlabPool : NonCopyable {
+	public:
+		/// Alignment of all blocks returned by the pool.
+		static constexpr size_t Block_Alignment = 16;
+
+		/// Maximum size of a pooled block; larger allocations are delegated to the global allocator.
+		static constexpr size_t Max_Block_Size = 512;
+
+	public:
+		/// Creates a pool that reserves slabs of (at least) \a slabSize bytes.
+		explicit SlabPool(size_t slabSize = 1024 * 1024);
+
+	public:
+		/// Gets the pool statistics.
+		/// \note Statistics are not captured atomically across size classes.
+		SlabPoolStatistics statistics() const;
+
+	public:
+		/// Allocates a block of at least \a size bytes.
+		void* allocate(size_t size);
+
+		/// Returns the block (\a pBlock) of \a size bytes to the pool.
+		void deallocate(void* pBlock, size_t size);
+
+	private:
+		struct FreeBlock {
+			FreeBlock* pNext;
+		};
+
+		struct Slab {
+			std::unique_ptr<uint8_t[]> pData;
+			uint8_t* pCurrent;
+			uint8_t* pEnd;
+			FreeBlock* pFreeList;
+			size_t NumBlocks;
+
+			// links in the list of (inactive) slabs with free blocks
+			Slab* pPreviousAvailable;
+			Slab* pNextAvailable;
+			bool IsAvailable;
+
+			bool hasFreeBlock() const {
+				// the slab end is aligned to the block size, so any remaining space holds at least one block
+				return pFreeList || pCurrent != pEnd;
+			}
+		};
+
+		struct SizeClass {
+			std::map<const uint8_t*, Slab> Slabs; // keyed by slab start
+			Slab* pActiveSlab = nullptr;
+			Slab* pAvailableSlabs = nullptr; // inactive slabs with free blocks
+			SpinLock Lock;
+		};
+
+	private:
+		static void linkAvailableSlab(SizeClass& sizeClass, Slab& slab);
+
+		static void unlinkAvailableSlab(SizeClass& sizeClass, Slab& slab);
+
+		Slab& addSlab(SizeClass& sizeClass, size_t blockSize);
+
+	private:
+		size_t m_slabSize;
+		std::array<SizeClass, Max_Block_Size / Block_Alignment> m_sizeClasses;
+		std::atomic<uint64_t> m_numSlabs;
+		std::atomic<uint64_t> m_numBlocks;
+		std::atomic<uint64_t> m_numBlockBytes;
+	};
+
+	/// A standard allocator that allocates all objects from a slab pool.
+	template<typename T>
+	class SlabAllocator {
+	public:
+		using value_type = T;
+
+	public:
+		/// Creates an allocator around \a pool.
+		explicit SlabAllocator(SlabPool& pool) noexcept : m_pPool(&pool)
+		{}
+
+		/// Creates an allocator around the same pool as \a allocator.
+		template<typename U>
+		SlabAllocator(const SlabAllocator<U>& allocator) noexcept : m_pPool(&allocator.pool())
+		{}
+
+	public:
+		/// Gets the underlying pool.
+		SlabPool& pool() const noexcept {
+			return *m_pPool;
+		}
+
+	public:
+		/// Allocates storage for \a count objects.
+		T* allocate(size_t count) {
+			if (alignof(T) > SlabPool::Block_Alignment)
+				return static_cast<T*>(::operator new(count * sizeof(T)));
+
+			return static_cast<T*>(m_pPool->allocate(count * sizeof(T)));
+		}
+
+		/// Deallocates storage (\a pObjects) for \a count objects.
+		void deallocate(T* pObjects, size_t count) noexcept {
+			if (alignof(T) > SlabPool::Block_Alignment)
+				return ::operator delete(pObjects);
+
+			m_pPool->deallocate(pObjects, count * sizeof(T));
+		}
+
+	public:
+		/// Returns \c true if this allocator and \a rhs share the same pool.
+		template<typename U>
+		bool operator==(const SlabAllocator<U>& rhs) const noexcept {
+			return m_pPool == &rhs.pool();
+		}
+
+		/// Returns \c true if this allocator and \a rhs do not share the same pool.
+		template<typename U>
+		bool operator!=(const SlabAllocator<U>& rhs) const noexcept {
+			return !(*this == rhs);
+		}
+
+	private:
+		SlabPool* m_pPool;
+	};
+}}
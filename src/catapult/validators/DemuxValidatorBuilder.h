@@ -19,55 +19,74 @@
 **/
 
 #pragma once
-#include "AggregateValidatorBuilder.h"
+#include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
-#include <functional>
+#include "catapult/model/NotificationDispatchTable.h"
+#include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace validators {
 
 	/// A demultiplexing validator builder.
+	/// \note Validators are grouped by notification type when the aggregate is built so that each notification is only
+	///       forwarded to the validators that are registered for its type.
 	template<typename... TArgs>
 	class DemuxValidatorBuilderT {
 	private:
 		template<typename TNotification>
 		using NotificationValidatorPointerT = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
-		using NotificationValidatorPredicate = predicate<const model::Notification&>;
+		using NotificationValidatorPointerVector = std::vector<NotificationValidatorPointerT<model::Notification>>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
+		struct ValidatorRegistration {
+			bool IsTyped;
+			model::NotificationType Type;
+		};
+
 	public:
 		/// Adds a validator (\a pValidator) to the builder that is invoked only when matching notifications are processed.
 		template<
 				typename TNotification,
 				typename X = typename std::enable_if<!std::is_same<model::Notification, TNotification>::value>::type>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+			m_validators.push_back(std::make_unique<TypedValidator<TNotification>>(std::move(pValidator)));
+			m_registrations.push_back({ true, TNotification::Notification_Type });
 			return *this;
 		}
 
 		/// Adds a validator (\a pValidator) to the builder that is always invoked.
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<model::Notification>&& pValidator) {
-			m_builder.add(std::move(pValidator));
+			m_validators.push_back(std::move(pValidator));
+			m_registrations.push_back({ false, model::NotificationType() });
 			return *this;
 		}
 
 		/// Builds a demultiplexing validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return m_builder.build(isSuppressedFailure);
+			DispatchTable dispatchTable;
+			for (auto i = 0u; i < m_validators.size(); ++i) {
+				const auto* pValidator = m_validators[i].get();
+				if (m_registrations[i].IsTyped)
+					dispatchTable.add(m_registrations[i].Type, pValidator);
+				else
+					dispatchTable.addAll(pValidator);
+			}
+
+			m_registrations.clear();
+			return std::make_unique<DemuxAggregateNotificationValidator>(
+					std::move(m_validators),
+					std::move(dispatchTable),
+					isSuppressedFailure);
 		}
 
 	private:
+		using DispatchTable = model::NotificationDispatchTable<const NotificationValidatorT<model::Notification, TArgs...>*>;
+
+		// notification type is checked by the dispatch table, so the validator can be called directly
 		template<typename TNotification>
-		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+		class TypedValidator : public NotificationValidatorT<model::Notification, TArgs...> {
 		public:
-			ConditionalValidator(
-					NotificationValidatorPointerT<TNotification>&& pValidator,
-					const NotificationValidatorPredicate& predicate)
-					: m_pValidator(std::move(pValidator))
-					, m_predicate(predicate)
+			explicit TypedValidator(NotificationValidatorPointerT<TNotification>&& pValidator) : m_pValidator(std::move(pValidator))
 			{}
 
 		public:
@@ -76,18 +95,62 @@ namespace catapult { namespace validators {
 			}
 
 			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
-				if (!m_predicate(notification))
-					return ValidationResult::Success;
-
 				return m_pValidator->validate(static_cast<const TNotification&>(notification), std::forward<TArgs>(args)...);
 			}
 
 		private:
 			NotificationValidatorPointerT<TNotification> m_pValidator;
-			NotificationValidatorPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationValidator : public AggregateNotificationValidatorT<model::Notification, TArgs...> {
+		public:
+			DemuxAggregateNotificationValidator(
+					NotificationValidatorPointerVector&& validators,
+					DispatchTable&& dispatchTable,
+					const ValidationResultPredicate& isSuppressedFailure)
+					: m_validators(std::move(validators))
+					, m_dispatchTable(std::move(dispatchTable))
+					, m_isSuppressedFailure(isSuppressedFailure)
+					, m_name(utils::ReduceNames(utils::ExtractNames(m_validators)))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_validators);
+			}
+
+			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
+				auto aggregateResult = ValidationResult::Success;
+				for (const auto* pValidator : m_dispatchTable.select(notification.Type)) {
+					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
+
+					// ignore suppressed failures
+					if (m_isSuppressedFailure(result))
+						continue;
+
+					// exit on other failures
+					if (IsValidationResultFailure(result))
+						return result;
+
+					AggregateValidationResult(aggregateResult, result);
+				}
+
+				return aggregateResult;
+			}
+
+		private:
+			NotificationValidatorPointerVector m_validators;
+			DispatchTable m_dispatchTable;
+			ValidationResultPredicate m_isSuppressedFailure;
+			std::string m_name;
 		};
 
 	private:
-		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
+		NotificationValidatorPointerVector m_validators;
+		std::vector<ValidatorRegistration> m_registrations;
 	};
 }}
@@ -216,7 +216,7 @@ namespace catapult { namespace api {
 
 		struct RemoteChainApiTraits {
 			static auto Create(const std::shared_ptr<ionet::PacketIo>& pPacketIo) {
-				return test::CreateLifetimeExtendedApi(CreateRemoteChainApi, *pPacketIo, model::TransactionRegistry());
+				return test::CreateLifetimeExtendedApi(CreateRemoteChainApi, *pPacketIo, Key(), model::TransactionRegistry());
 			}
 		};
 	}
@@ -229,4 +229,16 @@ namespace catapult { namespace api {
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockLast)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockAt)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApi, BlocksFrom)
+
+	TEST(RemoteChainApiTests, CanCreateApiForRemoteNode) {
+		// Arrange:
+		mocks::MockPacketIo packetIo;
+		auto remoteIdentityKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto pApi = test::CreateLifetimeExtendedApi(CreateRemoteChainApi, packetIo, remoteIdentityKey, model::TransactionRegistry());
+
+		// Assert:
+		EXPECT_EQ(remoteIdentityKey, pApi->remoteIdentityKey());
+	}
 }}
@@ -102,10 +102,23 @@ namespace catapult { namespace api {
 
 		struct RemoteTransactionApiTraits {
 			static auto Create(const std::shared_ptr<ionet::PacketIo>& pPacketIo) {
-				return test::CreateLifetimeExtendedApi(CreateRemoteTransactionApi, *pPacketIo, mocks::CreateDefaultTransactionRegistry());
+				auto registry = mocks::CreateDefaultTransactionRegistry();
+				return test::CreateLifetimeExtendedApi(CreateRemoteTransactionApi, *pPacketIo, Key(), std::move(registry));
 			}
 		};
 	}
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+
+	TEST(RemoteTransactionApiTests, CanCreateApiForRemoteNode) {
+		// Arrange:
+		mocks::MockPacketIo packetIo;
+		auto remoteIdentityKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto pApi = test::CreateLifetimeExtendedApi(CreateRemoteTransactionApi, packetIo, remoteIdentityKey, mocks::CreateDefaultTransactionRegistry());
+
+		// Assert:
+		EXPECT_EQ(remoteIdentityKey, pApi->remoteIdentityKey());
+	}
 }}
@@ -48,9 +48,22 @@ namespace catapult { namespace cache {
 				CATAPULT_THROW_RUNTIME_ERROR("count - not supported in mock");
 			}
 
+			bool canEvictFor(const model::TransactionInfo&) const override {
+				CATAPULT_THROW_RUNTIME_ERROR("canEvictFor - not supported in mock");
+			}
+
+			bool canAdd(const model::TransactionInfo&) const override {
+				CATAPULT_THROW_RUNTIME_ERROR("canAdd - not supported in mock");
+			}
+
 			std::vector<model::TransactionInfo> removeAll() override {
 				CATAPULT_THROW_RUNTIME_ERROR("removeAll - not supported in mock");
 			}
+
+			std::vector<model::TransactionInfo> takeEvicted() override {
+				// mocks never evict transactions
+				return {};
+			}
 		};
 
 		template<typename TUtCacheModifier>
@@ -172,6 +185,76 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region canEvictFor
+
+	namespace {
+		class MockCanEvictForUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			explicit MockCanEvictForUtCacheModifier(std::vector<Hash256>& hashes) : m_hashes(hashes)
+			{}
+
+		public:
+			bool canEvictFor(const model::TransactionInfo& transactionInfo) const override {
+				m_hashes.push_back(transactionInfo.EntityHash);
+				return true;
+			}
+
+		private:
+			std::vector<Hash256>& m_hashes;
+		};
+	}
+
+	TEST(TEST_CLASS, CanEvictForDelegatesToCache) {
+		// Arrange:
+		std::vector<Hash256> hashes;
+		auto transactionInfo = test::CreateRandomTransactionInfo();
+		TestContext<MockCanEvictForUtCacheModifier> context(hashes);
+
+		// Act:
+		auto canEvict = context.aggregate().modifier().canEvictFor(transactionInfo);
+
+		// Assert: - check ut cache modifier was called as expected
+		EXPECT_TRUE(canEvict);
+		EXPECT_EQ(std::vector<Hash256>({ transactionInfo.EntityHash }), hashes);
+	}
+
+	// endregion
+
+	// region canAdd
+
+	namespace {
+		class MockCanAddUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			explicit MockCanAddUtCacheModifier(std::vector<Hash256>& hashes) : m_hashes(hashes)
+			{}
+
+		public:
+			bool canAdd(const model::TransactionInfo& transactionInfo) const override {
+				m_hashes.push_back(transactionInfo.EntityHash);
+				return true;
+			}
+
+		private:
+			std::vector<Hash256>& m_hashes;
+		};
+	}
+
+	TEST(TEST_CLASS, CanAddDelegatesToCache) {
+		// Arrange:
+		std::vector<Hash256> hashes;
+		auto transactionInfo = test::CreateRandomTransactionInfo();
+		TestContext<MockCanAddUtCacheModifier> context(hashes);
+
+		// Act:
+		auto canAdd = context.aggregate().modifier().canAdd(transactionInfo);
+
+		// Assert: - check ut cache modifier was called as expected
+		EXPECT_TRUE(canAdd);
+		EXPECT_EQ(std::vector<Hash256>({ transactionInfo.EntityHash }), hashes);
+	}
+
+	// endregion
+
 	// region removeAll
 
 	namespace {
@@ -240,4 +323,57 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region eviction
+
+	namespace {
+		class MockEvictingUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			explicit MockEvictingUtCacheModifier(std::vector<model::TransactionInfo>&& evictedTransactionInfos)
+					: m_evictedTransactionInfos(std::move(evictedTransactionInfos))
+			{}
+
+		public:
+			bool add(const model::TransactionInfo&) override {
+				return true;
+			}
+
+			std::vector<model::TransactionInfo> takeEvicted() override {
+				return std::move(m_evictedTransactionInfos);
+			}
+
+		private:
+			std::vector<model::TransactionInfo> m_evictedTransactionInfos;
+		};
+	}
+
+	TEST(TEST_CLASS, AddNotifiesSubscriberOfEvictedTransactionsAsRemoves) {
+		// Arrange:
+		auto utInfos = test::CreateTransactionInfos(3);
+		auto evictedInfos = test::CreateTransactionInfos(2);
+		TestContext<MockEvictingUtCacheModifier> context(test::CopyTransactionInfos(evictedInfos));
+
+		// Act:
+		std::vector<model::TransactionInfo> takenInfos;
+		{
+			auto modifier = context.aggregate().modifier();
+			for (const auto& utInfo : utInfos)
+				modifier.add(utInfo);
+
+			takenInfos = modifier.takeEvicted();
+		}
+
+		// Assert:
+		ASSERT_EQ(2u, takenInfos.size());
+		test::AssertEquivalent(evictedInfos, takenInfos, "taken infos");
+
+		// - check subscriber
+		test::AssertEquivalent(utInfos, context.subscriber().addedInfos(), "subscriber added infos");
+		test::AssertEquivalent(evictedInfos, context.subscriber().removedInfos(), "subscriber removed infos");
+
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(FlushInfo({ 3u, 2u }), context.subscriber().flushInfos()[0]);
+	}
+
+	// endregion
 }}
@@ -231,5 +231,18 @@ namespace catapult { namespace cache {
 		EXPECT_THROW(cache.commit(delta), catapult_runtime_error);
 	}
 
+	COMMIT_TEST(CommitWithoutChangesDoesNotChangeGeneration) {
+		// Arrange:
+		TCache cache(CacheConfiguration{});
+		auto delta = cache.createDelta();
+
+		// Act:
+		cache.commit(delta);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.generation());
+		EXPECT_EQ(0u, cache.createView().Set.generation());
+	}
+
 	// endregion
 }}
@@ -32,6 +32,7 @@ namespace catapult { namespace cache {
 		// Assert:
 		EXPECT_FALSE(config.ShouldUseCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
+		EXPECT_FALSE(config.ShouldEnablePatriciaTrees);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPath) {
@@ -41,5 +42,6 @@ namespace catapult { namespace cache {
 		// Assert:
 		EXPECT_TRUE(config.ShouldUseCacheDatabase);
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
+		EXPECT_FALSE(config.ShouldEnablePatriciaTrees);
 	}
 }}
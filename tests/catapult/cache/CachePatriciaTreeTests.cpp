@@ -0,0 +1,373 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CachePatriciaTree.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/tree/PatriciaTreeProof.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <unordered_set>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS CachePatriciaTreeTests
+
+	namespace {
+		Hash256 CreateHash(uint8_t value) {
+			Hash256 hash;
+			hash.fill(value);
+			return hash;
+		}
+
+		std::vector<std::pair<Hash256, Hash256>> CreateKeyValuePairs(std::initializer_list<uint8_t> keys) {
+			std::vector<std::pair<Hash256, Hash256>> keyValuePairs;
+			for (auto key : keys)
+				keyValuePairs.emplace_back(CreateHash(key), CreateHash(static_cast<uint8_t>(key + 1)));
+
+			return keyValuePairs;
+		}
+	}
+
+	// region CachePatriciaTree
+
+	TEST(TEST_CLASS, TreeIsInitiallyEmpty) {
+		// Act:
+		CachePatriciaTree tree;
+
+		// Assert:
+		EXPECT_EQ(Hash256(), tree.root());
+		EXPECT_EQ(0u, tree.numNodes());
+	}
+
+	TEST(TEST_CLASS, UpdateWithoutChangesDoesNotChangeRoot) {
+		// Arrange:
+		CachePatriciaTree tree;
+		tree.update(CreateKeyValuePairs({ 0x11, 0x22 }), {});
+		auto root = tree.root();
+
+		// Act:
+		tree.update({}, {});
+
+		// Assert:
+		EXPECT_EQ(root, tree.root());
+		EXPECT_EQ(3u, tree.numNodes());
+	}
+
+	TEST(TEST_CLASS, CanAddKeyValuePairs) {
+		// Arrange:
+		CachePatriciaTree tree;
+
+		// Act:
+		tree.update(CreateKeyValuePairs({ 0x11, 0x22, 0x33 }), {});
+
+		// Assert: three leaves and one branch
+		EXPECT_NE(Hash256(), tree.root());
+		EXPECT_EQ(4u, tree.numNodes());
+	}
+
+	TEST(TEST_CLASS, RootIsIndependentOfUpdateOrder) {
+		// Arrange:
+		CachePatriciaTree tree1;
+		CachePatriciaTree tree2;
+
+		// Act:
+		tree1.update(CreateKeyValuePairs({ 0x11, 0x22, 0x33 }), {});
+		tree2.update(CreateKeyValuePairs({ 0x33 }), {});
+		tree2.update(CreateKeyValuePairs({ 0x22, 0x11 }), {});
+
+		// Assert:
+		EXPECT_EQ(tree1.root(), tree2.root());
+		EXPECT_EQ(tree1.numNodes(), tree2.numNodes());
+	}
+
+	TEST(TEST_CLASS, CanModifyValues) {
+		// Arrange:
+		CachePatriciaTree tree;
+		tree.update(CreateKeyValuePairs({ 0x11, 0x22 }), {});
+		auto root = tree.root();
+
+		// Act:
+		tree.update({ { CreateHash(0x11), CreateHash(0x99) } }, {});
+
+		// Assert: the previous leaf and branch nodes were pruned
+		EXPECT_NE(root, tree.root());
+		EXPECT_EQ(3u, tree.numNodes());
+	}
+
+	TEST(TEST_CLASS, CanRemoveKeys) {
+		// Arrange:
+		CachePatriciaTree expectedTree;
+		expectedTree.update(CreateKeyValuePairs({ 0x11, 0x33 }), {});
+
+		CachePatriciaTree tree;
+		tree.update(CreateKeyValuePairs({ 0x11, 0x22, 0x33 }), {});
+
+		// Act:
+		tree.update({}, { CreateHash(0x22) });
+
+		// Assert:
+		EXPECT_EQ(expectedTree.root(), tree.root());
+		EXPECT_EQ(expectedTree.numNodes(), tree.numNodes());
+	}
+
+	TEST(TEST_CLASS, RemovingAllKeysEmptiesTree) {
+		// Arrange:
+		CachePatriciaTree tree;
+		tree.update(CreateKeyValuePairs({ 0x11, 0x22, 0x33 }), {});
+
+		// Act:
+		tree.update({}, { CreateHash(0x11), CreateHash(0x22), CreateHash(0x33) });
+
+		// Assert:
+		EXPECT_EQ(Hash256(), tree.root());
+		EXPECT_EQ(0u, tree.numNodes());
+	}
+
+	TEST(TEST_CLASS, CanLookupKeyWithProof) {
+		// Arrange:
+		CachePatriciaTree tree;
+		tree.update(CreateKeyValuePairs({ 0x11, 0x22, 0x33 }), {});
+
+		// Act:
+		auto nodePath = tree.lookupWithProof(CreateHash(0x22));
+
+		// Assert:
+		Hash256 value;
+		auto keyPath = tree::TreeNodePath(CreateHash(0x22));
+		EXPECT_EQ(tree::TreeProofResult::Inclusion, tree::VerifyTreeProof(keyPath, nodePath, tree.root(), value));
+		EXPECT_EQ(CreateHash(0x23), value);
+	}
+
+	// endregion
+
+	// region PatriciaTreeCacheMixin
+
+	namespace {
+		class PatriciaTreeCacheMixinProxy : public PatriciaTreeCacheMixin {
+		public:
+			explicit PatriciaTreeCacheMixinProxy(const CacheConfiguration& config) : PatriciaTreeCacheMixin(config)
+			{}
+
+		public:
+			using PatriciaTreeCacheMixin::patriciaTree;
+		};
+	}
+
+	TEST(TEST_CLASS, MixinDoesNotHaveTreeWhenPatriciaTreesAreDisabled) {
+		// Arrange:
+		PatriciaTreeCacheMixinProxy mixin((CacheConfiguration()));
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = mixin.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+		EXPECT_FALSE(!!mixin.patriciaTree());
+	}
+
+	TEST(TEST_CLASS, MixinHasTreeWhenPatriciaTreesAreEnabled) {
+		// Arrange:
+		CacheConfiguration config;
+		config.ShouldEnablePatriciaTrees = true;
+		PatriciaTreeCacheMixinProxy mixin(config);
+		ASSERT_TRUE(!!mixin.patriciaTree());
+
+		mixin.patriciaTree()->update(CreateKeyValuePairs({ 0x11, 0x22 }), {});
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = mixin.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_TRUE(hasStateRoot);
+		EXPECT_EQ(mixin.patriciaTree()->root(), stateRoot);
+	}
+
+	TEST(TEST_CLASS, MixinCannotLookupWithProofWhenPatriciaTreesAreDisabled) {
+		// Arrange:
+		PatriciaTreeCacheMixinProxy mixin((CacheConfiguration()));
+
+		// Act:
+		Hash256 stateRoot;
+		std::vector<tree::TreeNode> nodePath;
+		auto hasProof = mixin.tryLookupWithProof(test::GenerateRandomData<Address_Decoded_Size>(), stateRoot, nodePath);
+
+		// Assert:
+		EXPECT_FALSE(hasProof);
+		EXPECT_TRUE(nodePath.empty());
+	}
+
+	TEST(TEST_CLASS, MixinCanLookupWithProofWhenPatriciaTreesAreEnabled) {
+		// Arrange:
+		CacheConfiguration config;
+		config.ShouldEnablePatriciaTrees = true;
+		PatriciaTreeCacheMixinProxy mixin(config);
+
+		auto address1 = test::GenerateRandomData<Address_Decoded_Size>();
+		auto address2 = test::GenerateRandomData<Address_Decoded_Size>();
+		mixin.patriciaTree()->update({
+			{ CalculatePatriciaTreeKey(address1), CreateHash(0x11) },
+			{ CalculatePatriciaTreeKey(address2), CreateHash(0x22) }
+		}, {});
+
+		// Act:
+		Hash256 stateRoot;
+		std::vector<tree::TreeNode> nodePath;
+		auto hasProof = mixin.tryLookupWithProof(address2, stateRoot, nodePath);
+
+		// Assert: the proof is for the tree key corresponding to the cache key
+		EXPECT_TRUE(hasProof);
+		EXPECT_EQ(mixin.patriciaTree()->root(), stateRoot);
+
+		Hash256 value;
+		auto keyPath = tree::TreeNodePath(CalculatePatriciaTreeKey(address2));
+		EXPECT_EQ(tree::TreeProofResult::Inclusion, tree::VerifyTreeProof(keyPath, nodePath, stateRoot, value));
+		EXPECT_EQ(CreateHash(0x22), value);
+	}
+
+	// endregion
+
+	// region HashingOutputStream
+
+	TEST(TEST_CLASS, HashingOutputStreamHashesAllWrittenData) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(100);
+		Hash256 expectedHash;
+		crypto::Sha3_256(buffer, expectedHash);
+
+		HashingOutputStream stream;
+
+		// Act:
+		stream.write({ buffer.data(), 30 });
+		stream.write({ buffer.data() + 30, 70 });
+		stream.flush();
+		auto hash = stream.hash();
+
+		// Assert:
+		EXPECT_EQ(expectedHash, hash);
+	}
+
+	// endregion
+
+	// region CalculatePatriciaTreeKey / CalculatePatriciaTreeValue
+
+	TEST(TEST_CLASS, CanCalculatePatriciaTreeKey) {
+		// Arrange:
+		auto key = test::GenerateRandomData<Address_Decoded_Size>();
+		Hash256 expectedKeyHash;
+		crypto::Sha3_256(key, expectedKeyHash);
+
+		// Act:
+		auto keyHash = CalculatePatriciaTreeKey(key);
+
+		// Assert:
+		EXPECT_EQ(expectedKeyHash, keyHash);
+	}
+
+	TEST(TEST_CLASS, CanCalculatePatriciaTreeValue) {
+		// Arrange:
+		uint64_t value = 0x0123'4567'89AB'CDEF;
+		Hash256 expectedValueHash;
+		crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&value), sizeof(uint64_t) }, expectedValueHash);
+
+		// Act:
+		auto valueHash = CalculatePatriciaTreeValue(value, [](auto element, auto& output) { io::Write64(output, element); });
+
+		// Assert:
+		EXPECT_EQ(expectedValueHash, valueHash);
+	}
+
+	// endregion
+
+	// region UpdatePatriciaTree
+
+	namespace {
+		struct TestElement {
+			uint32_t Key;
+			uint64_t Value;
+		};
+
+		class MockDelta {
+		public:
+			using ElementPointers = std::unordered_set<const TestElement*>;
+
+		public:
+			MockDelta(const ElementPointers& added, const ElementPointers& modified, const ElementPointers& removed)
+					: m_added(added)
+					, m_modified(modified)
+					, m_removed(removed)
+			{}
+
+		public:
+			const ElementPointers& addedElements() const {
+				return m_added;
+			}
+
+			const ElementPointers& modifiedElements() const {
+				return m_modified;
+			}
+
+			const ElementPointers& removedElements() const {
+				return m_removed;
+			}
+
+		private:
+			ElementPointers m_added;
+			ElementPointers m_modified;
+			ElementPointers m_removed;
+		};
+
+		uint32_t GetKey(const TestElement& element) {
+			return element.Key;
+		}
+
+		void SaveElement(const TestElement& element, io::OutputStream& output) {
+			io::Write64(output, element.Value);
+		}
+
+		std::pair<Hash256, Hash256> ToKeyValuePair(const TestElement& element) {
+			return std::make_pair(CalculatePatriciaTreeKey(element.Key), CalculatePatriciaTreeValue(element, SaveElement));
+		}
+	}
+
+	TEST(TEST_CLASS, UpdatePatriciaTreeAppliesAllDeltaChanges) {
+		// Arrange:
+		std::vector<TestElement> elements{ { 1, 11 }, { 2, 22 }, { 3, 33 }, { 4, 44 }, { 2, 99 } };
+
+		CachePatriciaTree tree;
+		tree.update({ ToKeyValuePair(elements[1]), ToKeyValuePair(elements[3]) }, {});
+
+		CachePatriciaTree expectedTree;
+		expectedTree.update({ ToKeyValuePair(elements[0]), ToKeyValuePair(elements[2]), ToKeyValuePair(elements[4]) }, {});
+
+		// - add { 1, 3 }, modify { 2 } and remove { 4 }
+		MockDelta delta({ &elements[0], &elements[2] }, { &elements[4] }, { &elements[3] });
+
+		// Act:
+		UpdatePatriciaTree(tree, delta, GetKey, SaveElement);
+
+		// Assert:
+		EXPECT_EQ(expectedTree.root(), tree.root());
+		EXPECT_EQ(expectedTree.numNodes(), tree.numNodes());
+	}
+
+	// endregion
+}}
@@ -19,10 +19,12 @@
 **/
 
 #include "catapult/cache/CacheStorageAdapter.h"
+#include "catapult/cache/CacheHeight.h"
 #include "catapult/cache/SubCachePluginAdapter.h"
 #include "tests/catapult/cache/test/CacheSerializationTestUtils.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -65,8 +67,12 @@ namespace catapult { namespace cache {
 
 		class VectorToCacheAdapter {
 		public:
+			static constexpr size_t Id = 0;
 			static constexpr auto Name = "TestEntry Cache!";
 
+		public:
+			using CacheViewType = ViewAdapter;
+
 		public:
 			explicit VectorToCacheAdapter(std::vector<TestEntry>& entries) : m_entries(entries)
 			{}
@@ -98,11 +104,41 @@ namespace catapult { namespace cache {
 				++m_counts.NumCommitCalls;
 			}
 
+			size_t generation() const {
+				return 100 + m_counts.NumCommitCalls;
+			}
+
 		private:
 			std::vector<TestEntry>& m_entries;
 			mutable CallCounts m_counts;
 		};
 
+		class ViewAdapterSubCacheView : public SubCacheView {
+		public:
+			explicit ViewAdapterSubCacheView(const std::vector<TestEntry>& entries) : m_view(entries)
+			{}
+
+		public:
+			const void* get() const override {
+				return &m_view;
+			}
+
+			void* get() override {
+				return &m_view;
+			}
+
+			const void* asReadOnly() const override {
+				return &m_view;
+			}
+
+			bool tryGetStateRoot(Hash256&) const override {
+				return false;
+			}
+
+		private:
+			ViewAdapter m_view;
+		};
+
 		// endregion
 
 		struct TestEntryStorageTraits : public TestEntryLoaderTraits {
@@ -127,6 +163,21 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("TestEntry Cache!", name);
 	}
 
+	TEST(TEST_CLASS, CanGetGenerationFromStorageAdapter) {
+		// Arrange:
+		std::vector<TestEntry> seed;
+		VectorToCacheAdapter cache(seed);
+		CacheStorageAdapter<VectorToCacheAdapter, TestEntryStorageTraits> storage(cache);
+		cache.commit();
+		cache.commit();
+
+		// Act:
+		auto generation = storage.generation();
+
+		// Assert:
+		EXPECT_EQ(102u, generation);
+	}
+
 	namespace {
 		void AssertCanSaveViaCacheStorageAdapter(uint64_t numEntries) {
 			// Arrange:
@@ -161,8 +212,35 @@ namespace catapult { namespace cache {
 		AssertCanSaveViaCacheStorageAdapter(8);
 	}
 
+	TEST(TEST_CLASS, CanSaveDataFromCatapultCacheViewViaCacheStorageAdapter) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(8);
+		VectorToCacheAdapter cache(seed);
+		CacheStorageAdapter<VectorToCacheAdapter, TestEntryStorageTraits> storage(cache);
+
+		CacheHeight cacheHeight;
+		std::vector<std::unique_ptr<const SubCacheView>> subViews;
+		subViews.push_back(std::make_unique<ViewAdapterSubCacheView>(seed));
+		CatapultCacheView cacheView(cacheHeight.view(), std::move(subViews));
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.saveAll(cacheView, stream);
+
+		// Assert: the supplied view is used instead of a new one
+		EXPECT_EQ(0u, cache.counts().NumCreateViewCalls);
+		EXPECT_EQ(0u, cache.counts().NumCreateDeltaCalls);
+		EXPECT_EQ(0u, cache.counts().NumCommitCalls);
+
+		AssertAreEqual(seed, buffer);
+		EXPECT_EQ(1u, stream.numFlushes());
+	}
+
 	namespace {
-		void AssertCanLoadViaCacheStorageAdapter(size_t numEntries, size_t batchSize, size_t numExpectedBatches) {
+		template<typename TLoadAll>
+		void AssertCanLoadViaCacheStorageAdapter(size_t numEntries, size_t batchSize, size_t numExpectedBatches, TLoadAll loadAll) {
 			// Arrange:
 			std::vector<TestEntry> loadedEntries;
 			VectorToCacheAdapter cache(loadedEntries);
@@ -173,7 +251,7 @@ namespace catapult { namespace cache {
 			mocks::MockMemoryStream stream("", buffer);
 
 			// Act:
-			storage.loadAll(stream, batchSize);
+			loadAll(storage, stream, batchSize);
 
 			// Assert:
 			EXPECT_EQ(0u, cache.counts().NumCreateViewCalls);
@@ -183,6 +261,22 @@ namespace catapult { namespace cache {
 			EXPECT_EQ(seed, loadedEntries);
 			EXPECT_EQ(0u, stream.numFlushes());
 		}
+
+		void AssertCanLoadViaCacheStorageAdapter(size_t numEntries, size_t batchSize, size_t numExpectedBatches) {
+			AssertCanLoadViaCacheStorageAdapter(numEntries, batchSize, numExpectedBatches, [](auto& storage, auto& stream, auto size) {
+				storage.loadAll(stream, size);
+			});
+		}
+
+		void AssertCanLoadViaCacheStorageAdapterWithPool(size_t numEntries, size_t batchSize, size_t numExpectedBatches) {
+			auto pPool = test::CreateStartedIoServiceThreadPool(2);
+			AssertCanLoadViaCacheStorageAdapter(numEntries, batchSize, numExpectedBatches, [&pool = *pPool](
+					auto& storage,
+					auto& stream,
+					auto size) {
+				storage.loadAll(stream, size, pool);
+			});
+		}
 	}
 
 	TEST(TEST_CLASS, CanLoadViaCacheStorageAdapter_SingleBatch) {
@@ -194,4 +288,14 @@ namespace catapult { namespace cache {
 		// Assert:
 		AssertCanLoadViaCacheStorageAdapter(7, 2, 4);
 	}
+
+	TEST(TEST_CLASS, CanLoadViaCacheStorageAdapterWithPool_SingleBatch) {
+		// Assert:
+		AssertCanLoadViaCacheStorageAdapterWithPool(7, 100, 1);
+	}
+
+	TEST(TEST_CLASS, CanLoadViaCacheStorageAdapterWithPool_MultipleBatches) {
+		// Assert:
+		AssertCanLoadViaCacheStorageAdapterWithPool(7, 2, 4);
+	}
 }}
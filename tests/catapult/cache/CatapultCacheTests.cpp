@@ -24,6 +24,7 @@
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
 
@@ -216,6 +217,165 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region parallel commit
+
+	TEST(TEST_CLASS, ParallelCommitDelegatesToSubCaches) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool(2);
+		auto cache = CreateSimpleCatapultCache();
+		{
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+
+			// Act:
+			cache.commit(Height(), *pPool);
+		}
+
+		// Assert:
+		AssertSubCacheSizes(cache.createView(), 1);
+	}
+
+	TEST(TEST_CLASS, ParallelCommitUpdatesCacheHeight) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool(2);
+		auto cache = CreateSimpleCatapultCache();
+		{
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+
+			// Act:
+			cache.commit(Height(123), *pPool);
+		}
+
+		// Assert:
+		EXPECT_EQ(Height(123), cache.createView().height());
+		EXPECT_EQ(Height(123), cache.createDetachableDelta().height());
+	}
+
+	TEST(TEST_CLASS, ParallelCommitSupportsSparseSubCaches) {
+		// Arrange: only register a single subcache
+		auto pPool = test::CreateStartedIoServiceThreadPool(2);
+		CatapultCacheBuilder builder;
+		AddSubCacheWithId<4>(builder);
+		auto cache = builder.build();
+		{
+			auto delta = cache.createDelta();
+			delta.sub<test::SimpleCacheT<4>>().increment();
+
+			// Act:
+			cache.commit(Height(7), *pPool);
+		}
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(Height(7), view.height());
+		EXPECT_EQ(1u, view.sub<test::SimpleCacheT<4>>().size());
+	}
+
+	// endregion
+
+	// region commit diagnostics
+
+	TEST(TEST_CLASS, CanRetrieveSubCacheNames) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act:
+		auto names = cache.subCacheNames();
+
+		// Assert: names are ordered by id
+		std::vector<std::pair<size_t, std::string>> expectedNames{
+			{ 2, "SimpleCache (id = 2)" }, { 4, "SimpleCache (id = 4)" }, { 6, "SimpleCache (id = 6)" }
+		};
+		EXPECT_EQ(expectedNames, names);
+	}
+
+	TEST(TEST_CLASS, LastCommitMillisIsInitiallyZero) {
+		// Act:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Assert:
+		for (auto id : { 2u, 4u, 6u })
+			EXPECT_EQ(0u, cache.lastCommitMillis(id)) << "cache " << id;
+	}
+
+	// endregion
+
+	// region state roots
+
+	namespace {
+		template<size_t CacheId>
+		void AddSubCacheWithStateRootWithId(CatapultCacheBuilder& builder) {
+			CacheConfiguration config;
+			config.ShouldEnablePatriciaTrees = true;
+			builder.add<test::SimpleCacheStorageTraits>(std::make_unique<test::SimpleCacheT<CacheId>>(config));
+		}
+
+		CatapultCache CreateSimpleCatapultCacheWithStateRoots() {
+			// Arrange: only enable state roots for some subcaches
+			CatapultCacheBuilder builder;
+			AddSubCacheWithStateRootWithId<2>(builder);
+			AddSubCacheWithId<6>(builder);
+			AddSubCacheWithStateRootWithId<4>(builder);
+			return builder.build();
+		}
+	}
+
+	TEST(TEST_CLASS, CanRetrieveSubCacheStateRootsFromView) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheWithStateRoots();
+		{
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+			cache.commit(Height());
+		}
+
+		// Act:
+		auto view = cache.createView();
+		Hash256 stateRoot2;
+		auto hasStateRoot2 = view.tryGetStateRoot<test::SimpleCacheT<2>>(stateRoot2);
+		Hash256 stateRoot6;
+		auto hasStateRoot6 = view.tryGetStateRoot<test::SimpleCacheT<6>>(stateRoot6);
+
+		// Assert:
+		EXPECT_TRUE(hasStateRoot2);
+		EXPECT_EQ(test::CalculateSimpleCacheStateRoot(1), stateRoot2);
+		EXPECT_FALSE(hasStateRoot6);
+	}
+
+	TEST(TEST_CLASS, CanRetrieveAllSubCacheStateRootsFromView) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheWithStateRoots();
+		{
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+			delta.sub<test::SimpleCacheT<4>>().increment();
+			cache.commit(Height());
+		}
+
+		// Act:
+		auto stateRoots = cache.createView().stateRoots();
+
+		// Assert: only subcaches supporting state roots are present (ordered by id)
+		std::vector<std::pair<size_t, Hash256>> expectedStateRoots{
+			{ 2, test::CalculateSimpleCacheStateRoot(1) }, { 4, test::CalculateSimpleCacheStateRoot(2) }
+		};
+		EXPECT_EQ(expectedStateRoots, stateRoots);
+	}
+
+	TEST(TEST_CLASS, StateRootsAreEmptyWhenNoSubCachesSupportStateRoots) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act:
+		auto stateRoots = cache.createView().stateRoots();
+
+		// Assert:
+		EXPECT_TRUE(stateRoots.empty());
+	}
+
+	// endregion
+
 	// region toReadOnly
 
 	TEST(TEST_CLASS, CanAcquireReadOnlyViewOfView) {
@@ -21,6 +21,7 @@
 #include "catapult/cache/ChunkedDataLoader.h"
 #include "tests/catapult/cache/test/CacheSerializationTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -201,4 +202,105 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region parallel parser
+
+	namespace {
+		constexpr uint64_t Unparsable_Alpha = 0;
+
+		struct TestEntryParallelLoaderTraits {
+			using DestinationType = std::vector<size_t>;
+			using ParsedType = size_t;
+
+			static TestEntry Load(io::InputStream& input) {
+				TestEntry entry;
+				input.read({ reinterpret_cast<uint8_t*>(&entry), sizeof(TestEntry) });
+				return entry;
+			}
+
+			static void LoadInto(io::InputStream&, DestinationType&) {
+				CATAPULT_THROW_RUNTIME_ERROR("LoadInto should not be called when parallel parsing is supported");
+			}
+
+			static size_t Parse(const TestEntry& entry) {
+				if (Unparsable_Alpha == entry.Alpha)
+					CATAPULT_THROW_INVALID_ARGUMENT("entry is unparsable");
+
+				return entry.Beta * entry.Gamma;
+			}
+
+			static void AddParsed(DestinationType& destination, size_t&& value) {
+				destination.push_back(value);
+			}
+		};
+
+		std::vector<TestEntry> GenerateRandomParsableEntries(size_t count) {
+			auto entries = GenerateRandomEntries(count);
+			for (auto& entry : entries)
+				entry.Alpha |= 1;
+
+			return entries;
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelParserLoadsAllEntriesInOrder) {
+		// Arrange:
+		constexpr auto Num_Entries = 107u;
+		auto seed = GenerateRandomParsableEntries(Num_Entries);
+		auto buffer = CopyEntriesToStreamBuffer(seed);
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataLoader<TestEntryParallelLoaderTraits> loader(stream);
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+
+		// Act: load all values
+		std::vector<size_t> loadedValues;
+		for (auto count : { 20u, 3u, 84u }) {
+			// Sanity:
+			EXPECT_TRUE(loader.hasNext());
+
+			// Act:
+			loader.next(count, loadedValues, *pPool);
+		}
+
+		EXPECT_FALSE(loader.hasNext());
+
+		// Assert:
+		ASSERT_EQ(Num_Entries, loadedValues.size());
+		for (auto i = 0u; i < Num_Entries; ++i)
+			EXPECT_EQ(static_cast<size_t>(seed[i].Beta * seed[i].Gamma), loadedValues[i]) << "entry at " << i;
+	}
+
+	TEST(TEST_CLASS, ParallelParserPropagatesParseException) {
+		// Arrange: make one entry unparsable
+		auto seed = GenerateRandomParsableEntries(20);
+		seed[13].Alpha = Unparsable_Alpha;
+		auto buffer = CopyEntriesToStreamBuffer(seed);
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataLoader<TestEntryParallelLoaderTraits> loader(stream);
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+
+		// Act + Assert:
+		std::vector<size_t> loadedValues;
+		EXPECT_THROW(loader.next(20, loadedValues, *pPool), catapult_invalid_argument);
+		EXPECT_TRUE(loadedValues.empty());
+	}
+
+	TEST(TEST_CLASS, PoolIsIgnoredWhenTraitsDoNotSupportParallelParsing) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(7);
+		auto buffer = CopyEntriesToStreamBuffer(seed);
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataLoader<TestEntryLoaderTraits> loader(stream);
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+
+		// Act:
+		std::vector<TestEntry> loadedEntries;
+		loader.next(7, loadedEntries, *pPool);
+
+		// Assert:
+		EXPECT_FALSE(loader.hasNext());
+		EXPECT_EQ(seed, loadedEntries);
+	}
+
+	// endregion
 }}
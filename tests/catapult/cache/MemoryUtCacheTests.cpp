@@ -515,6 +515,115 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEachByPriority
+
+	namespace {
+		model::TransactionInfo CreateTransactionInfoWithSizeAndFee(uint32_t size, Amount fee) {
+			auto pTransaction = test::GenerateRandomTransaction(size);
+			pTransaction->Fee = fee;
+			auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+			test::FillWithRandomData(transactionInfo.EntityHash);
+			return transactionInfo;
+		}
+
+		std::vector<Hash256> ExtractHashesByPriority(const MemoryUtCache& cache, size_t numRequested = 1'000) {
+			std::vector<Hash256> hashes;
+			cache.view().forEachByPriority([numRequested, &hashes](const auto& info) {
+				hashes.push_back(info.EntityHash);
+				return numRequested != hashes.size();
+			});
+			return hashes;
+		}
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithDifferentFeeDensities() {
+			// fee densities: 2, 5, 1, 5, 3
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.push_back(CreateTransactionInfoWithSizeAndFee(400, Amount(800)));
+			transactionInfos.push_back(CreateTransactionInfoWithSizeAndFee(200, Amount(1000)));
+			transactionInfos.push_back(CreateTransactionInfoWithSizeAndFee(600, Amount(600)));
+			transactionInfos.push_back(CreateTransactionInfoWithSizeAndFee(300, Amount(1500)));
+			transactionInfos.push_back(CreateTransactionInfoWithSizeAndFee(240, Amount(720)));
+			return transactionInfos;
+		}
+
+		std::vector<Hash256> SelectHashes(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				std::initializer_list<size_t> indexes) {
+			std::vector<Hash256> hashes;
+			for (auto index : indexes)
+				hashes.push_back(transactionInfos[index].EntityHash);
+
+			return hashes;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsNoTransactionInfosIfCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act:
+		auto hashes = ExtractHashesByPriority(cache);
+
+		// Assert:
+		EXPECT_TRUE(hashes.empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsTransactionsByDescendingFeeDensityAndThenByArrival) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithDifferentFeeDensities();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto hashes = ExtractHashesByPriority(cache);
+
+		// Assert:
+		EXPECT_EQ(SelectHashes(transactionInfos, { 1, 3, 4, 0, 2 }), hashes);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsSubsetOfTransactionsIfShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithDifferentFeeDensities();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto hashes = ExtractHashesByPriority(cache, 3);
+
+		// Assert:
+		EXPECT_EQ(SelectHashes(transactionInfos, { 1, 3, 4 }), hashes);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityDoesNotForwardRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithDifferentFeeDensities();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		cache.modifier().remove(transactionInfos[3].EntityHash);
+		cache.modifier().remove(transactionInfos[0].EntityHash);
+		auto hashes = ExtractHashesByPriority(cache);
+
+		// Assert:
+		EXPECT_EQ(SelectHashes(transactionInfos, { 1, 4, 2 }), hashes);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityDoesNotForwardTransactionsAfterRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithDifferentFeeDensities());
+
+		// Act:
+		cache.modifier().removeAll();
+		auto hashes = ExtractHashesByPriority(cache);
+
+		// Assert:
+		EXPECT_TRUE(hashes.empty());
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsAllShortHashes) {
@@ -614,15 +723,26 @@ namespace catapult { namespace cache {
 	// region max size
 
 	namespace {
-		auto CreateTransactionInfoWithDeadline(Timestamp deadline) {
-			return test::CreateTransactionInfoWithDeadline(deadline.unwrap());
+		constexpr Amount Seed_Fee(100);
+
+		auto CreateTransactionInfoWithDeadline(Timestamp deadline, Amount fee = Seed_Fee) {
+			return test::CreateTransactionInfoWithDeadlineAndFee(deadline.unwrap(), fee);
+		}
+
+		auto CreateSeedTransactionInfos(size_t count) {
+			// all seed transactions have the same size and fee
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(CreateTransactionInfoWithDeadline(Timestamp(i + 1)));
+
+			return transactionInfos;
 		}
 	}
 
 	TEST(TEST_CLASS, CacheCanContainMaxTransactions) {
 		// Arrange: fill the cache with one less than max transactions
 		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
-		test::AddAll(cache, test::CreateTransactionInfos(4));
+		test::AddAll(cache, CreateSeedTransactionInfos(4));
 		auto transactionInfo = CreateTransactionInfoWithDeadline(Timestamp(1234));
 
 		// Act: add another info
@@ -634,19 +754,139 @@ namespace catapult { namespace cache {
 		test::AssertDeadlines(cache, { 1, 2, 3, 4, 1234 });
 	}
 
+	namespace {
+		void AssertCacheRejectsTransactionWhenFull(Amount fee) {
+			// Arrange: fill the cache with max transactions
+			MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+			test::AddAll(cache, CreateSeedTransactionInfos(5));
+			auto transactionInfo = CreateTransactionInfoWithDeadline(Timestamp(1234), fee);
+
+			// Act: add another info
+			auto isAdded = cache.modifier().add(transactionInfo);
+
+			// Assert: the new info was not added and nothing was evicted
+			EXPECT_FALSE(isAdded);
+			AssertCacheSize(cache, 5);
+			test::AssertDeadlines(cache, { 1, 2, 3, 4, 5 });
+			EXPECT_TRUE(cache.modifier().takeEvicted().empty());
+		}
+	}
+
 	TEST(TEST_CLASS, CacheCannotContainMoreThanMaxTransactions) {
-		// Arrange: fill the cache with max transactions
+		// Assert: equal fee density does not have a higher priority than earlier arrivals
+		AssertCacheRejectsTransactionWhenFull(Seed_Fee);
+	}
+
+	TEST(TEST_CLASS, CacheRejectsLowerPriorityTransactionWhenFull) {
+		// Assert:
+		AssertCacheRejectsTransactionWhenFull(Amount(Seed_Fee.unwrap() - 1));
+	}
+
+	TEST(TEST_CLASS, CacheEvictsLowestPriorityTransactionWhenFullAndHigherPriorityTransactionIsAdded) {
+		// Arrange: fill the cache with max transactions and make the fourth transaction the lowest priority one
 		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
-		test::AddAll(cache, test::CreateTransactionInfos(5));
-		auto transactionInfo = CreateTransactionInfoWithDeadline(Timestamp(1234));
+		auto seedInfos = CreateSeedTransactionInfos(5);
+		seedInfos[3] = CreateTransactionInfoWithDeadline(Timestamp(4), Amount(Seed_Fee.unwrap() - 10));
+		test::AddAll(cache, seedInfos);
+		auto transactionInfo = CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() - 5));
 
 		// Act: add another info
-		auto isAdded = cache.modifier().add(transactionInfo);
+		bool isAdded;
+		std::vector<model::TransactionInfo> evictedInfos;
+		{
+			auto modifier = cache.modifier();
+			isAdded = modifier.add(transactionInfo);
+			evictedInfos = modifier.takeEvicted();
+		}
 
-		// Assert: the new info was not added
-		EXPECT_FALSE(isAdded);
+		// Assert: the new info was added and the lowest priority info was evicted
+		EXPECT_TRUE(isAdded);
 		AssertCacheSize(cache, 5);
-		test::AssertDeadlines(cache, { 1, 2, 3, 4, 5 });
+		test::AssertDeadlines(cache, { 1, 2, 3, 5, 1234 });
+
+		auto expectedHashes = SelectHashes(seedInfos, { 0, 1, 2, 4 });
+		expectedHashes.push_back(transactionInfo.EntityHash);
+		EXPECT_EQ(expectedHashes, ExtractHashesByPriority(cache));
+
+		ASSERT_EQ(1u, evictedInfos.size());
+		test::AssertEqual(seedInfos[3], evictedInfos[0]);
+		EXPECT_EQ(0u, cache.modifier().count(seedInfos[3].pEntity->Signer));
+	}
+
+	TEST(TEST_CLASS, CannotEvictForTransactionWhenCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto transactionInfo = CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() + 1));
+
+		// Act:
+		auto canEvict = cache.modifier().canEvictFor(transactionInfo);
+
+		// Assert:
+		EXPECT_FALSE(canEvict);
+	}
+
+	TEST(TEST_CLASS, CanEvictForTransactionOnlyWhenTransactionHasHigherPriorityThanLowestPriorityTransaction) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		test::AddAll(cache, CreateSeedTransactionInfos(5));
+		auto modifier = cache.modifier();
+
+		// Act + Assert:
+		EXPECT_FALSE(modifier.canEvictFor(CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() - 1))));
+		EXPECT_FALSE(modifier.canEvictFor(CreateTransactionInfoWithDeadline(Timestamp(1234), Seed_Fee)));
+		EXPECT_TRUE(modifier.canEvictFor(CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() + 1))));
+
+		// - nothing was evicted
+		EXPECT_EQ(5u, modifier.size());
+		EXPECT_TRUE(modifier.takeEvicted().empty());
+	}
+
+	TEST(TEST_CLASS, CanAddTransactionWhenCacheIsNotFullAndTransactionIsUnknown) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto seedInfos = CreateSeedTransactionInfos(4);
+		test::AddAll(cache, seedInfos);
+		auto modifier = cache.modifier();
+
+		// Act + Assert: a lower priority transaction can be added but a known transaction cannot
+		EXPECT_TRUE(modifier.canAdd(CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() - 1))));
+		EXPECT_FALSE(modifier.canAdd(seedInfos[2]));
+	}
+
+	TEST(TEST_CLASS, CanAddTransactionToFullCacheOnlyWhenTransactionHasHigherPriorityThanLowestPriorityTransaction) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		test::AddAll(cache, CreateSeedTransactionInfos(5));
+		auto modifier = cache.modifier();
+
+		// Act + Assert:
+		EXPECT_FALSE(modifier.canAdd(CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() - 1))));
+		EXPECT_FALSE(modifier.canAdd(CreateTransactionInfoWithDeadline(Timestamp(1234), Seed_Fee)));
+		EXPECT_TRUE(modifier.canAdd(CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() + 1))));
+
+		// - nothing was evicted
+		EXPECT_EQ(5u, modifier.size());
+		EXPECT_TRUE(modifier.takeEvicted().empty());
+	}
+
+	TEST(TEST_CLASS, EvictedTransactionsAreOnlyReturnedOnce) {
+		// Arrange: fill the cache with max transactions
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto seedInfos = CreateSeedTransactionInfos(5);
+		test::AddAll(cache, seedInfos);
+
+		// Act: add two higher priority infos
+		auto modifier = cache.modifier();
+		modifier.add(CreateTransactionInfoWithDeadline(Timestamp(1234), Amount(Seed_Fee.unwrap() + 1)));
+		modifier.add(CreateTransactionInfoWithDeadline(Timestamp(1235), Amount(Seed_Fee.unwrap() + 1)));
+		auto evictedInfos1 = modifier.takeEvicted();
+		auto evictedInfos2 = modifier.takeEvicted();
+
+		// Assert: most recent seed infos were evicted first
+		ASSERT_EQ(2u, evictedInfos1.size());
+		test::AssertEqual(seedInfos[4], evictedInfos1[0]);
+		test::AssertEqual(seedInfos[3], evictedInfos1[1]);
+		EXPECT_TRUE(evictedInfos2.empty());
 	}
 
 	TEST(TEST_CLASS, CacheCanAcceptNewTransactionsAfterMaxTransactionsAreReduced) {
@@ -655,7 +895,7 @@ namespace catapult { namespace cache {
 		auto transactionInfo = CreateTransactionInfoWithDeadline(Timestamp(1234));
 
 		// - fill the cache with max transactions
-		auto seedInfos = test::CreateTransactionInfos(5);
+		auto seedInfos = CreateSeedTransactionInfos(5);
 		auto seedHash = seedInfos[2].EntityHash;
 		test::AddAll(cache, seedInfos);
 
@@ -33,16 +33,25 @@ namespace catapult { namespace cache {
 		using SimpleCache = test::SimpleCacheT<3>;
 		using SimpleCachePluginAdapter = SubCachePluginAdapter<SimpleCache, test::SimpleCacheStorageTraits>;
 
-		std::unique_ptr<SimpleCache> CreateSimpleCacheWithValue(
-				size_t value,
-				test::SimpleCacheViewMode mode = test::SimpleCacheViewMode::Iterable) {
-			auto pCache = std::make_unique<SimpleCache>(mode);
+		std::unique_ptr<SimpleCache> SetValue(std::unique_ptr<SimpleCache>&& pCache, size_t value) {
 			auto delta = pCache->createDelta();
 			for (auto i = 0u; i < value; ++i)
 				delta->increment();
 
 			pCache->commit();
-			return pCache;
+			return std::move(pCache);
+		}
+
+		std::unique_ptr<SimpleCache> CreateSimpleCacheWithValue(
+				size_t value,
+				test::SimpleCacheViewMode mode = test::SimpleCacheViewMode::Iterable) {
+			return SetValue(std::make_unique<SimpleCache>(mode), value);
+		}
+
+		std::unique_ptr<SimpleCache> CreateSimpleCacheWithStateRootAndValue(size_t value) {
+			CacheConfiguration config;
+			config.ShouldEnablePatriciaTrees = true;
+			return SetValue(std::make_unique<SimpleCache>(config), value);
 		}
 
 		template<typename TRawView>
@@ -137,6 +146,50 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region state root
+
+	TEST(TEST_CLASS, ViewDoesNotHaveStateRootWhenCacheDoesNotSupportStateRoots) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pView = adapter.createView();
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = pView->tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	TEST(TEST_CLASS, ViewHasStateRootWhenCacheSupportsStateRoots) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithStateRootAndValue(5));
+		auto pView = adapter.createView();
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = pView->tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_TRUE(hasStateRoot);
+		EXPECT_EQ(test::CalculateSimpleCacheStateRoot(5), stateRoot);
+	}
+
+	TEST(TEST_CLASS, DeltaNeverHasStateRoot) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithStateRootAndValue(5));
+		auto pDelta = adapter.createDelta();
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = pDelta->tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	// endregion
+
 	// region createDetachedDelta
 
 	TEST(TEST_CLASS, CanAccessDetachedDelta) {
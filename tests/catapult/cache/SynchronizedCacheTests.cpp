@@ -323,6 +323,110 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region generation
+
+	namespace {
+		class BasicSimpleCacheWithGeneration : public test::BasicSimpleCache {
+		public:
+			size_t generation() const {
+				return 17;
+			}
+		};
+	}
+
+	TEST(TEST_CLASS, GenerationIsCommitCountWhenCacheDoesNotTrackChanges) {
+		// Arrange:
+		test::SimpleCache cache;
+		for (auto i = 0u; i < 3; ++i) {
+			auto delta = cache.createDelta();
+			cache.commit();
+		}
+
+		// Act:
+		auto generation = cache.generation();
+
+		// Assert:
+		EXPECT_EQ(3u, generation);
+	}
+
+	TEST(TEST_CLASS, GenerationIsForwardedWhenCacheTracksChanges) {
+		// Arrange:
+		SynchronizedCache<BasicSimpleCacheWithGeneration> cache((BasicSimpleCacheWithGeneration()));
+		{
+			auto delta = cache.createDelta();
+			cache.commit();
+		}
+
+		// Act:
+		auto generation = cache.generation();
+
+		// Assert:
+		EXPECT_EQ(17u, generation);
+	}
+
+	// endregion
+
+	// region tryGetStateRoot
+
+	namespace {
+		class BasicSimpleCacheWithoutStateRoot : public test::BasicSimpleCache {
+		private:
+			// hide tryGetStateRoot so that it is not detected by SynchronizedCache
+			using test::BasicSimpleCache::tryGetStateRoot;
+		};
+
+		CacheConfiguration CreateStateRootCacheConfiguration() {
+			CacheConfiguration config;
+			config.ShouldEnablePatriciaTrees = true;
+			return config;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotGetStateRootWhenCacheDoesNotSupportStateRoots) {
+		// Arrange:
+		SynchronizedCache<BasicSimpleCacheWithoutStateRoot> cache((BasicSimpleCacheWithoutStateRoot()));
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = cache.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	TEST(TEST_CLASS, CannotGetStateRootWhenCacheStateRootIsDisabled) {
+		// Arrange:
+		test::SimpleCache cache;
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = cache.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	TEST(TEST_CLASS, CanGetStateRootWhenCacheStateRootIsEnabled) {
+		// Arrange:
+		test::SimpleCache cache(CreateStateRootCacheConfiguration());
+		{
+			auto delta = cache.createDelta();
+			delta->increment();
+			delta->increment();
+			cache.commit();
+		}
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = cache.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_TRUE(hasStateRoot);
+		EXPECT_EQ(test::CalculateSimpleCacheStateRoot(2), stateRoot);
+	}
+
+	// endregion
+
 	// region locking
 
 	TEST(TEST_CLASS, CanGetMultipleViewsOfDifferentTypes) {
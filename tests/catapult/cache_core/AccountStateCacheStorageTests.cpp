@@ -198,4 +198,32 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region Parse / AddParsed
+
+	TEST(TEST_CLASS, CanParseAndAddParsedValue) {
+		// Arrange: create a random account info with a public key
+		auto pOriginalAccountState = std::make_unique<state::AccountState>(test::GenerateRandomAddress(), Height(123));
+		test::RandomFillAccountData(0, *pOriginalAccountState, 3);
+		pOriginalAccountState->PublicKey = test::GenerateRandomData<Key_Size>();
+		pOriginalAccountState->PublicKeyHeight = Height(124);
+		auto pOriginalAccountInfo = state::ToAccountInfo(*pOriginalAccountState);
+
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto parsedAccountState = AccountStateCacheStorage::Parse(pOriginalAccountInfo);
+		AccountStateCacheStorage::AddParsed(*delta, std::move(parsedAccountState));
+		cache.commit();
+
+		// Assert: the cache contains the account state accessible by both address and public key
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		ASSERT_TRUE(view->contains(pOriginalAccountState->Address));
+		EXPECT_TRUE(view->contains(pOriginalAccountState->PublicKey));
+		test::AssertEqual(*pOriginalAccountState, view->get(pOriginalAccountState->Address));
+	}
+
+	// endregion
 }}
@@ -1090,4 +1090,337 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region highValueBalance / forEachHighValueAccount
+
+	namespace {
+		// balances of committed accounts [3 match]
+		std::vector<Amount> GetCommittedHighValueTestBalances() {
+			return { Amount(1'100'000), Amount(900'000), Amount(1'000'000), Amount(800'000), Amount(1'200'000) };
+		}
+
+		// makes changes to \a delta so that addresses[0], addresses[1] and the third returned address meet criteria
+		template<typename TDelta>
+		std::vector<Address> ChangeHighValueAccounts(const std::vector<Address>& addresses, TDelta& delta) {
+			// - add 2/3 accounts with sufficient balance (uncommitted) [5 match]
+			auto uncommittedAddresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+
+			// - modify two [5 match]
+			delta->get(addresses[1]).Balances.credit(Xem_Id, Amount(100'000));
+			delta->get(addresses[4]).Balances.debit(Xem_Id, Amount(200'001));
+
+			// - delete two [3 match]
+			delta->queueRemove(addresses[2], Height(1));
+			delta->queueRemove(uncommittedAddresses[0], Height(1));
+			delta->commitRemovals();
+			return uncommittedAddresses;
+		}
+	}
+
+	TEST(TEST_CLASS, HighValueBalanceReturnsZeroWhenNoAccountsMeetCriteria) {
+		// Arrange: add 0/3 with sufficient balance
+		auto balances = std::vector<Amount>{ Amount(999'999), Amount(1'000), Amount(1) };
+		RunHighValueAddressesTest(balances, [](const auto&, const auto& delta) {
+			// Act:
+			auto balance = delta->highValueBalance();
+
+			// Assert:
+			EXPECT_EQ(Amount(0), balance);
+		});
+	}
+
+	TEST(TEST_CLASS, HighValueBalanceReturnsBalanceOfOriginalAccountsMeetingCriteria) {
+		// Arrange: add 3/5 accounts with sufficient balance
+		RunHighValueAddressesTest(GetCommittedHighValueTestBalances(), [](const auto&, const auto& delta) {
+			// Act:
+			auto balance = delta->highValueBalance();
+
+			// Assert:
+			EXPECT_EQ(Amount(1'100'000 + 1'000'000 + 1'200'000), balance);
+		});
+	}
+
+	TEST(TEST_CLASS, HighValueBalanceReturnsBalanceOfAllAccountsMeetingCriteria) {
+		// Arrange: add 3/5 accounts with sufficient balance
+		RunHighValueAddressesTest(GetCommittedHighValueTestBalances(), [](const auto& addresses, auto& delta) {
+			ChangeHighValueAccounts(addresses, delta);
+
+			// Act:
+			auto balance = delta->highValueBalance();
+
+			// Assert:
+			EXPECT_EQ(Amount(1'100'000 + 1'000'000 + 1'000'000), balance);
+		});
+	}
+
+	TEST(TEST_CLASS, HighValueBalanceAndAddressesAreUpdatedByCommit) {
+		// Arrange: set min balance to 1M
+		auto options = Default_Cache_Options;
+		options.MinHighValueAccountBalance = Amount(1'000'000);
+		AccountStateCache cache(CacheConfiguration(), options);
+
+		std::vector<Address> addresses;
+		std::vector<Address> uncommittedAddresses;
+		{
+			auto delta = cache.createDelta();
+			addresses = AddAccountsWithBalances(*delta, GetCommittedHighValueTestBalances());
+			cache.commit();
+
+			// Act:
+			uncommittedAddresses = ChangeHighValueAccounts(addresses, delta);
+			cache.commit();
+		}
+
+		// Assert:
+		auto delta = cache.createDelta();
+		EXPECT_EQ(Amount(1'100'000 + 1'000'000 + 1'000'000), delta->highValueBalance());
+		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[1], uncommittedAddresses[2] }), delta->highValueAddresses());
+		EXPECT_EQ(3u, cache.createView()->highValueAddressesSize());
+	}
+
+	TEST(TEST_CLASS, ForEachHighValueAccountVisitsAllAccountsMeetingCriteriaOnce) {
+		// Arrange: add 3/5 accounts with sufficient balance
+		RunHighValueAddressesTest(GetCommittedHighValueTestBalances(), [](const auto& addresses, auto& delta) {
+			auto uncommittedAddresses = ChangeHighValueAccounts(addresses, delta);
+
+			// Act:
+			std::vector<Address> visitedAddresses;
+			delta->forEachHighValueAccount([&visitedAddresses](const auto& accountState) {
+				visitedAddresses.push_back(accountState.Address);
+			});
+
+			// Assert:
+			EXPECT_EQ(3u, visitedAddresses.size());
+			EXPECT_EQ(
+					model::AddressSet({ addresses[0], addresses[1], uncommittedAddresses[2] }),
+					model::AddressSet(visitedAddresses.cbegin(), visitedAddresses.cend()));
+		});
+	}
+
+	TEST(TEST_CLASS, ForEachHighValueAccountAllowsAccountsToBeModified) {
+		// Arrange: add 3/5 accounts with sufficient balance
+		RunHighValueAddressesTest(GetCommittedHighValueTestBalances(), [](const auto& addresses, auto& delta) {
+			// Act:
+			delta->forEachHighValueAccount([](auto& accountState) {
+				accountState.ImportanceInfo.set(Importance(123), model::ImportanceHeight(1));
+			});
+
+			// Assert: only high value accounts were modified
+			auto expectedImportances = std::vector<Importance>{ Importance(123), Importance(), Importance(123), Importance(), Importance(123) };
+			for (auto i = 0u; i < addresses.size(); ++i)
+				EXPECT_EQ(expectedImportances[i], delta->get(addresses[i]).ImportanceInfo.current()) << "account at " << i;
+		});
+	}
+
+	// endregion
+
+	// region state root
+
+	namespace {
+		CacheConfiguration CreatePatriciaTreeCacheConfiguration() {
+			CacheConfiguration config;
+			config.ShouldEnablePatriciaTrees = true;
+			return config;
+		}
+
+		Hash256 GetStateRoot(const AccountStateCache& cache) {
+			Hash256 stateRoot;
+			EXPECT_TRUE(cache.tryGetStateRoot(stateRoot));
+			return stateRoot;
+		}
+
+		std::pair<Hash256, Hash256> ToKeyValuePair(const state::AccountState& accountState) {
+			auto pAccountInfo = state::ToAccountInfo(accountState);
+			Hash256 valueHash;
+			crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(pAccountInfo.get()), pAccountInfo->Size }, valueHash);
+			return std::make_pair(CalculatePatriciaTreeKey(accountState.Address), valueHash);
+		}
+
+		std::vector<Address> AddAccounts(AccountStateCache& cache, size_t numAccounts) {
+			std::vector<Address> addresses;
+			auto delta = cache.createDelta();
+			for (auto i = 0u; i < numAccounts; ++i) {
+				addresses.push_back(test::GenerateRandomData<Address_Decoded_Size>());
+				delta->addAccount(addresses.back(), Height(1)).Balances.credit(Xem_Id, Amount(1000 + i));
+			}
+
+			cache.commit();
+			return addresses;
+		}
+	}
+
+	TEST(TEST_CLASS, StateRootIsUnavailableWhenPatriciaTreesAreDisabled) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AddAccounts(cache, 3);
+
+		// Act:
+		Hash256 stateRoot;
+		auto hasStateRoot = cache.tryGetStateRoot(stateRoot);
+
+		// Assert:
+		EXPECT_FALSE(hasStateRoot);
+	}
+
+	TEST(TEST_CLASS, StateRootIsInitiallyZeroWhenPatriciaTreesAreEnabled) {
+		// Arrange:
+		AccountStateCache cache(CreatePatriciaTreeCacheConfiguration(), Default_Cache_Options);
+
+		// Act:
+		auto stateRoot = GetStateRoot(cache);
+
+		// Assert:
+		EXPECT_EQ(Hash256(), stateRoot);
+	}
+
+	TEST(TEST_CLASS, CommitUpdatesStateRootWithSerializedAccountStates) {
+		// Arrange:
+		AccountStateCache cache(CreatePatriciaTreeCacheConfiguration(), Default_Cache_Options);
+
+		// Act:
+		auto addresses = AddAccounts(cache, 3);
+		auto stateRoot = GetStateRoot(cache);
+
+		// Assert:
+		CachePatriciaTree expectedTree;
+		{
+			auto view = cache.createView();
+			std::vector<std::pair<Hash256, Hash256>> keyValuePairs;
+			for (const auto& address : addresses)
+				keyValuePairs.push_back(ToKeyValuePair(view->get(address)));
+
+			expectedTree.update(keyValuePairs, {});
+		}
+
+		EXPECT_EQ(expectedTree.root(), stateRoot);
+	}
+
+	TEST(TEST_CLASS, UncommittedChangesDoNotUpdateStateRoot) {
+		// Arrange:
+		AccountStateCache cache(CreatePatriciaTreeCacheConfiguration(), Default_Cache_Options);
+		auto addresses = AddAccounts(cache, 3);
+		auto stateRoot = GetStateRoot(cache);
+
+		// Act:
+		auto delta = cache.createDelta();
+		delta->get(addresses[1]).Balances.credit(Xem_Id, Amount(1));
+		delta->addAccount(test::GenerateRandomData<Address_Decoded_Size>(), Height(1));
+
+		// Assert:
+		EXPECT_EQ(stateRoot, GetStateRoot(cache));
+	}
+
+	TEST(TEST_CLASS, StateRootIsIndependentOfCommitGrouping) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(4);
+		AccountStateCache cache1(CreatePatriciaTreeCacheConfiguration(), Default_Cache_Options);
+		AccountStateCache cache2(CreatePatriciaTreeCacheConfiguration(), Default_Cache_Options);
+
+		// Act: add all accounts to cache1 in a single commit and to cache2 in two commits (in reverse order)
+		{
+			auto delta = cache1.createDelta();
+			for (const auto& address : addresses)
+				delta->addAccount(address, Height(1));
+
+			cache1.commit();
+		}
+
+		for (auto i = 0u; i < 2; ++i) {
+			auto delta = cache2.createDelta();
+			delta->addAccount(addresses[3 - 2 * i], Height(1));
+			delta->addAccount(addresses[2 - 2 * i], Height(1));
+			cache2.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(GetStateRoot(cache1), GetStateRoot(cache2));
+	}
+
+	TEST(TEST_CLASS, ModificationChangesStateRootAndReversalRestoresIt) {
+		// Arrange:
+		AccountStateCache cache(CreatePatriciaTreeCacheConfiguration(), Default_Cache_Options);
+		auto addresses = AddAccounts(cache, 3);
+		auto stateRoot = GetStateRoot(cache);
+
+		// Act: modify an account
+		{
+			auto delta = cache.createDelta();
+			delta->get(addresses[1]).Balances.credit(Xem_Id, Amount(1));
+			cache.commit();
+		}
+
+		auto modifiedStateRoot = GetStateRoot(cache);
+
+		// - undo the modification
+		{
+			auto delta = cache.createDelta();
+			delta->get(addresses[1]).Balances.debit(Xem_Id, Amount(1));
+			cache.commit();
+		}
+
+		// Assert:
+		EXPECT_NE(stateRoot, modifiedStateRoot);
+		EXPECT_EQ(stateRoot, GetStateRoot(cache));
+	}
+
+	TEST(TEST_CLASS, RemovalRestoresPreviousStateRoot) {
+		// Arrange:
+		AccountStateCache cache(CreatePatriciaTreeCacheConfiguration(), Default_Cache_Options);
+		AddAccounts(cache, 3);
+		auto stateRoot = GetStateRoot(cache);
+		auto addresses = AddAccounts(cache, 2);
+
+		// Sanity:
+		EXPECT_NE(stateRoot, GetStateRoot(cache));
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			for (const auto& address : addresses)
+				delta->queueRemove(address, Height(1));
+
+			delta->commitRemovals();
+			cache.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(stateRoot, GetStateRoot(cache));
+	}
+
+	// endregion
+
+	// region commit statistics
+
+	TEST(TEST_CLASS, DeltaExposesNumberOfChangedAccounts) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto addresses = AddAccounts(cache, 3);
+
+		// Act: add one account, modify one account and remove one account
+		auto delta = cache.createDelta();
+		delta->addAccount(test::GenerateRandomData<Address_Decoded_Size>(), Height(1));
+		delta->get(addresses[0]).Balances.credit(Xem_Id, Amount(1));
+		delta->queueRemove(addresses[1], Height(1));
+		delta->commitRemovals();
+
+		// Assert:
+		EXPECT_EQ(3u, delta->numChangedAccounts());
+	}
+
+	TEST(TEST_CLASS, CommitUpdatesCommitStatistics) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto statistics = GetAccountStateCacheCommitStatistics();
+
+		// Act:
+		AddAccounts(cache, 3);
+
+		// Assert:
+		auto newStatistics = GetAccountStateCacheCommitStatistics();
+		EXPECT_EQ(statistics.NumCommits + 1, newStatistics.NumCommits);
+		EXPECT_EQ(statistics.NumAccounts + 3, newStatistics.NumAccounts);
+		EXPECT_LE(statistics.NumMicros, newStatistics.NumMicros);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,210 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_core/HighValueAccounts.h"
+#include "catapult/constants.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS HighValueAccountsTests
+
+	namespace {
+		using DeltasSet = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::MemorySetType;
+
+		constexpr Amount Min_Balance(1'000'000);
+
+		struct DeltasSets {
+			DeltasSet Added;
+			DeltasSet Removed;
+			DeltasSet Copied;
+
+			HighValueAccounts::DeltaElements deltas() const {
+				return HighValueAccounts::DeltaElements(Added, Removed, Copied);
+			}
+		};
+
+		std::shared_ptr<state::AccountState> CreateAccountState(const Address& address, Amount balance) {
+			auto pAccountState = std::make_shared<state::AccountState>(address, Height(1));
+			pAccountState->Balances.credit(Xem_Id, balance);
+			return pAccountState;
+		}
+
+		void AddAll(DeltasSet& set, const std::vector<Address>& addresses, const std::vector<Amount>& balances) {
+			for (auto i = 0u; i < addresses.size(); ++i)
+				set.emplace(addresses[i], CreateAccountState(addresses[i], balances[i]));
+		}
+
+		// adds 3/5 high value accounts with total balance 3.3M
+		std::vector<Address> SeedHighValueAccounts(HighValueAccounts& accounts) {
+			auto addresses = test::GenerateRandomDataVector<Address>(5);
+			DeltasSets sets;
+			AddAll(sets.Added, addresses, { Amount(1'100'000), Amount(900'000), Amount(1'000'000), Amount(800'000), Amount(1'200'000) });
+			accounts.update(sets.deltas(), Min_Balance);
+			return addresses;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyHighValueAccounts) {
+		// Act:
+		HighValueAccounts accounts;
+
+		// Assert:
+		EXPECT_EQ(0u, accounts.size());
+		EXPECT_EQ(Amount(0), accounts.balance());
+		EXPECT_TRUE(accounts.balances().empty());
+	}
+
+	// endregion
+
+	// region calculateBalance
+
+	TEST(TEST_CLASS, CalculateBalanceReturnsCommittedBalanceWhenThereAreNoChanges) {
+		// Arrange:
+		HighValueAccounts accounts;
+		SeedHighValueAccounts(accounts);
+
+		// Act:
+		auto balance = accounts.calculateBalance(DeltasSets().deltas(), Min_Balance);
+
+		// Assert:
+		EXPECT_EQ(Amount(3'300'000), balance);
+	}
+
+	TEST(TEST_CLASS, CalculateBalanceIncludesAddedAccountsMeetingCriteria) {
+		// Arrange:
+		HighValueAccounts accounts;
+		SeedHighValueAccounts(accounts);
+
+		DeltasSets sets;
+		AddAll(sets.Added, test::GenerateRandomDataVector<Address>(3), { Amount(1'000'000), Amount(999'999), Amount(2'000'000) });
+
+		// Act:
+		auto balance = accounts.calculateBalance(sets.deltas(), Min_Balance);
+
+		// Assert:
+		EXPECT_EQ(Amount(3'300'000 + 3'000'000), balance);
+	}
+
+	TEST(TEST_CLASS, CalculateBalanceReplacesContributionsOfCopiedAccounts) {
+		// Arrange:
+		HighValueAccounts accounts;
+		auto addresses = SeedHighValueAccounts(accounts);
+
+		// - 1.1M => 1.5M (+400K), 900K => 1M (+1M), 1M => 999'999 (-1M), 800K => 500K (+0)
+		DeltasSets sets;
+		AddAll(sets.Copied, { addresses[0], addresses[1], addresses[2], addresses[3] }, {
+			Amount(1'500'000), Amount(1'000'000), Amount(999'999), Amount(500'000)
+		});
+
+		// Act:
+		auto balance = accounts.calculateBalance(sets.deltas(), Min_Balance);
+
+		// Assert:
+		EXPECT_EQ(Amount(3'300'000 + 400'000), balance);
+	}
+
+	TEST(TEST_CLASS, CalculateBalanceExcludesRemovedAccounts) {
+		// Arrange:
+		HighValueAccounts accounts;
+		auto addresses = SeedHighValueAccounts(accounts);
+
+		// - removed balances are ignored in favor of committed balances
+		DeltasSets sets;
+		AddAll(sets.Removed, { addresses[0], addresses[1] }, { Amount(5'000'000), Amount(5'000'000) });
+
+		// Act:
+		auto balance = accounts.calculateBalance(sets.deltas(), Min_Balance);
+
+		// Assert:
+		EXPECT_EQ(Amount(3'300'000 - 1'100'000), balance);
+	}
+
+	TEST(TEST_CLASS, CalculateBalanceDoesNotChangeAccounts) {
+		// Arrange:
+		HighValueAccounts accounts;
+		auto addresses = SeedHighValueAccounts(accounts);
+
+		DeltasSets sets;
+		AddAll(sets.Removed, { addresses[0] }, { Amount(1'100'000) });
+
+		// Act:
+		accounts.calculateBalance(sets.deltas(), Min_Balance);
+
+		// Assert:
+		EXPECT_EQ(3u, accounts.size());
+		EXPECT_EQ(Amount(3'300'000), accounts.balance());
+	}
+
+	// endregion
+
+	// region update
+
+	TEST(TEST_CLASS, UpdateAddsAccountsMeetingCriteria) {
+		// Act:
+		HighValueAccounts accounts;
+		auto addresses = SeedHighValueAccounts(accounts);
+
+		// Assert:
+		EXPECT_EQ(3u, accounts.size());
+		EXPECT_EQ(Amount(3'300'000), accounts.balance());
+		EXPECT_EQ(
+				HighValueAccounts::BalanceMap({
+					{ addresses[0], Amount(1'100'000) },
+					{ addresses[2], Amount(1'000'000) },
+					{ addresses[4], Amount(1'200'000) }
+				}),
+				accounts.balances());
+
+		EXPECT_TRUE(accounts.contains(addresses[0]));
+		EXPECT_FALSE(accounts.contains(addresses[1]));
+	}
+
+	TEST(TEST_CLASS, UpdateAppliesAllChanges) {
+		// Arrange:
+		HighValueAccounts accounts;
+		auto addresses = SeedHighValueAccounts(accounts);
+		auto newAddresses = test::GenerateRandomDataVector<Address>(2);
+
+		DeltasSets sets;
+		AddAll(sets.Added, newAddresses, { Amount(2'000'000), Amount(10) });
+		AddAll(sets.Copied, { addresses[0], addresses[1], addresses[2] }, { Amount(1'500'000), Amount(1'000'000), Amount(999'999) });
+		AddAll(sets.Removed, { addresses[4] }, { Amount(1'200'000) });
+
+		// Act:
+		accounts.update(sets.deltas(), Min_Balance);
+
+		// Assert:
+		EXPECT_EQ(3u, accounts.size());
+		EXPECT_EQ(Amount(1'500'000 + 1'000'000 + 2'000'000), accounts.balance());
+		EXPECT_EQ(
+				HighValueAccounts::BalanceMap({
+					{ addresses[0], Amount(1'500'000) },
+					{ addresses[1], Amount(1'000'000) },
+					{ newAddresses[0], Amount(2'000'000) }
+				}),
+				accounts.balances());
+	}
+
+	// endregion
+}}
@@ -27,6 +27,18 @@ namespace catapult { namespace cache {
 
 #define TEST_CLASS RdbColumnContainerTests
 
+	TEST(TEST_CLASS, CanAccessDatabase) {
+		// Arrange:
+		test::RdbTestContext context({});
+		RdbColumnContainer container(context.database(), 0);
+
+		// Act:
+		auto& database = container.database();
+
+		// Assert:
+		EXPECT_EQ(&context.database(), &database);
+	}
+
 	TEST(TEST_CLASS, SizeIsInitiallyZero) {
 		// Arrange:
 		test::RdbTestContext context({});
@@ -329,4 +329,180 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region batch
+
+	namespace {
+		void AssertKeyNotFound(RocksDatabase& database, size_t columnId, const std::string& key) {
+			RdbDataIterator iter;
+			database.get(columnId, key, iter);
+			EXPECT_EQ(RdbDataIterator::End(), iter) << "column " << columnId << " key " << key;
+		}
+	}
+
+	TEST(TEST_CLASS, BatchIsInitiallyInactive) {
+		// Arrange:
+		test::RdbTestContext context({});
+
+		// Act + Assert:
+		EXPECT_FALSE(context.database().isBatchActive());
+	}
+
+	TEST(TEST_CLASS, BatchedWritesAreNotAppliedBeforeFlush) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+		auto& database = context.database();
+		database.put(0, "world", "awesome");
+
+		// Act:
+		database.beginBatch();
+		database.put(0, "hello", "amazing");
+		database.put(1, "hello", "incredible");
+		database.del(0, "world");
+
+		// Assert:
+		EXPECT_TRUE(database.isBatchActive());
+		AssertKeyNotFound(database, 0, "hello");
+		AssertKeyNotFound(database, 1, "hello");
+		AssertKeyValueColumn0(database, "world", "awesome");
+	}
+
+	TEST(TEST_CLASS, FlushAppliesAllBatchedWritesAcrossColumns) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+		auto& database = context.database();
+		database.put(0, "world", "awesome");
+
+		database.beginBatch();
+		database.put(0, "hello", "amazing");
+		database.put(1, "hello", "incredible");
+		database.del(0, "world");
+
+		// Act:
+		database.flushBatch();
+
+		// Assert:
+		EXPECT_FALSE(database.isBatchActive());
+		auto iters = GetHelloKeyFromColumns(database, 2);
+		test::AssertIteratorValue("amazing", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+		AssertKeyNotFound(database, 0, "world");
+	}
+
+	TEST(TEST_CLASS, NestedBatchIsOnlyAppliedWhenOutermostBatchIsFlushed) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+
+		database.beginBatch();
+		database.put(0, "hello", "amazing");
+		database.beginBatch();
+		database.put(0, "world", "awesome");
+
+		// Act: flush inner batch
+		database.flushBatch();
+
+		// Assert: nothing was applied
+		EXPECT_TRUE(database.isBatchActive());
+		AssertKeyNotFound(database, 0, "hello");
+		AssertKeyNotFound(database, 0, "world");
+
+		// Act: flush outer batch
+		database.flushBatch();
+
+		// Assert: everything was applied
+		EXPECT_FALSE(database.isBatchActive());
+		AssertKeyValueColumn0(database, "hello", "amazing");
+		AssertKeyValueColumn0(database, "world", "awesome");
+	}
+
+	TEST(TEST_CLASS, CannotFlushWhenNoBatchIsActive) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+
+		// Act + Assert:
+		EXPECT_THROW(database.flushBatch(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, DiscardDropsAllBatchedWrites) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+
+		database.beginBatch();
+		database.beginBatch();
+		database.put(0, "hello", "amazing");
+
+		// Act:
+		database.discardBatch();
+
+		// Assert: batch is no longer active and subsequent writes are applied immediately
+		EXPECT_FALSE(database.isBatchActive());
+		AssertKeyNotFound(database, 0, "hello");
+
+		database.put(0, "world", "awesome");
+		AssertKeyValueColumn0(database, "world", "awesome");
+	}
+
+	TEST(TEST_CLASS, CanWriteWithWriteAheadLogDisabled) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		database.setWriteAheadLogEnabled(false);
+
+		// Act:
+		database.put(0, "hello", "amazing");
+		database.beginBatch();
+		database.put(0, "world", "awesome");
+		database.flushBatch();
+
+		// Assert:
+		AssertKeyValueColumn0(database, "hello", "amazing");
+		AssertKeyValueColumn0(database, "world", "awesome");
+	}
+
+	// endregion
+
+	// region RdbWriteBatchGuard
+
+	TEST(TEST_CLASS, WriteBatchGuardBatchesWritesUntilCommit) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+
+		// Act:
+		{
+			RdbWriteBatchGuard guard(database);
+			database.put(0, "hello", "amazing");
+
+			// Sanity:
+			EXPECT_TRUE(database.isBatchActive());
+			AssertKeyNotFound(database, 0, "hello");
+
+			guard.commit();
+		}
+
+		// Assert:
+		EXPECT_FALSE(database.isBatchActive());
+		AssertKeyValueColumn0(database, "hello", "amazing");
+	}
+
+	TEST(TEST_CLASS, WriteBatchGuardDiscardsWritesWhenNotCommitted) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+
+		// Act:
+		{
+			RdbWriteBatchGuard guard(database);
+			database.put(0, "hello", "amazing");
+		}
+
+		// Assert:
+		EXPECT_FALSE(database.isBatchActive());
+		AssertKeyNotFound(database, 0, "hello");
+	}
+
+	// endregion
 }}
@@ -19,9 +19,14 @@
 **/
 
 #include "catapult/chain/BatchEntityProcessor.h"
+#include "catapult/model/Address.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
+#include <map>
+#include <mutex>
 
 using namespace catapult::validators;
 
@@ -30,9 +35,36 @@ namespace catapult { namespace chain {
 #define TEST_CLASS BatchEntityProcessorTests
 
 	namespace {
+		constexpr uint32_t Num_Pool_Threads = 4;
+
+		struct SequentialTraits {
+			static constexpr size_t Num_Grouping_Publishes_Per_Entity = 0;
+
+			static BatchEntityProcessor CreateProcessor(
+					const ExecutionConfiguration& config,
+					const std::shared_ptr<thread::IoServiceThreadPool>&) {
+				return CreateBatchEntityProcessor(config);
+			}
+		};
+
+		struct ParallelTraits {
+			// each entity is published once in order to extract its addresses before it is executed
+			static constexpr size_t Num_Grouping_Publishes_Per_Entity = 1;
+
+			static BatchEntityProcessor CreateProcessor(
+					const ExecutionConfiguration& config,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
+				return CreateParallelBatchEntityProcessor(config, pPool);
+			}
+		};
+
+		template<typename TTraits>
 		class ProcessorTestContext {
 		public:
-			ProcessorTestContext() : m_processor(CreateBatchEntityProcessor(m_executionConfig.Config))
+			ProcessorTestContext()
+					: m_pPool(test::CreateStartedIoServiceThreadPool(Num_Pool_Threads))
+					, m_processor(TTraits::CreateProcessor(m_executionConfig.Config, m_pPool))
+					, m_numGroupingPublisherCalls(0)
 			{}
 
 		public:
@@ -48,6 +80,7 @@ namespace catapult { namespace chain {
 			ValidationResult process(Height height, Timestamp timestamp, const model::WeakEntityInfos& entityInfos) {
 				auto cache = test::CreateCatapultCacheWithMarkerAccount();
 				auto delta = cache.createDelta();
+				m_numGroupingPublisherCalls += entityInfos.size() * TTraits::Num_Grouping_Publishes_Per_Entity;
 				return m_processor(height, timestamp, entityInfos, observers::ObserverState(delta, m_state));
 			}
 
@@ -58,7 +91,9 @@ namespace catapult { namespace chain {
 					size_t numExpectedValidatorCalls,
 					size_t numExpectedObserverCalls) const {
 				// Assert:
-				EXPECT_EQ(numExpectedPublisherCalls, m_executionConfig.pNotificationPublisher->params().size());
+				EXPECT_EQ(
+						m_numGroupingPublisherCalls + numExpectedPublisherCalls,
+						m_executionConfig.pNotificationPublisher->params().size());
 				EXPECT_EQ(numExpectedValidatorCalls, statefulValidatorParams().size());
 				EXPECT_EQ(numExpectedObserverCalls, m_executionConfig.pObserver->params().size());
 			}
@@ -110,10 +145,11 @@ namespace catapult { namespace chain {
 			void assertPublisherEntities(const model::WeakEntityInfos& entityInfos) const {
 				CATAPULT_LOG(debug) << "checking entities passed to publisher";
 				const auto& publisherParams = m_executionConfig.pNotificationPublisher->params();
-				for (auto i = 0u; i < publisherParams.size(); ++i) {
-					// - publisher is called for each entity (1 entity : 1 publisher call)
-					EXPECT_EQ(entityInfos[i], publisherParams[i].EntityInfo) << "publisher at " << i;
-					EXPECT_EQ(entityInfos[i].hash(), publisherParams[i].HashCopy) << "publisher at " << i;
+				for (auto i = 0u; i < publisherParams.size() - m_numGroupingPublisherCalls; ++i) {
+					// - publisher is called for each entity (1 entity : 1 publisher call) after all grouping calls
+					const auto& params = publisherParams[m_numGroupingPublisherCalls + i];
+					EXPECT_EQ(entityInfos[i], params.EntityInfo) << "publisher at " << i;
+					EXPECT_EQ(entityInfos[i].hash(), params.HashCopy) << "publisher at " << i;
 				}
 			}
 
@@ -149,7 +185,9 @@ namespace catapult { namespace chain {
 		private:
 			test::MockExecutionConfiguration m_executionConfig;
 			state::CatapultState m_state;
+			std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
 			BatchEntityProcessor m_processor;
+			size_t m_numGroupingPublisherCalls;
 		};
 
 		model::WeakEntityInfos ExtractEntityInfosFromBlock(const model::Block& block) {
@@ -169,9 +207,17 @@ namespace catapult { namespace chain {
 		}
 	}
 
-	TEST(TEST_CLASS, CanProcessZeroEntities) {
+#define TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sequential) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SequentialTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Parallel) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region basic processing
+
+	TRAITS_BASED_TEST(CanProcessZeroEntities) {
 		// Arrange:
-		ProcessorTestContext context;
+		ProcessorTestContext<TTraits> context;
 		model::WeakEntityInfos entityInfos;
 
 		// Act:
@@ -182,9 +228,9 @@ namespace catapult { namespace chain {
 		context.assertCounters(0, 0, 0);
 	}
 
-	TEST(TEST_CLASS, CanProcessSingleEntity) {
+	TRAITS_BASED_TEST(CanProcessSingleEntity) {
 		// Arrange:
-		ProcessorTestContext context;
+		ProcessorTestContext<TTraits> context;
 		auto pBlock = test::GenerateBlockWithTransactions(0);
 		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
 
@@ -198,9 +244,9 @@ namespace catapult { namespace chain {
 		context.assertEntityInfos(entityInfos);
 	}
 
-	TEST(TEST_CLASS, CanProcessMultipleEntities) {
+	TRAITS_BASED_TEST(CanProcessMultipleEntities) {
 		// Arrange:
-		ProcessorTestContext context;
+		ProcessorTestContext<TTraits> context;
 		auto pBlock = test::GenerateBlockWithTransactions(3);
 		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
 
@@ -221,9 +267,9 @@ namespace catapult { namespace chain {
 		}
 	}
 
-	TEST(TEST_CLASS, CanReuseProcessor) {
+	TRAITS_BASED_TEST(CanReuseProcessor) {
 		// Arrange:
-		ProcessorTestContext context;
+		ProcessorTestContext<TTraits> context;
 		auto pBlock1 = test::GenerateBlockWithTransactions(0);
 		auto pBlock2 = test::GenerateBlockWithTransactions(0);
 		auto entityInfos1 = ExtractEntityInfosFromBlock(*pBlock1);
@@ -243,15 +289,29 @@ namespace catapult { namespace chain {
 		AssertValidatorContext(capturedParams[i++].Context, Height(250), Timestamp(777));
 	}
 
+	// endregion
+
+	// region short circuiting
+
 #define SHORT_CIRCUIT_TRAITS_BASED_TEST(TEST_NAME) \
-	template<ValidationResult TResult> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
-	TEST(TEST_CLASS, TEST_NAME##_Neutral) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ValidationResult::Neutral>(); } \
-	TEST(TEST_CLASS, TEST_NAME##_Failure) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ValidationResult::Failure>(); } \
-	template<ValidationResult TResult> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+	template<typename TTraits, ValidationResult TResult> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sequential_Neutral) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SequentialTraits, ValidationResult::Neutral>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_Sequential_Failure) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SequentialTraits, ValidationResult::Failure>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_Parallel_Neutral) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelTraits, ValidationResult::Neutral>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_Parallel_Failure) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelTraits, ValidationResult::Failure>(); \
+	} \
+	template<typename TTraits, ValidationResult TResult> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	SHORT_CIRCUIT_TRAITS_BASED_TEST(ExecuteShortCircuitsOnSingleEntityStatefulValidation) {
 		// Arrange:
-		ProcessorTestContext context;
+		ProcessorTestContext<TTraits> context;
 		context.setValidationResult(TResult, 2);
 		auto pBlock = test::GenerateBlockWithTransactions(3);
 		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
@@ -267,4 +327,217 @@ namespace catapult { namespace chain {
 		context.assertContexts(Height(248), Timestamp(725));
 		context.assertEntityInfos(entityInfos);
 	}
+
+	// endregion
+
+	// region parallel execution
+
+	namespace {
+		using AddressToEntityIndexesMap = std::map<Address, std::vector<size_t>>;
+
+		// publishes (address scoped) notifications registering and crediting a single account for each entity
+		class AccountCreditNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit AccountCreditNotificationPublisher(const std::vector<Address>& addresses) : m_addresses(addresses)
+			{}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+				// the fake entity hash stores the entity index, which is used as the credited amount
+				auto entityIndex = entityInfo.hash()[0];
+				const auto& address = m_addresses[entityIndex];
+				subscriber.notify(model::AccountAddressNotification(address));
+				subscriber.notify(model::BalanceTransferNotification(Key(), address, MosaicId(), Amount(entityIndex)));
+			}
+
+		private:
+			std::vector<Address> m_addresses;
+		};
+
+		class FailingAddressValidator : public validators::stateful::AggregateNotificationValidator {
+		public:
+			FailingAddressValidator() : m_name("FailingAddressValidator")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			ValidationResult validate(const model::Notification& notification, const ValidatorContext&) const override {
+				if (model::Core_Register_Account_Address_Notification != notification.Type)
+					return ValidationResult::Success;
+
+				const auto& address = static_cast<const model::AccountAddressNotification&>(notification).Address;
+				auto iter = m_addressResults.find(address);
+				return m_addressResults.cend() == iter ? ValidationResult::Success : iter->second;
+			}
+
+		public:
+			void setResult(const Address& address, ValidationResult result) {
+				m_addressResults.emplace(address, result);
+			}
+
+		private:
+			std::string m_name;
+			std::map<Address, ValidationResult> m_addressResults;
+		};
+
+		class RecordingCreditObserver : public observers::AggregateNotificationObserver {
+		public:
+			RecordingCreditObserver() : m_name("RecordingCreditObserver")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			void notify(const model::Notification& notification, const observers::ObserverContext&) const override {
+				if (model::Core_Balance_Transfer_Notification != notification.Type)
+					return;
+
+				const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_addressToEntityIndexesMap[transferNotification.Recipient].push_back(transferNotification.Amount.unwrap());
+			}
+
+		public:
+			AddressToEntityIndexesMap addressToEntityIndexesMap() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_addressToEntityIndexesMap;
+			}
+
+		private:
+			std::string m_name;
+			mutable std::mutex m_mutex;
+			mutable AddressToEntityIndexesMap m_addressToEntityIndexesMap;
+		};
+
+		class AddressScopedProcessorTestContext {
+		public:
+			explicit AddressScopedProcessorTestContext(const std::vector<Address>& addresses)
+					: m_pPool(test::CreateStartedIoServiceThreadPool(Num_Pool_Threads))
+					, m_pValidator(std::make_shared<FailingAddressValidator>())
+					, m_pObserver(std::make_shared<RecordingCreditObserver>())
+					, m_entities(addresses.size()) {
+				m_config.Network.Identifier = test::Mock_Execution_Configuration_Network_Identifier;
+				m_config.pObserver = m_pObserver;
+				m_config.pValidator = m_pValidator;
+				m_config.pNotificationPublisher = std::make_shared<AccountCreditNotificationPublisher>(addresses);
+
+				m_entityHashes.reserve(addresses.size());
+				for (auto i = 0u; i < addresses.size(); ++i) {
+					m_entityHashes.push_back(Hash256{ { static_cast<uint8_t>(i) } });
+					m_entityInfos.emplace_back(m_entities[i], m_entityHashes.back());
+				}
+			}
+
+		public:
+			void setResult(const Address& address, ValidationResult result) {
+				m_pValidator->setResult(address, result);
+			}
+
+			AddressToEntityIndexesMap addressToEntityIndexesMap() const {
+				return m_pObserver->addressToEntityIndexesMap();
+			}
+
+		public:
+			template<typename TTraits>
+			ValidationResult process() {
+				auto processor = TTraits::CreateProcessor(m_config, m_pPool);
+				auto cache = test::CreateCatapultCacheWithMarkerAccount();
+				auto delta = cache.createDelta();
+				return processor(Height(246), Timestamp(721), m_entityInfos, observers::ObserverState(delta, m_state));
+			}
+
+		private:
+			std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+			std::shared_ptr<FailingAddressValidator> m_pValidator;
+			std::shared_ptr<RecordingCreditObserver> m_pObserver;
+			ExecutionConfiguration m_config;
+			state::CatapultState m_state;
+
+			std::vector<model::VerifiableEntity> m_entities;
+			std::vector<Hash256> m_entityHashes;
+			model::WeakEntityInfos m_entityInfos;
+		};
+
+		std::vector<Address> GenerateAddresses(size_t count) {
+			std::vector<Address> addresses;
+			for (auto i = 0u; i < count; ++i)
+				addresses.push_back(test::GenerateRandomData<Address_Decoded_Size>());
+
+			return addresses;
+		}
+	}
+
+	TRAITS_BASED_TEST(CanProcessEntitiesTouchingDisjointAccounts) {
+		// Arrange:
+		auto addresses = GenerateAddresses(10);
+		AddressScopedProcessorTestContext context(addresses);
+
+		// Act:
+		auto result = context.process<TTraits>();
+
+		// Assert: all entities were observed
+		EXPECT_EQ(ValidationResult::Success, result);
+
+		AddressToEntityIndexesMap expectedAddressToEntityIndexesMap;
+		for (auto i = 0u; i < addresses.size(); ++i)
+			expectedAddressToEntityIndexesMap.emplace(addresses[i], std::vector<size_t>{ i });
+
+		EXPECT_EQ(expectedAddressToEntityIndexesMap, context.addressToEntityIndexesMap());
+	}
+
+	TRAITS_BASED_TEST(CanProcessEntitiesTouchingSameAccountsInEntityOrder) {
+		// Arrange: entities 0, 2, 3, 6 share an account, entities 4, 5 share an account
+		auto uniqueAddresses = GenerateAddresses(4);
+		const auto& a = uniqueAddresses;
+		AddressScopedProcessorTestContext context({ a[0], a[1], a[0], a[0], a[2], a[2], a[0], a[3] });
+
+		// Act:
+		auto result = context.process<TTraits>();
+
+		// Assert: conflicting entities were observed in entity order
+		EXPECT_EQ(ValidationResult::Success, result);
+
+		AddressToEntityIndexesMap expectedAddressToEntityIndexesMap{
+			{ a[0], { 0, 2, 3, 6 } },
+			{ a[1], { 1 } },
+			{ a[2], { 4, 5 } },
+			{ a[3], { 7 } }
+		};
+		EXPECT_EQ(expectedAddressToEntityIndexesMap, context.addressToEntityIndexesMap());
+	}
+
+	TRAITS_BASED_TEST(ProcessingReturnsFirstFailureInEntityOrder) {
+		// Arrange: fail entities 3 (neutral) and 1 (failure)
+		auto addresses = GenerateAddresses(6);
+		AddressScopedProcessorTestContext context(addresses);
+		context.setResult(addresses[3], ValidationResult::Neutral);
+		context.setResult(addresses[1], ValidationResult::Failure);
+
+		// Act:
+		auto result = context.process<TTraits>();
+
+		// Assert: the failure of the earliest failing entity is returned
+		EXPECT_EQ(ValidationResult::Failure, result);
+
+		// - entity 0 is always observed but entity 1 is never observed
+		auto addressToEntityIndexesMap = context.addressToEntityIndexesMap();
+		EXPECT_EQ(1u, addressToEntityIndexesMap.count(addresses[0]));
+		EXPECT_EQ(0u, addressToEntityIndexesMap.count(addresses[1]));
+	}
+
+	// endregion
 }}
@@ -23,7 +23,9 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/model/EntityRange.h"
+#include "catapult/utils/HexFormatter.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
@@ -173,7 +175,11 @@ namespace catapult { namespace chain {
 	}
 
 	namespace {
-		auto CreateDefaultTestContext(size_t numLocalHashes, size_t numRemoteHashes, size_t forkDepth = 0) {
+		auto CreateDefaultTestContext(
+				size_t numLocalHashes,
+				size_t numRemoteHashes,
+				size_t forkDepth = 0,
+				Height remoteHeight = Default_Height) {
 			auto remoteHashes = test::GenerateRandomHashes(numRemoteHashes);
 			auto localHashes = test::GenerateRandomHashesSubset(remoteHashes, numLocalHashes);
 			localHashes = test::ConcatHashes(localHashes, test::GenerateRandomHashes(forkDepth));
@@ -183,7 +189,7 @@ namespace catapult { namespace chain {
 					ChainScore(11),
 					localHashes,
 					remoteHashes,
-					test::GenerateVerifiableBlockAtHeight(Default_Height));
+					test::GenerateVerifiableBlockAtHeight(remoteHeight));
 			context.pChainApi->setNumBlocksPerBlocksFromRequest({ 2 });
 			context.Config.MaxRollbackBlocks = 9;
 			context.Config.MaxChainBytesPerSyncAttempt = 23;
@@ -667,4 +673,435 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region parallel sync
+
+	namespace {
+		constexpr auto Num_Helpers = 2u;
+
+		class ParallelTestContext {
+		public:
+			explicit ParallelTestContext(size_t numHelpers = Num_Helpers, Height remoteHeight = Default_Height + Height(10))
+					: m_context(CreateDefaultTestContext(9, 10, 0, remoteHeight))
+					, m_pStatistics(std::make_shared<ParallelSyncStatistics>()) {
+				// 9 blocks (max rollback) are pulled in chunks of 3 blocks starting at the default height
+				// (all peers report the same chain score)
+				m_context.Config.MaxParallelSyncPeers = static_cast<uint32_t>(numHelpers + 1);
+				m_context.pChainApi->setNumBlocksPerBlocksFromRequest({ 3 });
+
+				for (auto i = 0u; i < numHelpers; ++i) {
+					m_helperKeys.push_back(test::GenerateRandomData<Key_Size>());
+					m_helpers.push_back(std::make_shared<MockChainApi>(ChainScore(11), Default_Height + Height(10)));
+					m_helpers.back()->setNumBlocksPerBlocksFromRequest({ 3 });
+				}
+
+				// all peers agree on the chain
+				for (const auto& pBlock : GenerateLinkedBlocks(Default_Height, 9)) {
+					m_context.pChainApi->addBlock(test::CopyBlock(*pBlock));
+					for (const auto& pHelper : m_helpers)
+						pHelper->addBlock(test::CopyBlock(*pBlock));
+				}
+			}
+
+		public:
+			auto& primary() {
+				return *m_context.pChainApi;
+			}
+
+			auto& helper(size_t index) {
+				return *m_helpers[index];
+			}
+
+			const auto& helperKey(size_t index) const {
+				return m_helperKeys[index];
+			}
+
+			auto& config() {
+				return m_context.Config;
+			}
+
+			const auto& statistics() const {
+				return *m_pStatistics;
+			}
+
+			const auto& numRequestedHelpers() const {
+				return m_numRequestedHelpers;
+			}
+
+			const auto& consumedHeights() const {
+				return m_consumedHeights;
+			}
+
+		public:
+			void useForkedHelper(size_t index) {
+				// helper does not know the shared chain, so it returns random (unlinked) blocks
+				useUnlinkedHelper(index, ChainScore(11));
+			}
+
+			void useUnlinkedHelper(size_t index, const ChainScore& score) {
+				m_helpers[index] = std::make_shared<MockChainApi>(score, Default_Height + Height(10));
+				m_helpers[index]->setNumBlocksPerBlocksFromRequest({ 3 });
+			}
+
+			NodeInteractionResult sync() {
+				auto synchronizer = CreateChainSynchronizer(
+						std::make_shared<MockChainApi>(m_context.LocalScore, Default_Height, m_context.LocalHashes),
+						m_context.Config,
+						[this](auto&& range, const auto&) {
+							++m_context.BlockRangeConsumerCalls;
+							for (const auto& block : range)
+								m_consumedHeights.push_back(block.Height);
+
+							return m_context.BlockRangeConsumerCalls;
+						},
+						[this](auto numPeers) {
+							m_numRequestedHelpers.push_back(numPeers);
+
+							std::vector<ParallelSyncPeer> peers;
+							for (auto i = 0u; i < std::min<size_t>(numPeers, m_helpers.size()); ++i)
+								peers.push_back(ParallelSyncPeer{ m_helperKeys[i], m_helpers[i] });
+
+							return peers;
+						},
+						m_pStatistics);
+
+				return synchronizer(primary()).get();
+			}
+
+		private:
+			static std::vector<std::shared_ptr<const Block>> GenerateLinkedBlocks(Height startHeight, size_t numBlocks) {
+				std::vector<std::shared_ptr<const Block>> blocks;
+				for (auto i = 0u; i < numBlocks; ++i) {
+					auto pBlock = test::GenerateVerifiableBlockAtHeight(startHeight + Height(i));
+					if (0 != i)
+						pBlock->PreviousBlockHash = CalculateHash(*blocks.back());
+
+					blocks.push_back(std::move(pBlock));
+				}
+
+				return blocks;
+			}
+
+		private:
+			TestContext m_context;
+			std::vector<Key> m_helperKeys;
+			std::vector<std::shared_ptr<MockChainApi>> m_helpers;
+			std::shared_ptr<ParallelSyncStatistics> m_pStatistics;
+			std::vector<size_t> m_numRequestedHelpers;
+			std::vector<Height> m_consumedHeights;
+		};
+
+		std::vector<Height> GetRequestHeights(const MockChainApi& chainApi) {
+			std::vector<Height> heights;
+			for (const auto& params : chainApi.blocksFromRequests()) {
+				EXPECT_EQ(3u, params.second.NumBlocks) << "NumBlocks of request at " << params.first;
+				EXPECT_EQ(8u, params.second.NumBytes) << "NumBytes of request at " << params.first;
+				heights.push_back(params.first);
+			}
+
+			return heights;
+		}
+
+		std::vector<Height> GetHeights(Height startHeight, size_t count) {
+			std::vector<Height> heights;
+			for (auto i = 0u; i < count; ++i)
+				heights.push_back(startHeight + Height(i));
+
+			return heights;
+		}
+
+		PeerSyncThroughput FindPeer(const ParallelSyncStatistics& statistics, const Key& identityKey) {
+			for (const auto& peer : statistics.peers()) {
+				if (identityKey == peer.IdentityKey)
+					return peer;
+			}
+
+			return PeerSyncThroughput{ identityKey, 0, 0, 0, 0 };
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsBypassedWhenDisabled) {
+		// Arrange:
+		ParallelTestContext context;
+		context.config().MaxParallelSyncPeers = 1;
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: a single chunk was pulled from the synchronizing peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_TRUE(context.numRequestedHelpers().empty());
+		EXPECT_EQ(GetHeights(Default_Height, 3), context.consumedHeights());
+
+		ASSERT_EQ(1u, context.primary().blocksFromRequests().size());
+		EXPECT_EQ(9u, context.primary().blocksFromRequests()[0].second.NumBlocks);
+		EXPECT_TRUE(context.helper(0).blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsBypassedWhenNoHelpersAreAvailable) {
+		// Arrange:
+		ParallelTestContext context(0);
+		context.config().MaxParallelSyncPeers = 3;
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: helpers were requested but none were available
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(std::vector<size_t>({ 2 }), context.numRequestedHelpers());
+		EXPECT_EQ(GetHeights(Default_Height, 3), context.consumedHeights());
+
+		ASSERT_EQ(1u, context.primary().blocksFromRequests().size());
+		EXPECT_EQ(9u, context.primary().blocksFromRequests()[0].second.NumBlocks);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsBypassedWhenRemoteIsNotMoreThanOneChunkAhead) {
+		// Arrange: remote chain only contains a single chunk of new blocks
+		ParallelTestContext context(Num_Helpers, Default_Height + Height(2));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: no helpers were requested and all blocks were pulled from the synchronizing peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_TRUE(context.numRequestedHelpers().empty());
+		EXPECT_EQ(GetHeights(Default_Height, 3), context.consumedHeights());
+
+		ASSERT_EQ(1u, context.primary().blocksFromRequests().size());
+		EXPECT_EQ(9u, context.primary().blocksFromRequests()[0].second.NumBlocks);
+		EXPECT_TRUE(context.helper(0).blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsBypassedWhenForkIsDetected) {
+		// Arrange: local chain has a fork of depth 6
+		auto context = CreateDefaultTestContext(4, 10, 6);
+		context.Config.MaxParallelSyncPeers = 3;
+		auto numSupplierCalls = 0u;
+		auto synchronizer = CreateChainSynchronizer(
+				std::make_shared<MockChainApi>(context.LocalScore, Default_Height, context.LocalHashes),
+				context.Config,
+				[](const auto&, const auto&) { return 1u; },
+				[&numSupplierCalls](auto) {
+					++numSupplierCalls;
+					return std::vector<ParallelSyncPeer>();
+				},
+				std::make_shared<ParallelSyncStatistics>());
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert: the fork was pulled from the synchronizing peer alone
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(0u, numSupplierCalls);
+		AssertDefaultMultiplePullRequest(*context.pChainApi, { Height(15), Height(17), Height(19) });
+	}
+
+	TEST(TEST_CLASS, ParallelSyncPullsChunksFromAllPeers) {
+		// Arrange:
+		ParallelTestContext context;
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: each peer was assigned one chunk and all chunks were forwarded in order as a single range
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(std::vector<size_t>({ 2 }), context.numRequestedHelpers());
+		EXPECT_EQ(GetHeights(Default_Height, 9), context.consumedHeights());
+
+		EXPECT_EQ(std::vector<Height>({ Default_Height }), GetRequestHeights(context.primary()));
+		EXPECT_EQ(std::vector<Height>({ Default_Height + Height(3) }), GetRequestHeights(context.helper(0)));
+		EXPECT_EQ(std::vector<Height>({ Default_Height + Height(6) }), GetRequestHeights(context.helper(1)));
+	}
+
+	TEST(TEST_CLASS, ParallelSyncOnlyRequestsHelpersForAvailableChunks) {
+		// Arrange: remote chain only contains two chunks of new blocks
+		ParallelTestContext context(Num_Helpers, Default_Height + Height(5));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: a single helper was requested and each chunk was pulled with half of the bytes
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(std::vector<size_t>({ 1 }), context.numRequestedHelpers());
+		EXPECT_EQ(GetHeights(Default_Height, 6), context.consumedHeights());
+
+		ASSERT_EQ(1u, context.primary().blocksFromRequests().size());
+		EXPECT_EQ(Default_Height, context.primary().blocksFromRequests()[0].first);
+		EXPECT_EQ(3u, context.primary().blocksFromRequests()[0].second.NumBlocks);
+		EXPECT_EQ(12u, context.primary().blocksFromRequests()[0].second.NumBytes);
+
+		ASSERT_EQ(1u, context.helper(0).blocksFromRequests().size());
+		EXPECT_EQ(Default_Height + Height(3), context.helper(0).blocksFromRequests()[0].first);
+		EXPECT_EQ(3u, context.helper(0).blocksFromRequests()[0].second.NumBlocks);
+		EXPECT_EQ(12u, context.helper(0).blocksFromRequests()[0].second.NumBytes);
+	}
+
+	namespace {
+		void AssertFirstHelperIsExcluded(ParallelTestContext& context) {
+			// Arrange: blocks are split into two chunks (5 and 4 blocks)
+			context.primary().setNumBlocksPerBlocksFromRequest({ 5 });
+			context.helper(1).setNumBlocksPerBlocksFromRequest({ 4 });
+
+			// Act:
+			auto result = context.sync();
+
+			// Assert: all blocks were pulled from the synchronizing peer and the remaining helper
+			EXPECT_EQ(NodeInteractionResult::Success, result);
+			EXPECT_EQ(GetHeights(Default_Height, 9), context.consumedHeights());
+			EXPECT_TRUE(context.helper(0).blocksFromRequests().empty());
+			EXPECT_EQ(0u, context.statistics().numReassignedChunks());
+
+			ASSERT_EQ(1u, context.primary().blocksFromRequests().size());
+			EXPECT_EQ(Default_Height, context.primary().blocksFromRequests()[0].first);
+			EXPECT_EQ(5u, context.primary().blocksFromRequests()[0].second.NumBlocks);
+			EXPECT_EQ(12u, context.primary().blocksFromRequests()[0].second.NumBytes);
+
+			ASSERT_EQ(1u, context.helper(1).blocksFromRequests().size());
+			EXPECT_EQ(Default_Height + Height(5), context.helper(1).blocksFromRequests()[0].first);
+			EXPECT_EQ(4u, context.helper(1).blocksFromRequests()[0].second.NumBlocks);
+			EXPECT_EQ(12u, context.helper(1).blocksFromRequests()[0].second.NumBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelSyncExcludesHelperWithDifferentChainScore) {
+		// Arrange:
+		ParallelTestContext context;
+		context.useUnlinkedHelper(0, ChainScore(12));
+
+		// Assert:
+		AssertFirstHelperIsExcluded(context);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncExcludesHelperWithUnavailableChainInfo) {
+		// Arrange:
+		ParallelTestContext context;
+		context.helper(0).setError(MockChainApi::EntryPoint::Chain_Info);
+
+		// Assert:
+		AssertFirstHelperIsExcluded(context);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncCollectsPeerThroughputs) {
+		// Arrange:
+		ParallelTestContext context;
+
+		// Act:
+		context.sync();
+
+		// Assert:
+		const auto& statistics = context.statistics();
+		EXPECT_EQ(9 * sizeof(Block), statistics.numBytes());
+		EXPECT_EQ(0u, statistics.numReassignedChunks());
+		EXPECT_EQ(3u, statistics.peers().size());
+
+		for (const auto& identityKey : { context.primary().remoteIdentityKey(), context.helperKey(0), context.helperKey(1) }) {
+			auto peer = FindPeer(statistics, identityKey);
+			EXPECT_EQ(1u, peer.NumChunks) << utils::HexFormat(identityKey);
+			EXPECT_EQ(0u, peer.NumFailedChunks) << utils::HexFormat(identityKey);
+			EXPECT_EQ(3 * sizeof(Block), peer.NumBytes) << utils::HexFormat(identityKey);
+		}
+	}
+
+	namespace {
+		void AssertChunkIsReassigned(ParallelTestContext& context, size_t failedHelperIndex) {
+			// Act:
+			auto result = context.sync();
+
+			// Assert: the chunk was pulled again from the synchronizing peer and all blocks were forwarded in order
+			auto failedHeight = Default_Height + Height(3 * (failedHelperIndex + 1));
+			EXPECT_EQ(NodeInteractionResult::Success, result);
+			EXPECT_EQ(GetHeights(Default_Height, 9), context.consumedHeights());
+			EXPECT_EQ(std::vector<Height>({ Default_Height, failedHeight }), GetRequestHeights(context.primary()));
+
+			const auto& statistics = context.statistics();
+			EXPECT_EQ(1u, statistics.numReassignedChunks());
+			EXPECT_EQ(1u, FindPeer(statistics, context.helperKey(failedHelperIndex)).NumFailedChunks);
+			EXPECT_EQ(2u, FindPeer(statistics, context.primary().remoteIdentityKey()).NumChunks);
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelSyncReassignsChunkOfFailingHelper) {
+		// Arrange:
+		ParallelTestContext context;
+		context.helper(0).setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Assert:
+		AssertChunkIsReassigned(context, 0);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncReassignsChunkOfHelperWithoutBlocks) {
+		// Arrange:
+		ParallelTestContext context;
+		context.helper(1).setNumBlocksPerBlocksFromRequest({ 0 });
+
+		// Assert:
+		AssertChunkIsReassigned(context, 1);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncReassignsChunkOfHelperOnDifferentChain) {
+		// Arrange:
+		ParallelTestContext context;
+		context.useForkedHelper(1);
+
+		// Assert:
+		AssertChunkIsReassigned(context, 1);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncDiscardsChunksFollowingPartialChunk) {
+		// Arrange: first helper only returns two of three blocks
+		ParallelTestContext context;
+		context.helper(0).setNumBlocksPerBlocksFromRequest({ 2 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: chunk pulled from second helper does not follow partial chunk and is discarded
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(GetHeights(Default_Height, 5), context.consumedHeights());
+		EXPECT_EQ(0u, context.statistics().numReassignedChunks());
+	}
+
+	TEST(TEST_CLASS, ParallelSyncForwardsChunksPrecedingChunkUnavailableFromSynchronizingPeer) {
+		// Arrange: first helper fails and synchronizing peer does not return any blocks for the reassigned chunk
+		ParallelTestContext context;
+		context.helper(0).setError(MockChainApi::EntryPoint::Blocks_From);
+		context.primary().setNumBlocksPerBlocksFromRequest({ 3, 0 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(GetHeights(Default_Height, 3), context.consumedHeights());
+		EXPECT_EQ(1u, context.statistics().numReassignedChunks());
+	}
+
+	TEST(TEST_CLASS, ParallelSyncFailsWhenSynchronizingPeerFails) {
+		// Arrange:
+		ParallelTestContext context;
+		context.primary().setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: the chunks pulled from helpers are not forwarded
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_TRUE(context.consumedHeights().empty());
+		EXPECT_EQ(0u, context.statistics().numReassignedChunks());
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsNeutralWhenSynchronizingPeerReturnsNoBlocks) {
+		// Arrange:
+		ParallelTestContext context;
+		context.primary().setNumBlocksPerBlocksFromRequest({ 0 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		EXPECT_TRUE(context.consumedHeights().empty());
+	}
+
+	// endregion
 }}
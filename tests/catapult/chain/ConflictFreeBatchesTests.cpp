@@ -0,0 +1,191 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/ConflictFreeBatches.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS ConflictFreeBatchesTests
+
+	// region IsAddressScopedNotificationType
+
+	namespace {
+		constexpr auto Plugin_Facility_Code = static_cast<model::FacilityCode>(0x4E);
+
+		constexpr auto MakeTestNotificationType(model::NotificationChannel channel, model::FacilityCode facility) {
+			return model::MakeNotificationType(channel, facility, 0x0099);
+		}
+	}
+
+	TEST(TEST_CLASS, CoreNotificationsOtherThanBlockNotificationsAreAddressScoped) {
+		// Assert:
+		EXPECT_TRUE(IsAddressScopedNotificationType(model::Core_Register_Account_Address_Notification));
+		EXPECT_TRUE(IsAddressScopedNotificationType(model::Core_Register_Account_Public_Key_Notification));
+		EXPECT_TRUE(IsAddressScopedNotificationType(model::Core_Balance_Transfer_Notification));
+		EXPECT_TRUE(IsAddressScopedNotificationType(model::Core_Transaction_Notification));
+		EXPECT_TRUE(IsAddressScopedNotificationType(MakeTestNotificationType(model::NotificationChannel::All, model::FacilityCode::Core)));
+
+		EXPECT_FALSE(IsAddressScopedNotificationType(model::Core_Block_Notification));
+	}
+
+	TEST(TEST_CLASS, ValidatorOnlyNotificationsAreAddressScoped) {
+		// Assert:
+		EXPECT_TRUE(IsAddressScopedNotificationType(MakeTestNotificationType(model::NotificationChannel::None, Plugin_Facility_Code)));
+		EXPECT_TRUE(IsAddressScopedNotificationType(MakeTestNotificationType(model::NotificationChannel::Validator, Plugin_Facility_Code)));
+	}
+
+	TEST(TEST_CLASS, PluginObserverNotificationsAreNotAddressScoped) {
+		// Assert:
+		EXPECT_FALSE(IsAddressScopedNotificationType(MakeTestNotificationType(model::NotificationChannel::Observer, Plugin_Facility_Code)));
+		EXPECT_FALSE(IsAddressScopedNotificationType(MakeTestNotificationType(model::NotificationChannel::All, Plugin_Facility_Code)));
+	}
+
+	// endregion
+
+	// region GroupConflictFreeBatches
+
+	namespace {
+		constexpr auto Global_Notification_Type = MakeTestNotificationType(model::NotificationChannel::All, Plugin_Facility_Code);
+
+		struct EntityDescriptor {
+			std::vector<Address> Addresses;
+			bool IsGlobal;
+		};
+
+		// publishes account address notifications for all addresses in the descriptor associated with each entity
+		class DescriptorNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit DescriptorNotificationPublisher(const std::vector<EntityDescriptor>& descriptors) : m_descriptors(descriptors)
+			{}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+				// the fake entity hash stores the entity index
+				const auto& descriptor = m_descriptors[entityInfo.hash()[0]];
+				for (const auto& address : descriptor.Addresses)
+					subscriber.notify(model::AccountAddressNotification(address));
+
+				if (descriptor.IsGlobal)
+					subscriber.notify(model::Notification(Global_Notification_Type, sizeof(model::Notification)));
+			}
+
+		private:
+			std::vector<EntityDescriptor> m_descriptors;
+		};
+
+		std::vector<ConflictFreeBatch> Group(const std::vector<EntityDescriptor>& descriptors) {
+			// Arrange:
+			std::vector<model::VerifiableEntity> entities(descriptors.size());
+			std::vector<Hash256> entityHashes;
+			entityHashes.reserve(descriptors.size());
+
+			model::WeakEntityInfos entityInfos;
+			for (auto i = 0u; i < descriptors.size(); ++i) {
+				entityHashes.push_back(Hash256{ { static_cast<uint8_t>(i) } });
+				entityInfos.emplace_back(entities[i], entityHashes.back());
+			}
+
+			// Act:
+			return GroupConflictFreeBatches(entityInfos, DescriptorNotificationPublisher(descriptors));
+		}
+
+		void AssertBatches(const std::vector<ConflictFreeBatch>& expectedBatches, const std::vector<ConflictFreeBatch>& batches) {
+			ASSERT_EQ(expectedBatches.size(), batches.size());
+
+			for (auto i = 0u; i < expectedBatches.size(); ++i) {
+				EXPECT_EQ(expectedBatches[i].StartIndex, batches[i].StartIndex) << "batch at " << i;
+				EXPECT_EQ(expectedBatches[i].Count, batches[i].Count) << "batch at " << i;
+			}
+		}
+
+		std::vector<Address> GenerateAddresses(size_t count) {
+			std::vector<Address> addresses;
+			for (auto i = 0u; i < count; ++i)
+				addresses.push_back(test::GenerateRandomData<Address_Decoded_Size>());
+
+			return addresses;
+		}
+	}
+
+	TEST(TEST_CLASS, CanGroupZeroEntities) {
+		// Act:
+		auto batches = Group({});
+
+		// Assert:
+		EXPECT_TRUE(batches.empty());
+	}
+
+	TEST(TEST_CLASS, EntitiesTouchingDisjointAccountsAreGroupedIntoSingleBatch) {
+		// Arrange:
+		auto a = GenerateAddresses(5);
+
+		// Act:
+		auto batches = Group({
+			{ { a[0], a[1] }, false },
+			{ { a[2] }, false },
+			{ {}, false },
+			{ { a[3], a[4] }, false }
+		});
+
+		// Assert:
+		AssertBatches({ { 0, 4 } }, batches);
+	}
+
+	TEST(TEST_CLASS, EntityTouchingAccountInCurrentBatchStartsNewBatch) {
+		// Arrange:
+		auto a = GenerateAddresses(4);
+
+		// Act:
+		auto batches = Group({
+			{ { a[0], a[1] }, false },
+			{ { a[2] }, false },
+			{ { a[3], a[1] }, false }, // conflicts with entity 0
+			{ { a[0] }, false }, // does not conflict with entity 2 (entity 0 is in a previous batch)
+			{ { a[2], a[3] }, false } // conflicts with entity 2
+		});
+
+		// Assert:
+		AssertBatches({ { 0, 2 }, { 2, 2 }, { 4, 1 } }, batches);
+	}
+
+	TEST(TEST_CLASS, EntityTouchingGlobalStateIsPlacedIntoOwnBatch) {
+		// Arrange:
+		auto a = GenerateAddresses(4);
+
+		// Act:
+		auto batches = Group({
+			{ { a[0] }, false },
+			{ { a[1] }, false },
+			{ { a[2] }, true },
+			{ {}, true },
+			{ { a[3] }, false },
+			{ { a[0] }, false }
+		});
+
+		// Assert:
+		AssertBatches({ { 0, 2 }, { 2, 1 }, { 3, 1 }, { 4, 2 } }, batches);
+	}
+
+	// endregion
+}}
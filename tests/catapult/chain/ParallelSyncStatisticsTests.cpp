@@ -0,0 +1,136 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/ParallelSyncStatistics.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS ParallelSyncStatisticsTests
+
+	namespace {
+		PeerSyncThroughput FindPeer(const ParallelSyncStatistics& statistics, const Key& identityKey) {
+			for (const auto& peer : statistics.peers()) {
+				if (identityKey == peer.IdentityKey)
+					return peer;
+			}
+
+			CATAPULT_THROW_RUNTIME_ERROR("peer not found");
+		}
+
+		void AssertThroughput(
+				const PeerSyncThroughput& peer,
+				uint64_t expectedNumChunks,
+				uint64_t expectedNumFailedChunks,
+				uint64_t expectedNumBytes,
+				uint64_t expectedNumMillis) {
+			EXPECT_EQ(expectedNumChunks, peer.NumChunks);
+			EXPECT_EQ(expectedNumFailedChunks, peer.NumFailedChunks);
+			EXPECT_EQ(expectedNumBytes, peer.NumBytes);
+			EXPECT_EQ(expectedNumMillis, peer.NumMillis);
+		}
+	}
+
+	// region PeerSyncThroughput
+
+	TEST(TEST_CLASS, BytesPerSecondIsCalculatedFromBytesAndMillis) {
+		// Arrange:
+		auto peer = PeerSyncThroughput{ Key(), 3, 0, 12'000, 400 };
+
+		// Act + Assert:
+		EXPECT_EQ(30'000u, peer.bytesPerSecond());
+	}
+
+	TEST(TEST_CLASS, BytesPerSecondTreatsZeroMillisAsOneMillisecond) {
+		// Arrange:
+		auto peer = PeerSyncThroughput{ Key(), 1, 0, 123, 0 };
+
+		// Act + Assert:
+		EXPECT_EQ(123'000u, peer.bytesPerSecond());
+	}
+
+	// endregion
+
+	// region ParallelSyncStatistics
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyEmpty) {
+		// Act:
+		ParallelSyncStatistics statistics;
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.numBytes());
+		EXPECT_EQ(0u, statistics.numReassignedChunks());
+		EXPECT_TRUE(statistics.peers().empty());
+	}
+
+	TEST(TEST_CLASS, CanAddChunks) {
+		// Arrange:
+		auto key1 = test::GenerateRandomData<Key_Size>();
+		auto key2 = test::GenerateRandomData<Key_Size>();
+		ParallelSyncStatistics statistics;
+
+		// Act:
+		statistics.addChunk(key1, 100, 10);
+		statistics.addChunk(key2, 200, 30);
+		statistics.addChunk(key1, 50, 5);
+
+		// Assert:
+		EXPECT_EQ(350u, statistics.numBytes());
+		EXPECT_EQ(0u, statistics.numReassignedChunks());
+		ASSERT_EQ(2u, statistics.peers().size());
+		AssertThroughput(FindPeer(statistics, key1), 2, 0, 150, 15);
+		AssertThroughput(FindPeer(statistics, key2), 1, 0, 200, 30);
+	}
+
+	TEST(TEST_CLASS, CanAddFailedChunks) {
+		// Arrange:
+		auto key1 = test::GenerateRandomData<Key_Size>();
+		auto key2 = test::GenerateRandomData<Key_Size>();
+		ParallelSyncStatistics statistics;
+
+		// Act:
+		statistics.addChunk(key1, 100, 10);
+		statistics.addFailedChunk(key1);
+		statistics.addFailedChunk(key2);
+		statistics.addFailedChunk(key2);
+
+		// Assert: failed chunks do not contribute any bytes
+		EXPECT_EQ(100u, statistics.numBytes());
+		ASSERT_EQ(2u, statistics.peers().size());
+		AssertThroughput(FindPeer(statistics, key1), 1, 1, 100, 10);
+		AssertThroughput(FindPeer(statistics, key2), 0, 2, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CanAddReassignedChunks) {
+		// Arrange:
+		ParallelSyncStatistics statistics;
+
+		// Act:
+		statistics.addReassignedChunk();
+		statistics.addReassignedChunk();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.numBytes());
+		EXPECT_EQ(2u, statistics.numReassignedChunks());
+		EXPECT_TRUE(statistics.peers().empty());
+	}
+
+	// endregion
+}}
@@ -33,6 +33,7 @@ namespace catapult { namespace chain {
 		struct ProcessSyncParamsCapture {
 			size_t NumFactoryCalls = 0;
 			const ionet::PacketIo* pFactoryPacketIo = nullptr;
+			Key FactoryRemoteIdentityKey;
 			const model::TransactionRegistry* pFactoryTransactionRegistry = nullptr;
 
 			size_t NumActionCalls = 0;
@@ -46,9 +47,10 @@ namespace catapult { namespace chain {
 					capture.ActionApiId = apiId;
 					return thread::make_ready_future(NodeInteractionResult::Success);
 				},
-				[&capture](const auto& packetIo, const auto& registry) {
+				[&capture](const auto& packetIo, const auto& remoteIdentityKey, const auto& registry) {
 					++capture.NumFactoryCalls;
 					capture.pFactoryPacketIo = &packetIo;
+					capture.FactoryRemoteIdentityKey = remoteIdentityKey;
 					capture.pFactoryTransactionRegistry = &registry;
 					return std::make_unique<int>(Default_Action_Api_Id);
 				});
@@ -82,8 +84,10 @@ namespace catapult { namespace chain {
 	TEST(TEST_CLASS, ActionIsInvokedWhenPeerIsAvailable) {
 		// Arrange: create writers with a valid packet
 		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		auto remoteIdentityKey = test::GenerateRandomData<Key_Size>();
 		mocks::PickOneAwareMockPacketWriters writers;
 		writers.setPacketIo(pPacketIo);
+		writers.setNode(ionet::Node(remoteIdentityKey, ionet::NodeEndpoint(), ionet::NodeMetadata()));
 
 		// - create the forwarder
 		model::TransactionRegistry registry;
@@ -103,6 +107,7 @@ namespace catapult { namespace chain {
 		// - factory was called
 		EXPECT_EQ(1u, capture.NumFactoryCalls);
 		EXPECT_EQ(pPacketIo.get(), capture.pFactoryPacketIo);
+		EXPECT_EQ(remoteIdentityKey, capture.FactoryRemoteIdentityKey);
 		EXPECT_EQ(&registry, capture.pFactoryTransactionRegistry);
 
 		// - action was called
@@ -25,6 +25,7 @@
 #include "catapult/model/TransactionStatus.h"
 #include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -115,9 +116,9 @@ namespace catapult { namespace chain {
 
 		class UpdaterTestContext {
 		public:
-			explicit UpdaterTestContext(ThrottleMode throttleMode = ThrottleMode::Off)
+			explicit UpdaterTestContext(ThrottleMode throttleMode = ThrottleMode::Off, uint64_t maxCacheSize = 1000)
 					: m_cache(CreateCacheWithDefaultHeight())
-					, m_transactionsCache(cache::MemoryCacheOptions(1024, 1000))
+					, m_transactionsCache(cache::MemoryCacheOptions(1024, maxCacheSize))
 					, m_updater(
 							m_transactionsCache,
 							m_cache,
@@ -150,6 +151,42 @@ namespace catapult { namespace chain {
 				m_partialUndoFailureIndexes = partialUndoFailureIndexes;
 			}
 
+			std::vector<Hash256> validatedHashes() const {
+				std::vector<Hash256> hashes;
+				for (const auto& params : m_executionConfig.pValidator->params())
+					hashes.push_back(params.HashCopy);
+
+				return hashes;
+			}
+
+			std::vector<Hash256> observedHashes() const {
+				std::vector<Hash256> hashes;
+				for (const auto& params : m_executionConfig.pObserver->params())
+					hashes.push_back(params.HashCopy);
+
+				return hashes;
+			}
+
+			std::vector<size_t> validatedNumDifficultyInfos() const {
+				std::vector<size_t> numDifficultyInfos;
+				for (const auto& params : m_executionConfig.pValidator->params())
+					numDifficultyInfos.push_back(params.NumDifficultyInfos);
+
+				return numDifficultyInfos;
+			}
+
+			const std::vector<model::TransactionStatus>& failedTransactionStatuses() const {
+				return m_failedTransactionStatuses;
+			}
+
+			std::vector<Hash256> failedHashes() const {
+				std::vector<Hash256> hashes;
+				for (const auto& status : m_failedTransactionStatuses)
+					hashes.push_back(status.Hash);
+
+				return hashes;
+			}
+
 		private:
 			bool isRollbackExecution(size_t index) const {
 				// MockExecutionConfiguration is configured to create two notifications for each entity
@@ -963,4 +1000,326 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region update (block disruptor) - incremental
+
+	namespace {
+		// transactions created with an offset of 100 have deadlines (>= 100 * 100) that are after Default_Time
+		constexpr size_t Unexpired_Transaction_Offset = 100;
+
+		void SetExtractedAddresses(TransactionData& data, const std::vector<model::AddressSet>& addressSets) {
+			for (auto i = 0u; i < addressSets.size(); ++i)
+				data.UtInfos[i].OptionalExtractedAddresses = std::make_shared<model::AddressSet>(addressSets[i]);
+		}
+
+		std::vector<Hash256> Duplicate(const std::vector<Hash256>& hashes) {
+			// MockNotificationPublisher publishes two notifications per entity
+			std::vector<Hash256> result;
+			for (const auto& hash : hashes) {
+				result.push_back(hash);
+				result.push_back(hash);
+			}
+
+			return result;
+		}
+
+		struct IncrementalTestAddresses {
+			Address A = test::GenerateRandomData<Address_Decoded_Size>();
+			Address B = test::GenerateRandomData<Address_Decoded_Size>();
+			Address C = test::GenerateRandomData<Address_Decoded_Size>();
+			Address D = test::GenerateRandomData<Address_Decoded_Size>();
+			Address E = test::GenerateRandomData<Address_Decoded_Size>();
+		};
+
+		TransactionData CreateIncrementalTransactionData(const IncrementalTestAddresses& addresses) {
+			// tx 0 { A }, tx 1 { B }, tx 2 { C }, tx 3 { A, D }, tx 4 { E }, tx 5 { D }
+			auto data = CreateTransactionData(6, Unexpired_Transaction_Offset);
+			SetExtractedAddresses(data, {
+				{ addresses.A }, { addresses.B }, { addresses.C }, { addresses.A, addresses.D }, { addresses.E }, { addresses.D }
+			});
+			return data;
+		}
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateOnlyRevalidatesTransactionsDependentOnChangedAddresses) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context;
+		IncrementalTestAddresses addresses;
+		auto originalTransactionData = CreateIncrementalTransactionData(addresses);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, { addresses.A });
+
+		// Assert: all transactions are still in the cache
+		EXPECT_EQ(6u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalHashes);
+
+		// - tx 0 and tx 3 depend on A directly and tx 5 depends on D, which is changed by revalidated tx 3
+		EXPECT_EQ(Duplicate(Select(originalHashes, { 0, 3, 5 })), context.validatedHashes());
+
+		// - all transactions are reapplied to the rebased cache
+		EXPECT_EQ(Duplicate(originalHashes), context.observedHashes());
+		EXPECT_TRUE(context.failedHashes().empty());
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesExpiredTransactions) {
+		// Arrange: initialize the UT cache with 3 transactions with deadlines before Default_Time
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3);
+		SetExtractedAddresses(originalTransactionData, { {}, {}, {} });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, {});
+
+		// Assert: all transactions are revalidated even though no addresses changed
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		EXPECT_EQ(Duplicate(originalTransactionData.Hashes), context.validatedHashes());
+		EXPECT_EQ(Duplicate(originalTransactionData.Hashes), context.observedHashes());
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesAllTransactionsWhenTransactionsAreReverted) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context;
+		IncrementalTestAddresses addresses;
+		auto originalTransactionData = CreateIncrementalTransactionData(addresses);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - prepare 2 reverted transactions
+		auto transactionData = CreateTransactionData(2, 2 * Unexpired_Transaction_Offset);
+
+		// Act:
+		context.updater().update({}, transactionData.UtInfos, {});
+
+		// Assert: reverted transactions are applied first, so all original transactions are revalidated
+		EXPECT_EQ(8u, context.transactionsCache().view().size());
+		auto expectedHashes = Duplicate(ConcatContainers(transactionData.Hashes, originalTransactionData.Hashes));
+		EXPECT_EQ(expectedHashes, context.validatedHashes());
+		EXPECT_EQ(expectedHashes, context.observedHashes());
+	}
+
+	namespace {
+		struct DifferentialUpdateResult {
+			std::vector<Timestamp::ValueType> UtCacheDeadlines;
+			std::vector<Hash256> ObservedHashes;
+			std::vector<Hash256> FailedHashes;
+			size_t NumValidatedHashes;
+		};
+
+		template<typename TUpdate>
+		DifferentialUpdateResult RunDifferentialUpdate(
+				const TransactionData& originalTransactionData,
+				const std::vector<std::pair<size_t, ValidationResult>>& failures,
+				TUpdate update) {
+			// Arrange:
+			UpdaterTestContext context;
+			test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+			for (const auto& failure : failures)
+				context.setValidationResult(failure.second, originalTransactionData.Hashes[failure.first], 2);
+
+			// Act:
+			update(context.updater());
+
+			// Assert:
+			return {
+				test::ExtractRawDeadlines(context.transactionsCache()),
+				context.observedHashes(),
+				context.failedHashes(),
+				context.validatedHashes().size()
+			};
+		}
+
+		void AssertIncrementalUpdateMatchesFullUpdate(
+				const std::vector<std::pair<size_t, ValidationResult>>& failures,
+				const std::vector<size_t>& confirmedIndexes,
+				size_t expectedNumValidatedTransactions) {
+			// Arrange:
+			IncrementalTestAddresses addresses;
+			auto originalTransactionData = CreateIncrementalTransactionData(addresses);
+			utils::HashPointerSet confirmedHashes;
+			for (auto index : confirmedIndexes)
+				confirmedHashes.insert(&originalTransactionData.Hashes[index]);
+
+			// Act: block changed A and C
+			auto fullResult = RunDifferentialUpdate(originalTransactionData, failures, [&confirmedHashes](auto& updater) {
+				updater.update(confirmedHashes, {});
+			});
+			auto incrementalResult = RunDifferentialUpdate(originalTransactionData, failures, [&](auto& updater) {
+				updater.update(confirmedHashes, {}, { addresses.A, addresses.C });
+			});
+
+			// Assert: both updates produce the same cache and apply the same transaction effects
+			EXPECT_EQ(fullResult.UtCacheDeadlines, incrementalResult.UtCacheDeadlines);
+			EXPECT_EQ(fullResult.ObservedHashes, incrementalResult.ObservedHashes);
+			EXPECT_EQ(fullResult.FailedHashes, incrementalResult.FailedHashes);
+
+			// - but the incremental update only validated dependent transactions
+			EXPECT_EQ(2 * (6 - confirmedIndexes.size()), fullResult.NumValidatedHashes);
+			EXPECT_EQ(2 * expectedNumValidatedTransactions, incrementalResult.NumValidatedHashes);
+		}
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateMatchesFullUpdateWhenAllTransactionsAreValid) {
+		// Assert: tx 0, tx 2, tx 3 and tx 5 are revalidated
+		AssertIncrementalUpdateMatchesFullUpdate({}, {}, 4);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateMatchesFullUpdateWhenDependentTransactionsFailValidation) {
+		// Assert: tx 0, tx 2, tx 3 and tx 5 are revalidated (tx 3 and tx 5 are dropped)
+		AssertIncrementalUpdateMatchesFullUpdate({ { 3, ValidationResult::Failure }, { 5, ValidationResult::Failure } }, {}, 4);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateMatchesFullUpdateWhenTransactionsAreConfirmed) {
+		// Assert: tx 0, tx 3 and tx 5 are revalidated (tx 2 is confirmed and tx 3 is dropped)
+		AssertIncrementalUpdateMatchesFullUpdate({ { 3, ValidationResult::Failure } }, { 2 }, 3);
+	}
+
+	// endregion
+
+	// region update (tx disruptor) - eviction
+
+	namespace {
+		constexpr Amount Seed_Fee(100);
+
+		std::vector<model::TransactionInfo> CreateSeedTransactionInfos(size_t count) {
+			// all seed transactions have the same size and fee
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(i + 1, Seed_Fee));
+
+			return transactionInfos;
+		}
+	}
+
+	TEST(TEST_CLASS, LowerPriorityTransactionIsNotAddedToFullCache) {
+		// Arrange: fill the cache
+		UpdaterTestContext context(ThrottleMode::Off, 3);
+		auto seedInfos = CreateSeedTransactionInfos(3);
+		context.updater().update(seedInfos);
+
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(4, Seed_Fee));
+		const auto& transactionInfo = transactionInfos[0];
+
+		// Act:
+		context.updater().update(transactionInfos);
+
+		// Assert: the transaction was not added and only the seed transactions were executed
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), seedInfos);
+		test::AssertContainsNone(context.transactionsCache(), std::vector<Hash256>{ transactionInfo.EntityHash });
+
+		EXPECT_EQ(Duplicate(test::ExtractHashes(seedInfos)), context.validatedHashes());
+		EXPECT_TRUE(context.failedTransactionStatuses().empty());
+	}
+
+	TEST(TEST_CLASS, HigherPriorityTransactionEvictsLowestPriorityTransactionAndUndoesItsEffects) {
+		// Arrange: fill the cache
+		UpdaterTestContext context(ThrottleMode::Off, 3);
+		auto seedInfos = CreateSeedTransactionInfos(3);
+		context.updater().update(seedInfos);
+
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(4, Amount(Seed_Fee.unwrap() + 1)));
+		const auto& transactionInfo = transactionInfos[0];
+
+		// Act:
+		context.updater().update(transactionInfos);
+
+		// Assert: the most recent seed transaction (lowest priority) was replaced by the new transaction
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), std::vector<Hash256>{
+			seedInfos[0].EntityHash, seedInfos[1].EntityHash, transactionInfo.EntityHash
+		});
+		test::AssertContainsNone(context.transactionsCache(), std::vector<Hash256>{ seedInfos[2].EntityHash });
+
+		// - the evicted transaction was reported as failed
+		ASSERT_EQ(1u, context.failedTransactionStatuses().size());
+		const auto& status = context.failedTransactionStatuses()[0];
+		EXPECT_EQ(seedInfos[2].EntityHash, status.Hash);
+		EXPECT_EQ(Failure_Chain_Unconfirmed_Cache_Too_Full, validators::ValidationResult(status.Status));
+
+		// - all remaining transactions were reapplied to a fresh unconfirmed cache, which undid the evicted transaction's effects
+		//   (all transactions are expired, so they are revalidated; NumDifficultyInfos is incremented by each observer call)
+		auto expectedHashes = Duplicate({
+			seedInfos[0].EntityHash, seedInfos[1].EntityHash, seedInfos[2].EntityHash, transactionInfo.EntityHash,
+			seedInfos[0].EntityHash, seedInfos[1].EntityHash, transactionInfo.EntityHash
+		});
+		EXPECT_EQ(expectedHashes, context.validatedHashes());
+		EXPECT_EQ(std::vector<size_t>({ 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5 }), context.validatedNumDifficultyInfos());
+	}
+
+	TEST(TEST_CLASS, InvalidHigherPriorityTransactionDoesNotEvictTransactionFromFullCache) {
+		// Arrange: fill the cache
+		UpdaterTestContext context(ThrottleMode::Off, 3);
+		auto seedInfos = CreateSeedTransactionInfos(3);
+		context.updater().update(seedInfos);
+
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(4, Amount(Seed_Fee.unwrap() + 1)));
+		const auto& transactionInfo = transactionInfos[0];
+		context.setValidationResult(ValidationResult::Failure, transactionInfo.EntityHash, 1);
+
+		// Act:
+		context.updater().update(transactionInfos);
+
+		// Assert: the invalid transaction was not added and all seed transactions (including the lowest priority one) survived
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), seedInfos);
+		test::AssertContainsNone(context.transactionsCache(), std::vector<Hash256>{ transactionInfo.EntityHash });
+
+		// - only the invalid transaction was reported as failed
+		EXPECT_EQ(std::vector<Hash256>({ transactionInfo.EntityHash }), context.failedHashes());
+
+		// - the invalid transaction was validated before it was added, and nothing was reapplied
+		auto expectedValidatedHashes = Duplicate(test::ExtractHashes(seedInfos));
+		expectedValidatedHashes.push_back(transactionInfo.EntityHash);
+		EXPECT_EQ(expectedValidatedHashes, context.validatedHashes());
+		EXPECT_EQ(Duplicate(test::ExtractHashes(seedInfos)), context.observedHashes());
+	}
+
+	TEST(TEST_CLASS, EvictionOnlyRevalidatesTransactionsDependentOnEvictedTransaction) {
+		// Arrange: fill the cache with unexpired transactions; tx 0 { A }, tx 1 { B }, tx 2 { A } (lowest priority)
+		UpdaterTestContext context(ThrottleMode::Off, 3);
+		IncrementalTestAddresses addresses;
+		std::vector<model::TransactionInfo> seedInfos;
+		for (const auto& address : { addresses.A, addresses.B, addresses.A }) {
+			seedInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(Default_Time.unwrap() + seedInfos.size() + 1, Seed_Fee));
+			seedInfos.back().OptionalExtractedAddresses = std::make_shared<model::AddressSet>(model::AddressSet{ address });
+		}
+
+		context.updater().update(seedInfos);
+
+		// - the new transaction { C } has a higher priority than all seed transactions
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateTransactionInfoWithDeadlineAndFee(Default_Time.unwrap() + 4, Amount(Seed_Fee.unwrap() + 1)));
+		transactionInfos[0].OptionalExtractedAddresses = std::make_shared<model::AddressSet>(model::AddressSet{ addresses.C });
+		const auto& transactionInfo = transactionInfos[0];
+
+		// Act:
+		context.updater().update(transactionInfos);
+
+		// Assert: tx 2 was evicted
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsNone(context.transactionsCache(), std::vector<Hash256>{ seedInfos[2].EntityHash });
+		EXPECT_EQ(std::vector<Hash256>({ seedInfos[2].EntityHash }), context.failedHashes());
+
+		// - only tx 0, which shares address A with the evicted transaction, was revalidated
+		auto expectedValidatedHashes = Duplicate({
+			seedInfos[0].EntityHash, seedInfos[1].EntityHash, seedInfos[2].EntityHash, transactionInfo.EntityHash,
+			seedInfos[0].EntityHash
+		});
+		EXPECT_EQ(expectedValidatedHashes, context.validatedHashes());
+
+		// - all remaining transactions were observed again
+		auto expectedObservedHashes = Duplicate({
+			seedInfos[0].EntityHash, seedInfos[1].EntityHash, seedInfos[2].EntityHash, transactionInfo.EntityHash,
+			seedInfos[0].EntityHash, seedInfos[1].EntityHash, transactionInfo.EntityHash
+		});
+		EXPECT_EQ(expectedObservedHashes, context.observedHashes());
+	}
+
+	// endregion
 }}
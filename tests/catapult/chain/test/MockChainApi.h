@@ -44,7 +44,8 @@ namespace catapult { namespace mocks {
 	public:
 		/// Creates a mock chain api around a chain \a score, a last block (\a pLastBlock) and a range of \a hashes.
 		MockChainApi(const model::ChainScore& score, std::shared_ptr<model::Block>&& pLastBlock, const model::HashRange& hashes)
-				: m_score(score)
+				: api::RemoteChainApi(test::GenerateRandomData<Key_Size>())
+				, m_score(score)
 				, m_errorEntryPoint(EntryPoint::None)
 				, m_hashes(model::HashRange::CopyRange(hashes))
 				, m_numBlocksPerBlocksFromRequest({ 2 }) {
@@ -80,6 +81,7 @@ namespace catapult { namespace mocks {
 		}
 
 		/// Adds a block (\a pBlock) to the block map.
+		/// \note Blocks-from requests return copies of blocks in the block map instead of generating random blocks.
 		void addBlock(std::unique_ptr<model::Block>&& pBlock) {
 			auto height = pBlock->Height;
 			m_blocks.emplace(height, std::move(pBlock));
@@ -185,7 +187,11 @@ namespace catapult { namespace mocks {
 			std::vector<std::unique_ptr<const model::Block>> blocks;
 			std::vector<const model::Block*> rawBlocks;
 			for (auto i = 0u; i < numBlocks; ++i) {
-				blocks.push_back(test::GenerateVerifiableBlockAtHeight(startHeight + Height(i)));
+				auto height = startHeight + Height(i);
+				auto blockIter = m_blocks.find(height);
+				blocks.push_back(m_blocks.cend() != blockIter
+						? test::CopyBlock(*blockIter->second)
+						: test::GenerateVerifiableBlockAtHeight(height));
 				rawBlocks.push_back(blocks[i].get());
 			}
 
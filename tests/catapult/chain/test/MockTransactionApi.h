@@ -35,7 +35,8 @@ namespace catapult { namespace mocks {
 	public:
 		/// Creates a transaction api around a range of \a transactions.
 		explicit MockTransactionApi(const model::TransactionRange& transactions)
-				: m_transactions(model::TransactionRange::CopyRange(transactions))
+				: api::RemoteTransactionApi(Key())
+				, m_transactions(model::TransactionRange::CopyRange(transactions))
 				, m_errorEntryPoint(EntryPoint::None)
 		{}
 
@@ -72,12 +72,16 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.ShouldAllowAddressReuse);
 			EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 			EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+			EXPECT_FALSE(config.ShouldEnableCachePatriciaTrees);
+			EXPECT_FALSE(config.ShouldUsePackedBlockStorage);
+			EXPECT_FALSE(config.ShouldEnableBlockGroupCommit);
 
 			EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(1u, config.MaxParallelSyncPeers);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -86,6 +90,10 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(1'000'000u, config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_FALSE(config.ShouldEnableIncrementalUtUpdates);
+
+			EXPECT_EQ(utils::FileSize::FromMegabytes(50), config.BlockStorageCacheMaxSize);
+			EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.StateCheckpointInterval);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
@@ -98,10 +106,13 @@ namespace catapult { namespace config {
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
 			EXPECT_EQ(16384u, config.TransactionDisruptorSize);
 			EXPECT_EQ(10u, config.TransactionElementTraceInterval);
+			EXPECT_EQ(disruptor::WaitStrategy::Blocking, config.DispatcherWaitStrategy);
 
 			EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 			EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
 			EXPECT_FALSE(config.ShouldPrecomputeTransactionAddresses);
+			EXPECT_FALSE(config.ShouldEnableParallelBlockExecution);
+			EXPECT_FALSE(config.ShouldEnableParallelCacheCommit);
 
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.OutgoingSecurityMode);
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.IncomingSecurityModes);
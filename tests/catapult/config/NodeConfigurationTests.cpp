@@ -38,12 +38,16 @@ namespace catapult { namespace config {
 							{ "shouldAllowAddressReuse", "true" },
 							{ "shouldUseSingleThreadPool", "true" },
 							{ "shouldUseCacheDatabaseStorage", "true" },
+							{ "shouldEnableCachePatriciaTrees", "true" },
+							{ "shouldUsePackedBlockStorage", "true" },
+							{ "shouldEnableBlockGroupCommit", "true" },
 
 							{ "shouldEnableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxParallelSyncPeers", "3" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -52,6 +56,10 @@ namespace catapult { namespace config {
 
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98'763" },
+							{ "shouldEnableIncrementalUtUpdates", "true" },
+
+							{ "blockStorageCacheMaxSize", "12MB" },
+							{ "stateCheckpointInterval", "7m" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -64,10 +72,13 @@ namespace catapult { namespace config {
 							{ "blockElementTraceInterval", "34" },
 							{ "transactionDisruptorSize", "9876" },
 							{ "transactionElementTraceInterval", "98" },
+							{ "dispatcherWaitStrategy", "SpinThenYield" },
 
 							{ "shouldAbortWhenDispatcherIsFull", "true" },
 							{ "shouldAuditDispatcherInputs", "true" },
 							{ "shouldPrecomputeTransactionAddresses", "true" },
+							{ "shouldEnableParallelBlockExecution", "true" },
+							{ "shouldEnableParallelCacheCommit", "true" },
 
 							{ "outgoingSecurityMode", "Signed" },
 							{ "incomingSecurityModes", "None, Signed" }
@@ -119,12 +130,16 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAllowAddressReuse);
 				EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 				EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_FALSE(config.ShouldEnableCachePatriciaTrees);
+				EXPECT_FALSE(config.ShouldUsePackedBlockStorage);
+				EXPECT_FALSE(config.ShouldEnableBlockGroupCommit);
 
 				EXPECT_FALSE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -133,6 +148,10 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_FALSE(config.ShouldEnableIncrementalUtUpdates);
+
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockStorageCacheMaxSize);
+				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.StateCheckpointInterval);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -145,10 +164,13 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
 				EXPECT_EQ(0u, config.TransactionDisruptorSize);
 				EXPECT_EQ(0u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(static_cast<disruptor::WaitStrategy>(0), config.DispatcherWaitStrategy);
 
 				EXPECT_FALSE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
 				EXPECT_FALSE(config.ShouldPrecomputeTransactionAddresses);
+				EXPECT_FALSE(config.ShouldEnableParallelBlockExecution);
+				EXPECT_FALSE(config.ShouldEnableParallelCacheCommit);
 
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.OutgoingSecurityMode);
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.IncomingSecurityModes);
@@ -175,12 +197,16 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAllowAddressReuse);
 				EXPECT_TRUE(config.ShouldUseSingleThreadPool);
 				EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_TRUE(config.ShouldEnableCachePatriciaTrees);
+				EXPECT_TRUE(config.ShouldUsePackedBlockStorage);
+				EXPECT_TRUE(config.ShouldEnableBlockGroupCommit);
 
 				EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(3u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -189,6 +215,10 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(98'763u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_TRUE(config.ShouldEnableIncrementalUtUpdates);
+
+				EXPECT_EQ(utils::FileSize::FromMegabytes(12), config.BlockStorageCacheMaxSize);
+				EXPECT_EQ(utils::TimeSpan::FromMinutes(7), config.StateCheckpointInterval);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
@@ -201,10 +231,13 @@ namespace catapult { namespace config {
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
 				EXPECT_EQ(9876u, config.TransactionDisruptorSize);
 				EXPECT_EQ(98u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(disruptor::WaitStrategy::Spin_Then_Yield, config.DispatcherWaitStrategy);
 
 				EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
 				EXPECT_TRUE(config.ShouldPrecomputeTransactionAddresses);
+				EXPECT_TRUE(config.ShouldEnableParallelBlockExecution);
+				EXPECT_TRUE(config.ShouldEnableParallelCacheCommit);
 
 				EXPECT_EQ(ionet::ConnectionSecurityMode::Signed, config.OutgoingSecurityMode);
 				EXPECT_EQ(ionet::ConnectionSecurityMode::None | ionet::ConnectionSecurityMode::Signed, config.IncomingSecurityModes);
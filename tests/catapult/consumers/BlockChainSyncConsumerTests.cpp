@@ -208,14 +208,21 @@ namespace catapult { namespace consumers {
 
 		struct TransactionsChangeParams {
 		public:
-			TransactionsChangeParams(const HashSet& addedTransactionHashes, const HashSet& revertedTransactionHashes)
+			TransactionsChangeParams(
+					const HashSet& addedTransactionHashes,
+					const HashSet& revertedTransactionHashes,
+					const ConfirmedStateChanges* pConfirmedStateChanges)
 					: AddedTransactionHashes(addedTransactionHashes)
 					, RevertedTransactionHashes(revertedTransactionHashes)
+					, HasConfirmedStateChanges(!!pConfirmedStateChanges)
+					, ConfirmedStateChanges(pConfirmedStateChanges ? *pConfirmedStateChanges : consumers::ConfirmedStateChanges())
 			{}
 
 		public:
 			const HashSet AddedTransactionHashes;
 			const HashSet RevertedTransactionHashes;
+			const bool HasConfirmedStateChanges;
+			const consumers::ConfirmedStateChanges ConfirmedStateChanges;
 		};
 
 		class MockTransactionsChange : public test::ParamsCapture<TransactionsChangeParams> {
@@ -223,7 +230,8 @@ namespace catapult { namespace consumers {
 			void operator()(const TransactionsChangeInfo& changeInfo) const {
 				TransactionsChangeParams params(
 						CopyHashes(changeInfo.AddedTransactionHashes),
-						CopyHashes(changeInfo.RevertedTransactionInfos));
+						CopyHashes(changeInfo.RevertedTransactionInfos),
+						changeInfo.pConfirmedStateChanges);
 				const_cast<MockTransactionsChange*>(this)->push(std::move(params));
 			}
 
@@ -255,7 +263,7 @@ namespace catapult { namespace consumers {
 
 		struct ConsumerTestContext {
 		public:
-			ConsumerTestContext()
+			explicit ConsumerTestContext(const BlockChainSyncHandlers::CommitCacheFunc& commitCache = BlockChainSyncHandlers::CommitCacheFunc())
 					: Cache(test::CreateCatapultCacheWithMarkerAccount())
 					, Storage(std::make_unique<mocks::MockMemoryBasedStorage>()) {
 				State.LastRecalculationHeight = Initial_Last_Recalculation_Height;
@@ -276,6 +284,7 @@ namespace catapult { namespace consumers {
 				handlers.TransactionsChange = [this](const auto& changeInfo) {
 					return TransactionsChange(changeInfo);
 				};
+				handlers.CommitCache = commitCache;
 
 				Consumer = CreateBlockChainSyncConsumer(Cache, State, Storage, Max_Rollback_Blocks, handlers);
 			}
@@ -674,6 +683,26 @@ namespace catapult { namespace consumers {
 		context.assertStored(input, model::ChainScore(4 * (Base_Difficulty - 1)));
 	}
 
+	TEST(TEST_CLASS, CanSyncCompatibleChainsWithCustomCacheCommit) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
+		std::vector<Height> commitHeights;
+		ConsumerTestContext context([&commitHeights](auto& cache, auto height) {
+			commitHeights.push_back(height);
+			cache.commit(height);
+		});
+		context.seedStorage(Height(7));
+		auto input = CreateInput(Height(8), 4);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: the custom commit handler was used to commit the cache
+		test::AssertContinued(result);
+		EXPECT_EQ(std::vector<Height>({ Height(11) }), commitHeights);
+		EXPECT_EQ(Height(11), context.Cache.createView().height());
+		context.assertStored(input, model::ChainScore(4 * (Base_Difficulty - 1)));
+	}
+
 	TEST(TEST_CLASS, CanSyncIncompatibleChains) {
 		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 5-8
 		ConsumerTestContext context;
@@ -917,6 +946,59 @@ namespace catapult { namespace consumers {
 		AssertHashesAreEqual(expectedRevertedHashes, txChangeParams.RevertedTransactionHashes);
 	}
 
+	TEST(TEST_CLASS, CanSyncCompatibleChains_ConfirmedStateChangesNotification) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
+		ConsumerTestContext context;
+		context.seedStorage(Height(7));
+		auto input = CreateInput(Height(8), 4);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+		context.assertStored(input, model::ChainScore(4 * (Base_Difficulty - 1)));
+
+		// - the change notification contains the account added by the processor
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		const auto& txChangeParams = context.TransactionsChange.params()[0];
+		ASSERT_TRUE(txChangeParams.HasConfirmedStateChanges);
+
+		auto sentinelAddress = context.Cache.sub<cache::AccountStateCache>().createView()->get(Sentinel_Processor_Public_Key).Address;
+		const auto& changes = txChangeParams.ConfirmedStateChanges;
+		EXPECT_EQ(model::AddressSet({ sentinelAddress }), changes.ChangedAddresses);
+
+		// - only the account state cache was changed
+		EXPECT_EQ(std::unordered_set<std::string>({ cache::AccountStateCache::Name }), changes.ChangedCacheNames);
+	}
+
+	TEST(TEST_CLASS, CanSyncIncompatibleChains_ConfirmedStateChangesNotification) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 5-8
+		ConsumerTestContext context;
+		context.seedStorage(Height(7));
+		auto input = CreateInput(Height(5), 4);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+		context.assertStored(input, model::ChainScore(Base_Difficulty - 1));
+
+		// - the change notification contains the account added by the processor
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		const auto& txChangeParams = context.TransactionsChange.params()[0];
+		ASSERT_TRUE(txChangeParams.HasConfirmedStateChanges);
+
+		auto sentinelAddress = context.Cache.sub<cache::AccountStateCache>().createView()->get(Sentinel_Processor_Public_Key).Address;
+		const auto& changes = txChangeParams.ConfirmedStateChanges;
+		EXPECT_EQ(model::AddressSet({ sentinelAddress }), changes.ChangedAddresses);
+
+		// - both the account state cache and the block difficulty cache (modified by undo) were changed
+		auto expectedCacheNames = std::unordered_set<std::string>({ cache::AccountStateCache::Name, cache::BlockDifficultyCache::Name });
+		EXPECT_EQ(expectedCacheNames, changes.ChangedCacheNames);
+	}
+
 	// endregion
 
 	// region element updates
@@ -211,6 +211,27 @@ namespace catapult { namespace consumers {
 		EXPECT_THROW(CreateBlockHashCalculatorConsumer(registry)(blockElements), catapult_runtime_error);
 	}
 
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactionsUsingCustomMerkleLevelHasher) {
+		// Arrange:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto input = CreateBlockConsumerInput(registry, 3, 4);
+		auto& blockElements = input.blocks();
+
+		auto numLevelHasherCalls = 0u;
+		auto consumer = CreateBlockHashCalculatorConsumer(registry, [&numLevelHasherCalls](const auto& inputs, auto* pHashes) {
+			++numLevelHasherCalls;
+			crypto::Sha3_256_MultiBuffer(inputs, pHashes);
+		});
+
+		// Act:
+		auto result = consumer(blockElements);
+
+		// Assert: each merkle tree with four leaves has two levels
+		test::AssertContinued(result);
+		EXPECT_EQ(3u, blockElements.size());
+		EXPECT_EQ(3u * 2, numLevelHasherCalls);
+	}
+
 	// endregion
 
 	// region BlockHashCalculatorConsumer - block transactions hash validation
@@ -351,4 +351,29 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region level hasher
+
+	TEST(TEST_CLASS, CustomLevelHasherIsCalledOncePerLevel) {
+		// Arrange:
+		std::vector<size_t> levelSizes;
+		MerkleHashBuilder builder(0, [&levelSizes](const auto& inputs, auto* pHashes) {
+			levelSizes.push_back(inputs.size());
+			Sha3_256_MultiBuffer(inputs, pHashes);
+		});
+
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		// Act:
+		Hash256 merkleHash;
+		builder.final(merkleHash);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 3, 2, 1 }), levelSizes);
+		EXPECT_EQ(MerkleHashTraits::PrepareExpected(hashes), merkleHash);
+	}
+
+	// endregion
 }}
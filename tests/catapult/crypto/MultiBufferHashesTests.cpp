@@ -0,0 +1,230 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/MultiBufferHashes.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/utils/Casting.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS MultiBufferHashesTests
+
+	// region MultiBufferHashInput
+
+	TEST(TEST_CLASS, CanCreateInputWithoutParts) {
+		// Act:
+		MultiBufferHashInput input({});
+
+		// Assert:
+		EXPECT_EQ(0u, input.size());
+		EXPECT_EQ(input.begin(), input.end());
+	}
+
+	TEST(TEST_CLASS, CanCreateInputWithMaxParts) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(100);
+
+		// Act:
+		MultiBufferHashInput input({ { buffer.data(), 10 }, { buffer.data() + 10, 20 }, { buffer.data() + 30, 70 } });
+
+		// Assert:
+		EXPECT_EQ(100u, input.size());
+		ASSERT_EQ(3, std::distance(input.begin(), input.end()));
+
+		EXPECT_EQ(buffer.data(), input.begin()[0].pData);
+		EXPECT_EQ(10u, input.begin()[0].Size);
+		EXPECT_EQ(buffer.data() + 10, input.begin()[1].pData);
+		EXPECT_EQ(20u, input.begin()[1].Size);
+		EXPECT_EQ(buffer.data() + 30, input.begin()[2].pData);
+		EXPECT_EQ(70u, input.begin()[2].Size);
+	}
+
+	TEST(TEST_CLASS, CannotCreateInputWithMoreThanMaxParts) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(100);
+
+		// Act + Assert:
+		EXPECT_THROW(
+				MultiBufferHashInput({ { buffer.data(), 10 }, { buffer.data(), 10 }, { buffer.data(), 10 }, { buffer.data(), 10 } }),
+				catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region implementation selection
+
+	TEST(TEST_CLASS, PortableImplementationIsAlwaysSupported) {
+		// Act + Assert:
+		EXPECT_TRUE(IsSupported(MultiBufferKeccakImplementation::Portable));
+	}
+
+	TEST(TEST_CLASS, DefaultImplementationIsSupported) {
+		// Act:
+		auto implementation = GetDefaultMultiBufferKeccakImplementation();
+
+		// Assert:
+		EXPECT_TRUE(IsSupported(implementation));
+	}
+
+	TEST(TEST_CLASS, CannotHashWithUnsupportedImplementation) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(100);
+		std::vector<MultiBufferHashInput> inputs{ MultiBufferHashInput({ buffer }) };
+		Hash256 hash;
+
+		for (auto implementation : { MultiBufferKeccakImplementation::Avx2, MultiBufferKeccakImplementation::Avx512 }) {
+			if (IsSupported(implementation))
+				continue;
+
+			// Act + Assert:
+			EXPECT_THROW(Sha3_256_MultiBuffer(inputs, &hash, implementation), catapult_invalid_argument);
+		}
+	}
+
+	// endregion
+
+	// region Sha3_256_MultiBuffer
+
+	namespace {
+		std::vector<MultiBufferKeccakImplementation> GetSupportedImplementations() {
+			std::vector<MultiBufferKeccakImplementation> implementations;
+			for (auto implementation : {
+				MultiBufferKeccakImplementation::Portable,
+				MultiBufferKeccakImplementation::Avx2,
+				MultiBufferKeccakImplementation::Avx512
+			}) {
+				if (IsSupported(implementation))
+					implementations.push_back(implementation);
+			}
+
+			return implementations;
+		}
+
+		Hash256 CalculateExpectedHash(const MultiBufferHashInput& input) {
+			Sha3_256_Builder builder;
+			for (const auto& part : input)
+				builder.update(part);
+
+			Hash256 hash;
+			builder.final(hash);
+			return hash;
+		}
+
+		void AssertMultiBufferHashes(const std::vector<MultiBufferHashInput>& inputs) {
+			for (auto implementation : GetSupportedImplementations()) {
+				// Act:
+				std::vector<Hash256> hashes(inputs.size());
+				Sha3_256_MultiBuffer(inputs, hashes.data(), implementation);
+
+				// Assert:
+				for (auto i = 0u; i < inputs.size(); ++i) {
+					EXPECT_EQ(CalculateExpectedHash(inputs[i]), hashes[i])
+							<< "implementation " << utils::to_underlying_type(implementation) << ", input " << i;
+				}
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, MultiBufferHashOfEmptyInputMatchesKnownHash) {
+		// Arrange:
+		std::vector<MultiBufferHashInput> inputs{ MultiBufferHashInput({}), MultiBufferHashInput({}) };
+
+		for (auto implementation : GetSupportedImplementations()) {
+			// Act:
+			std::vector<Hash256> hashes(inputs.size());
+			Sha3_256_MultiBuffer(inputs, hashes.data(), implementation);
+
+			// Assert:
+			Hash256 expectedHash;
+			Sha3_256({}, expectedHash);
+			EXPECT_EQ(expectedHash, hashes[0]);
+			EXPECT_EQ(expectedHash, hashes[1]);
+		}
+	}
+
+	TEST(TEST_CLASS, MultiBufferHashesMatchSingleHashesForAllBlockBoundaries) {
+		// Arrange: sizes around the sha3 rate (136 bytes)
+		std::vector<std::vector<uint8_t>> buffers;
+		for (auto size : { 0u, 1u, 32u, 135u, 136u, 137u, 271u, 272u, 273u, 1000u })
+			buffers.push_back(test::GenerateRandomVector(size));
+
+		std::vector<MultiBufferHashInput> inputs;
+		for (const auto& buffer : buffers)
+			inputs.push_back({ buffer });
+
+		// Act + Assert:
+		AssertMultiBufferHashes(inputs);
+	}
+
+	TEST(TEST_CLASS, MultiBufferHashesMatchSingleHashesForMultiPartInputs) {
+		// Arrange: split buffers at various offsets, including across block boundaries
+		auto buffer = test::GenerateRandomVector(500);
+		std::vector<MultiBufferHashInput> inputs;
+		for (auto split : { 0u, 1u, 64u, 135u, 136u, 200u, 499u, 500u }) {
+			auto secondSize = (500u - split) / 2;
+			inputs.push_back({
+				{ buffer.data(), split },
+				{ buffer.data() + split, secondSize },
+				{ buffer.data() + split + secondSize, 500u - split - secondSize }
+			});
+		}
+
+		// Act + Assert:
+		AssertMultiBufferHashes(inputs);
+	}
+
+	TEST(TEST_CLASS, MultiBufferHashesMatchSingleHashesForVariousNumbersOfInputs) {
+		for (auto count : { 1u, 3u, 4u, 5u, 8u, 9u, 17u }) {
+			// Arrange: use different sizes so that lanes finish at different blocks
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto i = 0u; i < count; ++i)
+				buffers.push_back(test::GenerateRandomVector((i * 97) % 600));
+
+			std::vector<MultiBufferHashInput> inputs;
+			for (const auto& buffer : buffers)
+				inputs.push_back({ buffer });
+
+			// Act + Assert:
+			AssertMultiBufferHashes(inputs);
+		}
+	}
+
+	TEST(TEST_CLASS, DefaultMultiBufferHashesMatchSingleHashes) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> buffers;
+		for (auto i = 0u; i < 10; ++i)
+			buffers.push_back(test::GenerateRandomVector(64 + i));
+
+		std::vector<MultiBufferHashInput> inputs;
+		for (const auto& buffer : buffers)
+			inputs.push_back({ buffer });
+
+		// Act:
+		std::vector<Hash256> hashes(inputs.size());
+		Sha3_256_MultiBuffer(inputs, hashes.data());
+
+		// Assert:
+		for (auto i = 0u; i < inputs.size(); ++i)
+			EXPECT_EQ(CalculateExpectedHash(inputs[i]), hashes[i]) << "input " << i;
+	}
+
+	// endregion
+}}
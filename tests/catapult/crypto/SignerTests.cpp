@@ -19,9 +19,16 @@
 **/
 
 #include "catapult/crypto/Signer.h"
+#include "catapult/crypto/CryptoUtils.h"
+#include "catapult/crypto/Hashes.h"
 #include "tests/TestHarness.h"
 #include <numeric>
 
+extern "C" {
+#include <ref10/ge.h>
+#include <ref10/sc.h>
+}
+
 namespace catapult { namespace crypto {
 
 #define TEST_CLASS SignerTests
@@ -390,4 +397,253 @@ namespace catapult { namespace crypto {
 			EXPECT_EQ(properSignature, result);
 		}
 	}
+
+	// region VerifyBatch
+
+	namespace {
+		struct BatchEntry {
+			Key PublicKey;
+			std::vector<uint8_t> Payload;
+			catapult::Signature Signature;
+		};
+
+		std::vector<BatchEntry> GenerateBatchEntries(size_t count) {
+			std::vector<BatchEntry> entries;
+			for (auto i = 0u; i < count; ++i) {
+				auto keyPair = KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+				auto payload = test::GenerateRandomVector(50 + i);
+				auto signature = SignPayload(keyPair, payload);
+				entries.push_back(BatchEntry{ keyPair.publicKey(), std::move(payload), signature });
+			}
+
+			return entries;
+		}
+
+		std::vector<SignatureInput> ToSignatureInputs(const std::vector<BatchEntry>& entries) {
+			std::vector<SignatureInput> inputs;
+			for (const auto& entry : entries)
+				inputs.push_back({ entry.PublicKey, entry.Payload, entry.Signature });
+
+			return inputs;
+		}
+
+		std::vector<bool> VerifyEntries(const std::vector<BatchEntry>& entries) {
+			return VerifyBatch(ToSignatureInputs(entries));
+		}
+
+		std::vector<bool> VerifyEntriesIndividually(const std::vector<BatchEntry>& entries) {
+			std::vector<bool> results;
+			for (const auto& entry : entries)
+				results.push_back(Verify(entry.PublicKey, entry.Payload, entry.Signature));
+
+			return results;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyBatchReturnsNoResultsWhenInputsAreEmpty) {
+		// Act:
+		auto results = VerifyBatch({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	namespace {
+		void AssertBatchOfValidSignaturesCanBeVerified(size_t count) {
+			// Arrange:
+			auto entries = GenerateBatchEntries(count);
+
+			// Act:
+			auto results = VerifyEntries(entries);
+
+			// Assert:
+			EXPECT_EQ(std::vector<bool>(count, true), results) << "count " << count;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyBatchCanVerifySingleValidSignature) {
+		AssertBatchOfValidSignaturesCanBeVerified(1);
+	}
+
+	TEST(TEST_CLASS, VerifyBatchCanVerifyMultipleValidSignatures) {
+		AssertBatchOfValidSignaturesCanBeVerified(2);
+		AssertBatchOfValidSignaturesCanBeVerified(10);
+	}
+
+	TEST(TEST_CLASS, VerifyBatchCanVerifyValidSignaturesSpanningMultipleChunks) {
+		AssertBatchOfValidSignaturesCanBeVerified(150);
+	}
+
+	TEST(TEST_CLASS, VerifyBatchRejectsOnlyInvalidSignatures) {
+		// Arrange: invalidate a few signatures in different ways
+		auto entries = GenerateBatchEntries(100);
+		entries[3].Payload[0] ^= 0xFF;
+		entries[17].Signature[0] ^= 0xFF;
+		entries[42].Signature[Signature_Size - 1] ^= 0x01;
+		entries[43].Signature = entries[44].Signature;
+		entries[99].Payload.push_back(0);
+
+		// Act:
+		auto results = VerifyEntries(entries);
+
+		// Assert:
+		std::vector<bool> expectedResults(entries.size(), true);
+		for (auto index : { 3u, 17u, 42u, 43u, 99u })
+			expectedResults[index] = false;
+
+		EXPECT_EQ(expectedResults, results);
+		EXPECT_EQ(VerifyEntriesIndividually(entries), results);
+	}
+
+	TEST(TEST_CLASS, VerifyBatchRejectsSignatureWithMismatchedPublicKey) {
+		// Arrange:
+		auto entries = GenerateBatchEntries(10);
+		entries[5].PublicKey = GetAlteredKeyPair().publicKey();
+
+		// Act:
+		auto results = VerifyEntries(entries);
+
+		// Assert:
+		std::vector<bool> expectedResults(entries.size(), true);
+		expectedResults[5] = false;
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	TEST(TEST_CLASS, VerifyBatchRejectsNonCanonicalSignature) {
+		// Arrange:
+		auto entries = GenerateBatchEntries(10);
+		ScalarAddGroupOrder(entries[4].Signature.data() + Signature_Size / 2);
+
+		// Act:
+		auto results = VerifyEntries(entries);
+
+		// Assert:
+		std::vector<bool> expectedResults(entries.size(), true);
+		expectedResults[4] = false;
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	TEST(TEST_CLASS, VerifyBatchRejectsNonCanonicalREncoding) {
+		// Arrange: R is set to a non-canonical encoding of the neutral element (x = 0 with sign bit set)
+		auto entries = GenerateBatchEntries(10);
+		std::fill(entries[6].Signature.begin(), entries[6].Signature.begin() + Signature_Size / 2, static_cast<uint8_t>(0));
+		entries[6].Signature[0] = 0x01;
+		entries[6].Signature[Signature_Size / 2 - 1] = 0x80;
+
+		// Act:
+		auto results = VerifyEntries(entries);
+
+		// Assert:
+		std::vector<bool> expectedResults(entries.size(), true);
+		expectedResults[6] = false;
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	TEST(TEST_CLASS, VerifyBatchRejectsZeroPublicKey) {
+		// Arrange:
+		auto entries = GenerateBatchEntries(10);
+		Key zeroKey{};
+		std::vector<SignatureInput> inputs;
+		for (auto i = 0u; i < entries.size(); ++i)
+			inputs.push_back({ 2 == i ? zeroKey : entries[i].PublicKey, entries[i].Payload, entries[i].Signature });
+
+		// Act:
+		auto results = VerifyBatch(inputs);
+
+		// Assert:
+		std::vector<bool> expectedResults(entries.size(), true);
+		expectedResults[2] = false;
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	namespace {
+		// signs \a payload with \a keyPair like Sign but adds a point of order two to R
+		Signature SignWithSmallOrderComponentInR(const KeyPair& keyPair, const std::vector<uint8_t>& payload) {
+			Signature signature;
+			auto* encodedR = signature.data();
+			auto* encodedS = signature.data() + Signature_Size / 2;
+
+			Hash512 privHash;
+			HashPrivateKey(keyPair.privateKey(), privHash);
+			privHash[0] &= 0xF8;
+			privHash[31] &= 0x7F;
+			privHash[31] |= 0x40;
+
+			auto r = test::GenerateRandomData<Hash512_Size>();
+			sc_reduce(r.data());
+
+			// R = r * B + (0, -1)
+			ge_p3 rMulBase;
+			ge_scalarmult_base(&rMulBase, r.data());
+
+			auto encodedOrderTwoPoint = test::ToArray<Signature_Size / 2>("ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f");
+			ge_p3 orderTwoPoint;
+			ge_frombytes_negate_vartime(&orderTwoPoint, encodedOrderTwoPoint.data());
+			ge_cached orderTwoPointCached;
+			ge_p3_to_cached(&orderTwoPointCached, &orderTwoPoint);
+
+			ge_p1p1 sum;
+			ge_p3 R;
+			ge_add(&sum, &rMulBase, &orderTwoPointCached);
+			ge_p1p1_to_p3(&R, &sum);
+			ge_p3_tobytes(encodedR, &R);
+
+			// S = (r + H(R || A || payload) * a) mod group order
+			Hash512 h;
+			Sha3_512_Builder sha3_h;
+			sha3_h.update({ { encodedR, Signature_Size / 2 }, keyPair.publicKey(), payload });
+			sha3_h.final(h);
+			sc_reduce(h.data());
+			sc_muladd(encodedS, h.data(), privHash.data(), r.data());
+			return signature;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyBatchRejectsSignatureWithSmallOrderComponentInR) {
+		// Arrange: a combined check without special handling accepts such a signature whenever its random coefficient is even
+		auto entries = GenerateBatchEntries(10);
+		auto keyPair = KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+		entries[3].PublicKey = keyPair.publicKey();
+		entries[3].Signature = SignWithSmallOrderComponentInR(keyPair, entries[3].Payload);
+
+		std::vector<bool> expectedResults(entries.size(), true);
+		expectedResults[3] = false;
+
+		// Sanity:
+		EXPECT_EQ(expectedResults, VerifyEntriesIndividually(entries));
+
+		for (auto i = 0u; i < 20; ++i) {
+			// Act:
+			auto results = VerifyEntries(entries);
+
+			// Assert:
+			EXPECT_EQ(expectedResults, results) << "iteration " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyBatchPassesTestVectors) {
+		// Arrange:
+		auto input = GetTestVectorsInput();
+
+		std::vector<Key> publicKeys;
+		std::vector<std::vector<uint8_t>> payloads;
+		std::vector<Signature> signatures;
+		for (auto i = 0u; i < input.InputData.size(); ++i) {
+			publicKeys.push_back(KeyPair::FromString(input.PrivateKeys[i]).publicKey());
+			payloads.push_back(test::ToVector(input.InputData[i]));
+			signatures.push_back(test::ToArray<Signature_Size>(input.ExpectedSignatures[i]));
+		}
+
+		std::vector<SignatureInput> inputs;
+		for (auto i = 0u; i < publicKeys.size(); ++i)
+			inputs.push_back({ publicKeys[i], payloads[i], signatures[i] });
+
+		// Act:
+		auto results = VerifyBatch(inputs);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(inputs.size(), true), results);
+	}
+
+	// endregion
 }}
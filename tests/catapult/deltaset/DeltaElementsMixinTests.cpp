@@ -115,4 +115,50 @@ namespace catapult { namespace deltaset {
 
 	DEFINE_DELTA_ELEMENTS_MIXIN_TESTS(MutableTraits, _Mutable)
 	DEFINE_DELTA_ELEMENTS_MIXIN_TESTS(MutablePointerTraits, _MutablePointer)
+
+	// region set-based delta
+
+	namespace {
+		using OrderedSetImmutableTraits = test::BaseSetTraits<
+			test::ImmutableElementValueTraits,
+			test::OrderedSetTraits<test::SetElementType<test::ImmutableElementValueTraits>>>;
+
+		using SetDeltaElementsMixin = DeltaElementsMixin<OrderedSetImmutableTraits::DeltaType>;
+
+		template<typename TContainer>
+		std::set<unsigned int> ExtractValues(const TContainer& pointers) {
+			std::set<unsigned int> values;
+			for (const auto* pElement : pointers)
+				values.insert(pElement->Value);
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, CanAccessAddedAndRemovedElementsOfSetBasedDelta) {
+		// Arrange:
+		OrderedSetImmutableTraits::Type set;
+		{
+			auto pDelta = set.rebase();
+			for (auto i = 1u; i <= 3; ++i)
+				pDelta->insert(test::ImmutableTestElement("", i));
+
+			set.commit();
+		}
+
+		auto pDelta = set.rebase();
+		pDelta->insert(test::ImmutableTestElement("", 4));
+		pDelta->insert(test::ImmutableTestElement("", 5));
+		pDelta->remove(test::ImmutableTestElement("", 2));
+
+		// Act:
+		SetDeltaElementsMixin mixin(*pDelta);
+
+		// Assert:
+		EXPECT_EQ(std::set<unsigned int>({ 4, 5 }), ExtractValues(mixin.addedElements()));
+		EXPECT_EQ(std::set<unsigned int>(), ExtractValues(mixin.modifiedElements()));
+		EXPECT_EQ(std::set<unsigned int>({ 2 }), ExtractValues(mixin.removedElements()));
+	}
+
+	// endregion
 }}
@@ -125,6 +125,19 @@ DEFINE_IMMUTABLE_BASE_SET_TESTS_FOR(OrderedSetImmutablePointer);
 		});
 	}
 
+	ORDERED_SET_TEST(CommitPruningElementsIncrementsGeneration) {
+		// Arrange:
+		auto pSet = TTraits::CreateWithElements(5);
+		auto pDelta = pSet->rebase();
+		auto initialGeneration = pSet->generation();
+
+		// Act: prune without any other changes
+		CommitWithPruning(*pSet, TTraits::CreateElement("TestElement", 3));
+
+		// Assert:
+		EXPECT_EQ(initialGeneration + 1, pSet->generation());
+	}
+
 	ORDERED_SET_TEST(CommitIsNullOperationIfPruningBoundaryIsEqualToFirstSetElement) {
 		// Arrange:
 		auto pSet = TTraits::CreateWithElements(5);
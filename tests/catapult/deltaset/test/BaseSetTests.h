@@ -206,6 +206,54 @@ namespace catapult { namespace test {
 		}
 
 		// endregion
+
+		// region generation
+
+		static void AssertGenerationIsInitiallyZero() {
+			// Act:
+			auto pBaseSet = TTraits::Create();
+
+			// Assert:
+			EXPECT_EQ(0u, pBaseSet->generation());
+		}
+
+		static void AssertCommitWithChangesIncrementsGeneration() {
+			// Arrange:
+			auto pBaseSet = TTraits::CreateWithElements(3);
+			auto pDelta = pBaseSet->rebase();
+			auto initialGeneration = pBaseSet->generation();
+
+			// Act:
+			pDelta->emplace("MyTestElement", static_cast<unsigned int>(123));
+			TTraits::Commit(*pBaseSet);
+			auto generationAfterInsert = pBaseSet->generation();
+
+			pDelta->remove(TTraits::CreateKey("TestElement", 0));
+			TTraits::Commit(*pBaseSet);
+			auto generationAfterRemove = pBaseSet->generation();
+
+			// Assert:
+			EXPECT_EQ(initialGeneration + 1, generationAfterInsert);
+			EXPECT_EQ(initialGeneration + 2, generationAfterRemove);
+		}
+
+		static void AssertCommitWithoutChangesDoesNotIncrementGeneration() {
+			// Arrange:
+			auto pBaseSet = TTraits::CreateWithElements(3);
+			auto pDelta = pBaseSet->rebase();
+			pDelta->emplace("MyTestElement", static_cast<unsigned int>(123));
+			TTraits::Commit(*pBaseSet);
+			auto generationAfterInsert = pBaseSet->generation();
+
+			// Act:
+			for (auto i = 0u; i < 5; ++i)
+				TTraits::Commit(*pBaseSet);
+
+			// Assert:
+			EXPECT_EQ(generationAfterInsert, pBaseSet->generation());
+		}
+
+		// endregion
 	};
 
 #define MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, TEST_NAME) \
@@ -226,7 +274,11 @@ namespace catapult { namespace test {
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CannotCommitWhenThereAreNoPendingAttachedDeltas) \
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitThrowsIfOnlyDetachedDeltasAreOutstanding) \
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitCommitsToOriginalElements) \
-	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitIsIdempotent)
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitIsIdempotent) \
+	\
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, GenerationIsInitiallyZero) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitWithChangesIncrementsGeneration) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitWithoutChangesDoesNotIncrementGeneration)
 
 #define DEFINE_MUTABLE_BASE_SET_TESTS(TEST_CLASS, TRAITS) \
 	DEFINE_BASE_SET_TESTS(TEST_CLASS, TRAITS) \
@@ -430,6 +430,58 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	namespace {
+		void AssertCanConsumeAndInspectAllElementsWithWaitStrategy(WaitStrategy waitStrategy) {
+			// Arrange:
+			auto ranges = test::PrepareRanges(5);
+			auto expectedHeights = GetExpectedHeights(ranges);
+			std::vector<Heights> collectedHeights[2];
+			std::vector<Heights> inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			// Act:
+			ConsumerDispatcher dispatcher(
+					options,
+					{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// - push multiple elements
+			ProcessAll(dispatcher, std::move(ranges));
+			WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+			// Assert:
+			EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+			EXPECT_EQ(expectedHeights, collectedHeights[0]);
+			EXPECT_EQ(expectedHeights, collectedHeights[1]);
+			EXPECT_EQ(expectedHeights, inspectedHeights);
+			EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+		}
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithSleepWaitStrategy) {
+		// Assert:
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(WaitStrategy::Sleep);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithBusySpinWaitStrategy) {
+		// Assert:
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(WaitStrategy::Busy_Spin);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithSpinThenYieldWaitStrategy) {
+		// Assert:
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(WaitStrategy::Spin_Then_Yield);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithBlockingWaitStrategy) {
+		// Assert:
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(WaitStrategy::Blocking);
+	}
+
 	// endregion
 
 	// region element marking
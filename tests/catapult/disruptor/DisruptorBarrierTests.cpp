@@ -20,6 +20,7 @@
 
 #include "catapult/disruptor/DisruptorBarrier.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -45,4 +46,48 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	TEST(TEST_CLASS, WaitForReturnsImmediatelyWhenPositionIsDifferent) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act: timeout is long enough to cause test failure if wait blocks
+		barrier.waitFor(0, std::chrono::milliseconds(60'000));
+
+		// Assert:
+		EXPECT_EQ(1u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, WaitForReturnsAfterTimeoutWhenPositionIsUnchanged) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		barrier.waitFor(1, std::chrono::milliseconds(5));
+
+		// Assert:
+		EXPECT_EQ(1u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, AdvanceWakesUpWaitingThreads) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+		std::atomic<size_t> numWokenThreads(0);
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < 3; ++i) {
+			threads.emplace_back([&barrier, &numWokenThreads]() {
+				barrier.waitFor(1, std::chrono::milliseconds(60'000));
+				++numWokenThreads;
+			});
+		}
+
+		// Act:
+		barrier.advance();
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_EQ(3u, numWokenThreads);
+		EXPECT_EQ(2u, barrier.position());
+	}
 }}
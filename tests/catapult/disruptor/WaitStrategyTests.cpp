@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/WaitStrategy.h"
+#include "catapult/disruptor/DisruptorBarrier.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS WaitStrategyTests
+
+	// region parsing
+
+	TEST(TEST_CLASS, CanParseValidWaitStrategy) {
+		// Arrange:
+		auto assertSuccessfulParse = [](const auto& input, const auto& expectedParsedValue) {
+			test::AssertParse(input, expectedParsedValue, [](const auto& str, auto& parsedValue) {
+				return TryParseValue(str, parsedValue);
+			});
+		};
+
+		// Assert:
+		assertSuccessfulParse("Sleep", WaitStrategy::Sleep);
+		assertSuccessfulParse("BusySpin", WaitStrategy::Busy_Spin);
+		assertSuccessfulParse("SpinThenYield", WaitStrategy::Spin_Then_Yield);
+		assertSuccessfulParse("Blocking", WaitStrategy::Blocking);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidWaitStrategy) {
+		// Assert:
+		test::AssertEnumParseFailure("Blocking", WaitStrategy::Sleep, [](const auto& str, auto& parsedValue) {
+			return TryParseValue(str, parsedValue);
+		});
+	}
+
+	// endregion
+
+	// region WaitForBarrier
+
+	namespace {
+		void AssertWaitReturnsWithoutBarrierAdvance(WaitStrategy strategy, size_t numIdleIterations) {
+			// Arrange:
+			DisruptorBarrier barrier(0, 5);
+
+			// Act: wait should return even though the barrier was not advanced
+			WaitForBarrier(strategy, barrier, 5, numIdleIterations);
+
+			// Assert:
+			EXPECT_EQ(5u, barrier.position());
+		}
+	}
+
+	TEST(TEST_CLASS, SleepWaitReturnsWithoutBarrierAdvance) {
+		// Assert:
+		AssertWaitReturnsWithoutBarrierAdvance(WaitStrategy::Sleep, 0);
+	}
+
+	TEST(TEST_CLASS, BusySpinWaitReturnsWithoutBarrierAdvance) {
+		// Assert:
+		AssertWaitReturnsWithoutBarrierAdvance(WaitStrategy::Busy_Spin, 0);
+		AssertWaitReturnsWithoutBarrierAdvance(WaitStrategy::Busy_Spin, 100'000);
+	}
+
+	TEST(TEST_CLASS, SpinThenYieldWaitReturnsWithoutBarrierAdvance) {
+		// Assert:
+		AssertWaitReturnsWithoutBarrierAdvance(WaitStrategy::Spin_Then_Yield, 0);
+		AssertWaitReturnsWithoutBarrierAdvance(WaitStrategy::Spin_Then_Yield, 100'000);
+	}
+
+	TEST(TEST_CLASS, BlockingWaitReturnsWithoutBarrierAdvanceAfterTimeout) {
+		// Assert:
+		AssertWaitReturnsWithoutBarrierAdvance(WaitStrategy::Blocking, 0);
+	}
+
+	TEST(TEST_CLASS, BlockingWaitReturnsImmediatelyWhenBarrierHasAlreadyAdvanced) {
+		// Arrange:
+		DisruptorBarrier barrier(0, 5);
+		barrier.advance();
+
+		// Act + Assert: no deadlock
+		WaitForBarrier(WaitStrategy::Blocking, barrier, 5, 0);
+		EXPECT_EQ(6u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, BlockingWaitIsWokenUpByBarrierAdvance) {
+		// Arrange:
+		DisruptorBarrier barrier(0, 5);
+		std::atomic<size_t> numWaits(0);
+		std::atomic_bool isAdvanced(false);
+		std::thread waiter([&barrier, &numWaits, &isAdvanced]() {
+			while (!isAdvanced) {
+				WaitForBarrier(WaitStrategy::Blocking, barrier, 5, 0);
+				++numWaits;
+			}
+		});
+
+		// Act:
+		WAIT_FOR_EXPR(numWaits > 0);
+		isAdvanced = true;
+		barrier.advance();
+		waiter.join();
+
+		// Assert:
+		EXPECT_EQ(6u, barrier.position());
+	}
+
+	// endregion
+}}
@@ -62,7 +62,7 @@ namespace catapult { namespace extensions {
 					capture.ActionApiId = apiId;
 					return thread::make_ready_future(chain::NodeInteractionResult::Success);
 				}),
-				[&capture](const auto& packetIo, const auto& registry) {
+				[&capture](const auto& packetIo, const auto&, const auto& registry) {
 					++capture.NumFactoryCalls;
 					capture.pFactoryPacketIo = &packetIo;
 					capture.pFactoryTransactionRegistry = &registry;
@@ -52,6 +52,10 @@ namespace catapult { namespace io {
 				CATAPULT_THROW_RUNTIME_ERROR("saveBlock - not supported in mock");
 			}
 
+			void saveBlocks(const std::vector<model::BlockElement>&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("saveBlocks - not supported in mock");
+			}
+
 			void dropBlocksAfter(Height) override {
 				CATAPULT_THROW_RUNTIME_ERROR("dropBlocksAfter - not supported in mock");
 			}
@@ -253,6 +257,46 @@ namespace catapult { namespace io {
 		EXPECT_EQ(pBlockElement.get(), context.subscriber().Elements[0]);
 	}
 
+	TEST(TEST_CLASS, SaveBlocksDelegatesToStorageAndPublisher) {
+		// Arrange:
+		class MockBlockStorage : public UnsupportedBlockStorage {
+		public:
+			std::vector<const std::vector<model::BlockElement>*> ElementsVectors;
+
+		public:
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				ElementsVectors.push_back(&blockElements);
+			}
+		};
+
+		class MockBlockChangeSubscriber : public UnsupportedBlockChangeSubscriber {
+		public:
+			std::vector<const model::BlockElement*> Elements;
+
+		public:
+			void notifyBlock(const model::BlockElement& blockElement) override {
+				Elements.push_back(&blockElement);
+			}
+		};
+
+		TestContext<MockBlockStorage, MockBlockChangeSubscriber> context;
+
+		auto pBlock1 = test::GenerateEmptyRandomBlock();
+		auto pBlock2 = test::GenerateEmptyRandomBlock();
+		std::vector<model::BlockElement> blockElements{ model::BlockElement(*pBlock1), model::BlockElement(*pBlock2) };
+
+		// Act:
+		context.aggregate().saveBlocks(blockElements);
+
+		// Assert: storage saves all elements at once but subscriber is notified about each element
+		ASSERT_EQ(1u, context.storage().ElementsVectors.size());
+		EXPECT_EQ(&blockElements, context.storage().ElementsVectors[0]);
+
+		ASSERT_EQ(2u, context.subscriber().Elements.size());
+		EXPECT_EQ(&blockElements[0], context.subscriber().Elements[0]);
+		EXPECT_EQ(&blockElements[1], context.subscriber().Elements[1]);
+	}
+
 	TEST(TEST_CLASS, DropBlocksAfterDelegatesToStorageAndPublisher) {
 		// Arrange:
 		class MockBlockStorage : public UnsupportedBlockStorage {
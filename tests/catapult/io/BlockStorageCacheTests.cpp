@@ -322,6 +322,206 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region in memory cache
+
+	namespace {
+		void AssertStatistics(const BlockStorageCache& cache, uint64_t numHits, uint64_t numMisses, size_t numCachedElements) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numCachedElements, statistics.NumCachedElements);
+		}
+
+		std::vector<model::BlockElement> CreateBlockElements(
+				std::vector<std::unique_ptr<model::Block>>& blocks,
+				Height startHeight,
+				size_t count) {
+			std::vector<model::BlockElement> blockElements;
+			for (auto i = 0u; i < count; ++i) {
+				blocks.push_back(test::GenerateVerifiableBlockAtHeight(startHeight + Height(i)));
+				blockElements.push_back(test::BlockToBlockElement(*blocks.back(), test::GenerateRandomData<Hash256_Size>()));
+			}
+
+			return blockElements;
+		}
+
+		uint64_t GetCachedSize(const BlockStorageCache& cache) {
+			return cache.statistics().CachedSize.bytes();
+		}
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromMegabytes(1));
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0);
+		EXPECT_EQ(0u, GetCachedSize(cache));
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementCachesBlockElementLoadedFromStorage) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromMegabytes(1));
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(5));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(5));
+
+		// Assert: the second load was served from memory
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+		AssertStatistics(cache, 1, 1, 1);
+		EXPECT_LT(0u, GetCachedSize(cache));
+	}
+
+	TEST(TEST_CLASS, LoadBlockAndLoadBlockElementShareCache) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromMegabytes(1));
+
+		// Act:
+		auto pBlock = cache.view().loadBlock(Height(5));
+		auto pBlockElement = cache.view().loadBlockElement(Height(5));
+
+		// Assert:
+		EXPECT_EQ(pBlock.get(), &pBlockElement->Block);
+		AssertStatistics(cache, 1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, SaveBlockPopulatesCache) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromMegabytes(1));
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = CreateBlockElements(blocks, Height(Delegation_Chain_Size + 1), 1);
+
+		// Act:
+		cache.modifier().saveBlock(blockElements[0]);
+		auto pBlockElement = cache.view().loadBlockElement(Height(Delegation_Chain_Size + 1));
+
+		// Assert:
+		EXPECT_EQ(*blocks[0], pBlockElement->Block);
+		EXPECT_EQ(blockElements[0].EntityHash, pBlockElement->EntityHash);
+		AssertStatistics(cache, 1, 0, 1);
+	}
+
+	TEST(TEST_CLASS, SaveBlocksPopulatesCacheWithAllBlockElementsWhenTheyFit) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromMegabytes(1));
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = CreateBlockElements(blocks, Height(Delegation_Chain_Size + 1), 4);
+
+		// Act:
+		cache.modifier().saveBlocks(blockElements);
+		for (auto i = 0u; i < blockElements.size(); ++i)
+			cache.view().loadBlockElement(Height(Delegation_Chain_Size + 1 + i));
+
+		// Assert:
+		AssertStatistics(cache, 4, 0, 4);
+	}
+
+	TEST(TEST_CLASS, SaveBlocksOnlyPopulatesCacheWithBlockElementsAtEndOfRangeThatFit) {
+		// Arrange: determine the size of a single block element
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = CreateBlockElements(blocks, Height(Delegation_Chain_Size + 1), 4);
+		uint64_t elementSize;
+		{
+			BlockStorageCache sizingCache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+			sizingCache.modifier().saveBlock(blockElements[0]);
+			elementSize = GetCachedSize(sizingCache);
+		}
+
+		// - only allow two elements to be cached
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromBytes(2 * elementSize));
+
+		// Act:
+		cache.modifier().saveBlocks(blockElements);
+
+		// Assert: only the last two elements are cached
+		AssertStatistics(cache, 0, 0, 2);
+		cache.view().loadBlockElement(Height(Delegation_Chain_Size + 4));
+		cache.view().loadBlockElement(Height(Delegation_Chain_Size + 3));
+		AssertStatistics(cache, 2, 0, 2);
+	}
+
+	TEST(TEST_CLASS, CacheEvictsLeastRecentlyUsedBlockElements) {
+		// Arrange: determine the size of a single block element
+		uint64_t elementSize;
+		{
+			BlockStorageCache sizingCache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+			sizingCache.view().loadBlockElement(Height(2));
+			elementSize = GetCachedSize(sizingCache);
+		}
+
+		// - only allow two elements to be cached
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromBytes(2 * elementSize));
+		cache.view().loadBlockElement(Height(2));
+		cache.view().loadBlockElement(Height(3));
+		cache.view().loadBlockElement(Height(2)); // hit, marks 2 as most recently used
+
+		// Act: evicts 3
+		cache.view().loadBlockElement(Height(4));
+
+		// Assert:
+		AssertStatistics(cache, 1, 3, 2);
+		cache.view().loadBlockElement(Height(2));
+		cache.view().loadBlockElement(Height(4));
+		AssertStatistics(cache, 3, 3, 2);
+		cache.view().loadBlockElement(Height(3));
+		AssertStatistics(cache, 3, 4, 2);
+	}
+
+	TEST(TEST_CLASS, CacheAlwaysRetainsMostRecentBlockElement) {
+		// Arrange: disable caching of all but a single element
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+
+		// Act:
+		cache.view().loadBlockElement(Height(2));
+		cache.view().loadBlockElement(Height(3));
+		cache.view().loadBlockElement(Height(3));
+
+		// Assert:
+		AssertStatistics(cache, 1, 2, 1);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterInvalidatesCachedBlockElementsAboveHeight) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromMegabytes(1));
+		for (auto height : { 5u, 6u, 7u, 8u, 9u })
+			cache.view().loadBlockElement(Height(height));
+
+		// Act:
+		cache.modifier().dropBlocksAfter(Height(7));
+
+		// Assert:
+		AssertStatistics(cache, 0, 5, 3);
+		for (auto height : { 5u, 6u, 7u })
+			cache.view().loadBlockElement(Height(height));
+
+		AssertStatistics(cache, 3, 5, 3);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterDoesNotServeStaleBlockElements) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), utils::FileSize::FromMegabytes(1));
+		cache.view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = CreateBlockElements(blocks, Height(Delegation_Chain_Size), 1);
+
+		// Act: replace the last block
+		{
+			auto modifier = cache.modifier();
+			modifier.dropBlocksAfter(Height(Delegation_Chain_Size - 1));
+			modifier.saveBlock(blockElements[0]);
+		}
+
+		auto pBlockElement = cache.view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		// Assert:
+		EXPECT_EQ(*blocks[0], pBlockElement->Block);
+		EXPECT_EQ(blockElements[0].EntityHash, pBlockElement->EntityHash);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
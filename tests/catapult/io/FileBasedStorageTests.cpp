@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/PodIoUtils.h"
 #include "tests/catapult/io/test/BlockStorageTestUtils.h"
 #include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
@@ -95,6 +96,125 @@ namespace catapult { namespace io {
 		test::AssertEqual(element2, *pBlockElement2);
 	}
 
+	// region chain height
+
+	TEST(TEST_CLASS, ChainHeightIsReadFromIndexFileOnlyDuringConstruction) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<FileBasedTraits>(10);
+
+		// Act: change the persisted height behind the back of the storage
+		{
+			RawFile indexFile(pStorage.pTempDirectoryGuard->name() + "/index.dat", OpenMode::Read_Write);
+			Write64(indexFile, 5);
+		}
+
+		// Assert:
+		EXPECT_EQ(Height(10), pStorage->chainHeight());
+		EXPECT_EQ(Height(5), FileBasedStorage(pStorage.pTempDirectoryGuard->name()).chainHeight());
+	}
+
+	TEST(TEST_CLASS, ChainHeightChangesArePersisted) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<FileBasedTraits>(10);
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(7));
+
+		// Assert:
+		EXPECT_EQ(Height(7), pStorage->chainHeight());
+		EXPECT_EQ(Height(7), FileBasedStorage(pStorage.pTempDirectoryGuard->name()).chainHeight());
+	}
+
+	// endregion
+
+	// region saveBlocks
+
+	namespace {
+		struct SaveBlocksContext {
+		public:
+			explicit SaveBlocksContext(Height startHeight, size_t numBlocks) {
+				for (auto i = 0u; i < numBlocks; ++i) {
+					Blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(startHeight + Height(i)));
+					BlockElements.push_back(test::CreateBlockElementForSaveTests(*Blocks.back()));
+				}
+			}
+
+		public:
+			std::vector<std::unique_ptr<model::Block>> Blocks;
+			std::vector<model::BlockElement> BlockElements;
+		};
+
+		void AssertCanSaveBlocks(FileBasedStorageCommitMode commitMode, Height startHeight) {
+			// Arrange:
+			TempDirectoryGuard tempDir;
+			FileBasedTraits::PrepareStorage(tempDir.name(), startHeight);
+			FileBasedStorage storage(tempDir.name(), commitMode);
+			SaveBlocksContext context(startHeight, 10);
+
+			// Act:
+			storage.saveBlocks(context.BlockElements);
+
+			// Assert:
+			auto endHeight = startHeight + Height(9);
+			EXPECT_EQ(endHeight, storage.chainHeight());
+			EXPECT_EQ(endHeight, FileBasedStorage(tempDir.name()).chainHeight());
+
+			auto hashes = storage.loadHashesFrom(startHeight, 100);
+			ASSERT_EQ(10u, hashes.size());
+
+			auto i = 0u;
+			for (const auto& hash : hashes) {
+				const auto& expectedBlockElement = context.BlockElements[i];
+				test::AssertEqual(expectedBlockElement, *storage.loadBlockElement(startHeight + Height(i)));
+				EXPECT_EQ(expectedBlockElement.EntityHash, hash) << "hash at " << i;
+				++i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, SaveBlocks_CanSaveMultipleBlocks_PerBlock) {
+		// Assert:
+		AssertCanSaveBlocks(FileBasedStorageCommitMode::Per_Block, Height(2));
+	}
+
+	TEST(TEST_CLASS, SaveBlocks_CanSaveMultipleBlocks_Group) {
+		// Assert:
+		AssertCanSaveBlocks(FileBasedStorageCommitMode::Group, Height(2));
+	}
+
+	TEST(TEST_CLASS, SaveBlocks_CanSaveMultipleBlocksCrossingHashFileBoundary_Group) {
+		// Assert:
+		AssertCanSaveBlocks(FileBasedStorageCommitMode::Group, Height(65530));
+	}
+
+	TEST(TEST_CLASS, SaveBlocks_CannotSaveBlocksWithNonConsecutiveHeights_Group) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		FileBasedTraits::PrepareStorage(tempDir.name());
+		FileBasedStorage storage(tempDir.name(), FileBasedStorageCommitMode::Group);
+		SaveBlocksContext context(Height(2), 3);
+		context.Blocks[2]->Height = Height(5);
+
+		// Act + Assert: no blocks are saved
+		EXPECT_THROW(storage.saveBlocks(context.BlockElements), catapult_invalid_argument);
+		EXPECT_EQ(Height(1), storage.chainHeight());
+		EXPECT_FALSE(boost::filesystem::exists(tempDir.name() + "/00000/00002.dat"));
+	}
+
+	TEST(TEST_CLASS, SaveBlocks_CanSaveZeroBlocks_Group) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<FileBasedTraits>(10);
+		FileBasedStorage storage(pStorage.pTempDirectoryGuard->name(), FileBasedStorageCommitMode::Group);
+
+		// Act:
+		storage.saveBlocks({});
+
+		// Assert:
+		EXPECT_EQ(Height(10), storage.chainHeight());
+	}
+
+	// endregion
+
 	namespace {
 		// note: for test purposes, hardcoded 00000 dir is ok
 		auto GetPath(const std::string& baseDirectory, uint64_t height) {
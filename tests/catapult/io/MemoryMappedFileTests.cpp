@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+using catapult::test::TempFileGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		void WriteToFile(const std::string& name, const std::vector<uint8_t>& data) {
+			RawFile file(name, OpenMode::Read_Write);
+			file.write(data);
+		}
+	}
+
+	TEST(TEST_CLASS, MappingNonExistingFileThrows) {
+		// Arrange:
+		TempFileGuard guard("abcdefghijklmnopqrstuvwxyz");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteToFile(guard.name(), {});
+
+		// Act:
+		MemoryMappedFile file(guard.name());
+
+		// Assert:
+		EXPECT_FALSE(!!file.data());
+		EXPECT_EQ(0u, file.size());
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(1234);
+		WriteToFile(guard.name(), data);
+
+		// Act:
+		MemoryMappedFile file(guard.name());
+
+		// Assert:
+		ASSERT_EQ(data.size(), file.size());
+		EXPECT_TRUE(0 == std::memcmp(data.data(), file.data(), data.size()));
+	}
+
+	TEST(TEST_CLASS, MappingCoversFileSizeAtConstruction) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(1234);
+		WriteToFile(guard.name(), data);
+
+		// Act:
+		MemoryMappedFile file(guard.name());
+		{
+			RawFile rawFile(guard.name(), OpenMode::Read_Append);
+			rawFile.seek(rawFile.size());
+			rawFile.write(test::GenerateRandomVector(100));
+		}
+
+		// Assert:
+		ASSERT_EQ(data.size(), file.size());
+		EXPECT_TRUE(0 == std::memcmp(data.data(), file.data(), data.size()));
+	}
+}}
@@ -0,0 +1,364 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/PackedFileStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/RawFile.h"
+#include "tests/catapult/io/test/BlockStorageTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+using catapult::test::TempDirectoryGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS PackedFileStorageTests
+
+	namespace {
+		constexpr auto Blocks_Per_Segment = PackedFileStorage::Blocks_Per_Segment;
+
+		void FakeHeight(const std::string& destination, uint64_t height) {
+			std::vector<uint8_t> data(height * Hash256_Size);
+			{
+				RawFile file(destination + "/00000.hashes", OpenMode::Read_Write);
+				file.write(data);
+			}
+
+			--height;
+			{
+				RawFile file(destination + "/packed_index.dat", OpenMode::Read_Write);
+				Write64(file, height);
+			}
+		}
+
+		struct PackedTraits {
+			using Guard = TempDirectoryGuard;
+			using StorageType = PackedFileStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				// import the nemesis block from a file based seed
+				test::PrepareStorage(destination);
+				OpenStorage(destination);
+
+				if (Height() != height)
+					FakeHeight(destination, height.unwrap());
+
+				return OpenStorage(destination);
+			}
+		};
+
+		bool SegmentFileExists(const std::string& baseDirectory, const std::string& filename) {
+			return boost::filesystem::exists(baseDirectory + "/" + filename);
+		}
+	}
+
+	// region BlockStorage
+
+	// StorageSeedInitiallyContainsNemesisBlock is replaced by PreparedStorageContainsNemesisBlock because opening the seed would import it
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, SavingBlockWithHeightHigherThanChainHeightAltersChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CanOverwriteBlockWithSameData)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CanOverwriteBlockWithDifferentData)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CannotSaveBlockWithHeightLessThanChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CannotSaveBlockAtChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CannotSaveBlockMoreThanOneHeightBeyondChainHeight)
+
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CanLoadAtHeightLessThanChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CanLoadAtChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CannotLoadAtHeightGreaterThanChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CanLoadMultipleSaved)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CanDropBlocksAfterHeight)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsZeroHashesWhenRequestHeightIsZero)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsZeroHashesWhenRequestHeightIsLargerThanLocalHeight)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_CanLoadASingleHash)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_CanLoadLastHash)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsAtMostMaxHashes)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsAreBoundedByLastBlock)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsCanCrossIndexFileBoundary)
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, EmptyStorageHasHeightOne) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+
+		// Act:
+		PackedFileStorage storage(tempDir.name());
+
+		// Assert: height matches FileBasedStorage
+		EXPECT_EQ(FileBasedStorage(tempDir.name()).chainHeight(), storage.chainHeight());
+		EXPECT_EQ(Height(1), storage.chainHeight());
+		EXPECT_FALSE(ContainsPackedFileStorage(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, PreparedStorageContainsNemesisBlock) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+		auto pNemesisBlockElement = FileBasedStorage(tempDir.name()).loadBlockElement(Height(1));
+
+		// Act:
+		auto pBlockElement = pStorage->loadBlockElement(Height(1));
+
+		// Assert:
+		EXPECT_EQ(Height(1), pStorage->chainHeight());
+		test::AssertEqual(*pNemesisBlockElement, *pBlockElement);
+		EXPECT_TRUE(ContainsPackedFileStorage(tempDir.name()));
+		EXPECT_TRUE(SegmentFileExists(tempDir.name(), "00000.blocks"));
+		EXPECT_TRUE(SegmentFileExists(tempDir.name(), "00000.offsets"));
+		EXPECT_TRUE(SegmentFileExists(tempDir.name(), "00000.hashes"));
+	}
+
+	namespace {
+		std::vector<std::shared_ptr<const model::BlockElement>> PrepareFileBasedStorageWithBlocks(const std::string& destination) {
+			test::PrepareStorage(destination);
+			FileBasedStorage storage(destination);
+			test::SeedBlocks(storage, 5);
+
+			std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+			for (auto height = Height(1); height <= storage.chainHeight(); height = height + Height(1))
+				blockElements.push_back(storage.loadBlockElement(height));
+
+			return blockElements;
+		}
+
+		void AssertBlockElements(const std::vector<std::shared_ptr<const model::BlockElement>>& expectedBlockElements, const BlockStorage& storage) {
+			ASSERT_EQ(Height(expectedBlockElements.size()), storage.chainHeight());
+			for (const auto& pExpectedBlockElement : expectedBlockElements)
+				test::AssertEqual(*pExpectedBlockElement, *storage.loadBlockElement(pExpectedBlockElement->Block.Height));
+		}
+	}
+
+	TEST(TEST_CLASS, NewStorageImportsFileBasedStorageInDataDirectory) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto blockElements = PrepareFileBasedStorageWithBlocks(tempDir.name());
+
+		// Act:
+		PackedFileStorage storage(tempDir.name());
+
+		// Assert:
+		AssertBlockElements(blockElements, storage);
+		EXPECT_EQ(blockElements.size(), storage.loadHashesFrom(Height(1), 10).size());
+	}
+
+	TEST(TEST_CLASS, NewStorageImportsFileBasedStorageInSeedDirectory) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto seedDirectory = tempDir.name() + "/seed";
+		auto blockElements = PrepareFileBasedStorageWithBlocks(seedDirectory);
+
+		// Act:
+		PackedFileStorage storage(tempDir.name(), seedDirectory);
+
+		// Assert:
+		AssertBlockElements(blockElements, storage);
+		EXPECT_TRUE(ContainsPackedFileStorage(tempDir.name()));
+		EXPECT_FALSE(ContainsPackedFileStorage(seedDirectory));
+	}
+
+	TEST(TEST_CLASS, ExistingStorageDoesNotImportFileBasedStorage) {
+		// Arrange: prepare a packed storage with a nemesis block and then add blocks to the file based storage
+		TempDirectoryGuard tempDir;
+		PackedTraits::PrepareStorage(tempDir.name());
+		{
+			FileBasedStorage fileBasedStorage(tempDir.name());
+			test::SeedBlocks(fileBasedStorage, 5);
+		}
+
+		// Act:
+		PackedFileStorage storage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(1), storage.chainHeight());
+	}
+
+	TEST(TEST_CLASS, StorageDoesNotShareIndexWithFileBasedStorage) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+
+		// Act:
+		test::SeedBlocks(*pStorage, 5);
+
+		// Assert: the file based storage (containing only the nemesis block) is unchanged
+		EXPECT_EQ(Height(5), pStorage->chainHeight());
+		EXPECT_EQ(Height(1), FileBasedStorage(tempDir.name()).chainHeight());
+	}
+
+	// endregion
+
+	// region persistence
+
+	TEST(TEST_CLASS, CanReadMultipleSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pBlock1 = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactionsAtHeight(Height(3));
+		auto element1 = test::BlockToBlockElement(*pBlock1, test::GenerateRandomData<Hash256_Size>());
+		auto element2 = test::BlockToBlockElement(*pBlock2, test::GenerateRandomData<Hash256_Size>());
+		{
+			auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element1);
+			pStorage->saveBlock(element2);
+		}
+
+		// Act:
+		PackedFileStorage storage(tempDir.name());
+		auto pBlockElement1 = storage.loadBlockElement(Height(2));
+		auto pBlockElement2 = storage.loadBlockElement(Height(3));
+
+		// Assert:
+		EXPECT_EQ(Height(3), storage.chainHeight());
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockIsNotAffectedBySubsequentOverwrite) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<PackedTraits>(10);
+		auto pBlockElement = pStorage->loadBlockElement(Height(10));
+		auto pOriginalBlock = test::CopyBlock(pBlockElement->Block);
+
+		// Act: drop and overwrite the loaded block
+		pStorage->dropBlocksAfter(Height(9));
+		auto pNewBlock = test::GenerateBlockWithTransactionsAtHeight(Height(10));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+		pStorage->saveBlock(newBlockElement);
+
+		// Assert: the previously loaded block is unchanged and the new block is loaded
+		EXPECT_EQ(*pOriginalBlock, pBlockElement->Block);
+		test::AssertEqual(newBlockElement, *pStorage->loadBlockElement(Height(10)));
+	}
+
+	TEST(TEST_CLASS, CanLoadBlockSavedAfterSegmentWasMapped) {
+		// Arrange: map the segment files
+		auto pStorage = test::PrepareStorageWithBlocks<PackedTraits>(5);
+		pStorage->loadBlockElement(Height(5));
+		pStorage->loadHashesFrom(Height(1), 10);
+
+		// Act:
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(6));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		pStorage->saveBlock(blockElement);
+
+		// Assert: the new block is loaded even though it was saved after the segment files were mapped
+		test::AssertEqual(blockElement, *pStorage->loadBlockElement(Height(6)));
+		EXPECT_EQ(6u, pStorage->loadHashesFrom(Height(1), 10).size());
+	}
+
+	// endregion
+
+	// region segments
+
+	TEST(TEST_CLASS, CanLoadBlocksAcrossSegmentBoundary) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name(), Height(Blocks_Per_Segment - 2));
+
+		std::vector<model::BlockElement> blockElements;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		for (auto i = 0u; i < 4; ++i) {
+			blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(Height(Blocks_Per_Segment - 2 + i)));
+			blockElements.push_back(test::CreateBlockElementForSaveTests(*blocks.back()));
+			pStorage->saveBlock(blockElements.back());
+		}
+
+		// Act + Assert:
+		EXPECT_EQ(Height(Blocks_Per_Segment + 1), pStorage->chainHeight());
+		for (auto i = 0u; i < 4; ++i)
+			test::AssertEqual(blockElements[i], *pStorage->loadBlockElement(Height(Blocks_Per_Segment - 2 + i)));
+
+		EXPECT_TRUE(SegmentFileExists(tempDir.name(), "00001.blocks"));
+		EXPECT_TRUE(SegmentFileExists(tempDir.name(), "00001.offsets"));
+		EXPECT_TRUE(SegmentFileExists(tempDir.name(), "00001.hashes"));
+	}
+
+	// endregion
+
+	// region pruneBlocksBefore
+
+	namespace {
+		auto PrepareStorageSpanningThreeSegments(const std::string& destination) {
+			// segment 1 contains a single block (at Blocks_Per_Segment * 2 - 1) and segment 2 contains two blocks
+			auto pStorage = PackedTraits::PrepareStorage(destination, Height(Blocks_Per_Segment * 2 - 1));
+			test::SeedBlocks(*pStorage, Height(Blocks_Per_Segment * 2 - 1), Height(Blocks_Per_Segment * 2 + 1));
+			return pStorage;
+		}
+
+		void AssertBlockFiles(const std::string& baseDirectory, const std::vector<bool>& expectedExists) {
+			for (auto i = 0u; i < expectedExists.size(); ++i) {
+				auto filename = "0000" + std::to_string(i) + ".blocks";
+				EXPECT_EQ(expectedExists[i], SegmentFileExists(baseDirectory, filename)) << filename;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_DoesNotPrunePartialSegments) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PrepareStorageSpanningThreeSegments(tempDir.name());
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(Blocks_Per_Segment * 2 - 1));
+
+		// Assert:
+		EXPECT_EQ(Height(Blocks_Per_Segment * 2 + 1), pStorage->chainHeight());
+		AssertBlockFiles(tempDir.name(), { true, true, true });
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_PrunesCompleteSegmentsExceptFirst) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PrepareStorageSpanningThreeSegments(tempDir.name());
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(Blocks_Per_Segment * 2 + 1));
+
+		// Assert: hashes of pruned blocks are still available
+		EXPECT_EQ(Height(Blocks_Per_Segment * 2 + 1), pStorage->chainHeight());
+		AssertBlockFiles(tempDir.name(), { true, false, true });
+		EXPECT_TRUE(!!pStorage->loadBlockElement(Height(1)));
+		EXPECT_TRUE(!!pStorage->loadBlockElement(Height(Blocks_Per_Segment * 2)));
+		EXPECT_EQ(3u, pStorage->loadHashesFrom(Height(Blocks_Per_Segment * 2 - 1), 10).size());
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_ThrowsAtHeightAfterChainHeight) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<PackedTraits>(5);
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->pruneBlocksBefore(Height(10)), catapult_invalid_argument);
+	}
+
+	// endregion
+}}
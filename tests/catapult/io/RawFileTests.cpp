@@ -93,6 +93,40 @@ namespace catapult { namespace io {
 		EXPECT_EQ(inputData.size(), r.position());
 	}
 
+	WRITING_TRAITS_BASED_TEST(FlushDoesNotAlterSizeAndPosition) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		RawFile r(guard.name(), TTraits::Mode);
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		r.write(inputData);
+
+		// Act:
+		r.flush();
+
+		// Assert:
+		EXPECT_EQ(inputData.size(), r.size());
+		EXPECT_EQ(inputData.size(), r.position());
+	}
+
+	TEST(TEST_CLASS, FlushedDataCanBeRead) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		{
+			RawFile r(guard.name(), OpenMode::Read_Write);
+			r.write(inputData);
+			r.flush();
+		}
+
+		// Act:
+		RawFile r(guard.name(), OpenMode::Read_Only);
+		auto outputData = std::vector<uint8_t>(Default_Bytes_Written);
+		r.read(outputData);
+
+		// Assert:
+		EXPECT_EQ(inputData, outputData);
+	}
+
 	TEST(TEST_CLASS, WriteOnReadOnlyFileThrowsException) {
 		// Arrange:
 		TempFileGuard guard("test.dat");
@@ -645,4 +679,44 @@ namespace catapult { namespace io {
 		EXPECT_EQ(inputData2.size(), r.position());
 
 	}
+
+	// region FlushDirectory
+
+	TEST(TEST_CLASS, CanFlushDirectoryContainingWrittenFile) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		{
+			RawFile r(tempDir.name() + "/test.dat", OpenMode::Read_Write);
+			r.write(inputData);
+		}
+
+		// Act:
+		FlushDirectory(tempDir.name());
+
+		// Assert:
+		RawFile r(tempDir.name() + "/test.dat", OpenMode::Read_Only);
+		auto outputData = std::vector<uint8_t>(Default_Bytes_Written);
+		r.read(outputData);
+		EXPECT_EQ(inputData, outputData);
+	}
+
+	TEST(TEST_CLASS, CannotFlushNonexistentDirectory) {
+		// Act + Assert:
+		EXPECT_THROW(FlushDirectory("../nonexistent.dir"), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotFlushDirectoryWhenPathIsFile) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			RawFile r(tempDir.name() + "/test.dat", OpenMode::Read_Write);
+			r.write(test::GenerateRandomVector(Default_Bytes_Written));
+		}
+
+		// Act + Assert:
+		EXPECT_THROW(FlushDirectory(tempDir.name() + "/test.dat"), catapult_file_io_error);
+	}
+
+	// endregion
 }}
@@ -20,6 +20,7 @@
 
 #include "catapult/ionet/PacketPayload.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/SignedPacketPayloadCache.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -258,4 +259,41 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region WithSharedSigning
+
+	TEST(TEST_CLASS, PacketPayloadDoesNotShareSigningByDefault) {
+		// Act:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+		auto mergedPayload = PacketPayload::Merge(CreatePacketPointer(50), payload);
+
+		// Assert:
+		EXPECT_FALSE(!!PacketPayload().signedPayloadCache());
+		EXPECT_FALSE(!!payload.signedPayloadCache());
+		EXPECT_FALSE(!!mergedPayload.signedPayloadCache());
+	}
+
+	TEST(TEST_CLASS, CanCreatePacketPayloadWithSharedSigning) {
+		// Arrange:
+		constexpr auto Data_Size = 123u;
+		auto data = test::GenerateRandomData<Data_Size>();
+		auto originalPayload = PacketPayload(CreatePacketPointerWithData(data));
+
+		// Act:
+		auto payload = PacketPayload::WithSharedSigning(originalPayload);
+		auto payloadCopy = payload;
+
+		// Assert: the payload data is unchanged
+		test::AssertPacketHeader(payload, sizeof(PacketHeader) + Data_Size, Test_Packet_Type);
+		ASSERT_EQ(1u, payload.buffers().size());
+		EXPECT_EQ(originalPayload.buffers()[0].pData, payload.buffers()[0].pData);
+		EXPECT_EQ(Data_Size, payload.buffers()[0].Size);
+
+		// - all copies share the same cache but the original payload is unchanged
+		EXPECT_TRUE(!!payload.signedPayloadCache());
+		EXPECT_EQ(payload.signedPayloadCache(), payloadCopy.signedPayloadCache());
+		EXPECT_FALSE(!!originalPayload.signedPayloadCache());
+	}
+
+	// endregion
 }}
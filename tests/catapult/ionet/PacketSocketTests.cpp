@@ -22,6 +22,7 @@
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/WorkingBuffer.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
@@ -44,12 +45,19 @@ namespace catapult { namespace ionet {
 			return test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(1024 * 1024));
 		}
 
-		void AssertWriteSuccess(const PacketPayload& payload, const ByteBuffer& expectedPayload, uint32_t maxPacketDataSize = 0) {
+		void AssertWriteSuccess(
+				const PacketPayload& payload,
+				const ByteBuffer& expectedPayload,
+				uint32_t maxPacketDataSize = 0,
+				size_t maxWriteBufferCount = 0) {
 			// Arrange:
 			auto options = test::CreatePacketSocketOptions();
 			if (0 != maxPacketDataSize)
 				options.MaxPacketDataSize = maxPacketDataSize;
 
+			if (0 != maxWriteBufferCount)
+				options.MaxWriteBufferCount = maxWriteBufferCount;
+
 			// - set up payloads
 			auto bufferSize = payload.header().Size;
 			ByteBuffer receiveBuffer(bufferSize);
@@ -120,6 +128,58 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	namespace {
+		PacketPayload CreateMultiBufferPayload(size_t numBuffers, ByteBuffer& expectedPayload) {
+			PacketPayloadBuilder builder(PacketType::Push_Transactions);
+			for (auto i = 0u; i < numBuffers; ++i)
+				builder.appendValue(static_cast<uint32_t>(i * i + 7));
+
+			auto payload = builder.build();
+
+			// - flatten the header and all buffers into the expected payload
+			const auto& header = payload.header();
+			expectedPayload.resize(header.Size);
+			std::memcpy(expectedPayload.data(), &header, sizeof(PacketHeader));
+			auto offset = sizeof(PacketHeader);
+			for (const auto& buffer : payload.buffers()) {
+				std::memcpy(expectedPayload.data() + offset, buffer.pData, buffer.Size);
+				offset += buffer.Size;
+			}
+
+			return payload;
+		}
+
+		void AssertMultiBufferWriteSuccess(size_t numBuffers, size_t maxWriteBufferCount) {
+			// Arrange: set up payloads
+			ByteBuffer expectedPayload;
+			auto payload = CreateMultiBufferPayload(numBuffers, expectedPayload);
+
+			// Sanity:
+			EXPECT_EQ(numBuffers, payload.buffers().size());
+
+			// Assert:
+			AssertWriteSuccess(payload, expectedPayload, 0, maxWriteBufferCount);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayloadSingleGatherWrite) {
+		// Assert: header and all buffers fit into a single gather write
+		AssertMultiBufferWriteSuccess(10, 64);
+		AssertMultiBufferWriteSuccess(10, 11);
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayloadMultipleGatherWrites) {
+		// Assert: header and buffers are split across multiple gather writes
+		AssertMultiBufferWriteSuccess(10, 10);
+		AssertMultiBufferWriteSuccess(10, 3);
+		AssertMultiBufferWriteSuccess(200, 64);
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayloadSingleBufferWrites) {
+		// Assert: header and buffers are written one at a time
+		AssertMultiBufferWriteSuccess(10, 1);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
@@ -22,6 +22,7 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/SignedPacketPayloadCache.h"
 #include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PacketIoTestUtils.h"
@@ -154,6 +155,74 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(SocketOperationCode::Write_Error, writeCode);
 	}
 
+	TEST(TEST_CLASS, WriteSignsPayloadWithSharedSigning) {
+		// Arrange: payloads with shared signing that have not yet been signed are signed normally
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+		auto payload = PacketPayload::WithSharedSigning(PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities));
+
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		// Act:
+		context.pSecureIo->write(payload, [](auto) {});
+		const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+
+		// Assert:
+		ASSERT_EQ(sizeof(PacketHeader) + sizeof(Signature) + sizeof(PacketHeader) + 126, writtenPacket.Size);
+		const auto& signature = reinterpret_cast<const Signature&>(*(&writtenPacket + 1));
+		const auto& childPacket = reinterpret_cast<const Packet&>(*(reinterpret_cast<const uint8_t*>(&signature) + Signature_Size));
+		EXPECT_EQ(SignPacket(context.KeyPair, childPacket), signature);
+	}
+
+	TEST(TEST_CLASS, WriteReusesEnvelopeOfPayloadWithSharedSigningSignedBySameKeyPair) {
+		// Arrange: cache a marker envelope for the io key pair so that reuse can be detected
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+		auto payload = PacketPayload::WithSharedSigning(PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities));
+
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		auto pMarkerPacket = test::CreateRandomPacket(sizeof(Signature) + sizeof(PacketHeader) + 126, PacketType::Secure_Signed);
+		payload.signedPayloadCache()->getOrCreate(context.KeyPair.publicKey(), [&pMarkerPacket]() {
+			return PacketPayload(pMarkerPacket);
+		});
+
+		// Act:
+		SocketOperationCode writeCode;
+		context.pSecureIo->write(payload, [&writeCode](auto code) {
+			writeCode = code;
+		});
+
+		// Assert: the cached envelope was written without signing the payload again
+		EXPECT_EQ(SocketOperationCode::Success, writeCode);
+
+		const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+		ASSERT_EQ(pMarkerPacket->Size, writtenPacket.Size);
+		EXPECT_TRUE(0 == std::memcmp(pMarkerPacket.get(), &writtenPacket, pMarkerPacket->Size));
+	}
+
+	TEST(TEST_CLASS, WriteSignsPayloadWithSharedSigningSignedByDifferentKeyPair) {
+		// Arrange: cache an envelope for a different signer
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+		auto payload = PacketPayload::WithSharedSigning(PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities));
+		payload.signedPayloadCache()->getOrCreate(test::GenerateRandomData<Key_Size>(), []() {
+			return PacketPayload(test::CreateRandomPacket(10, PacketType::Secure_Signed));
+		});
+
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		// Act:
+		context.pSecureIo->write(payload, [](auto) {});
+		const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+
+		// Assert: the payload was signed by the io key pair
+		ASSERT_EQ(sizeof(PacketHeader) + sizeof(Signature) + sizeof(PacketHeader) + 126, writtenPacket.Size);
+		const auto& signature = reinterpret_cast<const Signature&>(*(&writtenPacket + 1));
+		const auto& childPacket = reinterpret_cast<const Packet&>(*(reinterpret_cast<const uint8_t*>(&signature) + Signature_Size));
+		EXPECT_EQ(SignPacket(context.KeyPair, childPacket), signature);
+	}
+
 	namespace {
 		void AssertMalformedDataWrite(TestContext&& context, const PacketPayload& payload) {
 			// Arrange:
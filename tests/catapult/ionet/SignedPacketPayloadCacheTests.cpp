@@ -0,0 +1,102 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/SignedPacketPayloadCache.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS SignedPacketPayloadCacheTests
+
+	namespace {
+		class CountingPayloadFactory {
+		public:
+			CountingPayloadFactory() : m_numCalls(0)
+			{}
+
+		public:
+			size_t numCalls() const {
+				return m_numCalls;
+			}
+
+		public:
+			SignedPacketPayloadCache::SignedPayloadFactory create() {
+				return [this]() {
+					++m_numCalls;
+					return PacketPayload(test::CreateRandomPacket(10 + static_cast<uint32_t>(m_numCalls), PacketType::Secure_Signed));
+				};
+			}
+
+		private:
+			size_t m_numCalls;
+		};
+	}
+
+	TEST(TEST_CLASS, CreatesSignedPayloadWhenSignerIsNotCached) {
+		// Arrange:
+		SignedPacketPayloadCache cache;
+		CountingPayloadFactory factory;
+
+		// Act:
+		auto signedPayload = cache.getOrCreate(test::GenerateRandomData<Key_Size>(), factory.create());
+
+		// Assert:
+		EXPECT_EQ(1u, factory.numCalls());
+		EXPECT_EQ(sizeof(PacketHeader) + 11, signedPayload.header().Size);
+	}
+
+	TEST(TEST_CLASS, ReusesSignedPayloadWhenSignerIsCached) {
+		// Arrange:
+		SignedPacketPayloadCache cache;
+		CountingPayloadFactory factory;
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto signedPayload1 = cache.getOrCreate(signer, factory.create());
+
+		// Act:
+		auto signedPayload2 = cache.getOrCreate(signer, factory.create());
+
+		// Assert: the same (backing) payload was returned
+		EXPECT_EQ(1u, factory.numCalls());
+		EXPECT_EQ(signedPayload1.header().Size, signedPayload2.header().Size);
+		ASSERT_EQ(1u, signedPayload2.buffers().size());
+		EXPECT_EQ(signedPayload1.buffers()[0].pData, signedPayload2.buffers()[0].pData);
+	}
+
+	TEST(TEST_CLASS, CreatesSignedPayloadForEachSigner) {
+		// Arrange:
+		SignedPacketPayloadCache cache;
+		CountingPayloadFactory factory;
+		auto signer1 = test::GenerateRandomData<Key_Size>();
+		auto signer2 = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto signedPayload1 = cache.getOrCreate(signer1, factory.create());
+		auto signedPayload2 = cache.getOrCreate(signer2, factory.create());
+		auto signedPayload3 = cache.getOrCreate(signer1, factory.create());
+
+		// Assert:
+		EXPECT_EQ(2u, factory.numCalls());
+		EXPECT_EQ(sizeof(PacketHeader) + 11, signedPayload1.header().Size);
+		EXPECT_EQ(sizeof(PacketHeader) + 12, signedPayload2.header().Size);
+		EXPECT_EQ(sizeof(PacketHeader) + 11, signedPayload3.header().Size);
+	}
+}}
@@ -19,6 +19,8 @@
 **/
 
 #include "catapult/local/MemoryCounters.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/state/AccountStatePool.h"
 #include "catapult/utils/DiagnosticCounter.h"
 #include "tests/TestHarness.h"
 
@@ -48,9 +50,9 @@ namespace catapult { namespace local {
 
 		constexpr size_t GetNumExpectedCounters() {
 #ifdef __APPLE__
-			return 3;
+			return 3 + 3;
 #else
-			return 4;
+			return 4 + 3;
 #endif
 		}
 	}
@@ -66,6 +68,9 @@ namespace catapult { namespace local {
 		// - check common counters
 		HasCounter(counters, "MEM CUR RSS");
 		HasCounter(counters, "MEM MAX RSS");
+		HasCounter(counters, "MEM ACNT SLAB");
+		HasCounter(counters, "MEM ACNT BPA");
+		HasCounter(counters, "MEM ACNT CAPS");
 
 		// - check platform dependent counters
 #ifdef _WIN32
@@ -80,7 +85,18 @@ namespace catapult { namespace local {
 	}
 
 	TEST(TEST_CLASS, CountersHaveNonZeroValues) {
-		// Arrange:
+		// Arrange: make sure at least one account state is allocated from the pool and committed
+		cache::AccountStateCache accountStateCache(cache::CacheConfiguration(), cache::AccountStateCacheTypes::Options{
+			model::NetworkIdentifier::Mijin_Test,
+			123,
+			Amount(1)
+		});
+		{
+			auto delta = accountStateCache.createDelta();
+			delta->addAccount(Address(), Height(123));
+			accountStateCache.commit();
+		}
+
 		Counters counters;
 		AddMemoryCounters(counters);
 
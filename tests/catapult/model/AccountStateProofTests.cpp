@@ -0,0 +1,97 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/AccountStateProof.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/test/core/VariableSizedEntityTestUtils.h"
+#include "tests/test/nodeps/NumericTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS AccountStateProofTests
+
+	TEST(TEST_CLASS, EntityHasExpectedSize) {
+		// Arrange:
+		auto expectedSize =
+				sizeof(uint32_t) // size
+				+ Address_Decoded_Size // account address
+				+ Hash256_Size // state root
+				+ sizeof(uint32_t); // nodes size
+
+		// Assert:
+		EXPECT_EQ(expectedSize, sizeof(AccountStateProof));
+		EXPECT_EQ(65u, sizeof(AccountStateProof));
+	}
+
+	// region CalculateRealSize
+
+	TEST(TEST_CLASS, CanCalculateRealSizeWithReasonableValues) {
+		// Arrange:
+		AccountStateProof proof;
+		proof.Size = 0;
+		proof.NodesSize = 100;
+
+		// Act:
+		auto realSize = AccountStateProof::CalculateRealSize(proof);
+
+		// Assert:
+		EXPECT_EQ(sizeof(AccountStateProof) + 100, realSize);
+	}
+
+	TEST(TEST_CLASS, CalculateRealSizeDoesNotOverflowWithMaxValues) {
+		// Arrange:
+		AccountStateProof proof;
+		proof.Size = 0;
+		test::SetMaxValue(proof.NodesSize);
+
+		// Act:
+		auto realSize = AccountStateProof::CalculateRealSize(proof);
+
+		// Assert:
+		EXPECT_EQ(sizeof(AccountStateProof) + proof.NodesSize, realSize);
+		EXPECT_LT(std::numeric_limits<uint32_t>::max(), realSize);
+	}
+
+	// endregion
+
+	// region data pointers
+
+	namespace {
+		struct AccountStateProofTraits {
+			static auto GenerateEntityWithAttachments(uint16_t count) {
+				uint32_t entitySize = sizeof(AccountStateProof) + count;
+				auto pProof = utils::MakeUniqueWithSize<AccountStateProof>(entitySize);
+				pProof->Size = entitySize;
+				pProof->NodesSize = count;
+				return pProof;
+			}
+
+			template<typename TEntity>
+			static auto GetAttachmentPointer(TEntity& entity) {
+				return entity.NodesPtr();
+			}
+		};
+	}
+
+	DEFINE_ATTACHMENT_POINTER_TESTS(TEST_CLASS, AccountStateProofTraits) // NodesPtr
+
+	// endregion
+}}
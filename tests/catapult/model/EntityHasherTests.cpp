@@ -360,5 +360,37 @@ namespace catapult { namespace model {
 		EXPECT_NE(transactionElement.EntityHash, transactionElement.MerkleComponentHash);
 	}
 
+	TEST(TEST_CLASS, UpdateHashes_MultipleTransactionElementsHaveSameHashesAsSingleTransactionElements) {
+		// Arrange:
+		auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
+				mocks::OffsetRange{ 6, 10 },
+				std::vector<mocks::OffsetRange>{ { 7, 11 }, { 4, 7 } });
+		auto registry = TransactionRegistry();
+		registry.registerPlugin(std::move(pPlugin));
+
+		auto transactions = test::GenerateRandomTransactions(10);
+		std::vector<TransactionElement> expectedTransactionElements;
+		std::vector<TransactionElement> transactionElements;
+		for (const auto& pTransaction : transactions) {
+			expectedTransactionElements.emplace_back(*pTransaction);
+			UpdateHashes(registry, expectedTransactionElements.back());
+
+			transactionElements.emplace_back(*pTransaction);
+		}
+
+		std::vector<TransactionElement*> transactionElementPointers;
+		for (auto& transactionElement : transactionElements)
+			transactionElementPointers.push_back(&transactionElement);
+
+		// Act:
+		UpdateHashes(registry, transactionElementPointers);
+
+		// Assert:
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElements[i].EntityHash) << "at index " << i;
+			EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElements[i].MerkleComponentHash) << "at index " << i;
+		}
+	}
+
 	// endregion
 }}
@@ -0,0 +1,114 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationDispatchTable.h"
+#include "tests/TestHarness.h"
+#include <string>
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationDispatchTableTests
+
+	namespace {
+		using Handlers = std::vector<std::string>;
+		using DispatchTable = NotificationDispatchTable<std::string>;
+
+		constexpr auto Type_Alpha = MakeNotificationType(NotificationChannel::All, FacilityCode::Core, 0x0011);
+		constexpr auto Type_Beta = MakeNotificationType(NotificationChannel::Validator, FacilityCode::Core, 0x0012);
+		constexpr auto Type_Gamma = MakeNotificationType(NotificationChannel::Observer, FacilityCode::Transfer, 0x0011);
+	}
+
+	TEST(TEST_CLASS, EmptyTableSelectsNoHandlers) {
+		// Arrange:
+		DispatchTable table;
+
+		// Act + Assert:
+		EXPECT_TRUE(table.select(Type_Alpha).empty());
+		EXPECT_TRUE(table.select(Type_Beta).empty());
+	}
+
+	TEST(TEST_CLASS, CanSelectTypedHandlers) {
+		// Arrange:
+		DispatchTable table;
+		table.add(Type_Alpha, "a1");
+		table.add(Type_Beta, "b1");
+		table.add(Type_Alpha, "a2");
+
+		// Act + Assert:
+		EXPECT_EQ(Handlers({ "a1", "a2" }), table.select(Type_Alpha));
+		EXPECT_EQ(Handlers({ "b1" }), table.select(Type_Beta));
+		EXPECT_TRUE(table.select(Type_Gamma).empty());
+	}
+
+	TEST(TEST_CLASS, UntypedHandlersAreSelectedForAllTypes) {
+		// Arrange:
+		DispatchTable table;
+		table.addAll("x1");
+		table.add(Type_Alpha, "a1");
+		table.addAll("x2");
+
+		// Act + Assert:
+		EXPECT_EQ(Handlers({ "x1", "a1", "x2" }), table.select(Type_Alpha));
+		EXPECT_EQ(Handlers({ "x1", "x2" }), table.select(Type_Beta));
+		EXPECT_EQ(Handlers({ "x1", "x2" }), table.select(Type_Gamma));
+	}
+
+	TEST(TEST_CLASS, HandlersAreSelectedInRegistrationOrder) {
+		// Arrange:
+		DispatchTable table;
+		table.add(Type_Beta, "b1");
+		table.addAll("x1");
+		table.add(Type_Alpha, "a1");
+		table.add(Type_Beta, "b2");
+		table.addAll("x2");
+		table.add(Type_Alpha, "a2");
+
+		// Act + Assert:
+		EXPECT_EQ(Handlers({ "x1", "a1", "x2", "a2" }), table.select(Type_Alpha));
+		EXPECT_EQ(Handlers({ "b1", "x1", "b2", "x2" }), table.select(Type_Beta));
+		EXPECT_EQ(Handlers({ "x1", "x2" }), table.select(Type_Gamma));
+	}
+
+	TEST(TEST_CLASS, SelectionIgnoresChannel) {
+		// Arrange:
+		DispatchTable table;
+		table.add(Type_Alpha, "a1");
+		table.addAll("x1");
+
+		auto type = Type_Alpha;
+		SetNotificationChannel(type, NotificationChannel::None);
+
+		// Act + Assert:
+		EXPECT_EQ(Handlers({ "a1", "x1" }), table.select(type));
+	}
+
+	TEST(TEST_CLASS, RegistrationIgnoresChannel) {
+		// Arrange:
+		auto type = Type_Alpha;
+		SetNotificationChannel(type, NotificationChannel::Validator);
+
+		DispatchTable table;
+		table.add(Type_Alpha, "a1");
+		table.add(type, "a2");
+
+		// Act + Assert:
+		EXPECT_EQ(Handlers({ "a1", "a2" }), table.select(Type_Alpha));
+	}
+}}
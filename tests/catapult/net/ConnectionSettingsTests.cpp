@@ -35,6 +35,7 @@ namespace catapult { namespace net {
 		EXPECT_EQ(utils::FileSize::FromKilobytes(4), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(0u, settings.SocketWorkingBufferSensitivity);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(100), settings.MaxPacketDataSize);
+		EXPECT_EQ(64u, settings.SocketMaxWriteBufferCount);
 
 		EXPECT_EQ(ionet::ConnectionSecurityMode::None, settings.OutgoingSecurityMode);
 		EXPECT_EQ(ionet::ConnectionSecurityMode::None, settings.IncomingSecurityModes);
@@ -46,6 +47,7 @@ namespace catapult { namespace net {
 		settings.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(54);
 		settings.SocketWorkingBufferSensitivity = 123;
 		settings.MaxPacketDataSize = utils::FileSize::FromMegabytes(2);
+		settings.SocketMaxWriteBufferCount = 17;
 
 		// Act:
 		auto options = settings.toSocketOptions();
@@ -54,5 +56,6 @@ namespace catapult { namespace net {
 		EXPECT_EQ(54u * 1024, options.WorkingBufferSize);
 		EXPECT_EQ(123u, options.WorkingBufferSensitivity);
 		EXPECT_EQ(2u * 1024 * 1024, options.MaxPacketDataSize);
+		EXPECT_EQ(17u, options.MaxWriteBufferCount);
 	}
 }}
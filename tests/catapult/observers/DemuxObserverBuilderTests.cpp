@@ -250,5 +250,43 @@ namespace catapult { namespace observers {
 		});
 	}
 
+	namespace {
+		void AssertMatchingObserversAreNotifiedInOrder(NotifyMode mode, const Breadcrumbs& expectedSelectedNames) {
+			// Arrange:
+			Breadcrumbs breadcrumbs;
+			DemuxObserverBuilder builder;
+
+			state::CatapultState state;
+			cache::CatapultCache cache({});
+			auto cacheDelta = cache.createDelta();
+			auto context = test::CreateObserverContext(cacheDelta, state, Height(123), mode);
+
+			builder
+				.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "a1"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "x1"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "p1"))
+				.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "a2"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "x2"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "p2"));
+			auto pObserver = builder.build();
+
+			// Act:
+			test::ObserveNotification<model::Notification>(*pObserver, model::AccountPublicKeyNotification(Key()), context);
+
+			// Assert:
+			EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+		}
+	}
+
+	TEST(TEST_CLASS, MatchingObserversAreNotifiedInRegistrationOrderOnCommit) {
+		// Assert:
+		AssertMatchingObserversAreNotifiedInOrder(NotifyMode::Commit, { "x1", "p1", "x2", "p2" });
+	}
+
+	TEST(TEST_CLASS, MatchingObserversAreNotifiedInReverseRegistrationOrderOnRollback) {
+		// Assert:
+		AssertMatchingObserversAreNotifiedInOrder(NotifyMode::Rollback, { "p2", "x2", "p1", "x1" });
+	}
+
 	// endregion
 }}
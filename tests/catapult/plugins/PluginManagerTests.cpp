@@ -39,6 +39,7 @@ namespace catapult { namespace plugins {
 		// Assert:
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
+		EXPECT_FALSE(config.EnableCachePatriciaTrees);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -70,10 +71,27 @@ namespace catapult { namespace plugins {
 		auto cacheConfig1 = manager.cacheConfig("foo");
 		EXPECT_TRUE(cacheConfig1.ShouldUseCacheDatabase);
 		EXPECT_EQ("abc/foo", cacheConfig1.CacheDatabaseDirectory);
+		EXPECT_FALSE(cacheConfig1.ShouldEnablePatriciaTrees);
 
 		auto cacheConfig2 = manager.cacheConfig("bar");
 		EXPECT_TRUE(cacheConfig2.ShouldUseCacheDatabase);
 		EXPECT_EQ("abc/bar", cacheConfig2.CacheDatabaseDirectory);
+		EXPECT_FALSE(cacheConfig2.ShouldEnablePatriciaTrees);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithPatriciaTreesEnabled) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.EnableCachePatriciaTrees = true;
+
+		// Act:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+		auto cacheConfig = manager.cacheConfig("foo");
+
+		// Assert:
+		EXPECT_FALSE(cacheConfig.ShouldUseCacheDatabase);
+		EXPECT_TRUE(cacheConfig.CacheDatabaseDirectory.empty());
+		EXPECT_TRUE(cacheConfig.ShouldEnablePatriciaTrees);
 	}
 
 	// endregion
@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/state/AccountStatePool.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace state {
+
+#define TEST_CLASS AccountStatePoolTests
+
+	TEST(TEST_CLASS, PoolIsShared) {
+		// Act:
+		auto& pool1 = GetAccountStatePool();
+		auto& pool2 = GetAccountStatePool();
+
+		// Assert:
+		EXPECT_EQ(&pool1, &pool2);
+	}
+
+	TEST(TEST_CLASS, CanCreatePooledAccountState) {
+		// Arrange:
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+		auto numBlocks = GetAccountStatePool().statistics().NumBlocks;
+
+		// Act:
+		auto pAccountState = MakePooledAccountState(address, Height(123));
+
+		// Assert:
+		EXPECT_EQ(address, pAccountState->Address);
+		EXPECT_EQ(Height(123), pAccountState->AddressHeight);
+		EXPECT_EQ(numBlocks + 1, GetAccountStatePool().statistics().NumBlocks);
+	}
+
+	TEST(TEST_CLASS, CanCreatePooledAccountStateCopy) {
+		// Arrange:
+		AccountState accountState(test::GenerateRandomData<Address_Decoded_Size>(), Height(123));
+		accountState.Balances.credit(MosaicId(1111), Amount(2222));
+		accountState.ImportanceInfo.set(Importance(3333), model::ImportanceHeight(4444));
+		auto numBlocks = GetAccountStatePool().statistics().NumBlocks;
+
+		// Act:
+		auto pAccountState = MakePooledAccountState(accountState);
+
+		// Assert:
+		EXPECT_EQ(accountState.Address, pAccountState->Address);
+		EXPECT_EQ(Height(123), pAccountState->AddressHeight);
+		EXPECT_EQ(Amount(2222), pAccountState->Balances.get(MosaicId(1111)));
+		EXPECT_EQ(Importance(3333), pAccountState->ImportanceInfo.current());
+		EXPECT_EQ(numBlocks + 1, GetAccountStatePool().statistics().NumBlocks);
+	}
+
+	TEST(TEST_CLASS, DestroyingPooledAccountStateReturnsBlockToPool) {
+		// Arrange:
+		auto numBlocks = GetAccountStatePool().statistics().NumBlocks;
+		auto pAccountState = MakePooledAccountState(test::GenerateRandomData<Address_Decoded_Size>(), Height(123));
+		auto pAccountStateCopy = pAccountState;
+
+		// Act:
+		pAccountState.reset();
+		auto numBlocksAfterFirstReset = GetAccountStatePool().statistics().NumBlocks;
+		pAccountStateCopy.reset();
+
+		// Assert: the block is only returned after the last reference is released
+		EXPECT_EQ(numBlocks + 1, numBlocksAfterFirstReset);
+		EXPECT_EQ(numBlocks, GetAccountStatePool().statistics().NumBlocks);
+	}
+}}
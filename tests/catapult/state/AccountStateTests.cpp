@@ -37,6 +37,7 @@ namespace catapult { namespace state {
 		// Assert:
 		EXPECT_EQ(address, state.Address);
 		EXPECT_EQ(height, state.AddressHeight);
+		EXPECT_EQ(Key(), state.PublicKey);
 		EXPECT_EQ(Height(0), state.PublicKeyHeight);
 		EXPECT_EQ(0u, state.Balances.size());
 
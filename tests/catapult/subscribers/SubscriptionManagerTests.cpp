@@ -20,11 +20,14 @@
 
 #include "catapult/subscribers/SubscriptionManager.h"
 #include "catapult/config/LocalNodeConfiguration.h"
+#include "catapult/io/PackedFileStorage.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/model/ChainScore.h"
 #include "tests/catapult/subscribers/test/UnsupportedSubscribers.h"
+#include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace subscribers {
@@ -46,6 +49,20 @@ namespace catapult { namespace subscribers {
 					config::LoggingConfiguration::Uninitialized(),
 					config::UserConfiguration::Uninitialized());
 		}
+
+		config::LocalNodeConfiguration CreateConfiguration(const std::string& dataDirectory, bool shouldUsePackedBlockStorage) {
+			auto nodeConfig = config::NodeConfiguration::Uninitialized();
+			nodeConfig.ShouldUsePackedBlockStorage = shouldUsePackedBlockStorage;
+
+			auto userConfig = config::UserConfiguration::Uninitialized();
+			userConfig.DataDirectory = dataDirectory;
+
+			return config::LocalNodeConfiguration(
+					model::BlockChainConfiguration::Uninitialized(),
+					std::move(nodeConfig),
+					config::LoggingConfiguration::Uninitialized(),
+					std::move(userConfig));
+		}
 	}
 
 	// region traits
@@ -149,6 +166,31 @@ namespace catapult { namespace subscribers {
 		manager.fileStorage();
 	}
 
+	TEST(TEST_CLASS, CanCreateManagerWithPackedStorageInDataDirectoryContainingFileBasedStorage) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+		auto config = CreateConfiguration(tempDir.name(), true);
+
+		// Act:
+		SubscriptionManager manager(config);
+
+		// Assert: the file based nemesis block was imported
+		EXPECT_EQ(Height(1), manager.fileStorage().chainHeight());
+		EXPECT_TRUE(!!manager.fileStorage().loadBlock(Height(1)));
+	}
+
+	TEST(TEST_CLASS, CannotCreateManagerWithFileBasedStorageInDataDirectoryContainingPackedStorage) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+		io::PackedFileStorage packedStorage(tempDir.name());
+		auto config = CreateConfiguration(tempDir.name(), false);
+
+		// Act + Assert:
+		EXPECT_THROW(SubscriptionManager manager(config), catapult_runtime_error);
+	}
+
 	// endregion
 
 	// region single aggregate creation
@@ -0,0 +1,129 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/ParallelMerkleHashing.h"
+#include "catapult/thread/Future.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+#include <boost/asio.hpp>
+
+namespace catapult { namespace thread {
+
+#define TEST_CLASS ParallelMerkleHashingTests
+
+	namespace {
+		std::vector<crypto::MultiBufferHashInput> CreateInputs(const std::vector<Hash256>& hashes) {
+			std::vector<crypto::MultiBufferHashInput> inputs;
+			for (const auto& hash : hashes)
+				inputs.push_back({ hash });
+
+			return inputs;
+		}
+
+		template<typename TBuilderFactory>
+		std::vector<Hash256> CalculateMerkleTree(const std::vector<Hash256>& hashes, TBuilderFactory builderFactory) {
+			auto builder = builderFactory();
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			std::vector<Hash256> tree;
+			builder.final(tree);
+			return tree;
+		}
+
+		void AssertSameMerkleTree(uint32_t numThreads, size_t numLeaves, size_t levelThreshold) {
+			// Arrange:
+			auto pPool = std::shared_ptr<IoServiceThreadPool>(test::CreateStartedIoServiceThreadPool(numThreads));
+			auto hashes = test::GenerateRandomDataVector<Hash256>(numLeaves);
+
+			// Act:
+			auto expectedTree = CalculateMerkleTree(hashes, []() { return crypto::MerkleHashBuilder(); });
+			auto tree = CalculateMerkleTree(hashes, [pPool, levelThreshold]() {
+				return crypto::MerkleHashBuilder(0, CreateParallelMerkleLevelHasher(pPool, levelThreshold));
+			});
+
+			// Assert:
+			EXPECT_EQ(expectedTree, tree) << "threads " << numThreads << ", leaves " << numLeaves << ", threshold " << levelThreshold;
+		}
+	}
+
+	// region level hasher
+
+	TEST(TEST_CLASS, LevelHasherCalculatesSameHashesAsMultiBufferHashing) {
+		// Arrange:
+		auto pPool = std::shared_ptr<IoServiceThreadPool>(test::CreateStartedIoServiceThreadPool(4));
+		auto hashes = test::GenerateRandomDataVector<Hash256>(1000);
+		auto inputs = CreateInputs(hashes);
+		auto levelHasher = CreateParallelMerkleLevelHasher(pPool, 0);
+
+		std::vector<Hash256> expectedHashes(inputs.size());
+		crypto::Sha3_256_MultiBuffer(inputs, expectedHashes.data());
+
+		// Act:
+		std::vector<Hash256> parallelHashes(inputs.size());
+		levelHasher(inputs, parallelHashes.data());
+
+		// Assert:
+		EXPECT_EQ(expectedHashes, parallelHashes);
+	}
+
+	TEST(TEST_CLASS, LevelHasherCanBeCalledFromPoolWorker) {
+		// Arrange: use a single worker so that hashing can only complete if the calling thread participates
+		auto pPool = std::shared_ptr<IoServiceThreadPool>(test::CreateStartedIoServiceThreadPool(1));
+		auto hashes = test::GenerateRandomDataVector<Hash256>(1000);
+		auto inputs = CreateInputs(hashes);
+		auto levelHasher = CreateParallelMerkleLevelHasher(pPool, 0);
+
+		std::vector<Hash256> expectedHashes(inputs.size());
+		crypto::Sha3_256_MultiBuffer(inputs, expectedHashes.data());
+
+		// Act:
+		std::vector<Hash256> parallelHashes(inputs.size());
+		thread::promise<bool> promise;
+		auto future = promise.get_future();
+		pPool->service().post([&levelHasher, &inputs, &parallelHashes, &promise]() {
+			levelHasher(inputs, parallelHashes.data());
+			promise.set_value(true);
+		});
+		future.get();
+
+		// Assert:
+		EXPECT_EQ(expectedHashes, parallelHashes);
+	}
+
+	// endregion
+
+	// region merkle tree
+
+	TEST(TEST_CLASS, ParallelMerkleTreeIsSameAsSequentialMerkleTreeBelowThreshold) {
+		for (auto numLeaves : { 0u, 1u, 2u, 5u, 300u })
+			AssertSameMerkleTree(4, numLeaves, 1024);
+	}
+
+	TEST(TEST_CLASS, ParallelMerkleTreeIsSameAsSequentialMerkleTreeAboveThreshold) {
+		for (auto numThreads : { 1u, 2u, 4u, 7u }) {
+			for (auto numLeaves : { 256u, 257u, 1000u, 4097u })
+				AssertSameMerkleTree(numThreads, numLeaves, 0);
+		}
+	}
+
+	// endregion
+}}
@@ -0,0 +1,157 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/MemoryDataSource.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS MemoryDataSourceTests
+
+	namespace {
+		LeafTreeNode CreateLeaf(uint8_t value) {
+			Hash256 leafValue;
+			leafValue.fill(value);
+			return LeafTreeNode(TreeNodePath(static_cast<uint64_t>(value)), leafValue);
+		}
+
+		BranchTreeNode CreateBranch(const LeafTreeNode& leafNode) {
+			BranchTreeNode branchNode(TreeNodePath(static_cast<uint64_t>(0x12)));
+			branchNode.setLink(leafNode.hash(), 4);
+			return branchNode;
+		}
+	}
+
+	TEST(TEST_CLASS, DataSourceIsInitiallyEmpty) {
+		// Act:
+		MemoryDataSource dataSource;
+
+		// Assert:
+		EXPECT_EQ(0u, dataSource.size());
+		EXPECT_FALSE(!!dataSource.get(CreateLeaf(1).hash()));
+	}
+
+	TEST(TEST_CLASS, CanSetLeafNode) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto leafNode = CreateLeaf(1);
+
+		// Act:
+		dataSource.set(leafNode);
+		const auto* pNode = dataSource.get(leafNode.hash());
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		ASSERT_TRUE(!!pNode);
+		EXPECT_TRUE(pNode->isLeaf());
+		EXPECT_EQ(leafNode.hash(), pNode->hash());
+	}
+
+	TEST(TEST_CLASS, CanSetBranchNode) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto branchNode = CreateBranch(CreateLeaf(1));
+
+		// Act:
+		dataSource.set(branchNode);
+		const auto* pNode = dataSource.get(branchNode.hash());
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		ASSERT_TRUE(!!pNode);
+		EXPECT_TRUE(pNode->isBranch());
+		EXPECT_EQ(branchNode.hash(), pNode->hash());
+	}
+
+	TEST(TEST_CLASS, CanSetTreeNode) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto node = TreeNode(CreateLeaf(1));
+
+		// Act:
+		dataSource.set(node);
+		const auto* pNode = dataSource.get(node.hash());
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		ASSERT_TRUE(!!pNode);
+		EXPECT_EQ(node.hash(), pNode->hash());
+	}
+
+	TEST(TEST_CLASS, SettingEmptyTreeNodeHasNoEffect) {
+		// Arrange:
+		MemoryDataSource dataSource;
+
+		// Act:
+		dataSource.set(TreeNode());
+
+		// Assert:
+		EXPECT_EQ(0u, dataSource.size());
+	}
+
+	TEST(TEST_CLASS, CanRemoveNode) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto leafNode1 = CreateLeaf(1);
+		auto leafNode2 = CreateLeaf(2);
+		dataSource.set(leafNode1);
+		dataSource.set(leafNode2);
+
+		// Act:
+		dataSource.remove(leafNode1.hash());
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		EXPECT_FALSE(!!dataSource.get(leafNode1.hash()));
+		EXPECT_TRUE(!!dataSource.get(leafNode2.hash()));
+	}
+
+	TEST(TEST_CLASS, RemovingUnknownNodeHasNoEffect) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		dataSource.set(CreateLeaf(1));
+
+		// Act:
+		dataSource.remove(CreateLeaf(2).hash());
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+	}
+
+	TEST(TEST_CLASS, NodeIsOnlyRemovedWhenAllReferencesAreRemoved) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto leafNode = CreateLeaf(1);
+		dataSource.set(leafNode);
+		dataSource.set(TreeNode(leafNode));
+		dataSource.set(leafNode);
+
+		// Act + Assert:
+		for (auto i = 0u; i < 2; ++i) {
+			dataSource.remove(leafNode.hash());
+			EXPECT_EQ(1u, dataSource.size()) << i;
+			EXPECT_TRUE(!!dataSource.get(leafNode.hash())) << i;
+		}
+
+		dataSource.remove(leafNode.hash());
+		EXPECT_EQ(0u, dataSource.size());
+		EXPECT_FALSE(!!dataSource.get(leafNode.hash()));
+	}
+}}
@@ -0,0 +1,313 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/PatriciaTreeProof.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS PatriciaTreeProofTests
+
+	namespace {
+		class PassThroughEncoder {
+		public:
+			using KeyType = uint32_t;
+			using ValueType = std::string;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static Hash256 EncodeValue(const ValueType& value) {
+				Hash256 valueHash;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(value.data()), value.size() }, valueHash);
+				return valueHash;
+			}
+		};
+
+		using ProofTestTree = PatriciaTree<PassThroughEncoder, MemoryDataSource>;
+
+		class TestContext {
+		public:
+			TestContext() : m_tree(m_dataSource) {
+				m_tree.set(0x64'6F'00'00, "verb");
+				m_tree.set(0x64'6F'67'00, "puppy");
+				m_tree.set(0x64'6F'67'65, "coin");
+				m_tree.set(0x7A'6F'72'73, "stallion");
+			}
+
+		public:
+			Hash256 root() const {
+				return m_tree.root();
+			}
+
+			std::vector<TreeNode> lookupWithProof(uint32_t key) const {
+				return m_tree.lookupWithProof(key);
+			}
+
+		private:
+			MemoryDataSource m_dataSource;
+			ProofTestTree m_tree;
+		};
+
+		TreeProofResult Verify(uint32_t key, const std::vector<TreeNode>& nodePath, const Hash256& root) {
+			Hash256 value;
+			return VerifyTreeProof(TreeNodePath(key), nodePath, root, value);
+		}
+	}
+
+	// region VerifyTreeProof - success
+
+	TEST(TEST_CLASS, CanVerifyInclusionProof) {
+		// Arrange:
+		TestContext context;
+		for (const auto& pair : std::vector<std::pair<uint32_t, std::string>>{
+			{ 0x64'6F'00'00, "verb" }, { 0x64'6F'67'00, "puppy" }, { 0x64'6F'67'65, "coin" }, { 0x7A'6F'72'73, "stallion" }
+		}) {
+			auto nodePath = context.lookupWithProof(pair.first);
+
+			// Act:
+			Hash256 value;
+			auto result = VerifyTreeProof(TreeNodePath(pair.first), nodePath, context.root(), value);
+
+			// Assert:
+			EXPECT_EQ(TreeProofResult::Inclusion, result) << pair.second;
+			EXPECT_EQ(PassThroughEncoder::EncodeValue(pair.second), value) << pair.second;
+		}
+	}
+
+	TEST(TEST_CLASS, CanVerifyExclusionProof) {
+		// Arrange: (missing root link, diverging branch path, missing branch link, diverging leaf path)
+		TestContext context;
+		for (auto key : { 0x54'6F'67'00u, 0x6A'6F'67'00u, 0x64'6F'67'44u, 0x64'6F'67'66u }) {
+			auto nodePath = context.lookupWithProof(key);
+
+			// Act:
+			auto result = Verify(key, nodePath, context.root());
+
+			// Assert:
+			EXPECT_EQ(TreeProofResult::Exclusion, result) << utils::HexFormat(key);
+		}
+	}
+
+	TEST(TEST_CLASS, CanVerifyExclusionProofForEmptyTree) {
+		// Act:
+		auto result = Verify(0x64'6F'67'65, {}, Hash256());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Exclusion, result);
+	}
+
+	// endregion
+
+	// region VerifyTreeProof - failure
+
+	TEST(TEST_CLASS, EmptyProofIsInvalidForNonEmptyTree) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto result = Verify(0x64'6F'67'65, {}, context.root());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	TEST(TEST_CLASS, ProofIsInvalidForDifferentRoot) {
+		// Arrange:
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'65);
+
+		// Act:
+		auto result = Verify(0x64'6F'67'65, nodePath, test::GenerateRandomData<Hash256_Size>());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	TEST(TEST_CLASS, ProofIsInvalidWhenLeafValueIsModified) {
+		// Arrange:
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'65);
+		const auto& leafNode = nodePath.back().asLeafNode();
+		nodePath.back() = TreeNode(LeafTreeNode(leafNode.path(), PassThroughEncoder::EncodeValue("dog")));
+
+		// Act:
+		auto result = Verify(0x64'6F'67'65, nodePath, context.root());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	TEST(TEST_CLASS, ProofIsInvalidWhenBranchLinkIsModified) {
+		// Arrange: clear the link from the root to the subtree containing the key
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'65);
+		auto branchNode = nodePath.front().asBranchNode();
+		branchNode.clearLink(6);
+		nodePath.front() = TreeNode(branchNode);
+
+		// Act:
+		auto result = Verify(0x64'6F'67'65, nodePath, context.root());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	TEST(TEST_CLASS, ProofIsInvalidWhenTruncated) {
+		// Arrange:
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'65);
+		nodePath.pop_back();
+
+		// Act:
+		auto result = Verify(0x64'6F'67'65, nodePath, context.root());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	TEST(TEST_CLASS, ProofIsInvalidWhenItContainsTrailingNodes) {
+		// Arrange:
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'65);
+		nodePath.push_back(nodePath.back().copy());
+
+		// Act:
+		auto result = Verify(0x64'6F'67'65, nodePath, context.root());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	TEST(TEST_CLASS, InclusionProofIsInvalidForOtherKey) {
+		// Arrange: coin and puppy share all branches
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'65);
+
+		// Act:
+		auto result = Verify(0x64'6F'67'00, nodePath, context.root());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	TEST(TEST_CLASS, ExclusionProofCannotHideKeyInTree) {
+		// Arrange: the proof ends at a branch that has a link to coin
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'44);
+
+		// Act:
+		auto result = Verify(0x64'6F'67'65, nodePath, context.root());
+
+		// Assert:
+		EXPECT_EQ(TreeProofResult::Invalid, result);
+	}
+
+	// endregion
+
+	// region serialization
+
+	TEST(TEST_CLASS, CanRoundtripTreeNodes) {
+		// Arrange:
+		TestContext context;
+		auto nodePath = context.lookupWithProof(0x64'6F'67'65);
+
+		// Act:
+		auto buffer = SerializeTreeNodes(nodePath);
+
+		std::vector<TreeNode> deserializedNodePath;
+		auto isDeserialized = TryDeserializeTreeNodes(buffer, deserializedNodePath);
+
+		// Assert:
+		EXPECT_TRUE(isDeserialized);
+		ASSERT_EQ(nodePath.size(), deserializedNodePath.size());
+		for (auto i = 0u; i < nodePath.size(); ++i) {
+			EXPECT_EQ(nodePath[i].isLeaf(), deserializedNodePath[i].isLeaf()) << "node at " << i;
+			EXPECT_EQ(nodePath[i].path(), deserializedNodePath[i].path()) << "node at " << i;
+			EXPECT_EQ(nodePath[i].hash(), deserializedNodePath[i].hash()) << "node at " << i;
+		}
+
+		Hash256 value;
+		EXPECT_EQ(TreeProofResult::Inclusion, VerifyTreeProof(TreeNodePath(0x64'6F'67'65u), deserializedNodePath, context.root(), value));
+	}
+
+	TEST(TEST_CLASS, SerializedNodesAreCompact) {
+		// Arrange: leaf with odd path (3 nibbles) and branch with even path (2 nibbles) and two links
+		std::vector<TreeNode> nodes;
+		nodes.emplace_back(LeafTreeNode(TreeNodePath(static_cast<uint16_t>(0x1234)).subpath(1), Hash256()));
+
+		BranchTreeNode branchNode(TreeNodePath(static_cast<uint8_t>(0x56)));
+		branchNode.setLink(test::GenerateRandomData<Hash256_Size>(), 3);
+		branchNode.setLink(test::GenerateRandomData<Hash256_Size>(), 9);
+		nodes.emplace_back(branchNode);
+
+		// Act:
+		auto buffer = SerializeTreeNodes(nodes);
+
+		// Assert:
+		EXPECT_EQ((1u + 1 + 2 + Hash256_Size) + (1u + 1 + 1 + sizeof(uint16_t) + 2 * Hash256_Size), buffer.size());
+	}
+
+	TEST(TEST_CLASS, CannotSerializeEmptyTreeNode) {
+		// Arrange:
+		std::vector<TreeNode> nodes;
+		nodes.emplace_back();
+
+		// Act + Assert:
+		EXPECT_THROW(SerializeTreeNodes(nodes), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDeserializeTruncatedBuffer) {
+		// Arrange:
+		TestContext context;
+		auto buffer = SerializeTreeNodes(context.lookupWithProof(0x64'6F'67'65));
+
+		// Act + Assert: every strict prefix that does not end at a node boundary is malformed
+		auto numMalformedBuffers = 0u;
+		for (auto size = 1u; size < buffer.size(); ++size) {
+			std::vector<TreeNode> nodes;
+			if (!TryDeserializeTreeNodes({ buffer.data(), size }, nodes))
+				++numMalformedBuffers;
+		}
+
+		EXPECT_EQ(buffer.size() - 4, numMalformedBuffers);
+	}
+
+	TEST(TEST_CLASS, CannotDeserializeUnknownNodeType) {
+		// Arrange:
+		TestContext context;
+		auto buffer = SerializeTreeNodes(context.lookupWithProof(0x64'6F'67'65));
+		buffer[0] = 2;
+
+		// Act:
+		std::vector<TreeNode> nodes;
+		auto isDeserialized = TryDeserializeTreeNodes(buffer, nodes);
+
+		// Assert:
+		EXPECT_FALSE(isDeserialized);
+	}
+
+	// endregion
+}}
@@ -56,13 +56,15 @@ namespace catapult { namespace tree {
 
 		class MemoryDataSource {
 		public:
-			explicit MemoryDataSource(bool verbose = true) : m_verbose(verbose)
+			explicit MemoryDataSource(bool verbose = true)
+					: m_verbose(verbose)
+					, m_numSaves(0)
 			{}
 
 		public:
 			const TreeNode* get(const Hash256& hash) const {
 				auto iter = m_nodes.find(hash);
-				return m_nodes.cend() != iter ? iter->second.get() : nullptr;
+				return m_nodes.cend() != iter ? iter->second.pNode.get() : nullptr;
 			}
 
 		public:
@@ -93,6 +95,12 @@ namespace catapult { namespace tree {
 				save(node);
 			}
 
+			void remove(const Hash256& hash) {
+				auto iter = m_nodes.find(hash);
+				if (m_nodes.end() != iter && 0 == --iter->second.RefCount)
+					m_nodes.erase(iter);
+			}
+
 		public:
 			size_t size() const {
 				return m_nodes.size();
@@ -102,15 +110,31 @@ namespace catapult { namespace tree {
 				return !!get(hash);
 			}
 
+			size_t numSaves() const {
+				return m_numSaves;
+			}
+
 		private:
 			template<typename TNode>
 			void save(const TNode& node) {
-				m_nodes.emplace(node.hash(), std::make_unique<TreeNode>(node));
+				auto& entry = m_nodes[node.hash()];
+				if (!entry.pNode)
+					entry.pNode = std::make_unique<TreeNode>(node);
+
+				++entry.RefCount;
+				++m_numSaves;
 			}
 
+		private:
+			struct NodeEntry {
+				std::unique_ptr<TreeNode> pNode;
+				size_t RefCount = 0;
+			};
+
 		private:
 			bool m_verbose;
-			std::unordered_map<Hash256, std::unique_ptr<TreeNode>, utils::ArrayHasher<Hash256>> m_nodes;
+			size_t m_numSaves;
+			std::unordered_map<Hash256, NodeEntry, utils::ArrayHasher<Hash256>> m_nodes;
 		};
 	}
 
@@ -1342,6 +1366,102 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region lookupWithProof
+
+	namespace {
+		using ProofTestTree = PatriciaTree<PassThroughEncoder, MemoryDataSource>;
+
+		void SeedPuppyTree(ProofTestTree& tree) {
+			// root branch (no path) with links 6 and 7 (stallion leaf)
+			// - link 6: branch (path 4 6 F) with links 0 (verb leaf) and 6
+			//   - link 6: branch (path 7) with links 0 (puppy leaf) and 6 (coin leaf)
+			tree.set(0x64'6F'00'00, "verb");
+			tree.set(0x64'6F'67'00, "puppy");
+			tree.set(0x64'6F'67'65, "coin");
+			tree.set(0x7A'6F'72'73, "stallion");
+		}
+
+		void AssertLinkedNodePath(const Hash256& root, uint32_t key, const std::vector<TreeNode>& nodePath) {
+			auto expectedHash = root;
+			auto keyPath = TreeNodePath(key);
+			for (auto i = 0u; i < nodePath.size(); ++i) {
+				const auto& node = nodePath[i];
+				EXPECT_EQ(expectedHash, node.hash()) << "node at " << i;
+				if (!node.isBranch())
+					break;
+
+				auto differenceIndex = FindFirstDifferenceIndex(node.path(), keyPath);
+				expectedHash = node.asBranchNode().link(keyPath.nibbleAt(differenceIndex));
+				keyPath = keyPath.subpath(differenceIndex + 1);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, LookupWithProofReturnsNoNodesWhenTreeIsEmpty) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		ProofTestTree tree(dataSource);
+
+		// Act:
+		auto nodePath = tree.lookupWithProof(0x64'6F'67'00);
+
+		// Assert:
+		EXPECT_TRUE(nodePath.empty());
+	}
+
+	TEST(TEST_CLASS, LookupWithProofReturnsAllNodesOnPathToKeyInTree) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		ProofTestTree tree(dataSource);
+		SeedPuppyTree(tree);
+
+		// Act:
+		auto coinNodePath = tree.lookupWithProof(0x64'6F'67'65);
+		auto stallionNodePath = tree.lookupWithProof(0x7A'6F'72'73);
+
+		// Assert:
+		ASSERT_EQ(4u, coinNodePath.size());
+		AssertLinkedNodePath(tree.root(), 0x64'6F'67'65, coinNodePath);
+		ASSERT_TRUE(coinNodePath.back().isLeaf());
+		EXPECT_EQ(PassThroughEncoder::EncodeValue("coin"), coinNodePath.back().asLeafNode().value());
+
+		ASSERT_EQ(2u, stallionNodePath.size());
+		AssertLinkedNodePath(tree.root(), 0x7A'6F'72'73, stallionNodePath);
+		ASSERT_TRUE(stallionNodePath.back().isLeaf());
+		EXPECT_EQ(PassThroughEncoder::EncodeValue("stallion"), stallionNodePath.back().asLeafNode().value());
+	}
+
+	TEST(TEST_CLASS, LookupWithProofReturnsNodesUpToFirstNonMatchingNodeWhenKeyIsNotInTree) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		ProofTestTree tree(dataSource);
+		SeedPuppyTree(tree);
+
+		// Act + Assert: root branch does not have link 5
+		auto nodePath = tree.lookupWithProof(0x54'6F'67'00);
+		EXPECT_EQ(1u, nodePath.size());
+		AssertLinkedNodePath(tree.root(), 0x54'6F'67'00, nodePath);
+
+		// - branch path (4 6 F) diverges
+		nodePath = tree.lookupWithProof(0x6A'6F'67'00);
+		EXPECT_EQ(2u, nodePath.size());
+		AssertLinkedNodePath(tree.root(), 0x6A'6F'67'00, nodePath);
+
+		// - branch (7) does not have link 4
+		nodePath = tree.lookupWithProof(0x64'6F'67'44);
+		ASSERT_EQ(3u, nodePath.size());
+		AssertLinkedNodePath(tree.root(), 0x64'6F'67'44, nodePath);
+		EXPECT_TRUE(nodePath.back().isBranch());
+
+		// - leaf (coin) path diverges
+		nodePath = tree.lookupWithProof(0x64'6F'67'66);
+		ASSERT_EQ(4u, nodePath.size());
+		AssertLinkedNodePath(tree.root(), 0x64'6F'67'66, nodePath);
+		EXPECT_TRUE(nodePath.back().isLeaf());
+	}
+
+	// endregion
+
 	// region any order tests
 
 	namespace {
@@ -1424,4 +1544,327 @@ namespace catapult { namespace tree {
 	}
 
 	// endregion
+
+	// region batch
+
+	namespace {
+		using BatchTestTree = PatriciaTree<PassThroughEncoder, MemoryDataSource>;
+		using KeyValuePairs = std::vector<std::pair<uint32_t, std::string>>;
+
+		KeyValuePairs GenerateKeyValuePairs(size_t count, uint32_t seed) {
+			// mix keys with random prefixes and keys with long shared prefixes
+			KeyValuePairs pairs;
+			for (auto i = 0u; i < count; ++i) {
+				auto key = 0 == i % 2 ? static_cast<uint32_t>(test::Random()) : 0x1234'0000 + seed + i;
+				pairs.emplace_back(key, "value " + std::to_string(seed + i));
+			}
+
+			return pairs;
+		}
+
+		std::vector<uint32_t> ExtractKeys(const KeyValuePairs& pairs, size_t step) {
+			std::vector<uint32_t> keys;
+			for (auto i = 0u; i < pairs.size(); i += step)
+				keys.push_back(pairs[i].first);
+
+			return keys;
+		}
+
+		Hash256 CalculateExpectedRoot(const KeyValuePairs& seedPairs, const KeyValuePairs& pairs, const std::vector<uint32_t>& keys) {
+			MemoryDataSource dataSource(false);
+			BatchTestTree tree(dataSource);
+			for (const auto& pair : seedPairs)
+				tree.set(pair.first, pair.second);
+
+			for (const auto& pair : pairs)
+				tree.set(pair.first, pair.second);
+
+			for (auto key : keys)
+				tree.unset(key);
+
+			return tree.root();
+		}
+
+		void SeedTree(BatchTestTree& tree, const KeyValuePairs& seedPairs) {
+			for (const auto& pair : seedPairs)
+				tree.set(pair.first, pair.second);
+		}
+	}
+
+	TEST(TEST_CLASS, TreeInitiallyHasNoPendingChanges) {
+		// Act:
+		MemoryDataSource dataSource;
+		BatchTestTree tree(dataSource);
+
+		// Assert:
+		EXPECT_FALSE(tree.hasPendingChanges());
+	}
+
+	TEST(TEST_CLASS, BatchChangesAreNotVisibleBeforeCommit) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		SeedTree(tree, GenerateKeyValuePairs(10, 0));
+		auto originalRoot = tree.root();
+
+		// Act:
+		tree.batchSet(GenerateKeyValuePairs(10, 100));
+
+		// Assert:
+		EXPECT_TRUE(tree.hasPendingChanges());
+		EXPECT_EQ(originalRoot, tree.root());
+	}
+
+	TEST(TEST_CLASS, CannotModifyOrLookupTreeWithPendingChanges) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		tree.batchUnset({ 0x1234'0000 });
+
+		// Act + Assert:
+		EXPECT_THROW(tree.set(0x1234'0001, "alpha"), catapult_runtime_error);
+		EXPECT_THROW(tree.unset(0x1234'0001), catapult_runtime_error);
+		EXPECT_THROW(tree.lookup(0x1234'0001), catapult_runtime_error);
+		EXPECT_THROW(tree.lookupWithProof(0x1234'0001), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CommitWithoutPendingChangesHasNoEffect) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		SeedTree(tree, GenerateKeyValuePairs(10, 0));
+		auto originalRoot = tree.root();
+		auto numSaves = dataSource.numSaves();
+
+		// Act:
+		tree.commit();
+
+		// Assert:
+		EXPECT_FALSE(tree.hasPendingChanges());
+		EXPECT_EQ(originalRoot, tree.root());
+		EXPECT_EQ(numSaves, dataSource.numSaves());
+	}
+
+	TEST(TEST_CLASS, BatchSetIntoEmptyTreeProducesSameTreeAsSet) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto pairs = GenerateKeyValuePairs(500, 0);
+
+		// Act:
+		tree.batchSet(pairs);
+		tree.commit();
+
+		// Assert:
+		EXPECT_FALSE(tree.hasPendingChanges());
+		EXPECT_EQ(CalculateExpectedRoot({}, pairs, {}), tree.root());
+		AssertLeaves(tree, pairs);
+	}
+
+	TEST(TEST_CLASS, BatchSetIntoExistingTreeProducesSameTreeAsSet) {
+		// Arrange: update some existing values and insert new ones
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto seedPairs = GenerateKeyValuePairs(500, 0);
+		SeedTree(tree, seedPairs);
+
+		auto pairs = GenerateKeyValuePairs(200, 1000);
+		for (auto i = 0u; i < seedPairs.size(); i += 5)
+			pairs.emplace_back(seedPairs[i].first, "updated " + seedPairs[i].second);
+
+		// Act:
+		tree.batchSet(pairs);
+		tree.commit();
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedRoot(seedPairs, pairs, {}), tree.root());
+		AssertLeaves(tree, pairs);
+	}
+
+	TEST(TEST_CLASS, BatchSetUsesLastValueOfDuplicateKeys) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		KeyValuePairs pairs{ { 0x1234'0001, "alpha" }, { 0x1234'0002, "beta" }, { 0x1234'0001, "gamma" } };
+
+		// Act:
+		tree.batchSet(pairs);
+		tree.commit();
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedRoot({}, pairs, {}), tree.root());
+		AssertLeaves(tree, { { 0x1234'0001, "gamma" }, { 0x1234'0002, "beta" } });
+	}
+
+	TEST(TEST_CLASS, BatchUnsetProducesSameTreeAsUnset) {
+		// Arrange: remove existing and unknown keys
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto seedPairs = GenerateKeyValuePairs(500, 0);
+		SeedTree(tree, seedPairs);
+
+		auto keys = ExtractKeys(seedPairs, 3);
+		keys.push_back(0x1234'FFFF);
+		keys.push_back(0xFFFF'FFFF);
+
+		// Act:
+		tree.batchUnset(keys);
+		tree.commit();
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedRoot(seedPairs, {}, keys), tree.root());
+		AssertNotLeaves(tree, std::unordered_set<uint32_t>(keys.cbegin(), keys.cend()));
+	}
+
+	TEST(TEST_CLASS, BatchUnsetOfAllKeysProducesEmptyTree) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto seedPairs = GenerateKeyValuePairs(100, 0);
+		SeedTree(tree, seedPairs);
+
+		// Act:
+		tree.batchUnset(ExtractKeys(seedPairs, 1));
+		tree.commit();
+
+		// Assert:
+		EXPECT_EQ(Hash256(), tree.root());
+	}
+
+	TEST(TEST_CLASS, MixedBatchChangesProduceSameTreeAsPerKeyChanges) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto seedPairs = GenerateKeyValuePairs(500, 0);
+		SeedTree(tree, seedPairs);
+
+		auto pairs = GenerateKeyValuePairs(200, 1000);
+		auto keys = ExtractKeys(seedPairs, 2);
+
+		// Act: sets are applied before unsets in both trees
+		tree.batchSet(pairs);
+		tree.batchUnset(keys);
+		tree.commit();
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedRoot(seedPairs, pairs, keys), tree.root());
+		AssertLeaves(tree, pairs);
+	}
+
+	TEST(TEST_CLASS, CanApplyMultipleBatchesToTree) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto pairs1 = GenerateKeyValuePairs(300, 0);
+		auto pairs2 = GenerateKeyValuePairs(300, 1000);
+		auto keys = ExtractKeys(pairs1, 4);
+
+		// Act:
+		tree.batchSet(pairs1);
+		tree.commit();
+
+		tree.batchSet(pairs2);
+		tree.batchUnset(keys);
+		tree.commit();
+
+		// Assert:
+		auto expectedPairs = pairs1;
+		expectedPairs.insert(expectedPairs.end(), pairs2.cbegin(), pairs2.cend());
+		EXPECT_EQ(CalculateExpectedRoot({}, expectedPairs, keys), tree.root());
+	}
+
+	TEST(TEST_CLASS, BatchCommitSavesEachModifiedNodeOnce) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto pairs = GenerateKeyValuePairs(500, 0);
+
+		// Act:
+		tree.batchSet(pairs);
+		tree.commit();
+
+		// Assert: no node was saved multiple times
+		EXPECT_EQ(dataSource.size(), dataSource.numSaves());
+
+		// Sanity: per-key updates save (intermediate) upper nodes multiple times
+		MemoryDataSource perKeyDataSource(false);
+		BatchTestTree perKeyTree(perKeyDataSource);
+		SeedTree(perKeyTree, pairs);
+		EXPECT_EQ(perKeyTree.root(), tree.root());
+		EXPECT_LT(dataSource.numSaves(), perKeyDataSource.numSaves());
+	}
+
+	TEST(TEST_CLASS, BatchCommitRemovesReplacedNodesFromDataSource) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto seedPairs = GenerateKeyValuePairs(500, 0);
+		tree.batchSet(seedPairs);
+		tree.commit();
+
+		auto pairs = GenerateKeyValuePairs(200, 1000);
+		for (auto i = 0u; i < seedPairs.size(); i += 5)
+			pairs.emplace_back(seedPairs[i].first, "updated " + seedPairs[i].second);
+
+		auto keys = ExtractKeys(seedPairs, 3);
+
+		// Act:
+		tree.batchSet(pairs);
+		tree.batchUnset(keys);
+		tree.commit();
+
+		// Assert: the data source only contains the nodes of a tree created directly from the final key value pairs
+		MemoryDataSource expectedDataSource(false);
+		BatchTestTree expectedTree(expectedDataSource);
+		expectedTree.batchSet(seedPairs);
+		expectedTree.batchSet(pairs);
+		expectedTree.batchUnset(keys);
+		expectedTree.commit();
+
+		EXPECT_EQ(expectedTree.root(), tree.root());
+		EXPECT_EQ(expectedDataSource.size(), dataSource.size());
+	}
+
+	TEST(TEST_CLASS, BatchCommitDoesNotRemoveNodesThatAreStillReferenced) {
+		// Arrange: all leaves have the same path (after the first nibble) and value, so they are identical nodes
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		tree.batchSet({ { 0x1000'0000, "alpha" }, { 0x2000'0000, "alpha" }, { 0x3000'0000, "alpha" } });
+		tree.commit();
+
+		// Sanity: root branch and a single leaf node
+		EXPECT_EQ(2u, dataSource.size());
+
+		// Act:
+		tree.batchUnset({ 0x1000'0000 });
+		tree.commit();
+
+		// Assert: the shared leaf is still available
+		EXPECT_EQ(2u, dataSource.size());
+		AssertLeaves(tree, { { 0x2000'0000, "alpha" }, { 0x3000'0000, "alpha" } });
+		AssertNotLeaves(tree, { 0x1000'0000 });
+	}
+
+	TEST(TEST_CLASS, BatchCommitUsesExecutorToHashIndependentSubtrees) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		BatchTestTree tree(dataSource);
+		auto pairs = GenerateKeyValuePairs(500, 0);
+		tree.batchSet(pairs);
+
+		// Act: run actions in reverse order to ensure they are independent
+		std::vector<size_t> numActionsPerCall;
+		tree.commit([&numActionsPerCall](const auto& actions) {
+			numActionsPerCall.push_back(actions.size());
+			for (auto iter = actions.crbegin(); actions.crend() != iter; ++iter)
+				(*iter)();
+		});
+
+		// Assert:
+		ASSERT_EQ(1u, numActionsPerCall.size());
+		EXPECT_LT(1u, numActionsPerCall[0]);
+		EXPECT_EQ(CalculateExpectedRoot({}, pairs, {}), tree.root());
+	}
+
+	// endregion
 }}
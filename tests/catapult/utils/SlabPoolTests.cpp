@@ -0,0 +1,332 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/SlabPool.h"
+#include "tests/TestHarness.h"
+#include <cstring>
+#include <set>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS SlabPoolTests
+
+	namespace {
+		constexpr size_t Slab_Size = 1024;
+
+		void AssertStatistics(
+				const SlabPool& pool,
+				uint64_t expectedNumSlabs,
+				uint64_t expectedNumBlocks,
+				uint64_t expectedNumBlockBytes) {
+			auto statistics = pool.statistics();
+			EXPECT_EQ(expectedNumSlabs, statistics.NumSlabs);
+			EXPECT_EQ(expectedNumSlabs * Slab_Size, statistics.NumReservedBytes);
+			EXPECT_EQ(expectedNumBlocks, statistics.NumBlocks);
+			EXPECT_EQ(expectedNumBlockBytes, statistics.NumBlockBytes);
+		}
+	}
+
+	// region allocate / deallocate
+
+	TEST(TEST_CLASS, PoolIsInitiallyEmpty) {
+		// Act:
+		SlabPool pool(Slab_Size);
+
+		// Assert:
+		AssertStatistics(pool, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CanAllocateBlock) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+
+		// Act:
+		auto* pBlock = pool.allocate(40);
+
+		// Assert: block size is rounded up to alignment
+		EXPECT_TRUE(!!pBlock);
+		EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(pBlock) % SlabPool::Block_Alignment);
+		AssertStatistics(pool, 1, 1, 48);
+
+		pool.deallocate(pBlock, 40);
+	}
+
+	TEST(TEST_CLASS, BlocksOfSameSizeAreCarvedFromSameSlab) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+
+		// Act: 1024 / 64 blocks fit into a single slab
+		std::vector<void*> blocks;
+		for (auto i = 0u; i < 16; ++i)
+			blocks.push_back(pool.allocate(64));
+
+		// Assert:
+		AssertStatistics(pool, 1, 16, 16 * 64);
+		for (auto i = 1u; i < blocks.size(); ++i)
+			EXPECT_EQ(static_cast<uint8_t*>(blocks[i - 1]) + 64, blocks[i]) << "block at " << i;
+
+		for (auto* pBlock : blocks)
+			pool.deallocate(pBlock, 64);
+	}
+
+	TEST(TEST_CLASS, NewSlabIsReservedWhenSlabIsExhausted) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+		std::vector<void*> blocks;
+		for (auto i = 0u; i < 16; ++i)
+			blocks.push_back(pool.allocate(64));
+
+		// Act:
+		blocks.push_back(pool.allocate(64));
+
+		// Assert:
+		AssertStatistics(pool, 2, 17, 17 * 64);
+
+		for (auto* pBlock : blocks)
+			pool.deallocate(pBlock, 64);
+	}
+
+	TEST(TEST_CLASS, BlocksOfDifferentSizeClassesAreCarvedFromDifferentSlabs) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+
+		// Act:
+		auto* pBlock1 = pool.allocate(16);
+		auto* pBlock2 = pool.allocate(17);
+
+		// Assert:
+		AssertStatistics(pool, 2, 2, 16 + 32);
+
+		pool.deallocate(pBlock1, 16);
+		pool.deallocate(pBlock2, 17);
+	}
+
+	TEST(TEST_CLASS, DeallocatedBlocksAreReused) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+		auto* pBlock1 = pool.allocate(100);
+		auto* pBlock2 = pool.allocate(100);
+
+		// Act:
+		pool.deallocate(pBlock1, 100);
+		auto* pBlock3 = pool.allocate(100);
+
+		// Assert: the most recently freed block is reused and no new slab is reserved
+		EXPECT_EQ(pBlock1, pBlock3);
+		AssertStatistics(pool, 1, 2, 2 * 112);
+
+		pool.deallocate(pBlock2, 100);
+		pool.deallocate(pBlock3, 100);
+	}
+
+	TEST(TEST_CLASS, DeallocateUpdatesStatistics) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+		auto* pBlock1 = pool.allocate(100);
+		auto* pBlock2 = pool.allocate(10);
+
+		// Act:
+		pool.deallocate(pBlock1, 100);
+
+		// Assert: active slabs are retained
+		AssertStatistics(pool, 2, 1, 16);
+
+		pool.deallocate(pBlock2, 10);
+		AssertStatistics(pool, 2, 0, 0);
+	}
+
+	TEST(TEST_CLASS, EmptySlabIsReleasedWhenNotActive) {
+		// Arrange: fill the first slab and start a second (active) one
+		SlabPool pool(Slab_Size);
+		std::vector<void*> blocks;
+		for (auto i = 0u; i < 17; ++i)
+			blocks.push_back(pool.allocate(64));
+
+		// Act: empty the first slab
+		for (auto i = 0u; i < 16; ++i)
+			pool.deallocate(blocks[i], 64);
+
+		// Assert:
+		AssertStatistics(pool, 1, 1, 64);
+
+		pool.deallocate(blocks[16], 64);
+		AssertStatistics(pool, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, FreeBlocksInInactiveSlabsAreReusedBeforeNewSlabIsReserved) {
+		// Arrange: fill two slabs and free one block from the first (inactive) slab
+		SlabPool pool(Slab_Size);
+		std::vector<void*> blocks;
+		for (auto i = 0u; i < 32; ++i)
+			blocks.push_back(pool.allocate(64));
+
+		pool.deallocate(blocks[3], 64);
+
+		// Act:
+		auto* pBlock = pool.allocate(64);
+
+		// Assert:
+		EXPECT_EQ(blocks[3], pBlock);
+		AssertStatistics(pool, 2, 32, 32 * 64);
+
+		blocks[3] = pBlock;
+		for (auto* pBlockToFree : blocks)
+			pool.deallocate(pBlockToFree, 64);
+	}
+
+	TEST(TEST_CLASS, FreeBlocksInAllInactiveSlabsAreReusedBeforeNewSlabIsReserved) {
+		// Arrange: fill four slabs and free one block from each of the first three (inactive) slabs
+		SlabPool pool(Slab_Size);
+		std::vector<void*> blocks;
+		for (auto i = 0u; i < 64; ++i)
+			blocks.push_back(pool.allocate(64));
+
+		std::set<void*> freedBlocks{ blocks[1], blocks[17], blocks[33] };
+		for (auto* pFreedBlock : freedBlocks)
+			pool.deallocate(pFreedBlock, 64);
+
+		// Act:
+		std::set<void*> reusedBlocks;
+		for (auto i = 0u; i < 3; ++i)
+			reusedBlocks.insert(pool.allocate(64));
+
+		// Assert:
+		EXPECT_EQ(freedBlocks, reusedBlocks);
+		AssertStatistics(pool, 4, 64, 64 * 64);
+
+		for (auto* pBlockToFree : blocks)
+			pool.deallocate(pBlockToFree, 64);
+	}
+
+	TEST(TEST_CLASS, ReleasedSlabIsNoLongerReused) {
+		// Arrange: fill three slabs and partially free the first two (inactive) slabs
+		SlabPool pool(Slab_Size);
+		std::vector<void*> blocks;
+		for (auto i = 0u; i < 48; ++i)
+			blocks.push_back(pool.allocate(64));
+
+		pool.deallocate(blocks[20], 64);
+		for (auto i = 0u; i < 16; ++i)
+			pool.deallocate(blocks[i], 64);
+
+		// Act: the first slab is released, so only the second slab has a free block
+		auto* pBlock = pool.allocate(64);
+
+		// Assert:
+		EXPECT_EQ(blocks[20], pBlock);
+		AssertStatistics(pool, 2, 32, 32 * 64);
+
+		blocks[20] = pBlock;
+		for (auto i = 16u; i < 48; ++i)
+			pool.deallocate(blocks[i], 64);
+	}
+
+	TEST(TEST_CLASS, LargeAllocationsBypassPool) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+
+		// Act:
+		auto* pBlock = pool.allocate(SlabPool::Max_Block_Size + 1);
+		std::memset(pBlock, 0xCC, SlabPool::Max_Block_Size + 1);
+
+		// Assert:
+		AssertStatistics(pool, 0, 0, 0);
+
+		pool.deallocate(pBlock, SlabPool::Max_Block_Size + 1);
+	}
+
+	TEST(TEST_CLASS, AllocatedBlocksDoNotOverlap) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+
+		// Act:
+		std::set<uint8_t*> blocks;
+		for (auto i = 0u; i < 100; ++i) {
+			auto* pBlock = static_cast<uint8_t*>(pool.allocate(48));
+			std::memset(pBlock, static_cast<uint8_t>(i), 48);
+			blocks.insert(pBlock);
+		}
+
+		// Assert:
+		EXPECT_EQ(100u, blocks.size());
+		auto* pPrevious = static_cast<uint8_t*>(nullptr);
+		for (auto* pBlock : blocks) {
+			if (pPrevious)
+				EXPECT_LE(pPrevious + 48, pBlock);
+
+			pPrevious = pBlock;
+		}
+
+		for (auto* pBlock : blocks)
+			pool.deallocate(pBlock, 48);
+	}
+
+	// endregion
+
+	// region SlabAllocator
+
+	TEST(TEST_CLASS, AllocatorAllocatesFromPool) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+		SlabAllocator<uint64_t> allocator(pool);
+
+		// Act:
+		auto* pValues = allocator.allocate(5);
+
+		// Assert:
+		AssertStatistics(pool, 1, 1, 48);
+
+		allocator.deallocate(pValues, 5);
+		AssertStatistics(pool, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AllocatorsSharingPoolAreEqual) {
+		// Arrange:
+		SlabPool pool1(Slab_Size);
+		SlabPool pool2(Slab_Size);
+		SlabAllocator<uint64_t> allocator1(pool1);
+		SlabAllocator<uint8_t> allocator2(allocator1);
+		SlabAllocator<uint64_t> allocator3(pool2);
+
+		// Act + Assert:
+		EXPECT_EQ(&pool1, &allocator2.pool());
+		EXPECT_TRUE(allocator1 == allocator2);
+		EXPECT_FALSE(allocator1 != allocator2);
+		EXPECT_FALSE(allocator1 == allocator3);
+		EXPECT_TRUE(allocator1 != allocator3);
+	}
+
+	TEST(TEST_CLASS, CanAllocateSharedObjectsWithAllocator) {
+		// Arrange:
+		SlabPool pool(Slab_Size);
+
+		// Act:
+		auto pValue = std::allocate_shared<uint64_t>(SlabAllocator<uint64_t>(pool), 0x1234'5678'9ABC'DEF0);
+
+		// Assert: the object and its reference counts share a single block
+		EXPECT_EQ(0x1234'5678'9ABC'DEF0u, *pValue);
+		EXPECT_EQ(1u, pool.statistics().NumBlocks);
+
+		pValue.reset();
+		EXPECT_EQ(0u, pool.statistics().NumBlocks);
+	}
+
+	// endregion
+}}
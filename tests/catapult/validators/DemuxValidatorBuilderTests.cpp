@@ -260,5 +260,38 @@ namespace catapult { namespace validators {
 		});
 	}
 
+	TEST(TEST_CLASS, MatchingValidatorsAreInvokedInRegistrationOrder) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		size_t numIsSuppressedFailureCalls = 0;
+		stateful::DemuxValidatorBuilder builder;
+
+		auto cache = test::CreateEmptyCatapultCache();
+		auto cacheView = cache.createView();
+		auto context = test::CreateValidatorContext(Height(123), cacheView.toReadOnly());
+
+		builder
+			.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "a1"))
+			.add(CreateBreadcrumbValidator(breadcrumbs, "x1"))
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "p1"))
+			.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "a2"))
+			.add(CreateBreadcrumbValidator(breadcrumbs, "x2"))
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "p2"));
+		auto pValidator = builder.build([&numIsSuppressedFailureCalls](auto) {
+			++numIsSuppressedFailureCalls;
+			return false;
+		});
+
+		// Act:
+		auto result = test::ValidateNotification<model::Notification>(*pValidator, model::AccountPublicKeyNotification(Key()), context);
+
+		// Assert: only matching validators are invoked (and their results checked)
+		EXPECT_EQ(ValidationResult::Success, result);
+
+		Breadcrumbs expectedSelectedNames{ "x1", "p1", "x2", "p2" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+		EXPECT_EQ(4u, numIsSuppressedFailureCalls);
+	}
+
 	// endregion
 }}
@@ -100,6 +100,7 @@ namespace catapult { namespace local {
 
 		// Assert: check candidate counters
 		EXPECT_TRUE(test::HasCounter(counters, "ACNTST C")) << "cache counters";
+		EXPECT_TRUE(test::HasCounter(counters, "ACCOUN CMT MS")) << "cache commit counters";
 		EXPECT_TRUE(test::HasCounter(counters, "TX ELEM TOT")) << "service local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UNLKED ACCTS")) << "peer local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE")) << "basic local node counters";
@@ -26,6 +26,7 @@
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
 #include "tests/test/nodeps/Atomics.h"
+#include <cstring>
 #include <numeric>
 
 namespace catapult {
@@ -47,6 +48,13 @@ namespace catapult { namespace test {
 		Non_Iterable
 	};
 
+	/// Calculates the state root of a simple cache with \a id.
+	inline Hash256 CalculateSimpleCacheStateRoot(size_t id) {
+		Hash256 stateRoot{};
+		std::memcpy(stateRoot.data(), &id, sizeof(size_t));
+		return stateRoot;
+	}
+
 	// region SimpleCacheView
 
 	/// Basic view on top of the simple cache.
@@ -216,12 +224,14 @@ namespace catapult { namespace test {
 		using CacheReadOnlyType = SimpleCacheReadOnlyType;
 
 	public:
-		/// Creates a cache with an optional auto set flag (\a pFlag) and view \a mode.
+		/// Creates a cache with an optional auto set flag (\a pFlag), view \a mode and state root support (\a shouldEnableStateRoot).
 		explicit BasicSimpleCache(
 				const std::shared_ptr<const test::AutoSetFlag::State>& pFlag = nullptr,
-				SimpleCacheViewMode mode = SimpleCacheViewMode::Iterable)
+				SimpleCacheViewMode mode = SimpleCacheViewMode::Iterable,
+				bool shouldEnableStateRoot = false)
 				: m_pFlag(pFlag)
 				, m_mode(mode)
+				, m_shouldEnableStateRoot(shouldEnableStateRoot)
 				, m_id(0)
 		{}
 
@@ -252,9 +262,19 @@ namespace catapult { namespace test {
 			m_id = delta.id();
 		}
 
+		/// Gets the cache state root (\a stateRoot) and returns \c true if state roots are enabled.
+		bool tryGetStateRoot(Hash256& stateRoot) const {
+			if (!m_shouldEnableStateRoot)
+				return false;
+
+			stateRoot = CalculateSimpleCacheStateRoot(m_id);
+			return true;
+		}
+
 	private:
 		std::shared_ptr<const test::AutoSetFlag::State> m_pFlag;
 		SimpleCacheViewMode m_mode;
+		bool m_shouldEnableStateRoot;
 		size_t m_id;
 	};
 
@@ -266,7 +286,9 @@ namespace catapult { namespace test {
 
 	public:
 		/// Creates a cache around \a config.
-		SimpleCache(const cache::CacheConfiguration& = cache::CacheConfiguration()) : SynchronizedCache(BasicSimpleCache())
+		/// \note State roots are enabled when patricia trees are enabled.
+		SimpleCache(const cache::CacheConfiguration& config = cache::CacheConfiguration())
+				: SynchronizedCache(BasicSimpleCache(nullptr, SimpleCacheViewMode::Iterable, config.ShouldEnablePatriciaTrees))
 		{}
 
 		/// Creates a cache with \a mode.
@@ -34,8 +34,13 @@ namespace catapult { namespace test {
 	}
 
 	model::TransactionInfo CreateTransactionInfoWithDeadline(size_t deadline) {
+		return CreateTransactionInfoWithDeadlineAndFee(deadline, GenerateRandomValue<Amount>());
+	}
+
+	model::TransactionInfo CreateTransactionInfoWithDeadlineAndFee(size_t deadline, Amount fee) {
 		auto pTransaction = test::GenerateRandomTransaction();
 		pTransaction->Deadline = Timestamp(deadline);
+		pTransaction->Fee = fee;
 		auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
 		test::FillWithRandomData(transactionInfo.EntityHash);
 		test::FillWithRandomData(transactionInfo.MerkleComponentHash);
@@ -33,6 +33,10 @@ namespace catapult { namespace test {
 	/// and a random hash.
 	model::TransactionInfo CreateTransactionInfoWithDeadline(size_t deadline);
 
+	/// Creates a transaction info composed of a random transaction with the specified \a deadline and \a fee
+	/// and a random hash.
+	model::TransactionInfo CreateTransactionInfoWithDeadlineAndFee(size_t deadline, Amount fee);
+
 	/// Creates \a count transaction infos with deadlines generated by \a deadlineGenerator.
 	std::vector<model::TransactionInfo> CreateTransactionInfos(size_t count, const std::function<Timestamp (size_t)>& deadlineGenerator);
 
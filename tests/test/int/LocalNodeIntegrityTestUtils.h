@@ -65,8 +65,12 @@ namespace catapult { namespace test {
 
 		/// Connects to the local node and calls \a onConnect on completion.
 		void apiCall(const consumer<const std::shared_ptr<api::RemoteChainApi>&>& onConnect) {
-			connect([onConnect](const auto& pPacketIo) {
-				auto pRemoteApi = CreateLifetimeExtendedApi(api::CreateRemoteChainApi, pPacketIo, CreateTransactionRegistry());
+			connect([onConnect, remoteIdentityKey = m_localNode.identityKey()](const auto& pPacketIo) {
+				auto pRemoteApi = CreateLifetimeExtendedApi(
+						api::CreateRemoteChainApi,
+						pPacketIo,
+						remoteIdentityKey,
+						CreateTransactionRegistry());
 				onConnect(pRemoteApi);
 			});
 		}
@@ -34,52 +34,52 @@ namespace catapult { namespace test {
 		constexpr unsigned short Local_Node_Api_Port = Local_Node_Port + 1;
 		constexpr const char* Local_Node_Private_Key = "4A236D9F894CF0C4FC8C042DB5DB41CCF35118B7B220163E5B4BC1872C1CD618";
 
-		config::NodeConfiguration CreateNodeConfiguration() {
-			auto config = config::NodeConfiguration::Uninitialized();
-			config.Port = Local_Node_Port;
-			config.ApiPort = Local_Node_Api_Port;
-			config.ShouldAllowAddressReuse = true;
+		void SetNetwork(model::NetworkInfo& network) {
+			network.Identifier = model::NetworkIdentifier::Mijin_Test;
+			network.PublicKey = crypto::KeyPair::FromString(test::Mijin_Test_Nemesis_Private_Key).publicKey();
+			network.GenerationHash = test::GetNemesisGenerationHash();
+		}
+	}
 
-			config.MaxBlocksPerSyncAttempt = 4 * 100;
-			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
+	crypto::KeyPair LoadServerKeyPair() {
+		return crypto::KeyPair::FromPrivate(crypto::PrivateKey::FromString(Local_Node_Private_Key));
+	}
 
-			config.ShortLivedCacheMaxSize = 10;
+	config::NodeConfiguration CreateLocalNodeNodeConfiguration() {
+		auto config = config::NodeConfiguration::Uninitialized();
+		config.Port = Local_Node_Port;
+		config.ApiPort = Local_Node_Api_Port;
+		config.ShouldAllowAddressReuse = true;
 
-			config.UnconfirmedTransactionsCacheMaxSize = 100;
+		config.MaxBlocksPerSyncAttempt = 4 * 100;
+		config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
 
-			config.ConnectTimeout = utils::TimeSpan::FromSeconds(10);
+		config.ShortLivedCacheMaxSize = 10;
 
-			config.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(4);
-			config.MaxPacketDataSize = utils::FileSize::FromMegabytes(100);
+		config.UnconfirmedTransactionsCacheMaxSize = 100;
 
-			config.BlockDisruptorSize = 4 * 1024;
-			config.TransactionDisruptorSize = 16 * 1024;
+		config.ConnectTimeout = utils::TimeSpan::FromSeconds(10);
 
-			config.OutgoingSecurityMode = ionet::ConnectionSecurityMode::None;
-			config.IncomingSecurityModes = ionet::ConnectionSecurityMode::None;
+		config.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(4);
+		config.MaxPacketDataSize = utils::FileSize::FromMegabytes(100);
 
-			config.Local.Host = "127.0.0.1";
-			config.Local.FriendlyName = "LOCAL";
-			config.Local.Roles = ionet::NodeRoles::Peer;
+		config.BlockDisruptorSize = 4 * 1024;
+		config.TransactionDisruptorSize = 16 * 1024;
 
-			config.OutgoingConnections.MaxConnections = 25;
-			config.OutgoingConnections.MaxConnectionAge = 10;
+		config.OutgoingSecurityMode = ionet::ConnectionSecurityMode::None;
+		config.IncomingSecurityModes = ionet::ConnectionSecurityMode::None;
 
-			config.IncomingConnections.MaxConnections = 25;
-			config.IncomingConnections.MaxConnectionAge = 10;
-			config.IncomingConnections.BacklogSize = 100;
-			return config;
-		}
+		config.Local.Host = "127.0.0.1";
+		config.Local.FriendlyName = "LOCAL";
+		config.Local.Roles = ionet::NodeRoles::Peer;
 
-		void SetNetwork(model::NetworkInfo& network) {
-			network.Identifier = model::NetworkIdentifier::Mijin_Test;
-			network.PublicKey = crypto::KeyPair::FromString(test::Mijin_Test_Nemesis_Private_Key).publicKey();
-			network.GenerationHash = test::GetNemesisGenerationHash();
-		}
-	}
+		config.OutgoingConnections.MaxConnections = 25;
+		config.OutgoingConnections.MaxConnectionAge = 10;
 
-	crypto::KeyPair LoadServerKeyPair() {
-		return crypto::KeyPair::FromPrivate(crypto::PrivateKey::FromString(Local_Node_Private_Key));
+		config.IncomingConnections.MaxConnections = 25;
+		config.IncomingConnections.MaxConnectionAge = 10;
+		config.IncomingConnections.BacklogSize = 100;
+		return config;
 	}
 
 	model::BlockChainConfiguration CreateLocalNodeBlockChainConfiguration() {
@@ -108,13 +108,20 @@ namespace catapult { namespace test {
 	config::LocalNodeConfiguration LoadLocalNodeConfiguration(
 			model::BlockChainConfiguration&& blockChainConfiguration,
 			const std::string& dataDirectory) {
+		return LoadLocalNodeConfiguration(std::move(blockChainConfiguration), CreateLocalNodeNodeConfiguration(), dataDirectory);
+	}
+
+	config::LocalNodeConfiguration LoadLocalNodeConfiguration(
+			model::BlockChainConfiguration&& blockChainConfiguration,
+			config::NodeConfiguration&& nodeConfiguration,
+			const std::string& dataDirectory) {
 		auto userConfig = config::UserConfiguration::Uninitialized();
 		userConfig.BootKey = Local_Node_Private_Key;
 		userConfig.DataDirectory = dataDirectory;
 
 		return config::LocalNodeConfiguration(
 				std::move(blockChainConfiguration),
-				CreateNodeConfiguration(),
+				std::move(nodeConfiguration),
 				config::LoggingConfiguration::Uninitialized(),
 				std::move(userConfig));
 	}
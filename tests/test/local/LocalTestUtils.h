@@ -52,6 +52,9 @@ namespace catapult { namespace test {
 	/// Returns server key pair.
 	crypto::KeyPair LoadServerKeyPair();
 
+	/// Creates a node configuration.
+	config::NodeConfiguration CreateLocalNodeNodeConfiguration();
+
 	/// Creates a block chain configuration.
 	model::BlockChainConfiguration CreateLocalNodeBlockChainConfiguration();
 
@@ -62,6 +65,13 @@ namespace catapult { namespace test {
 	/// with a storage in the specified directory (\a dataDirectory).
 	config::LocalNodeConfiguration LoadLocalNodeConfiguration(model::BlockChainConfiguration&& config, const std::string& dataDirectory);
 
+	/// Creates a test configuration for a local node according to the supplied configurations (\a blockChainConfig and \a nodeConfig)
+	/// with a storage in the specified directory (\a dataDirectory).
+	config::LocalNodeConfiguration LoadLocalNodeConfiguration(
+			model::BlockChainConfiguration&& blockChainConfig,
+			config::NodeConfiguration&& nodeConfig,
+			const std::string& dataDirectory);
+
 	/// Creates a prototypical local node configuration that is safe to use in local node tests.
 	config::LocalNodeConfiguration CreatePrototypicalLocalNodeConfiguration();
 
@@ -50,7 +50,15 @@ namespace catapult { namespace test {
 
 		/// Creates the test state around \a cache and \a timeSupplier.
 		explicit ServiceTestState(cache::CatapultCache&& cache, const supplier<Timestamp>& timeSupplier)
-				: m_config(LoadLocalNodeConfiguration(""))
+				: ServiceTestState(std::move(cache), timeSupplier, LoadLocalNodeConfiguration(""))
+		{}
+
+		/// Creates the test state around \a cache, \a timeSupplier and \a config.
+		explicit ServiceTestState(
+				cache::CatapultCache&& cache,
+				const supplier<Timestamp>& timeSupplier,
+				config::LocalNodeConfiguration&& config)
+				: m_config(std::move(config))
 				, m_catapultCache(std::move(cache))
 				, m_storage(std::make_unique<mocks::MockMemoryBasedStorage>())
 				, m_pUtCache(CreateUtCacheProxy())
@@ -152,6 +160,13 @@ namespace catapult { namespace test {
 				, m_testState(std::move(cache), timeSupplier)
 		{}
 
+		/// Creates the test context around \a cache and \a config.
+		explicit ServiceLocatorTestContext(cache::CatapultCache&& cache, config::LocalNodeConfiguration&& config)
+				: m_keyPair(GenerateKeyPair())
+				, m_locator(m_keyPair)
+				, m_testState(std::move(cache), &utils::NetworkTime, std::move(config))
+		{}
+
 	public:
 		/// Gets the value of the counter named \a counterName.
 		uint64_t counter(const std::string& counterName) const {
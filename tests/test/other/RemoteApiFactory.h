@@ -25,23 +25,29 @@
 
 namespace catapult { namespace test {
 
-	/// Creates a remote api around \a io using \a apiFactory such that the returned api extends the lifetime of \a registry.
+	/// Creates a remote api around \a io for the node with \a remoteIdentityKey using \a apiFactory such that the returned api
+	/// extends the lifetime of \a registry.
 	template<typename TRemoteApiFactory>
-	auto CreateLifetimeExtendedApi(TRemoteApiFactory apiFactory, ionet::PacketIo& io, model::TransactionRegistry&& registry) {
+	auto CreateLifetimeExtendedApi(
+			TRemoteApiFactory apiFactory,
+			ionet::PacketIo& io,
+			const Key& remoteIdentityKey,
+			model::TransactionRegistry&& registry) {
 		auto pRegistry = std::make_shared<model::TransactionRegistry>(std::move(registry));
-		auto pRemoteApi = utils::UniqueToShared(apiFactory(io, *pRegistry));
+		auto pRemoteApi = utils::UniqueToShared(apiFactory(io, remoteIdentityKey, *pRegistry));
 		return decltype(pRemoteApi)(pRemoteApi.get(), [pRegistry, pRemoteApi](const auto*) {});
 	}
 
-	/// Creates a remote api around \a pIo using \a apiFactory such that the returned api extends the lifetime of both
-	/// \a pIo and \a registry.
+	/// Creates a remote api around \a pIo for the node with \a remoteIdentityKey using \a apiFactory such that the returned api
+	/// extends the lifetime of both \a pIo and \a registry.
 	template<typename TRemoteApiFactory>
 	auto CreateLifetimeExtendedApi(
 			TRemoteApiFactory apiFactory,
 			const std::shared_ptr<ionet::PacketIo>& pIo,
+			const Key& remoteIdentityKey,
 			model::TransactionRegistry&& registry) {
 		auto pRegistry = std::make_shared<model::TransactionRegistry>(std::move(registry));
-		auto pRemoteApi = utils::UniqueToShared(apiFactory(*pIo, *pRegistry));
+		auto pRemoteApi = utils::UniqueToShared(apiFactory(*pIo, remoteIdentityKey, *pRegistry));
 		return decltype(pRemoteApi)(pRemoteApi.get(), [pIo, pRegistry, pRemoteApi](const auto*) {});
 	}
 }}
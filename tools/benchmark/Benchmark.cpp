@@ -0,0 +1,32 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	void LogThroughput(size_t numOperations, uint64_t elapsedMillis) {
+		auto elapsedMicrosPerOp = 0 == numOperations ? 0 : elapsedMillis * 1000u / numOperations;
+		auto opsPerSecond = 0 == elapsedMillis ? 0 : numOperations * 1000u / elapsedMillis;
+		CATAPULT_LOG(info)
+				<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
+				<< "(elapsed time " << elapsedMillis << "ms, " << elapsedMicrosPerOp << "us/op)";
+	}
+}}}
@@ -0,0 +1,134 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "tools/Options.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/utils/StackLogger.h"
+#include <memory>
+#include <string>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	/// Settings shared by all benchmarks.
+	struct BenchmarkSettings {
+		/// Number of threads.
+		uint32_t NumThreads;
+
+		/// Number of partitions.
+		uint32_t NumPartitions;
+
+		/// Number of operations per partition.
+		uint32_t OpsPerPartition;
+
+		/// Returns the total number of operations.
+		size_t numOperations() const {
+			return static_cast<size_t>(NumPartitions) * OpsPerPartition;
+		}
+	};
+
+	/// A benchmark that can be selected and run by the benchmark tool.
+	class Benchmark {
+	public:
+		virtual ~Benchmark() = default;
+
+	public:
+		/// Gets the name of the benchmark (used to select it from the command line).
+		virtual std::string name() const = 0;
+
+		/// Prepares benchmark-specific options using \a optionsBuilder.
+		virtual void prepareOptions(OptionsBuilder& optionsBuilder) = 0;
+
+		/// Runs the benchmark with \a settings using \a pool.
+		virtual void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool& pool) = 0;
+	};
+
+	/// Logs throughput statistics given \a numOperations completed in \a elapsedMillis.
+	void LogThroughput(size_t numOperations, uint64_t elapsedMillis);
+
+	/// Runs \a action on all \a entries in parallel on \a pool using \a numPartitions partitions.
+	/// Throughput is logged with the test name \a testName.
+	template<typename TEntries, typename TAction>
+	uint64_t RunParallel(
+			const char* testName,
+			thread::IoServiceThreadPool& pool,
+			uint32_t numPartitions,
+			TEntries& entries,
+			TAction action) {
+		utils::StackLogger stopwatch(testName, utils::LogLevel::Info);
+		thread::ParallelFor(pool.service(), entries, numPartitions, [action](auto& entry, auto) {
+			action(entry);
+			return true;
+		}).get();
+
+		auto elapsedMillis = stopwatch.millis();
+		LogThroughput(entries.size(), elapsedMillis);
+		return elapsedMillis;
+	}
+
+	/// Runs \a action once on the current thread and logs its throughput as \a numOperations operations.
+	/// Throughput is logged with the test name \a testName.
+	template<typename TAction>
+	uint64_t RunSerial(const char* testName, size_t numOperations, TAction action) {
+		utils::StackLogger stopwatch(testName, utils::LogLevel::Info);
+		action();
+
+		auto elapsedMillis = stopwatch.millis();
+		LogThroughput(numOperations, elapsedMillis);
+		return elapsedMillis;
+	}
+
+	/// Creates a benchmark that measures signing and verification throughput.
+	std::unique_ptr<Benchmark> CreateSignatureBenchmark();
+
+	/// Creates a benchmark that compares single and multi-buffer hashing throughput.
+	std::unique_ptr<Benchmark> CreateHashBenchmark();
+
+	/// Creates a benchmark that compares sequential and parallel merkle tree construction for various numbers of leaves.
+	std::unique_ptr<Benchmark> CreateMerkleBenchmark();
+
+	/// Creates a benchmark that compares per-key and batched patricia tree updates.
+	std::unique_ptr<Benchmark> CreatePatriciaTreeBenchmark();
+
+	/// Creates a benchmark that measures per-element latency through a consumer dispatcher.
+	std::unique_ptr<Benchmark> CreateDispatcherBenchmark();
+
+	/// Creates a benchmark that compares per-key and batched cache database commits.
+	std::unique_ptr<Benchmark> CreateCacheDatabaseBenchmark();
+
+	/// Creates a benchmark that compares account state cache commit latency with and without patricia tree state roots.
+	std::unique_ptr<Benchmark> CreateCacheRootsBenchmark();
+
+	/// Creates a benchmark that measures unconfirmed transactions cache add, remove and priority selection throughput.
+	std::unique_ptr<Benchmark> CreateUtCacheBenchmark();
+
+	/// Creates a benchmark that compares block replay and pull throughput of file based and packed block storages.
+	std::unique_ptr<Benchmark> CreateBlockStorageBenchmark();
+
+	/// Creates a benchmark that compares single buffer and gather packet socket writes of multi-entity payloads.
+	std::unique_ptr<Benchmark> CreateSocketBenchmark();
+
+	/// Creates a benchmark that measures notification throughput through all stateless and stateful plugin validators.
+	std::unique_ptr<Benchmark> CreateValidatorBenchmark();
+
+	/// Creates a benchmark that compares address set based and incremental importance recalculation of high value accounts.
+	std::unique_ptr<Benchmark> CreateImportanceBenchmark();
+}}}
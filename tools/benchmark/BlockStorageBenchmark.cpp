@@ -0,0 +1,148 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/PackedFileStorage.h"
+#include "catapult/io/RawFile.h"
+#include "catapult/model/Block.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <boost/filesystem.hpp>
+#include <random>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		constexpr uint32_t Num_Transactions_Per_Block = 10;
+		constexpr uint32_t Transaction_Size = 250;
+
+		std::unique_ptr<model::Block> GenerateBlock(Height height) {
+			uint32_t size = sizeof(model::BlockHeader) + Num_Transactions_Per_Block * Transaction_Size;
+			auto pBlock = utils::MakeUniqueWithSize<model::Block>(size);
+			std::generate_n(reinterpret_cast<uint8_t*>(pBlock.get()), size, []() { return static_cast<uint8_t>(std::rand()); });
+			pBlock->Size = size;
+			pBlock->Height = height;
+
+			auto* pTransactionData = reinterpret_cast<uint8_t*>(pBlock.get() + 1);
+			for (auto i = 0u; i < Num_Transactions_Per_Block; ++i)
+				reinterpret_cast<model::Transaction*>(pTransactionData + i * Transaction_Size)->Size = Transaction_Size;
+
+			return pBlock;
+		}
+
+		void SaveBlock(io::BlockStorage& storage, const model::Block& block) {
+			model::BlockElement blockElement(block);
+			blockElement.EntityHash = model::CalculateHash(block);
+			for (const auto& transaction : block.Transactions()) {
+				blockElement.Transactions.push_back(model::TransactionElement(transaction));
+				blockElement.Transactions.back().EntityHash = model::CalculateHash(transaction);
+			}
+
+			storage.saveBlock(blockElement);
+		}
+
+		class BlockStorageBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "blockstorage";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("blockstorage blocks",
+						OptionsValue<uint32_t>(m_numBlocks)->default_value(100'000),
+						"the number of blocks in each storage");
+				optionsBuilder("blockstorage directory",
+						OptionsValue<std::string>(m_storageDirectory)->default_value("benchmarkblocks"),
+						"the (temporary) storage directory");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool& pool) override {
+				auto fileDirectory = m_storageDirectory + "/file";
+				auto packedDirectory = m_storageDirectory + "/packed";
+				boost::filesystem::remove_all(m_storageDirectory);
+				boost::filesystem::create_directories(fileDirectory + "/00000");
+				boost::filesystem::create_directories(packedDirectory);
+
+				// both storages expect the nemesis block to be present, so only the file based hashes file needs to be seeded
+				{
+					io::RawFile hashFile(fileDirectory + "/00000/hashes.dat", io::OpenMode::Read_Write);
+					hashFile.write(std::vector<uint8_t>(2 * Hash256_Size));
+				}
+
+				io::FileBasedStorage fileStorage(fileDirectory);
+				io::PackedFileStorage packedStorage(packedDirectory);
+
+				CATAPULT_LOG(info) << "*** generating " << m_numBlocks << " blocks ***";
+				for (auto i = 0u; i < m_numBlocks; ++i) {
+					auto pBlock = GenerateBlock(Height(2 + i));
+					SaveBlock(fileStorage, *pBlock);
+					SaveBlock(packedStorage, *pBlock);
+				}
+
+				// random pulls are spread across the whole chain
+				std::vector<Height> randomHeights(settings.numOperations());
+				std::mt19937_64 generator;
+				std::uniform_int_distribution<uint64_t> distribution(2, m_numBlocks + 1);
+				for (auto& height : randomHeights)
+					height = Height(distribution(generator));
+
+				runStorage("File Based", fileStorage, randomHeights, settings, pool);
+				runStorage("Packed", packedStorage, randomHeights, settings, pool);
+
+				boost::filesystem::remove_all(m_storageDirectory);
+			}
+
+		private:
+			void runStorage(
+					const std::string& storageName,
+					const io::BlockStorage& storage,
+					std::vector<Height>& randomHeights,
+					const BenchmarkSettings& settings,
+					thread::IoServiceThreadPool& pool) const {
+				CATAPULT_LOG(info) << "*** " << storageName << " Storage ***";
+
+				auto numBlocks = m_numBlocks;
+				RunSerial("Sequential Replay", numBlocks, [numBlocks, &storage]() {
+					for (auto i = 0u; i < numBlocks; ++i)
+						storage.loadBlockElement(Height(2 + i));
+				});
+
+				RunParallel("Random Pulls", pool, settings.NumPartitions, randomHeights, [&storage](auto height) {
+					storage.loadBlockElement(height);
+				});
+
+				RunSerial("Hash Range Pulls", numBlocks, [numBlocks, &storage]() {
+					constexpr uint32_t Max_Hashes = 1000;
+					for (auto i = 0u; i < numBlocks; i += Max_Hashes)
+						storage.loadHashesFrom(Height(2 + i), Max_Hashes);
+				});
+			}
+
+		private:
+			uint32_t m_numBlocks;
+			std::string m_storageDirectory;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateBlockStorageBenchmark() {
+		return std::make_unique<BlockStorageBenchmark>();
+	}
+}}}
@@ -0,0 +1,131 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/cache_db/RdbColumnContainer.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/types.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		// roughly the size of a serialized account state with a few mosaic balances
+		constexpr size_t Account_State_Value_Size = 150;
+
+		constexpr uint32_t Default_Num_Changes[] = { 10'000, 100'000, 1'000'000 };
+
+		struct AccountStateChange {
+			Address Key;
+			std::string Value;
+		};
+
+		std::vector<AccountStateChange> GenerateChanges(size_t numChanges) {
+			std::vector<AccountStateChange> changes(numChanges);
+			for (auto& change : changes) {
+				std::generate_n(change.Key.begin(), change.Key.size(), []() { return static_cast<uint8_t>(std::rand()); });
+
+				change.Value.resize(Account_State_Value_Size);
+				std::generate_n(change.Value.begin(), change.Value.size(), []() { return static_cast<char>(std::rand()); });
+			}
+
+			return changes;
+		}
+
+		void ApplyChanges(cache::RdbColumnContainer& container, const std::vector<AccountStateChange>& changes) {
+			// mirror UpdateSet: write all elements followed by the new size
+			for (const auto& change : changes)
+				container.insert({ change.Key.data(), change.Key.size() }, change.Value);
+
+			container.saveSize(container.size() + changes.size());
+		}
+
+		class CacheDatabaseBenchmark : public Benchmark {
+		private:
+			enum class CommitMode { Per_Key, Batch, Batch_Without_Write_Ahead_Log };
+
+		public:
+			std::string name() const override {
+				return "cachedb";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("cachedb changes",
+						OptionsValue<uint32_t>(m_numChanges)->default_value(0),
+						"the number of account state changes per commit; 10k, 100k and 1M changes are run when zero");
+				optionsBuilder("cachedb directory",
+						OptionsValue<std::string>(m_databaseDirectory)->default_value("benchmarkdb"),
+						"the (temporary) database directory");
+			}
+
+			void run(const BenchmarkSettings&, thread::IoServiceThreadPool&) override {
+				if (0 != m_numChanges) {
+					runChanges(m_numChanges);
+					return;
+				}
+
+				for (auto numChanges : Default_Num_Changes)
+					runChanges(numChanges);
+			}
+
+		private:
+			void runChanges(uint32_t numChanges) const {
+				CATAPULT_LOG(info) << "*** " << numChanges << " account state changes ***";
+
+				auto changes = GenerateChanges(numChanges);
+				runCommit("Per-Key Commit", CommitMode::Per_Key, changes);
+				runCommit("Batch Commit", CommitMode::Batch, changes);
+				runCommit("Batch Commit (WAL disabled)", CommitMode::Batch_Without_Write_Ahead_Log, changes);
+			}
+
+			void runCommit(const char* testName, CommitMode mode, const std::vector<AccountStateChange>& changes) const {
+				// start each run with an empty database
+				boost::filesystem::remove_all(m_databaseDirectory);
+
+				{
+					cache::RocksDatabase database(m_databaseDirectory, { "accounts" });
+					cache::RdbColumnContainer container(database, 1);
+					database.setWriteAheadLogEnabled(CommitMode::Batch_Without_Write_Ahead_Log != mode);
+
+					RunSerial(testName, changes.size(), [mode, &database, &container, &changes]() {
+						if (CommitMode::Per_Key == mode) {
+							ApplyChanges(container, changes);
+							return;
+						}
+
+						cache::RdbWriteBatchGuard batchGuard(database);
+						ApplyChanges(container, changes);
+						batchGuard.commit();
+					});
+				}
+
+				boost::filesystem::remove_all(m_databaseDirectory);
+			}
+
+		private:
+			uint32_t m_numChanges;
+			std::string m_databaseDirectory;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateCacheDatabaseBenchmark() {
+		return std::make_unique<CacheDatabaseBenchmark>();
+	}
+}}}
@@ -0,0 +1,145 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/state/AccountState.h"
+#include "catapult/constants.h"
+#include <algorithm>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		constexpr uint32_t Default_Num_Changes[] = { 1'000, 10'000, 100'000 };
+
+		Address GenerateRandomAddress() {
+			Address address;
+			std::generate(address.begin(), address.end(), []() { return static_cast<uint8_t>(std::rand()); });
+			return address;
+		}
+
+		std::vector<Address> GenerateAddresses(size_t count) {
+			std::vector<Address> addresses(count);
+			std::generate(addresses.begin(), addresses.end(), GenerateRandomAddress);
+			return addresses;
+		}
+
+		std::unique_ptr<cache::AccountStateCache> CreateCache(bool shouldEnablePatriciaTrees) {
+			cache::CacheConfiguration config;
+			config.ShouldEnablePatriciaTrees = shouldEnablePatriciaTrees;
+
+			// disable high value account tracking by using a maximum minimum balance
+			auto options = cache::AccountStateCacheTypes::Options{
+				model::NetworkIdentifier::Mijin_Test,
+				123,
+				Amount(std::numeric_limits<uint64_t>::max())
+			};
+			return std::make_unique<cache::AccountStateCache>(config, options);
+		}
+
+		class CacheRootsBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "cacheroots";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("cacheroots accounts",
+						OptionsValue<uint32_t>(m_numAccounts)->default_value(100'000),
+						"the number of accounts in the account state cache before the first measured commit");
+				optionsBuilder("cacheroots changes",
+						OptionsValue<uint32_t>(m_numChanges)->default_value(0),
+						"the number of modified accounts per commit; 1k, 10k and 100k changes are run when zero");
+				optionsBuilder("cacheroots commits",
+						OptionsValue<uint32_t>(m_numCommits)->default_value(10),
+						"the number of measured commits");
+			}
+
+			void run(const BenchmarkSettings&, thread::IoServiceThreadPool&) override {
+				auto addresses = GenerateAddresses(m_numAccounts);
+				if (0 != m_numChanges) {
+					runChanges(addresses, m_numChanges);
+					return;
+				}
+
+				for (auto numChanges : Default_Num_Changes)
+					runChanges(addresses, numChanges);
+			}
+
+		private:
+			void runChanges(const std::vector<Address>& addresses, uint32_t numChanges) const {
+				CATAPULT_LOG(info) << "*** " << numChanges << " account changes per commit (" << addresses.size() << " accounts) ***";
+
+				runCommits("Commit (State Roots Disabled)", false, addresses, numChanges);
+				runCommits("Commit (State Roots Enabled)", true, addresses, numChanges);
+			}
+
+			void runCommits(
+					const char* testName,
+					bool shouldEnablePatriciaTrees,
+					const std::vector<Address>& addresses,
+					uint32_t numChanges) const {
+				auto pCache = CreateCache(shouldEnablePatriciaTrees);
+
+				// seed the cache (unmeasured)
+				{
+					auto delta = pCache->createDelta();
+					for (const auto& address : addresses)
+						delta->addAccount(address, Height(1)).Balances.credit(Xem_Id, Amount(1));
+
+					pCache->commit();
+				}
+
+				// prepare all changes upfront so that only commits are measured
+				std::vector<std::vector<Address>> changedAddressesPerCommit(m_numCommits);
+				for (auto& changedAddresses : changedAddressesPerCommit) {
+					changedAddresses.reserve(numChanges);
+					for (auto i = 0u; i < numChanges; ++i)
+						changedAddresses.push_back(addresses[static_cast<size_t>(std::rand()) % addresses.size()]);
+				}
+
+				uint64_t elapsedMillis = 0;
+				for (const auto& changedAddresses : changedAddressesPerCommit) {
+					auto delta = pCache->createDelta();
+					for (const auto& address : changedAddresses)
+						delta->get(address).Balances.credit(Xem_Id, Amount(1));
+
+					utils::StackLogger stopwatch(testName, utils::LogLevel::Trace);
+					pCache->commit();
+					elapsedMillis += stopwatch.millis();
+				}
+
+				auto numOperations = static_cast<size_t>(m_numCommits) * numChanges;
+				auto averageMillis = elapsedMillis / std::max<uint32_t>(1, m_numCommits);
+				CATAPULT_LOG(info) << testName << ": average commit latency " << averageMillis << "ms";
+				LogThroughput(numOperations, elapsedMillis);
+			}
+
+		private:
+			uint32_t m_numAccounts;
+			uint32_t m_numChanges;
+			uint32_t m_numCommits;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateCacheRootsBenchmark() {
+		return std::make_unique<CacheRootsBenchmark>();
+	}
+}}}
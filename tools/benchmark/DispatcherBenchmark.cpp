@@ -0,0 +1,151 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/model/Transaction.h"
+#include <algorithm>
+#include <thread>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		constexpr disruptor::WaitStrategy All_Wait_Strategies[] = {
+			disruptor::WaitStrategy::Sleep,
+			disruptor::WaitStrategy::Busy_Spin,
+			disruptor::WaitStrategy::Spin_Then_Yield,
+			disruptor::WaitStrategy::Blocking
+		};
+
+		disruptor::ConsumerInput CreateInput() {
+			uint8_t* pData;
+			auto range = model::TransactionRange::PrepareFixed(1, &pData);
+			std::memset(pData, 0, sizeof(model::Transaction));
+			reinterpret_cast<model::Transaction&>(*pData).Size = sizeof(model::Transaction);
+			return disruptor::ConsumerInput(std::move(range));
+		}
+
+		void LogLatencies(std::vector<uint64_t>& latencies) {
+			if (latencies.empty())
+				return;
+
+			std::sort(latencies.begin(), latencies.end());
+			uint64_t sum = 0;
+			for (auto latency : latencies)
+				sum += latency;
+
+			auto percentile = [&latencies](size_t value) { return latencies[(latencies.size() - 1) * value / 100]; };
+			CATAPULT_LOG(info)
+					<< "latency (us): avg " << sum / latencies.size()
+					<< ", p50 " << percentile(50)
+					<< ", p99 " << percentile(99)
+					<< ", max " << latencies.back();
+		}
+
+		class DispatcherBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "dispatcher";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("dispatcher stages",
+						OptionsValue<uint32_t>(m_numStages)->default_value(6),
+						"the number of dispatcher stages (consumers)");
+				optionsBuilder("dispatcher wait strategy",
+						OptionsValue<std::string>(m_waitStrategy)->default_value(""),
+						"the dispatcher wait strategy (Sleep, BusySpin, SpinThenYield, Blocking); all strategies are run when empty");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool&) override {
+				CATAPULT_LOG(info) << "dispatcher stages (" << m_numStages << ")";
+
+				if (!m_waitStrategy.empty()) {
+					disruptor::WaitStrategy waitStrategy;
+					if (!disruptor::TryParseValue(m_waitStrategy, waitStrategy))
+						CATAPULT_THROW_INVALID_ARGUMENT_1("unknown dispatcher wait strategy", m_waitStrategy);
+
+					runWaitStrategy(waitStrategy, settings.numOperations());
+					return;
+				}
+
+				for (auto waitStrategy : All_Wait_Strategies)
+					runWaitStrategy(waitStrategy, settings.numOperations());
+			}
+
+		private:
+			void runWaitStrategy(disruptor::WaitStrategy waitStrategy, size_t numElements) const {
+				CATAPULT_LOG(info) << "*** wait strategy " << waitStrategy << " ***";
+
+				auto options = disruptor::ConsumerDispatcherOptions("benchmark dispatcher", 2 * numElements + 2);
+				options.ElementTraceInterval = 2 * numElements + 2;
+				options.WaitStrategy = waitStrategy;
+
+				std::vector<disruptor::DisruptorConsumer> consumers;
+				for (auto i = 0u; i < m_numStages; ++i)
+					consumers.push_back([](const auto&) { return disruptor::ConsumerResult::Continue(); });
+
+				disruptor::ConsumerDispatcher dispatcher(options, consumers);
+
+				// 1. push elements one at a time and wait for each to complete in order to measure end-to-end latency
+				std::vector<uint64_t> latencies(numElements);
+				RunSerial("Latency", numElements, [&dispatcher, &latencies]() {
+					for (auto& latency : latencies) {
+						std::atomic_bool isComplete(false);
+						auto start = Clock::now();
+						dispatcher.processElement(CreateInput(), [start, &latency, &isComplete](auto, const auto&) {
+							latency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+									Clock::now() - start).count());
+							isComplete = true;
+						});
+
+						while (!isComplete)
+							std::this_thread::yield();
+					}
+				});
+
+				LogLatencies(latencies);
+
+				// 2. push all elements at once in order to measure throughput
+				std::vector<disruptor::ConsumerInput> inputs(numElements);
+				for (auto& input : inputs)
+					input = CreateInput();
+
+				RunSerial("Throughput", numElements, [&dispatcher, &inputs]() {
+					for (auto& input : inputs)
+						dispatcher.processElement(std::move(input));
+
+					while (0 != dispatcher.numActiveElements())
+						std::this_thread::yield();
+				});
+			}
+
+		private:
+			uint32_t m_numStages;
+			std::string m_waitStrategy;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateDispatcherBenchmark() {
+		return std::make_unique<DispatcherBenchmark>();
+	}
+}}}
@@ -0,0 +1,126 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/MultiBufferHashes.h"
+#include <algorithm>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		const char* GetImplementationName(crypto::MultiBufferKeccakImplementation implementation) {
+			switch (implementation) {
+			case crypto::MultiBufferKeccakImplementation::Avx2:
+				return "Sha3 Multi-Buffer (AVX2)";
+			case crypto::MultiBufferKeccakImplementation::Avx512:
+				return "Sha3 Multi-Buffer (AVX-512)";
+			default:
+				return "Sha3 Multi-Buffer (Portable)";
+			}
+		}
+
+		class HashBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "hash";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("hash data size",
+						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
+						"the size of each hashed buffer");
+				optionsBuilder("hash merkle leaves",
+						OptionsValue<uint32_t>(m_numMerkleLeaves)->default_value(1024),
+						"the number of leaves in each merkle tree");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool&) override {
+				CATAPULT_LOG(info) << "data size (" << m_dataSize << "), merkle leaves (" << m_numMerkleLeaves << ")";
+				CATAPULT_LOG(info) << "default multi-buffer implementation: "
+						<< GetImplementationName(crypto::GetDefaultMultiBufferKeccakImplementation());
+
+				auto numOperations = settings.numOperations();
+				std::vector<uint8_t> data(numOperations * m_dataSize);
+				std::generate(data.begin(), data.end(), []() { return static_cast<uint8_t>(std::rand()); });
+
+				std::vector<crypto::MultiBufferHashInput> inputs;
+				for (auto i = 0u; i < numOperations; ++i)
+					inputs.push_back({ { data.data() + i * m_dataSize, m_dataSize } });
+
+				// all hashing runs on the current thread in order to compare per-core throughput
+				std::vector<Hash256> expectedHashes(numOperations);
+				RunSerial("Sha3 Single", numOperations, [&inputs, &expectedHashes]() {
+					auto i = 0u;
+					for (const auto& input : inputs)
+						crypto::Sha3_256(*input.begin(), expectedHashes[i++]);
+				});
+
+				for (auto implementation : {
+					crypto::MultiBufferKeccakImplementation::Portable,
+					crypto::MultiBufferKeccakImplementation::Avx2,
+					crypto::MultiBufferKeccakImplementation::Avx512
+				}) {
+					if (!crypto::IsSupported(implementation))
+						continue;
+
+					std::vector<Hash256> hashes(numOperations);
+					RunSerial(GetImplementationName(implementation), numOperations, [&inputs, &hashes, implementation]() {
+						crypto::Sha3_256_MultiBuffer(inputs, hashes.data(), implementation);
+					});
+
+					if (expectedHashes != hashes)
+						CATAPULT_LOG(warning) << "multi-buffer hashes do not match single hashes!";
+				}
+
+				runMerkleBenchmark(numOperations);
+			}
+
+		private:
+			void runMerkleBenchmark(size_t numOperations) {
+				std::vector<Hash256> leaves(std::max<uint32_t>(1, m_numMerkleLeaves));
+				for (auto& leaf : leaves)
+					std::generate(leaf.begin(), leaf.end(), []() { return static_cast<uint8_t>(std::rand()); });
+
+				// each tree requires (approximately) as many hashes as there are leaves
+				auto numTrees = std::max<size_t>(1, numOperations / leaves.size());
+				RunSerial("Merkle Root", numTrees * leaves.size(), [&leaves, numTrees]() {
+					for (auto i = 0u; i < numTrees; ++i) {
+						crypto::MerkleHashBuilder builder(leaves.size());
+						for (const auto& leaf : leaves)
+							builder.update(leaf);
+
+						Hash256 merkleRoot;
+						builder.final(merkleRoot);
+					}
+				});
+			}
+
+		private:
+			uint32_t m_dataSize;
+			uint32_t m_numMerkleLeaves;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateHashBenchmark() {
+		return std::make_unique<HashBenchmark>();
+	}
+}}}
@@ -0,0 +1,179 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/ImportanceHeight.h"
+#include "catapult/state/AccountState.h"
+#include "catapult/constants.h"
+#include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		constexpr Amount Min_High_Value_Balance(1'000'000);
+		constexpr uint64_t Total_Chain_Balance = 8'999'999'998'000'000;
+
+		Address GenerateRandomAddress() {
+			Address address;
+			std::generate(address.begin(), address.end(), []() { return static_cast<uint8_t>(std::rand()); });
+			return address;
+		}
+
+		std::vector<Address> GenerateAddresses(size_t count) {
+			std::vector<Address> addresses(count);
+			std::generate(addresses.begin(), addresses.end(), GenerateRandomAddress);
+			return addresses;
+		}
+
+		std::unique_ptr<cache::AccountStateCache> CreateCache() {
+			auto options = cache::AccountStateCacheTypes::Options{
+				model::NetworkIdentifier::Mijin_Test,
+				123,
+				Min_High_Value_Balance
+			};
+			return std::make_unique<cache::AccountStateCache>(cache::CacheConfiguration(), options);
+		}
+
+		void SetImportance(state::AccountState& accountState, Amount activeXem, model::ImportanceHeight importanceHeight) {
+			boost::multiprecision::uint128_t importance = Total_Chain_Balance;
+			importance *= accountState.Balances.get(Xem_Id).unwrap();
+			importance /= activeXem.unwrap();
+			accountState.ImportanceInfo.set(Importance(static_cast<Importance::ValueType>(importance)), importanceHeight);
+		}
+
+		// recalculates importances by copying all high value addresses and looking up each account twice
+		size_t RecalculateWithAddressSet(cache::AccountStateCacheDelta& delta, model::ImportanceHeight importanceHeight) {
+			auto highValueAddresses = delta.highValueAddresses();
+			std::vector<state::AccountState*> highValueAccounts;
+			highValueAccounts.reserve(highValueAddresses.size());
+
+			Amount activeXem;
+			for (const auto& address : highValueAddresses) {
+				auto& accountState = delta.get(address);
+				highValueAccounts.push_back(&accountState);
+				activeXem = activeXem + accountState.Balances.get(Xem_Id);
+			}
+
+			for (auto* pAccountState : highValueAccounts)
+				SetImportance(*pAccountState, activeXem, importanceHeight);
+
+			return highValueAccounts.size();
+		}
+
+		// recalculates importances using the incrementally maintained high value balance and a single pass over all accounts
+		size_t RecalculateIncrementally(cache::AccountStateCacheDelta& delta, model::ImportanceHeight importanceHeight) {
+			auto activeXem = delta.highValueBalance();
+
+			size_t numHighValueAccounts = 0;
+			delta.forEachHighValueAccount([activeXem, importanceHeight, &numHighValueAccounts](auto& accountState) {
+				SetImportance(accountState, activeXem, importanceHeight);
+				++numHighValueAccounts;
+			});
+
+			return numHighValueAccounts;
+		}
+
+		using RecalculateFunc = size_t (*)(cache::AccountStateCacheDelta&, model::ImportanceHeight);
+
+		class ImportanceBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "importance";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("importance accounts",
+						OptionsValue<uint32_t>(m_numAccounts)->default_value(1'000'000),
+						"the number of high value accounts in the account state cache");
+				optionsBuilder("importance changes",
+						OptionsValue<uint32_t>(m_numChanges)->default_value(1'000),
+						"the number of accounts with changed balances before each recalculation");
+				optionsBuilder("importance rounds",
+						OptionsValue<uint32_t>(m_numRounds)->default_value(5),
+						"the number of measured recalculations");
+			}
+
+			void run(const BenchmarkSettings&, thread::IoServiceThreadPool&) override {
+				auto addresses = GenerateAddresses(m_numAccounts);
+				CATAPULT_LOG(info) << "*** " << addresses.size() << " eligible accounts, " << m_numChanges << " changes per round ***";
+
+				runRecalculations("Importance Recalculation (Address Set)", RecalculateWithAddressSet, addresses);
+				runRecalculations("Importance Recalculation (Incremental)", RecalculateIncrementally, addresses);
+			}
+
+		private:
+			void runRecalculations(const char* testName, RecalculateFunc recalculate, const std::vector<Address>& addresses) const {
+				auto pCache = CreateCache();
+
+				// seed the cache with eligible accounts (unmeasured)
+				{
+					auto delta = pCache->createDelta();
+					for (const auto& address : addresses)
+						delta->addAccount(address, Height(1)).Balances.credit(Xem_Id, Min_High_Value_Balance + Amount(std::rand() % 1000));
+
+					pCache->commit();
+				}
+
+				uint64_t elapsedMillis = 0;
+				uint64_t commitMillis = 0;
+				size_t numHighValueAccounts = 0;
+				for (auto i = 1u; i <= m_numRounds; ++i) {
+					// change balances of random accounts, some of which will no longer be eligible (unmeasured)
+					auto delta = pCache->createDelta();
+					for (auto j = 0u; j < m_numChanges; ++j) {
+						auto& accountState = delta->get(addresses[static_cast<size_t>(std::rand()) % addresses.size()]);
+						if (0 == j % 2)
+							accountState.Balances.credit(Xem_Id, Amount(1000));
+						else
+							accountState.Balances.debit(Xem_Id, accountState.Balances.get(Xem_Id));
+					}
+
+					{
+						utils::StackLogger stopwatch(testName, utils::LogLevel::Trace);
+						numHighValueAccounts = recalculate(*delta, model::ImportanceHeight(i));
+						elapsedMillis += stopwatch.millis();
+					}
+
+					utils::StackLogger stopwatch("Commit", utils::LogLevel::Trace);
+					pCache->commit();
+					commitMillis += stopwatch.millis();
+				}
+
+				auto numRounds = std::max<uint32_t>(1, m_numRounds);
+				CATAPULT_LOG(info)
+						<< testName << ": average recalculation latency " << elapsedMillis / numRounds << "ms, "
+						<< "average commit latency " << commitMillis / numRounds << "ms "
+						<< "(" << numHighValueAccounts << " high value accounts)";
+				LogThroughput(static_cast<size_t>(m_numRounds) * numHighValueAccounts, elapsedMillis);
+			}
+
+		private:
+			uint32_t m_numAccounts;
+			uint32_t m_numChanges;
+			uint32_t m_numRounds;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateImportanceBenchmark() {
+		return std::make_unique<ImportanceBenchmark>();
+	}
+}}}
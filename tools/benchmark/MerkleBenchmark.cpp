@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "tools/ToolThreadUtils.h"
+#include "catapult/thread/ParallelMerkleHashing.h"
+#include <algorithm>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		template<typename TBuilderFactory>
+		Hash256 CalculateMerkleRoot(const std::vector<Hash256>& leaves, TBuilderFactory builderFactory) {
+			auto builder = builderFactory();
+			for (const auto& leaf : leaves)
+				builder.update(leaf);
+
+			Hash256 merkleRoot;
+			builder.final(merkleRoot);
+			return merkleRoot;
+		}
+
+		class MerkleBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "merkle";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("merkle max leaves",
+						OptionsValue<uint32_t>(m_maxNumLeaves)->default_value(100'000),
+						"the maximum number of leaves (trees with 1, 10, 100, ... leaves up to this number are built)");
+				optionsBuilder("merkle level threshold",
+						OptionsValue<uint32_t>(m_levelThreshold)->default_value(thread::Default_Parallel_Merkle_Level_Threshold),
+						"the minimum number of nodes in a tree level for the level to be hashed in parallel");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool&) override {
+				CATAPULT_LOG(info) << "max leaves (" << m_maxNumLeaves << "), level threshold (" << m_levelThreshold << ")";
+
+				// level hasher requires shared ownership of its pool
+				auto pPool = CreateStartedThreadPool(settings.NumThreads);
+				auto levelHasher = thread::CreateParallelMerkleLevelHasher(pPool, m_levelThreshold);
+
+				for (auto numLeaves = 1u; numLeaves <= m_maxNumLeaves; numLeaves *= 10) {
+					std::vector<Hash256> leaves(numLeaves);
+					for (auto& leaf : leaves)
+						std::generate(leaf.begin(), leaf.end(), []() { return static_cast<uint8_t>(std::rand()); });
+
+					// build enough trees to hash (at least) the requested number of operations
+					auto numTrees = std::max<size_t>(1, settings.numOperations() / numLeaves);
+					CATAPULT_LOG(info) << "building " << numTrees << " trees with " << numLeaves << " leaves";
+
+					Hash256 sequentialRoot;
+					RunSerial("Sequential", numTrees * numLeaves, [&leaves, numTrees, &sequentialRoot]() {
+						for (auto i = 0u; i < numTrees; ++i)
+							sequentialRoot = CalculateMerkleRoot(leaves, [&leaves]() { return crypto::MerkleHashBuilder(leaves.size()); });
+					});
+
+					Hash256 parallelRoot;
+					RunSerial("Parallel", numTrees * numLeaves, [&leaves, &levelHasher, numTrees, &parallelRoot]() {
+						for (auto i = 0u; i < numTrees; ++i) {
+							parallelRoot = CalculateMerkleRoot(leaves, [&leaves, &levelHasher]() {
+								return crypto::MerkleHashBuilder(leaves.size(), levelHasher);
+							});
+						}
+					});
+
+					if (sequentialRoot != parallelRoot)
+						CATAPULT_LOG(warning) << "parallel merkle root does not match sequential merkle root!";
+
+					if (numLeaves > m_maxNumLeaves / 10)
+						break;
+				}
+			}
+
+		private:
+			uint32_t m_maxNumLeaves;
+			uint32_t m_levelThreshold;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateMerkleBenchmark() {
+		return std::make_unique<MerkleBenchmark>();
+	}
+}}}
@@ -0,0 +1,163 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include <algorithm>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		constexpr uint32_t Default_Num_Changes[] = { 1'000, 10'000, 100'000 };
+
+		// number of leaves inserted into the tree by a single batch while seeding
+		constexpr size_t Seed_Batch_Size = 1'000'000;
+
+		class PassThroughEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const ValueType& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using Tree = tree::PatriciaTree<PassThroughEncoder, tree::MemoryDataSource>;
+		using KeyValuePairs = std::vector<std::pair<Hash256, Hash256>>;
+
+		Hash256 GenerateRandomHash() {
+			Hash256 hash;
+			std::generate(hash.begin(), hash.end(), []() { return static_cast<uint8_t>(std::rand()); });
+			return hash;
+		}
+
+		KeyValuePairs GenerateKeyValuePairs(size_t count) {
+			KeyValuePairs pairs;
+			pairs.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				pairs.emplace_back(GenerateRandomHash(), GenerateRandomHash());
+
+			return pairs;
+		}
+
+		class PatriciaTreeBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "tree";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("tree leaves",
+						OptionsValue<uint32_t>(m_numLeaves)->default_value(10'000'000),
+						"the number of leaves in the tree before any changes are applied");
+				optionsBuilder("tree changes",
+						OptionsValue<uint32_t>(m_numChanges)->default_value(0),
+						"the number of changes per update; 1k, 10k and 100k changes are run when zero");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool& pool) override {
+				tree::MemoryDataSource dataSource;
+				Tree tree(dataSource);
+
+				auto executor = [&pool, numPartitions = settings.NumPartitions](const auto& actions) {
+					thread::ParallelFor(pool.service(), actions, numPartitions, [](const auto& action, auto) {
+						action();
+						return true;
+					}).get();
+				};
+
+				// remember (some) existing keys so that changes can update existing leaves
+				std::vector<Hash256> existingKeys;
+				RunSerial("Seed", m_numLeaves, [numLeaves = m_numLeaves, &tree, &executor, &existingKeys]() {
+					for (auto i = 0u; i < numLeaves; i += Seed_Batch_Size) {
+						auto pairs = GenerateKeyValuePairs(std::min<size_t>(Seed_Batch_Size, numLeaves - i));
+						if (existingKeys.empty()) {
+							for (const auto& pair : pairs)
+								existingKeys.push_back(pair.first);
+						}
+
+						tree.batchSet(pairs);
+						tree.commit(executor);
+					}
+				});
+
+				if (0 != m_numChanges) {
+					runChanges(tree, executor, existingKeys, m_numChanges);
+					return;
+				}
+
+				for (auto numChanges : Default_Num_Changes)
+					runChanges(tree, executor, existingKeys, numChanges);
+			}
+
+		private:
+			void runChanges(
+					Tree& tree,
+					const Tree::ParallelExecutor& executor,
+					const std::vector<Hash256>& existingKeys,
+					uint32_t numChanges) const {
+				CATAPULT_LOG(info) << "*** " << numChanges << " changes to tree with " << m_numLeaves << " leaves ***";
+
+				// update existing leaves (half) and insert new leaves (half)
+				auto pairs = GenerateKeyValuePairs(numChanges);
+				for (auto i = 0u; i < numChanges / 2 && i < existingKeys.size(); ++i)
+					pairs[i].first = existingKeys[static_cast<size_t>(std::rand()) % existingKeys.size()];
+
+				RunSerial("Per-Key Update", numChanges, [&tree, &pairs]() {
+					for (const auto& pair : pairs)
+						tree.set(pair.first, pair.second);
+				});
+
+				auto perKeyRoot = tree.root();
+				auto updatedPairs = pairs;
+				for (auto& pair : updatedPairs)
+					pair.second = GenerateRandomHash();
+
+				RunSerial("Batch Update (sequential hashing)", numChanges, [&tree, &updatedPairs]() {
+					tree.batchSet(updatedPairs);
+					tree.commit();
+				});
+
+				RunSerial("Batch Update (parallel hashing)", numChanges, [&tree, &pairs, &executor]() {
+					tree.batchSet(pairs);
+					tree.commit(executor);
+				});
+
+				if (perKeyRoot != tree.root())
+					CATAPULT_LOG(warning) << "batch update root does not match per-key update root!";
+			}
+
+		private:
+			uint32_t m_numLeaves;
+			uint32_t m_numChanges;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreatePatriciaTreeBenchmark() {
+		return std::make_unique<PatriciaTreeBenchmark>();
+	}
+}}}
@@ -0,0 +1,113 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "tools/ToolKeys.h"
+#include "catapult/crypto/Signer.h"
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		struct BenchmarkEntry {
+			std::vector<uint8_t> Data;
+			catapult::Signature Signature;
+			bool IsVerified = false;
+		};
+
+		struct BatchBenchmarkEntry {
+			std::vector<crypto::SignatureInput> Inputs;
+			std::vector<bool> Results;
+		};
+
+		std::vector<BatchBenchmarkEntry> CreateBatches(const Key& publicKey, const std::vector<BenchmarkEntry>& entries, size_t batchSize) {
+			std::vector<BatchBenchmarkEntry> batches;
+			for (auto i = 0u; i < entries.size(); ++i) {
+				if (0 == i % batchSize)
+					batches.emplace_back();
+
+				batches.back().Inputs.push_back({ publicKey, entries[i].Data, entries[i].Signature });
+			}
+
+			return batches;
+		}
+
+		class SignatureBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "signature";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("data size,s",
+						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
+						"the size of the data to generate");
+				optionsBuilder("signature batch size",
+						OptionsValue<uint32_t>(m_batchSize)->default_value(64),
+						"the number of signatures verified together by batch verification (0 to disable)");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool& pool) override {
+				CATAPULT_LOG(info) << "data size (" << m_dataSize << "), batch size (" << m_batchSize << ")";
+
+				auto keyPair = GenerateRandomKeyPair();
+				auto entries = std::vector<BenchmarkEntry>(settings.numOperations());
+				auto numPartitions = settings.NumPartitions;
+
+				RunParallel("Data Generation", pool, numPartitions, entries, [dataSize = m_dataSize](auto& entry) {
+					entry.Data.resize(dataSize);
+					std::generate_n(entry.Data.begin(), entry.Data.size(), []() { return static_cast<uint8_t>(std::rand()); });
+				});
+
+				RunParallel("Signature", pool, numPartitions, entries, [&keyPair](auto& entry) {
+					crypto::Sign(keyPair, entry.Data, entry.Signature);
+				});
+
+				RunParallel("Verify", pool, numPartitions, entries, [&keyPair](auto& entry) {
+					entry.IsVerified = crypto::Verify(keyPair.publicKey(), entry.Data, entry.Signature);
+					if (!entry.IsVerified)
+						CATAPULT_LOG(warning) << "could not verify data!";
+				});
+
+				if (0 == m_batchSize)
+					return;
+
+				auto batches = CreateBatches(keyPair.publicKey(), entries, m_batchSize);
+				utils::StackLogger stopwatch("Verify Batch", utils::LogLevel::Info);
+				thread::ParallelFor(pool.service(), batches, numPartitions, [](auto& batch, auto) {
+					batch.Results = crypto::VerifyBatch(batch.Inputs);
+					if (std::any_of(batch.Results.cbegin(), batch.Results.cend(), [](auto isVerified) { return !isVerified; }))
+						CATAPULT_LOG(warning) << "could not verify batch data!";
+
+					return true;
+				}).get();
+
+				LogThroughput(entries.size(), stopwatch.millis());
+			}
+
+		private:
+			uint32_t m_dataSize;
+			uint32_t m_batchSize;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateSignatureBenchmark() {
+		return std::make_unique<SignatureBenchmark>();
+	}
+}}}
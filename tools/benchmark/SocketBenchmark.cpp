@@ -0,0 +1,191 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/ionet/Node.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/ionet/PacketSocket.h"
+#include "catapult/model/Transaction.h"
+#include "catapult/net/ConnectionSettings.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <boost/asio.hpp>
+#include <future>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		ionet::PacketPayload CreatePayload(uint32_t numEntities, uint32_t entitySize) {
+			ionet::PacketPayloadBuilder builder(ionet::PacketType::Push_Transactions);
+			for (auto i = 0u; i < numEntities; ++i) {
+				auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(entitySize);
+				std::memset(static_cast<void*>(pTransaction.get()), 0, entitySize);
+				pTransaction->Size = entitySize;
+				builder.appendEntity(pTransaction);
+			}
+
+			return builder.build();
+		}
+
+		std::pair<std::shared_ptr<ionet::PacketSocket>, std::shared_ptr<ionet::PacketSocket>> ConnectSockets(
+				boost::asio::ip::tcp::acceptor& acceptor,
+				const ionet::PacketSocketOptions& options,
+				unsigned short port) {
+			std::promise<std::shared_ptr<ionet::PacketSocket>> serverPromise;
+			std::promise<std::shared_ptr<ionet::PacketSocket>> clientPromise;
+			ionet::Accept(acceptor, options, [&serverPromise](const auto& socketInfo) {
+				serverPromise.set_value(socketInfo.socket());
+			});
+
+			auto endpoint = ionet::NodeEndpoint{ "127.0.0.1", port };
+			ionet::Connect(acceptor.get_io_service(), options, endpoint, [&clientPromise](auto result, const auto& pSocket) {
+				clientPromise.set_value(ionet::ConnectResult::Connected == result ? pSocket : nullptr);
+			});
+
+			auto pServerSocket = serverPromise.get_future().get();
+			auto pClientSocket = clientPromise.get_future().get();
+			return std::make_pair(pServerSocket, pClientSocket);
+		}
+
+		class SocketBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "socket";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("socket entities",
+						OptionsValue<uint32_t>(m_numEntities)->default_value(200),
+						"the number of entities in each packet");
+				optionsBuilder("socket entity size",
+						OptionsValue<uint32_t>(m_entitySize)->default_value(250),
+						"the size of each entity");
+				optionsBuilder("socket max write buffers",
+						OptionsValue<uint32_t>(m_maxWriteBufferCount)->default_value(64),
+						"the maximum number of buffers submitted by a single gather write");
+				optionsBuilder("socket port",
+						OptionsValue<unsigned short>(m_port)->default_value(7950),
+						"the local port used by the benchmark");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool& pool) override {
+				CATAPULT_LOG(info)
+						<< "entities (" << m_numEntities << "), entity size (" << m_entitySize
+						<< "), max write buffers (" << m_maxWriteBufferCount << ")";
+
+				auto payload = CreatePayload(m_numEntities, m_entitySize);
+				if (payload.buffers().empty()) {
+					CATAPULT_LOG(error) << "could not create payload with requested entities";
+					return;
+				}
+
+				// compare writing one buffer at a time with gather writes
+				runWrites("Single Buffer Writes", payload, 1, settings.numOperations(), pool);
+				runWrites("Gather Writes", payload, m_maxWriteBufferCount, settings.numOperations(), pool);
+			}
+
+		private:
+			void runWrites(
+					const char* testName,
+					const ionet::PacketPayload& payload,
+					size_t maxWriteBufferCount,
+					size_t numPackets,
+					thread::IoServiceThreadPool& pool) const {
+				// the header is submitted together with the payload buffers
+				// (this is the configured lower bound, not a measurement, because asio writes with sendmsg, which is not
+				//  counted by /proc/self/io, and partial writes require additional calls)
+				auto numBuffers = 1 + payload.buffers().size();
+				auto minWritesPerPacket = (numBuffers + maxWriteBufferCount - 1) / maxWriteBufferCount;
+				CATAPULT_LOG(info) << "*** " << testName << " (at least " << minWritesPerPacket << " write calls / packet) ***";
+
+				auto options = net::ConnectionSettings().toSocketOptions();
+				options.MaxWriteBufferCount = maxWriteBufferCount;
+
+				boost::asio::ip::tcp::acceptor acceptor(pool.service());
+				auto endpoint = boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), m_port);
+				acceptor.open(endpoint.protocol());
+				acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+				acceptor.bind(endpoint);
+				acceptor.listen();
+
+				auto sockets = ConnectSockets(acceptor, options, m_port);
+				if (!sockets.first || !sockets.second) {
+					CATAPULT_LOG(error) << "could not connect sockets";
+					return;
+				}
+
+				// the server writes packets back to back and the client reads them
+				std::promise<bool> writePromise;
+				std::promise<void> readPromise;
+				std::function<void (size_t)> writeNext;
+				writeNext = [&writeNext, &writePromise, &payload, numPackets, &serverSocket = *sockets.first](auto index) {
+					serverSocket.write(payload, [&writeNext, &writePromise, numPackets, index](auto code) {
+						if (ionet::SocketOperationCode::Success != code)
+							writePromise.set_value(false);
+						else if (numPackets == index + 1)
+							writePromise.set_value(true);
+						else
+							writeNext(index + 1);
+					});
+				};
+
+				std::function<void (size_t)> readNext;
+				readNext = [&readNext, &readPromise, numPackets, &clientSocket = *sockets.second](auto index) {
+					clientSocket.read([&readNext, &readPromise, numPackets, index](auto code, const auto*) {
+						if (ionet::SocketOperationCode::Success != code || numPackets == index + 1)
+							readPromise.set_value();
+						else
+							readNext(index + 1);
+					});
+				};
+
+				utils::StackLogger stopwatch(testName, utils::LogLevel::Info);
+				readNext(0);
+				writeNext(0);
+				if (!writePromise.get_future().get()) {
+					// unblock the pending read
+					sockets.second->close();
+				}
+
+				readPromise.get_future().get();
+
+				auto elapsedMillis = stopwatch.millis();
+				LogThroughput(numPackets, elapsedMillis);
+
+				auto bytesPerSecond = numPackets * payload.header().Size * 1000u / std::max<uint64_t>(1, elapsedMillis);
+				CATAPULT_LOG(info) << utils::FileSize::FromBytes(bytesPerSecond) << "/s";
+
+				sockets.first->close();
+				sockets.second->close();
+				acceptor.close();
+			}
+
+		private:
+			uint32_t m_numEntities;
+			uint32_t m_entitySize;
+			uint32_t m_maxWriteBufferCount;
+			unsigned short m_port;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateSocketBenchmark() {
+		return std::make_unique<SocketBenchmark>();
+	}
+}}}
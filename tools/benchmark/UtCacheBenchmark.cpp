@@ -0,0 +1,140 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		constexpr uint32_t Default_Num_Transactions[] = { 100'000, 1'000'000 };
+
+		model::TransactionInfo GenerateRandomTransactionInfo() {
+			// vary sizes and fees so that fee densities differ
+			auto size = static_cast<uint32_t>(sizeof(model::Transaction) + static_cast<size_t>(std::rand()) % 256);
+			auto pTransaction = utils::MakeUniqueWithSize<model::Transaction>(size);
+			std::memset(static_cast<void*>(pTransaction.get()), 0, size);
+			pTransaction->Size = size;
+			pTransaction->Fee = Amount(static_cast<uint64_t>(std::rand()) % 100'000);
+			std::generate(pTransaction->Signer.begin(), pTransaction->Signer.end(), []() { return static_cast<uint8_t>(std::rand()); });
+
+			auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+			std::generate(transactionInfo.EntityHash.begin(), transactionInfo.EntityHash.end(), []() {
+				return static_cast<uint8_t>(std::rand());
+			});
+			return transactionInfo;
+		}
+
+		std::vector<model::TransactionInfo> GenerateRandomTransactionInfos(size_t count) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(GenerateRandomTransactionInfo());
+
+			return transactionInfos;
+		}
+
+		class UtCacheBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "utcache";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("utcache transactions",
+						OptionsValue<uint32_t>(m_numTransactions)->default_value(0),
+						"the number of pending transactions; 100k and 1M transactions are run when zero");
+				optionsBuilder("utcache select",
+						OptionsValue<uint32_t>(m_numSelected)->default_value(10'000),
+						"the number of transactions selected by priority per selection");
+				optionsBuilder("utcache selections",
+						OptionsValue<uint32_t>(m_numSelections)->default_value(100),
+						"the number of measured selections");
+			}
+
+			void run(const BenchmarkSettings&, thread::IoServiceThreadPool&) override {
+				if (0 != m_numTransactions) {
+					runTransactions(m_numTransactions);
+					return;
+				}
+
+				for (auto numTransactions : Default_Num_Transactions)
+					runTransactions(numTransactions);
+			}
+
+		private:
+			void runTransactions(uint32_t numTransactions) const {
+				CATAPULT_LOG(info) << "*** " << numTransactions << " pending transactions ***";
+
+				// generate all transactions upfront so that only cache operations are measured
+				auto transactionInfos = GenerateRandomTransactionInfos(numTransactions);
+				auto evictingTransactionInfos = GenerateRandomTransactionInfos(numTransactions);
+				cache::MemoryUtCache cache(cache::MemoryCacheOptions(1024, numTransactions));
+
+				RunSerial("Add", numTransactions, [&cache, &transactionInfos]() {
+					auto modifier = cache.modifier();
+					for (const auto& transactionInfo : transactionInfos)
+						modifier.add(transactionInfo);
+				});
+
+				auto numSelected = std::min(m_numSelected, numTransactions);
+				RunSerial("Select By Priority", static_cast<size_t>(m_numSelections) * numSelected, [this, &cache, numSelected]() {
+					for (auto i = 0u; i < m_numSelections; ++i) {
+						auto numVisited = 0u;
+						cache.view().forEachByPriority([numSelected, &numVisited](const auto&) {
+							return numSelected != ++numVisited;
+						});
+					}
+				});
+
+				// the cache is full, so each add either evicts the lowest priority transaction or is rejected
+				RunSerial("Add (Full Cache)", numTransactions, [&cache, &evictingTransactionInfos]() {
+					auto modifier = cache.modifier();
+					for (const auto& transactionInfo : evictingTransactionInfos)
+						modifier.add(transactionInfo);
+
+					CATAPULT_LOG(info) << "evicted " << modifier.takeEvicted().size() << " transactions";
+				});
+
+				RunSerial("Remove", 2 * static_cast<size_t>(numTransactions), [&cache, &transactionInfos, &evictingTransactionInfos]() {
+					auto modifier = cache.modifier();
+					for (const auto& transactionInfo : transactionInfos)
+						modifier.remove(transactionInfo.EntityHash);
+
+					for (const auto& transactionInfo : evictingTransactionInfos)
+						modifier.remove(transactionInfo.EntityHash);
+				});
+			}
+
+		private:
+			uint32_t m_numTransactions;
+			uint32_t m_numSelected;
+			uint32_t m_numSelections;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateUtCacheBenchmark() {
+		return std::make_unique<UtCacheBenchmark>();
+	}
+}}}
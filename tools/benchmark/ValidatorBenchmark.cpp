@@ -0,0 +1,195 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Benchmark.h"
+#include "tools/ToolConfigurationUtils.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/plugins/PluginLoader.h"
+#include "catapult/plugins/PluginManager.h"
+#include "catapult/validators/ValidatorContext.h"
+#include "catapult/constants.h"
+#include <algorithm>
+#include <atomic>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		constexpr size_t Num_Notification_Types = 5;
+
+		template<typename TArray>
+		TArray GenerateRandomArray() {
+			TArray array;
+			std::generate(array.begin(), array.end(), []() { return static_cast<uint8_t>(std::rand()); });
+			return array;
+		}
+
+		// notifications reference their data, so all data needs to be generated before any notification is created
+		class NotificationsHolder {
+		public:
+			explicit NotificationsHolder(size_t count, model::NetworkIdentifier networkIdentifier) {
+				m_keys.reserve(count);
+				m_addresses.reserve(count);
+				m_hashes.reserve(count);
+				for (auto i = 0u; i < count; ++i) {
+					m_keys.push_back(GenerateRandomArray<Key>());
+					m_addresses.push_back(GenerateRandomArray<Address>());
+					m_hashes.push_back(GenerateRandomArray<Hash256>());
+				}
+
+				// mix the core notification types that are raised by every transaction
+				m_notifications.reserve(count);
+				for (auto i = 0u; i < count; ++i) {
+					switch (i % Num_Notification_Types) {
+					case 0:
+						m_notifications.push_back(std::make_shared<model::EntityNotification>(networkIdentifier));
+						break;
+					case 1:
+						m_notifications.push_back(std::make_shared<model::TransactionNotification>(
+								m_keys[i],
+								m_hashes[i],
+								static_cast<model::EntityType>(0x4154),
+								Timestamp(static_cast<uint64_t>(std::rand()))));
+						break;
+					case 2:
+						m_notifications.push_back(std::make_shared<model::AccountAddressNotification>(m_addresses[i]));
+						break;
+					case 3:
+						m_notifications.push_back(std::make_shared<model::BalanceTransferNotification>(
+								m_keys[i],
+								m_addresses[i],
+								Xem_Id,
+								Amount(static_cast<uint64_t>(std::rand()))));
+						break;
+					default:
+						m_notifications.push_back(std::make_shared<model::BalanceReserveNotification>(
+								m_keys[i],
+								Xem_Id,
+								Amount(static_cast<uint64_t>(std::rand()))));
+						break;
+					}
+				}
+			}
+
+		public:
+			std::vector<std::shared_ptr<const model::Notification>>& notifications() {
+				return m_notifications;
+			}
+
+		private:
+			std::vector<Key> m_keys;
+			std::vector<Address> m_addresses;
+			std::vector<Hash256> m_hashes;
+			std::vector<std::shared_ptr<const model::Notification>> m_notifications;
+		};
+
+		void LogNumFailures(size_t numFailures, size_t numNotifications) {
+			CATAPULT_LOG(info) << numFailures << " of " << numNotifications << " notifications failed validation";
+		}
+
+		class ValidatorBenchmark : public Benchmark {
+		public:
+			std::string name() const override {
+				return "validator";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder) override {
+				optionsBuilder("validator resources",
+						OptionsValue<std::string>(m_resourcesPath)->default_value(".."),
+						"the path to the resources directory containing the plugins to load");
+			}
+
+			void run(const BenchmarkSettings& settings, thread::IoServiceThreadPool& pool) override {
+				auto config = LoadConfiguration(m_resourcesPath);
+
+				// modules need to outlive the plugin manager and all validators created by it
+				plugins::PluginModules modules;
+				plugins::PluginManager pluginManager(config.BlockChain, plugins::StorageConfiguration());
+				for (const auto& pluginName : { "catapult.coresystem", "catapult.plugins.signature" })
+					LoadPluginByName(pluginManager, modules, config.User.PluginsDirectory, pluginName);
+
+				for (const auto& pair : config.BlockChain.Plugins)
+					LoadPluginByName(pluginManager, modules, config.User.PluginsDirectory, pair.first);
+
+				NotificationsHolder holder(settings.numOperations(), config.BlockChain.Network.Identifier);
+				auto& notifications = holder.notifications();
+				runStateless(pluginManager, notifications, settings, pool);
+				runStateful(pluginManager, config.BlockChain.Network, notifications);
+			}
+
+		private:
+			void runStateless(
+					const plugins::PluginManager& pluginManager,
+					std::vector<std::shared_ptr<const model::Notification>>& notifications,
+					const BenchmarkSettings& settings,
+					thread::IoServiceThreadPool& pool) const {
+				auto pValidator = pluginManager.createStatelessValidator();
+				CATAPULT_LOG(info) << "*** " << pValidator->names().size() << " stateless validators ***";
+
+				size_t numFailures = 0;
+				RunSerial("Stateless Validation", notifications.size(), [&validator = *pValidator, &notifications, &numFailures]() {
+					for (const auto& pNotification : notifications) {
+						if (validators::IsValidationResultFailure(validator.validate(*pNotification)))
+							++numFailures;
+					}
+				});
+				LogNumFailures(numFailures, notifications.size());
+
+				std::atomic<size_t> numParallelFailures(0);
+				auto validateNotification = [&validator = *pValidator, &numParallelFailures](const auto& pNotification) {
+					if (validators::IsValidationResultFailure(validator.validate(*pNotification)))
+						++numParallelFailures;
+				};
+				RunParallel("Stateless Validation (Parallel)", pool, settings.NumPartitions, notifications, validateNotification);
+				LogNumFailures(numParallelFailures, notifications.size());
+			}
+
+			void runStateful(
+					plugins::PluginManager& pluginManager,
+					const model::NetworkInfo& network,
+					const std::vector<std::shared_ptr<const model::Notification>>& notifications) const {
+				auto pValidator = pluginManager.createStatefulValidator();
+				CATAPULT_LOG(info) << "*** " << pValidator->names().size() << " stateful validators ***";
+
+				// validate against an empty cache, so account dependent validators fail early for most notifications
+				auto cache = pluginManager.createCache();
+				auto cacheView = cache.createView();
+				auto readOnlyCache = cacheView.toReadOnly();
+				auto context = validators::ValidatorContext(Height(1), Timestamp(), network, readOnlyCache);
+
+				size_t numFailures = 0;
+				RunSerial("Stateful Validation", notifications.size(), [&validator = *pValidator, &notifications, &context, &numFailures]() {
+					for (const auto& pNotification : notifications) {
+						if (validators::IsValidationResultFailure(validator.validate(*pNotification, context)))
+							++numFailures;
+					}
+				});
+				LogNumFailures(numFailures, notifications.size());
+			}
+
+		private:
+			std::string m_resourcesPath;
+		};
+	}
+
+	std::unique_ptr<Benchmark> CreateValidatorBenchmark() {
+		return std::make_unique<ValidatorBenchmark>();
+	}
+}}}
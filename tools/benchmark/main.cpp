@@ -18,105 +18,92 @@
 *** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
 **/
 
+#include "Benchmark.h"
 #include "tools/ToolMain.h"
-#include "tools/ToolKeys.h"
 #include "tools/ToolThreadUtils.h"
-#include "catapult/crypto/Signer.h"
-#include "catapult/thread/IoServiceThreadPool.h"
-#include "catapult/thread/ParallelFor.h"
-#include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace tools { namespace benchmark {
 
 	namespace {
-		struct BenchmarkEntry {
-			std::vector<uint8_t> Data;
-			catapult::Signature Signature;
-			bool IsVerified = false;
-		};
-
 		class BenchmarkTool : public Tool {
+		public:
+			BenchmarkTool() {
+				m_benchmarks.push_back(CreateSignatureBenchmark());
+				m_benchmarks.push_back(CreateHashBenchmark());
+				m_benchmarks.push_back(CreateMerkleBenchmark());
+				m_benchmarks.push_back(CreatePatriciaTreeBenchmark());
+				m_benchmarks.push_back(CreateDispatcherBenchmark());
+				m_benchmarks.push_back(CreateCacheDatabaseBenchmark());
+				m_benchmarks.push_back(CreateCacheRootsBenchmark());
+				m_benchmarks.push_back(CreateBlockStorageBenchmark());
+				m_benchmarks.push_back(CreateUtCacheBenchmark());
+				m_benchmarks.push_back(CreateSocketBenchmark());
+				m_benchmarks.push_back(CreateValidatorBenchmark());
+				m_benchmarks.push_back(CreateImportanceBenchmark());
+			}
+
 		public:
 			std::string name() const override {
 				return "Benchmark Tool";
 			}
 
 			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				auto modeDescription = "the benchmark to run (" + benchmarkNames() + ")";
+				optionsBuilder("mode,m",
+						OptionsValue<std::string>(m_mode)->default_value(m_benchmarks.front()->name()),
+						modeDescription.c_str());
 				optionsBuilder("num threads,t",
-						OptionsValue<uint32_t>(m_numThreads)->default_value(0),
+						OptionsValue<uint32_t>(m_settings.NumThreads)->default_value(0),
 						"the number of threads");
 				optionsBuilder("num partitions,p",
-						OptionsValue<uint32_t>(m_numPartitions)->default_value(0),
+						OptionsValue<uint32_t>(m_settings.NumPartitions)->default_value(0),
 						"the number of partitions");
 				optionsBuilder("ops / partition,o",
-						OptionsValue<uint32_t>(m_opsPerPartition)->default_value(1000),
+						OptionsValue<uint32_t>(m_settings.OpsPerPartition)->default_value(1000),
 						"the number of operations per partition");
-				optionsBuilder("data size,s",
-						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
-						"the size of the data to generate");
+
+				for (const auto& pBenchmark : m_benchmarks)
+					pBenchmark->prepareOptions(optionsBuilder);
 			}
 
 			int run(const Options&) override {
-				m_numThreads = 0 != m_numThreads ? m_numThreads : std::thread::hardware_concurrency();
-				m_numPartitions = 0 != m_numPartitions ? m_numPartitions : m_numThreads;
-
-				CATAPULT_LOG(info)
-						<< "num threads (" << m_numThreads
-						<< "), num partitions (" << m_numPartitions
-						<< "), ops / partition (" << m_opsPerPartition
-						<< "), data size (" << m_dataSize << ")";
-
-				auto keyPair = GenerateRandomKeyPair();
-				auto entries = std::vector<BenchmarkEntry>(m_numPartitions * m_opsPerPartition);
-				auto pPool = CreateStartedThreadPool(m_numThreads);
-
-				CATAPULT_LOG(info) << "num operations (" << entries.size() << ")";
-
-				RunParallel("Data Generation", *pPool, entries, [dataSize = m_dataSize](auto& entry) {
-					entry.Data.resize(dataSize);
-					std::generate_n(entry.Data.begin(), entry.Data.size(), []() { return static_cast<uint8_t>(std::rand()); });
+				auto iter = std::find_if(m_benchmarks.cbegin(), m_benchmarks.cend(), [&mode = m_mode](const auto& pBenchmark) {
+					return mode == pBenchmark->name();
 				});
 
-				RunParallel("Signature", *pPool, entries, [&keyPair](auto& entry) {
-					crypto::Sign(keyPair, entry.Data, entry.Signature);
-				});
+				if (m_benchmarks.cend() == iter) {
+					CATAPULT_LOG(error) << "unknown benchmark mode '" << m_mode << "', expected one of " << benchmarkNames();
+					return -1;
+				}
 
-				RunParallel("Verify", *pPool, entries, [&keyPair](auto& entry) {
-					entry.IsVerified = crypto::Verify(keyPair.publicKey(), entry.Data, entry.Signature);
-					if (!entry.IsVerified)
-						CATAPULT_LOG(warning) << "could not verify data!";
-				});
+				m_settings.NumThreads = 0 != m_settings.NumThreads ? m_settings.NumThreads : std::thread::hardware_concurrency();
+				m_settings.NumPartitions = 0 != m_settings.NumPartitions ? m_settings.NumPartitions : m_settings.NumThreads;
 
+				CATAPULT_LOG(info)
+						<< "mode (" << m_mode
+						<< "), num threads (" << m_settings.NumThreads
+						<< "), num partitions (" << m_settings.NumPartitions
+						<< "), ops / partition (" << m_settings.OpsPerPartition << ")";
+				CATAPULT_LOG(info) << "num operations (" << m_settings.numOperations() << ")";
+
+				auto pPool = CreateStartedThreadPool(m_settings.NumThreads);
+				(*iter)->run(m_settings, *pPool);
 				return 0;
 			}
 
 		private:
-			template<typename TAction>
-			uint64_t RunParallel(
-					const char* testName,
-					thread::IoServiceThreadPool& pool,
-					std::vector<BenchmarkEntry>& entries,
-					TAction action) const {
-				utils::StackLogger stopwatch(testName, utils::LogLevel::Info);
-				thread::ParallelFor(pool.service(), entries, m_numPartitions, [action](auto& entry, auto) {
-					action(entry);
-					return true;
-				}).get();
+			std::string benchmarkNames() const {
+				std::string names;
+				for (const auto& pBenchmark : m_benchmarks)
+					names += (names.empty() ? "" : ", ") + pBenchmark->name();
 
-				auto elapsedMillis = stopwatch.millis();
-				auto elapsedMicrosPerOp = elapsedMillis * 1000u / entries.size();
-				auto opsPerSecond = 0 == elapsedMillis ? 0 : entries.size() * 1000u / elapsedMillis;
-				CATAPULT_LOG(info)
-						<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
-						<< "(elapsed time " << elapsedMillis << "ms, " << elapsedMicrosPerOp << "us/op)";
-				return elapsedMillis;
+				return names;
 			}
 
 		private:
-			uint32_t m_numThreads;
-			uint32_t m_numPartitions;
-			uint32_t m_opsPerPartition;
-			uint32_t m_dataSize;
+			std::vector<std::unique_ptr<Benchmark>> m_benchmarks;
+			std::string m_mode;
+			BenchmarkSettings m_settings;
 		};
 	}
 }}}
@@ -0,0 +1,73 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/io/PackedFileStorage.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/StackLogger.h"
+#include "catapult/exceptions.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace tools { namespace storageconverter {
+
+	namespace {
+		class StorageConverterTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Storage Converter Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("source,s",
+						OptionsValue<std::string>(m_sourceDirectory)->required(),
+						"directory containing blocks stored in individual block files");
+				optionsBuilder("destination,d",
+						OptionsValue<std::string>(m_destinationDirectory)->required(),
+						"directory that will contain blocks stored in packed segment files");
+			}
+
+			int run(const Options&) override {
+				if (!boost::filesystem::is_directory(m_sourceDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("source directory does not exist", m_sourceDirectory);
+
+				if (io::ContainsPackedFileStorage(m_destinationDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("destination storage is not empty", m_destinationDirectory);
+
+				boost::filesystem::create_directories(m_destinationDirectory);
+
+				// a new packed storage imports all blocks from the (seed) file based storage
+				utils::StackLogger stopwatch("converting blocks", utils::LogLevel::Info);
+				io::PackedFileStorage destinationStorage(m_destinationDirectory, m_sourceDirectory);
+
+				CATAPULT_LOG(info) << "packed storage in " << m_destinationDirectory << " has height " << destinationStorage.chainHeight();
+				return 0;
+			}
+
+		private:
+			std::string m_sourceDirectory;
+			std::string m_destinationDirectory;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::storageconverter::StorageConverterTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}